@@ -26,420 +26,1385 @@
 #define CC_QUICK_COMPILE
 #include "BigInt.h"
 #include "BigIntFast.h"
-#include "List.h"
+#include "MemoryAllocation.h"
+#include <string.h>
 
+#ifndef CC_BIG_INT_UINT128
+#if defined(__SIZEOF_INT128__)
+#define CC_BIG_INT_UINT128 1
+#else
+#define CC_BIG_INT_UINT128 0
+#endif
+#endif
 
-static void CCBigIntDestructor(CCBigInt Ptr)
-{
-    CCListDestroy(Ptr->value);
-}
+#pragma mark - Component Arithmetic
 
-CCBigInt CCBigIntCreate(CCAllocatorType Allocator)
+/*
+ Components are stored least significant first. The functions in this section operate on raw
+ component arrays and don't require them to be normalized (leading zero components are allowed).
+ Unless stated otherwise the result may alias the inputs.
+ */
+
+static CC_FORCE_INLINE uint64_t CCBigIntMulWide(uint64_t a, uint64_t b, uint64_t *High)
 {
-    CCBigInt Integer = CCMalloc(Allocator, sizeof(CCBigIntInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
-    if (Integer)
-    {
-        *Integer = (CCBigIntInfo){
-            .sign = FALSE,
-            .value = CCListCreate(Allocator, sizeof(uint64_t), 4, 16)
-        };
-        
-        CCListAppendElement(Integer->value, &(uint64_t){ 0 });
-        
-        CCMemorySetDestructor(Integer, (CCMemoryDestructorCallback)CCBigIntDestructor);
-    }
+#if CC_BIG_INT_UINT128
+    const unsigned __int128 Product = (unsigned __int128)a * b;
+    *High = (uint64_t)(Product >> 64);
     
+    return (uint64_t)Product;
+#else
+    const uint64_t a0 = a & UINT32_MAX, a1 = a >> 32, b0 = b & UINT32_MAX, b1 = b >> 32;
+    const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    const uint64_t Middle = (p00 >> 32) + (p01 & UINT32_MAX) + (p10 & UINT32_MAX);
+    *High = p11 + (p01 >> 32) + (p10 >> 32) + (Middle >> 32);
     
-    return Integer;
-}
-
-void CCBigIntDestroy(CCBigInt Integer)
-{
-    CCAssertLog(Integer, "Integer must not be null");
-    CCFree(Integer);
+    return (Middle << 32) | (p00 & UINT32_MAX);
+#endif
 }
 
-void CCBigIntSetBigInt(CCBigInt Integer, CCBigInt Value)
+#if !CC_BIG_INT_UINT128
+static uint64_t CCBigIntDivWidePortable(uint64_t High, uint64_t Low, uint64_t Divisor, uint64_t *Remainder)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    CCAssertLog(Value, "Value must not be null");
+    //Divisor must be normalized and High < Divisor
+    const uint64_t Base = (uint64_t)1 << 32;
+    const uint64_t DivisorHigh = Divisor >> 32, DivisorLow = Divisor & UINT32_MAX;
+    const uint64_t LowHigh = Low >> 32, LowLow = Low & UINT32_MAX;
     
-    Integer->sign = Value->sign;
-
-    CCListRemoveAllElements(Integer->value);
+    uint64_t Quotient1 = High / DivisorHigh, Estimate = High - (Quotient1 * DivisorHigh);
+    while ((Quotient1 >= Base) || ((Quotient1 * DivisorLow) > ((Estimate << 32) | LowHigh)))
+    {
+        Quotient1--;
+        Estimate += DivisorHigh;
+        if (Estimate >= Base) break;
+    }
     
-    for (CCLinkedListNode *Node = Value->value->list; Node; Node = CCLinkedListEnumerateNext(Node))
+    const uint64_t Partial = (High << 32) + LowHigh - (Quotient1 * Divisor);
+    
+    uint64_t Quotient0 = Partial / DivisorHigh;
+    Estimate = Partial - (Quotient0 * DivisorHigh);
+    while ((Quotient0 >= Base) || ((Quotient0 * DivisorLow) > ((Estimate << 32) | LowLow)))
     {
-        CCArray Array = *(CCArray*)CCLinkedListGetNodeData(Node);
-        CCListAppendElements(Integer->value, CCArrayGetElementAtIndex(Array, 0), CCArrayGetCount(Array));
+        Quotient0--;
+        Estimate += DivisorHigh;
+        if (Estimate >= Base) break;
     }
+    
+    *Remainder = (Partial << 32) + LowLow - (Quotient0 * Divisor);
+    
+    return (Quotient1 << 32) | Quotient0;
 }
+#endif
 
-void CCBigIntSetBigIntFast(CCBigInt Integer, CCBigIntFast Value)
+/*!
+ * @brief Get the reciprocal of a normalized divisor.
+ * @description Computes floor((B^2 - 1) / Divisor) - B, where B is 2^64, for use with
+ *              @b CCBigIntDivWide (Möller and Granlund, "Improved division by invariant integers").
+ *
+ * @param Divisor The divisor. Must have the most significant bit set.
+ * @return The reciprocal.
+ */
+static uint64_t CCBigIntReciprocal(uint64_t Divisor)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    CCAssertLog(Value, "Value must not be null");
-    
-    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntSet(Integer, CCBigIntFastGetTaggedValue(Value));
-    else CCBigIntSet(Integer, (CCBigInt)Value);
+#if CC_BIG_INT_UINT128
+    return (uint64_t)((((unsigned __int128)~Divisor << 64) | UINT64_MAX) / Divisor);
+#else
+    uint64_t Remainder;
+    return CCBigIntDivWidePortable(~Divisor, UINT64_MAX, Divisor, &Remainder);
+#endif
 }
 
-void CCBigIntSetInt(CCBigInt Integer, int64_t Value)
+/*!
+ * @brief Divide a two component value by a normalized divisor.
+ * @param High The high component of the dividend. Must be less than Divisor.
+ * @param Low The low component of the dividend.
+ * @param Divisor The divisor. Must have the most significant bit set.
+ * @param Reciprocal The reciprocal of the divisor from @b CCBigIntReciprocal.
+ * @param Remainder Where to store the remainder.
+ * @return The quotient.
+ */
+static CC_FORCE_INLINE uint64_t CCBigIntDivWide(uint64_t High, uint64_t Low, uint64_t Divisor, uint64_t Reciprocal, uint64_t *Remainder)
 {
-    CCAssertLog(Integer, "Integer must not be null");
+    uint64_t Quotient;
+    uint64_t QuotientLow = CCBigIntMulWide(Reciprocal, High, &Quotient);
     
-    CCListRemoveAllElements(Integer->value);
+    QuotientLow += Low;
+    Quotient += High + 1 + (QuotientLow < Low);
     
-    const int64_t Mask = Value >> 63;
+    uint64_t Result = Low - (Quotient * Divisor);
     
-    Integer->sign = Mask;
+    if (Result > QuotientLow)
+    {
+        Quotient--;
+        Result += Divisor;
+    }
     
-    CCListAppendElement(Integer->value, &(uint64_t){ (Value ^ Mask) - Mask });
+    if (CC_UNLIKELY(Result >= Divisor))
+    {
+        Quotient++;
+        Result -= Divisor;
+    }
+    
+    *Remainder = Result;
+    
+    return Quotient;
 }
 
-static uint64_t CCBigIntParseHex(const char *String, size_t Length)
+static CCComparisonResult CCBigIntComponentsCompare(const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    uint64_t Value = 0;
-    for (size_t Loop = 0; Loop < Length; Loop++)
+    //Components must be normalized
+    if (CountA != CountB) return CountA < CountB ? CCComparisonResultAscending : CCComparisonResultDescending;
+    
+    for (size_t Loop = CountA; Loop--; )
     {
-        const char Chr = String[Loop];
-        
-        uint64_t Bits = 0;
-        if ((Chr >= '0') && (Chr <= '9')) Bits = Chr - '0';
-        else if ((Chr >= 'a') && (Chr <= 'f')) Bits = Chr - 'a' + 10;
-        else if ((Chr >= 'A') && (Chr <= 'F')) Bits = Chr - 'A' + 10;
-        else return Value;
-        
-        Value |= (Bits << ((Length - Loop - 1) * 4));
+        if (a[Loop] != b[Loop]) return a[Loop] < b[Loop] ? CCComparisonResultAscending : CCComparisonResultDescending;
     }
     
-    return Value;
+    return CCComparisonResultEqual;
 }
 
-static void CCBigIntParse(CCBigInt Integer, const char *String, size_t Length)
+static uint64_t CCBigIntComponentsAdd(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    CCAssertLog(String, "String must not be null");
-    CCAssertLog(Length, "Length must not be 0");
-    
-    CCListRemoveAllElements(Integer->value);
-    
-    if (*String == '-')
+    //CountA must be greater than or equal to CountB
+    uint64_t Carry = 0;
+    size_t Loop = 0;
+    for ( ; Loop < CountB; Loop++)
     {
-        Integer->sign = TRUE;
-        String++;
-        Length--;
+        const uint64_t ValueA = a[Loop], Value = ValueA + b[Loop], Sum = Value + Carry;
+        Carry = (Value < ValueA) | (Sum < Value);
+        Result[Loop] = Sum;
     }
     
-    else Integer->sign = FALSE;
-    
-    if ((Length > 2) && (String[0] == '0') && (String[1] == 'x'))
+    for ( ; (Carry) && (Loop < CountA); Loop++)
     {
-        String += 2;
-        Length -= 2;
-        
-        size_t Index = 0;
-        const size_t ElementCount = Length / 16;
-        for (size_t Loop = 0; Loop < ElementCount; Loop++)
-        {
-            Index = CCListAppendElement(Integer->value, &(uint64_t){ 0 });
-        }
-        
-        _Bool NonZero = FALSE;
-        const size_t Leftover = Length % 16;
-        if (Leftover)
-        {
-            const uint64_t Value = CCBigIntParseHex(String, Leftover);
-            if (Value)
-            {
-                CCListAppendElement(Integer->value, &Value);
-                NonZero = TRUE;
-            }
-        }
-        
-        String += Leftover;
-        
-        size_t Loop = 0;
-        for ( ; (!NonZero) && (Loop < ElementCount); Loop++, Index--)
-        {
-            const uint64_t Value = CCBigIntParseHex(String + (Loop * 16), 16);
-            if (Value)
-            {
-                CCListReplaceElementAtIndex(Integer->value, Index, &Value);
-                NonZero = TRUE;
-            }
-            
-            else CCListRemoveElementAtIndex(Integer->value, Index);
-        }
-        
-        for ( ; Loop < ElementCount; Loop++, Index--)
-        {
-            CCListReplaceElementAtIndex(Integer->value, Index, &(uint64_t){ CCBigIntParseHex(String + (Loop * 16), 16) });
-        }
-        
-        if (!NonZero)
-        {
-            CCListAppendElement(Integer->value, &(uint64_t){ 0 });
-            Integer->sign = FALSE;
-        }
+        Result[Loop] = a[Loop] + 1;
+        Carry = !Result[Loop];
     }
     
-    else CCAssertLog(0, "Unsupported big integer format");
+    if ((Result != a) && (Loop < CountA)) memcpy(Result + Loop, a + Loop, sizeof(uint64_t) * (CountA - Loop));
+    
+    return Carry;
 }
 
-void CCBigIntSetString(CCBigInt Integer, CCString Value)
+static uint64_t CCBigIntComponentsSub(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    CCAssertLog(Integer, "Integer must not be null");
+    //CountA must be greater than or equal to CountB
+    uint64_t Borrow = 0;
+    size_t Loop = 0;
+    for ( ; Loop < CountB; Loop++)
+    {
+        const uint64_t ValueA = a[Loop], ValueB = b[Loop], Value = ValueA - ValueB;
+        Result[Loop] = Value - Borrow;
+        Borrow = (ValueA < ValueB) | (Value < Borrow);
+    }
     
-    CC_STRING_TEMP_BUFFER(Buffer, Value)
+    for ( ; (Borrow) && (Loop < CountA); Loop++)
     {
-        CCBigIntParse(Integer, Buffer, CCStringGetSize(Value));
+        Borrow = !a[Loop];
+        Result[Loop] = a[Loop] - 1;
     }
+    
+    if ((Result != a) && (Loop < CountA)) memcpy(Result + Loop, a + Loop, sizeof(uint64_t) * (CountA - Loop));
+    
+    return Borrow;
 }
 
-CCString CCBigIntGetString(CCBigInt Integer)
+/*!
+ * @brief Calculate |a - b|.
+ * @param Result Where to store the CountA components of the result.
+ * @param CountA Must be greater than or equal to CountB.
+ * @return Whether a is less than b.
+ */
+static _Bool CCBigIntComponentsAbsDiff(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    
-    const size_t Count = CCListGetCount(Integer->value);
-    
-    char *String;
-    CC_SAFE_Malloc(String, sizeof(char) * ((Count * 16) + 4),
-                   return 0;
-                   );
+    _Bool Less = FALSE;
     
-    size_t Index = 0;
-    if (Integer->sign) String[Index++] = '-';
-    String[Index++] = '0';
-    String[Index++] = 'x';
+    size_t Loop = CountA;
+    while ((Loop > CountB) && (!a[Loop - 1])) Loop--;
     
-    const char * const Hex = "0123456789abcdef";
-    for (size_t Loop = 0; Loop < Count; Loop++)
+    if (Loop == CountB)
     {
-        const uint64_t Value = *(uint64_t*)CCListGetElementAtIndex(Integer->value, Count - Loop - 1);
+        while ((Loop) && (a[Loop - 1] == b[Loop - 1])) Loop--;
         
-        for (size_t Loop2 = 0; Loop2 < 16; Loop2++)
-        {
-            String[Index++] = Hex[(Value >> (60 - (Loop2 * 4))) & 0xf];
-        }
+        Less = (Loop) && (a[Loop - 1] < b[Loop - 1]);
     }
     
-    String[Index] = 0;
+    if (Less)
+    {
+        CCBigIntComponentsSub(Result, b, CountB, a, CountB);
+        memset(Result + CountB, 0, sizeof(uint64_t) * (CountA - CountB));
+    }
     
-    return CCStringCreateWithSize(CC_STD_ALLOCATOR, CCStringEncodingASCII | CCStringHintFree, String, Index);
+    else CCBigIntComponentsSub(Result, a, CountA, b, CountB);
+    
+    return Less;
 }
 
-static CCComparisonResult CCBigIntCompareComponents(CCBigInt a, size_t CountA, CCBigInt b, size_t CountB)
+static void CCBigIntComponentsNegate(uint64_t *Result, size_t Count)
 {
-    if (CountA == CountB)
+    uint64_t Carry = 1;
+    for (size_t Loop = 0; Loop < Count; Loop++)
     {
-        CCEnumerable EnumerableA, EnumerableB;
-        CCListGetEnumerable(a->value, &EnumerableA);
-        CCListGetEnumerable(b->value, &EnumerableB);
-        
-        for (const uint64_t *ComponentA = CCEnumerableGetTail(&EnumerableA), *ComponentB = CCEnumerableGetTail(&EnumerableB); ComponentA; ComponentA = CCEnumerablePrevious(&EnumerableA), ComponentB = CCEnumerablePrevious(&EnumerableB))
-        {
-            if (*ComponentA != *ComponentB)
-            {
-                return *ComponentA < *ComponentB ? CCComparisonResultAscending : CCComparisonResultDescending;
-            }
-        }
-        
-        return CCComparisonResultEqual;
+        Result[Loop] = ~Result[Loop] + Carry;
+        Carry &= !Result[Loop];
     }
-    
-    return CountA < CountB ? CCComparisonResultAscending : CCComparisonResultDescending;
 }
 
-CCComparisonResult CCBigIntCompareBigInt(CCBigInt a, CCBigInt b)
+static uint64_t CCBigIntComponentsShiftLeft(uint64_t *Result, const uint64_t *a, size_t Count, unsigned int Shift)
 {
-    CCAssertLog(a, "a must not be null");
-    CCAssertLog(b, "b must not be null");
-    
-    if (a == b) return CCComparisonResultEqual;
+    //Shift must be between 1 and 63
+    const uint64_t Overflow = a[Count - 1] >> (64 - Shift);
     
-    if (a->sign != b->sign) return a->sign ? CCComparisonResultAscending : CCComparisonResultDescending;
+    for (size_t Loop = Count - 1; Loop > 0; Loop--)
+    {
+        Result[Loop] = (a[Loop] << Shift) | (a[Loop - 1] >> (64 - Shift));
+    }
     
-    const CCComparisonResult Result = CCBigIntCompareComponents(a, CCListGetCount(a->value), b, CCListGetCount(b->value));
+    Result[0] = a[0] << Shift;
     
-    return a->sign ? CCComparisonResultFlipOrder(Result) : Result;
+    return Overflow;
 }
 
-CCComparisonResult CCBigIntCompareBigIntFast(CCBigInt a, CCBigIntFast b)
+static void CCBigIntComponentsShiftRight(uint64_t *Result, const uint64_t *a, size_t Count, unsigned int Shift)
 {
-    if (CCBigIntFastIsTaggedValue(b)) return CCBigIntCompare(a, CCBigIntFastGetTaggedValue(b));
+    //Shift must be between 1 and 63
+    for (size_t Loop = 0; Loop + 1 < Count; Loop++)
+    {
+        Result[Loop] = (a[Loop] >> Shift) | (a[Loop + 1] << (64 - Shift));
+    }
     
-    return CCBigIntCompare(a, (CCBigInt)b);
+    Result[Count - 1] = a[Count - 1] >> Shift;
 }
 
-CCComparisonResult CCBigIntCompareInt(CCBigInt Integer, int64_t Value)
+static void CCBigIntComponentsDivExact3(uint64_t *Result, const uint64_t *a, size_t Count)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    
-    CCBigInt IntegerB = CCBigIntCreate(CC_STD_ALLOCATOR);
-    CCBigIntSet(IntegerB, Value);
-    const CCComparisonResult Result = CCBigIntCompare(Integer, IntegerB);
-    CCBigIntDestroy(IntegerB);
+    //Hensel division, the result is exact modulo B^Count when a is a multiple of 3
+    const uint64_t Inverse = 0xaaaaaaaaaaaaaaabULL;
     
-    return Result;
+    uint64_t Borrow = 0;
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const uint64_t Value = a[Loop], Diff = Value - Borrow, Quotient = Diff * Inverse;
+        
+        uint64_t High;
+        CCBigIntMulWide(Quotient, 3, &High);
+        
+        Borrow = High + (Diff > Value);
+        Result[Loop] = Quotient;
+    }
 }
 
-CCComparisonResult CCBigIntCompareString(CCBigInt Integer, CCString Value)
+static uint64_t CCBigIntComponentsMul1(uint64_t *Result, const uint64_t *a, size_t Count, uint64_t b)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    
-    CCBigInt IntegerB = CCBigIntCreate(CC_STD_ALLOCATOR);
-    CCBigIntSet(IntegerB, Value);
-    const CCComparisonResult Result = CCBigIntCompare(Integer, IntegerB);
-    CCBigIntDestroy(IntegerB);
+    uint64_t Carry = 0;
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        uint64_t High;
+        const uint64_t Low = CCBigIntMulWide(a[Loop], b, &High) + Carry;
+        
+        Carry = High + (Low < Carry);
+        Result[Loop] = Low;
+    }
     
-    return Result;
+    return Carry;
 }
 
-static void CCBigIntApplyAdd(CCBigInt Integer, CCEnumerable *Values)
+static uint64_t CCBigIntComponentsMulAdd1(uint64_t *Result, const uint64_t *a, size_t Count, uint64_t b)
 {
-    const uint64_t *Value = CCEnumerableGetCurrent(Values);
     uint64_t Carry = 0;
-    
-    CCEnumerable Enumerable;
-    CCListGetEnumerable(Integer->value, &Enumerable);
-    
-    for (uint64_t *Component = CCEnumerableGetCurrent(&Enumerable); (Carry || Value) && Component; Component = CCEnumerableNext(&Enumerable), Value = CCEnumerableNext(Values))
-    {
-        const uint64_t Result = *Component + (Value ? *Value : 0) + Carry;
-        Carry = (Result <= *Component) && ((Value ? *Value : 0) | Carry);
-        *Component = Result;
-    }
-    
-    for ( ; Value; Value = CCEnumerableNext(Values))
+    for (size_t Loop = 0; Loop < Count; Loop++)
     {
-        const uint64_t Result = *Value + Carry;
-        Carry = (Result < *Value);
-        CCListAppendElement(Integer->value, &Result);
+        uint64_t High;
+        uint64_t Low = CCBigIntMulWide(a[Loop], b, &High) + Carry;
+        High += Low < Carry;
+        
+        const uint64_t Sum = Result[Loop] + Low;
+        Carry = High + (Sum < Low);
+        Result[Loop] = Sum;
     }
     
-    if (Carry) CCListAppendElement(Integer->value, &Carry);
+    return Carry;
 }
 
-static void CCBigIntApplySub(CCBigInt Integer, CCEnumerable *Values)
+static uint64_t CCBigIntComponentsMulSub1(uint64_t *Result, const uint64_t *a, size_t Count, uint64_t b)
 {
-    const uint64_t *Value = CCEnumerableGetCurrent(Values);
-    uint64_t Carry = 0;
-    
-    CCEnumerable Enumerable;
-    CCListGetEnumerable(Integer->value, &Enumerable);
-    
-    size_t LastNonZero = 0, Index = 0;
-    for (uint64_t *Component = CCEnumerableGetCurrent(&Enumerable); (Carry || Value) && Component; Component = CCEnumerableNext(&Enumerable), Value = CCEnumerableNext(Values))
+    uint64_t Borrow = 0;
+    for (size_t Loop = 0; Loop < Count; Loop++)
     {
-        uint64_t Result = Value ? *Value : 0;
-        const _Bool NextCarry = (*Component < Result) || (*Component < (Result + Carry)) || ((Carry) && (Result == UINT64_MAX));
-        *Component = *Component - (Result + Carry);
-        Carry = NextCarry;
+        uint64_t High;
+        uint64_t Low = CCBigIntMulWide(a[Loop], b, &High) + Borrow;
+        High += Low < Borrow;
         
-        if (*Component) LastNonZero = Index;
-        
-        Index++;
+        const uint64_t Value = Result[Loop];
+        Borrow = High + (Value < Low);
+        Result[Loop] = Value - Low;
     }
     
-    CCAssertLog(!Value, "Values must not exceed size of Integer");
-    
-    for (size_t Loop = LastNonZero + 1, Count = CCListGetCount(Integer->value); Loop < Count; Loop++)
-    {
-        CCListRemoveElementAtIndex(Integer->value, Count - Loop);
-    }
+    return Borrow;
+}
+
+static void CCBigIntComponentsMul(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB);
+
+static void CCBigIntComponentsMulBasecase(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
+{
+    Result[CountA] = CCBigIntComponentsMul1(Result, a, CountA, b[0]);
     
-    if (Carry)
+    for (size_t Loop = 1; Loop < CountB; Loop++)
     {
-        Integer->sign = !Integer->sign;
-        uint64_t *Value = CCListGetElementAtIndex(Integer->value, 0);
-        
-        const int64_t Mask = *(int64_t*)Value >> 63;
-        *Value = (*(int64_t*)Value ^ Mask) - Mask;
+        Result[CountA + Loop] = CCBigIntComponentsMulAdd1(Result + Loop, a, CountA, b[Loop]);
     }
 }
 
-void CCBigIntAddBigInt(CCBigInt Integer, CCBigInt Value)
+static _Bool CCBigIntComponentsMulUnbalanced(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    CCAssertLog(Value, "Value must not be null");
+    //Split a into CountB sized pieces so each product is balanced
+    uint64_t *Product = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * CountB * 2, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Product) return FALSE;
     
-    CCEnumerable Enumerable;
-    CCListGetEnumerable(Value->value, &Enumerable);
+    CCBigIntComponentsMul(Result, a, CountB, b, CountB);
     
-    if (Integer->sign == Value->sign) CCBigIntApplyAdd(Integer, &Enumerable);
-    else if (CCBigIntCompareComponents(Integer, CCListGetCount(Integer->value), Value, CCListGetCount(Value->value)) != CCComparisonResultAscending) CCBigIntApplySub(Integer, &Enumerable);
-    else
+    for (size_t Offset = CountB; Offset < CountA; Offset += CountB)
     {
-        const _Bool OriginalSign = Integer->sign;
-        CCList OriginalValue = Integer->value;
-        CCListGetEnumerable(OriginalValue, &Enumerable);
+        const size_t Count = (CountA - Offset) < CountB ? (CountA - Offset) : CountB;
         
-        Integer->value = CCListCreate(CC_STD_ALLOCATOR, sizeof(uint64_t), 4, 16);
-        CCBigIntSet(Integer, Value);
-        
-        CCBigIntApplySub(Integer, &Enumerable);
-        CCListDestroy(OriginalValue);
-        
-        Integer->sign = !OriginalSign;
+        CCBigIntComponentsMul(Product, a + Offset, Count, b, CountB);
+        CCBigIntComponentsAdd(Result + Offset, Product, Count + CountB, Result + Offset, CountB);
     }
-}
-
-void CCBigIntAddBigIntFast(CCBigInt Integer, CCBigIntFast Value)
-{
-    CCAssertLog(Integer, "Integer must not be null");
-    CCAssertLog(Value, "Value must not be null");
     
-    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntAdd(Integer, CCBigIntFastGetTaggedValue(Value));
-    else CCBigIntAdd(Integer, (CCBigInt)Value);
+    CCFree(Product);
+    
+    return TRUE;
 }
 
-void CCBigIntAddInt(CCBigInt Integer, int64_t Value)
+static _Bool CCBigIntComponentsMulKaratsuba(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    CCAssertLog(Integer, "Integer must not be null");
+    //CountB must be greater than half of CountA
+    const size_t Half = (CountA + 1) / 2, HighCountA = CountA - Half, HighCountB = CountB - Half;
     
-    const int64_t Mask = Value >> 63;
-    uint64_t AbsValue = (Value ^ Mask) - Mask;
+    uint64_t *Temp = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * ((Half * 6) + 1), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Temp) return FALSE;
+    
+    uint64_t *DiffA = Temp, *DiffB = Temp + Half, *Product = Temp + (Half * 2), *Middle = Temp + (Half * 4);
+    
+    const _Bool NegativeA = CCBigIntComponentsAbsDiff(DiffA, a, Half, a + Half, HighCountA);
+    const _Bool NegativeB = CCBigIntComponentsAbsDiff(DiffB, b, Half, b + Half, HighCountB);
     
-    CCEnumerable Enumerable = CCEnumerableCreate(&AbsValue, sizeof(typeof(AbsValue)), 1);
+    CCBigIntComponentsMul(Result, a, Half, b, Half);
+    CCBigIntComponentsMul(Result + (Half * 2), a + Half, HighCountA, b + Half, HighCountB);
+    CCBigIntComponentsMul(Product, DiffA, Half, DiffB, Half);
     
-    if (Integer->sign == (_Bool)Mask) CCBigIntApplyAdd(Integer, &Enumerable);
-    else CCBigIntApplySub(Integer, &Enumerable);
+    //a0b1 + a1b0 = a0b0 + a1b1 - (a0 - a1)(b0 - b1)
+    Middle[Half * 2] = CCBigIntComponentsAdd(Middle, Result, Half * 2, Result + (Half * 2), HighCountA + HighCountB);
+    
+    if (NegativeA == NegativeB) CCBigIntComponentsSub(Middle, Middle, (Half * 2) + 1, Product, Half * 2);
+    else CCBigIntComponentsAdd(Middle, Middle, (Half * 2) + 1, Product, Half * 2);
+    
+    const size_t Count = CountA + CountB - Half;
+    CCBigIntComponentsAdd(Result + Half, Result + Half, Count, Middle, Count < ((Half * 2) + 1) ? Count : ((Half * 2) + 1));
+    
+    CCFree(Temp);
+    
+    return TRUE;
 }
 
-void CCBigIntAddString(CCBigInt Integer, CCString Value)
+static void CCBigIntComponentsToom3Evaluate2(uint64_t *Result, const uint64_t *a, size_t Part, size_t HighCount)
 {
-    CCAssertLog(Integer, "Integer must not be null");
+    //a0 + 2(a1 + 2a2)
+    memcpy(Result, a + (Part * 2), sizeof(uint64_t) * HighCount);
+    memset(Result + HighCount, 0, sizeof(uint64_t) * (Part + 1 - HighCount));
     
-    CCBigInt Source = CCBigIntCreate(CC_STD_ALLOCATOR);
-    CCBigIntSet(Source, Value);
-    CCBigIntAdd(Integer, Source);
-    CCBigIntDestroy(Source);
+    CCBigIntComponentsShiftLeft(Result, Result, Part + 1, 1);
+    CCBigIntComponentsAdd(Result, Result, Part + 1, a + Part, Part);
+    CCBigIntComponentsShiftLeft(Result, Result, Part + 1, 1);
+    CCBigIntComponentsAdd(Result, Result, Part + 1, a, Part);
 }
 
-void CCBigIntSubBigInt(CCBigInt Integer, CCBigInt Value)
+static _Bool CCBigIntComponentsMulToom3(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
 {
-    CCAssertLog(Integer, "Integer must not be null");
-    CCAssertLog(Value, "Value must not be null");
+    //CountB must be greater than 2/3 of CountA, evaluates at 0, 1, -1, 2, inf
+    const size_t Part = (CountA + 2) / 3, HighCountA = CountA - (Part * 2), HighCountB = CountB - (Part * 2), HighCount = HighCountA + HighCountB, Width = (Part * 2) + 2;
     
-    CCEnumerable Enumerable;
-    CCListGetEnumerable(Value->value, &Enumerable);
+    uint64_t *Temp = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * (((Part + 1) * 4) + (Width * 3)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Temp) return FALSE;
     
-    if (Integer->sign != Value->sign) CCBigIntApplyAdd(Integer, &Enumerable);
-    else if (CCBigIntCompareComponents(Integer, CCListGetCount(Integer->value), Value, CCListGetCount(Value->value)) != CCComparisonResultAscending) CCBigIntApplySub(Integer, &Enumerable);
-    else
+    uint64_t *SumA = Temp, *SumB = SumA + Part + 1, *EvalA = SumB + Part + 1, *EvalB = EvalA + Part + 1;
+    uint64_t *P1 = EvalB + Part + 1, *PM1 = P1 + Width, *P2 = PM1 + Width;
+    uint64_t *Low = Result, *High = Result + (Part * 4);
+    
+    CCBigIntComponentsMul(Low, a, Part, b, Part);
+    CCBigIntComponentsMul(High, a + (Part * 2), HighCountA, b + (Part * 2), HighCountB);
+    memset(Result + (Part * 2), 0, sizeof(uint64_t) * Part * 2);
+    
+    SumA[Part] = CCBigIntComponentsAdd(SumA, a, Part, a + (Part * 2), HighCountA);
+    SumB[Part] = CCBigIntComponentsAdd(SumB, b, Part, b + (Part * 2), HighCountB);
+    
+    CCBigIntComponentsAdd(EvalA, SumA, Part + 1, a + Part, Part);
+    CCBigIntComponentsAdd(EvalB, SumB, Part + 1, b + Part, Part);
+    CCBigIntComponentsMul(P1, EvalA, Part + 1, EvalB, Part + 1);
+    
+    const _Bool NegativeA = CCBigIntComponentsAbsDiff(EvalA, SumA, Part + 1, a + Part, Part);
+    const _Bool NegativeB = CCBigIntComponentsAbsDiff(EvalB, SumB, Part + 1, b + Part, Part);
+    CCBigIntComponentsMul(PM1, EvalA, Part + 1, EvalB, Part + 1);
+    
+    if (NegativeA != NegativeB) CCBigIntComponentsNegate(PM1, Width);
+    
+    CCBigIntComponentsToom3Evaluate2(EvalA, a, Part, HighCountA);
+    CCBigIntComponentsToom3Evaluate2(EvalB, b, Part, HighCountB);
+    CCBigIntComponentsMul(P2, EvalA, Part + 1, EvalB, Part + 1);
+    
+    //Interpolate, all intermediate values are non-negative (the inputs are modulo B^Width)
+    CCBigIntComponentsSub(P2, P2, Width, PM1, Width);
+    CCBigIntComponentsDivExact3(P2, P2, Width);
+    
+    CCBigIntComponentsSub(PM1, P1, Width, PM1, Width);
+    CCBigIntComponentsShiftRight(PM1, PM1, Width, 1);
+    
+    CCBigIntComponentsSub(P1, P1, Width, Low, Part * 2);
+    
+    CCBigIntComponentsSub(P2, P2, Width, P1, Width);
+    CCBigIntComponentsShiftRight(P2, P2, Width, 1);
+    
+    CCBigIntComponentsSub(P1, P1, Width, PM1, Width);
+    CCBigIntComponentsSub(P1, P1, Width, High, HighCount);
+    
+    CCBigIntComponentsSub(P2, P2, Width, High, HighCount);
+    CCBigIntComponentsSub(P2, P2, Width, High, HighCount);
+    
+    CCBigIntComponentsSub(PM1, PM1, Width, P2, Width);
+    
+    const size_t Count = CountA + CountB;
+    for (size_t Loop = 1; Loop <= 3; Loop++)
     {
-        const _Bool OriginalSign = Integer->sign;
-        CCList OriginalValue = Integer->value;
-        CCListGetEnumerable(OriginalValue, &Enumerable);
+        const uint64_t *Coefficient = (uint64_t*[]){ PM1, P1, P2 }[Loop - 1];
+        const size_t Available = Count - (Part * Loop);
         
-        Integer->value = CCListCreate(CC_STD_ALLOCATOR, sizeof(uint64_t), 4, 16);
-        CCBigIntSet(Integer, Value);
-        
-        CCBigIntApplySub(Integer, &Enumerable);
-        CCListDestroy(OriginalValue);
-        
-        Integer->sign = !OriginalSign;
+        CCBigIntComponentsAdd(Result + (Part * Loop), Result + (Part * Loop), Available, Coefficient, Available < Width ? Available : Width);
     }
+    
+    CCFree(Temp);
+    
+    return TRUE;
+}
+
+/*!
+ * @brief Multiply two component arrays.
+ * @param Result Where to store the CountA + CountB components of the result. Must not alias a or b.
+ */
+static void CCBigIntComponentsMul(uint64_t *Result, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
+{
+    if (CountA < CountB)
+    {
+        const uint64_t *Components = a;
+        a = b;
+        b = Components;
+        
+        const size_t Count = CountA;
+        CountA = CountB;
+        CountB = Count;
+    }
+    
+    _Bool Done = FALSE;
+    if (CountB >= CC_BIG_INT_KARATSUBA_THRESHOLD)
+    {
+        if ((CountB >= CC_BIG_INT_TOOM3_THRESHOLD) && (CountB > (((CountA + 2) / 3) * 2))) Done = CCBigIntComponentsMulToom3(Result, a, CountA, b, CountB);
+        else if (CountB > ((CountA + 1) / 2)) Done = CCBigIntComponentsMulKaratsuba(Result, a, CountA, b, CountB);
+        else Done = CCBigIntComponentsMulUnbalanced(Result, a, CountA, b, CountB);
+    }
+    
+    if (!Done) CCBigIntComponentsMulBasecase(Result, a, CountA, b, CountB);
+}
+
+static uint64_t CCBigIntComponentsDivide1(uint64_t *Quotient, const uint64_t *a, size_t Count, uint64_t b)
+{
+    const unsigned int Shift = __builtin_clzll(b);
+    const uint64_t Divisor = b << Shift, Reciprocal = CCBigIntReciprocal(Divisor);
+    
+    uint64_t Remainder = Shift ? a[Count - 1] >> (64 - Shift) : 0;
+    for (size_t Loop = Count; Loop--; )
+    {
+        const uint64_t Value = (a[Loop] << Shift) | ((Shift && Loop) ? a[Loop - 1] >> (64 - Shift) : 0);
+        const uint64_t Result = CCBigIntDivWide(Remainder, Value, Divisor, Reciprocal, &Remainder);
+        
+        if (Quotient) Quotient[Loop] = Result;
+    }
+    
+    return Remainder >> Shift;
+}
+
+/*!
+ * @brief Divide component arrays (Knuth, TAOCP Vol 2, 4.3.1, Algorithm D).
+ * @param Quotient Where to store the CountA - CountB + 1 components of the quotient. May be NULL.
+ * @param Remainder Where to store the CountB components of the remainder. May be NULL.
+ * @param CountA Must be greater than or equal to CountB.
+ * @param b The divisor. The most significant component must not be zero.
+ * @return Whether the division could be performed.
+ */
+static _Bool CCBigIntComponentsDivide(uint64_t *Quotient, uint64_t *Remainder, const uint64_t *a, size_t CountA, const uint64_t *b, size_t CountB)
+{
+    if (CountB == 1)
+    {
+        const uint64_t Value = CCBigIntComponentsDivide1(Quotient, a, CountA, b[0]);
+        if (Remainder) *Remainder = Value;
+        
+        return TRUE;
+    }
+    
+    uint64_t *Dividend = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * (CountA + 1 + CountB), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Dividend) return FALSE;
+    
+    uint64_t *Divisor = Dividend + CountA + 1;
+    
+    const unsigned int Shift = __builtin_clzll(b[CountB - 1]);
+    if (Shift)
+    {
+        CCBigIntComponentsShiftLeft(Divisor, b, CountB, Shift);
+        Dividend[CountA] = CCBigIntComponentsShiftLeft(Dividend, a, CountA, Shift);
+    }
+    
+    else
+    {
+        memcpy(Divisor, b, sizeof(uint64_t) * CountB);
+        memcpy(Dividend, a, sizeof(uint64_t) * CountA);
+        Dividend[CountA] = 0;
+    }
+    
+    const uint64_t DivisorHigh = Divisor[CountB - 1], DivisorLow = Divisor[CountB - 2], Reciprocal = CCBigIntReciprocal(DivisorHigh);
+    
+    for (size_t Loop = CountA - CountB + 1; Loop--; )
+    {
+        uint64_t *Window = Dividend + Loop;
+        const uint64_t Value2 = Window[CountB], Value1 = Window[CountB - 1], Value0 = Window[CountB - 2];
+        
+        uint64_t Estimate, Estimated;
+        _Bool Overflow = FALSE;
+        if (Value2 == DivisorHigh)
+        {
+            Estimate = UINT64_MAX;
+            Estimated = Value1 + DivisorHigh;
+            Overflow = Estimated < DivisorHigh;
+        }
+        
+        else Estimate = CCBigIntDivWide(Value2, Value1, DivisorHigh, Reciprocal, &Estimated);
+        
+        while (!Overflow)
+        {
+            uint64_t ProductHigh;
+            const uint64_t ProductLow = CCBigIntMulWide(Estimate, DivisorLow, &ProductHigh);
+            
+            if ((ProductHigh < Estimated) || ((ProductHigh == Estimated) && (ProductLow <= Value0))) break;
+            
+            Estimate--;
+            Estimated += DivisorHigh;
+            Overflow = Estimated < DivisorHigh;
+        }
+        
+        const uint64_t Borrow = CCBigIntComponentsMulSub1(Window, Divisor, CountB, Estimate);
+        Window[CountB] = Value2 - Borrow;
+        
+        if (CC_UNLIKELY(Value2 < Borrow))
+        {
+            Estimate--;
+            Window[CountB] += CCBigIntComponentsAdd(Window, Window, CountB, Divisor, CountB);
+        }
+        
+        if (Quotient) Quotient[Loop] = Estimate;
+    }
+    
+    if (Remainder)
+    {
+        if (Shift) CCBigIntComponentsShiftRight(Remainder, Dividend, CountB, Shift);
+        else memcpy(Remainder, Dividend, sizeof(uint64_t) * CountB);
+    }
+    
+    CCFree(Dividend);
+    
+    return TRUE;
+}
+
+#pragma mark - Radix Conversion
+
+#define CC_BIG_INT_DECIMAL_BASE 10000000000000000000ULL
+#define CC_BIG_INT_DECIMAL_BASE_DIGITS 19
+
+_Static_assert(CC_BIG_INT_DECIMAL_THRESHOLD >= 2, "CC_BIG_INT_DECIMAL_THRESHOLD must be at least 2");
+
+/*!
+ * @brief Calculate floor(B^(2 * Count) / Divisor).
+ * @param Result Where to store the Count + 2 components of the reciprocal. The most significant
+ *        component will always be zero.
+ *
+ * @param Divisor The divisor of Count components. The most significant bit must be set.
+ * @return Whether the reciprocal could be calculated.
+ */
+static _Bool CCBigIntComponentsReciprocal(uint64_t *Result, const uint64_t *Divisor, size_t Count)
+{
+    if (Count < CC_BIG_INT_RECIPROCAL_THRESHOLD)
+    {
+        uint64_t *Dividend = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * ((Count * 2) + 1), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Dividend) return FALSE;
+        
+        memset(Dividend, 0, sizeof(uint64_t) * Count * 2);
+        Dividend[Count * 2] = 1;
+        
+        const _Bool Done = CCBigIntComponentsDivide(Result, NULL, Dividend, (Count * 2) + 1, Divisor, Count);
+        CCFree(Dividend);
+        
+        return Done;
+    }
+    
+    //Newton iteration from the reciprocal of the most significant half, X = X0 + X0(B^2n - D X0) / B^2n
+    const size_t High = (Count + 1) / 2, Low = Count - High, Size = Count + High + 1;
+    
+    uint64_t *Temp = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * ((High + 2) + Size + (Count + (High * 2) + 2)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Temp) return FALSE;
+    
+    uint64_t *Approximate = Temp, *Error = Approximate + High + 2, *Product = Error + Size;
+    
+    if (!CCBigIntComponentsReciprocal(Approximate, Divisor + Low, High))
+    {
+        CCFree(Temp);
+        
+        return FALSE;
+    }
+    
+    //E = D X0 - B^2n, where X0 = Xh B^l
+    CCBigIntComponentsMul(Error, Divisor, Count, Approximate, High + 1);
+    Error[Size - 1]--;
+    
+    const _Bool Under = Error[Size - 1] >> 63;
+    if (Under) CCBigIntComponentsNegate(Error, Size);
+    
+    size_t ErrorCount = Size;
+    while ((ErrorCount > 1) && (!Error[ErrorCount - 1])) ErrorCount--;
+    
+    CCBigIntComponentsMul(Product, Approximate, High + 1, Error, ErrorCount);
+    
+    memset(Result, 0, sizeof(uint64_t) * Low);
+    memcpy(Result + Low, Approximate, sizeof(uint64_t) * (High + 1));
+    Result[Count + 1] = 0;
+    
+    size_t CorrectionCount = (High + 1) + ErrorCount;
+    while ((CorrectionCount > (High * 2)) && (!Product[CorrectionCount - 1])) CorrectionCount--;
+    
+    if (CorrectionCount > (High * 2))
+    {
+        CorrectionCount -= High * 2;
+        
+        CCAssertLog(CorrectionCount <= (Count + 2), "Reciprocal approximation should be close");
+        
+        if (Under) CCBigIntComponentsAdd(Result, Result, Count + 2, Product + (High * 2), CorrectionCount);
+        else CCBigIntComponentsSub(Result, Result, Count + 2, Product + (High * 2), CorrectionCount);
+    }
+    
+    //Correct the approximation using the remainder R = B^2n - D X
+    uint64_t *Remainder = Product;
+    const size_t RemainderCount = (Count * 2) + 1;
+    const uint64_t One = 1;
+    
+    CCBigIntComponentsMul(Remainder, Divisor, Count, Result, Count + 1);
+    CCBigIntComponentsNegate(Remainder, RemainderCount);
+    Remainder[RemainderCount - 1]++;
+    
+    while (Remainder[RemainderCount - 1] >> 63)
+    {
+        CCBigIntComponentsAdd(Remainder, Remainder, RemainderCount, Divisor, Count);
+        CCBigIntComponentsSub(Result, Result, Count + 2, &One, 1);
+    }
+    
+    for ( ; ; )
+    {
+        size_t Loop = RemainderCount;
+        while ((Loop > Count) && (!Remainder[Loop - 1])) Loop--;
+        
+        if ((Loop == Count) && (CCBigIntComponentsCompare(Remainder, Count, Divisor, Count) == CCComparisonResultAscending)) break;
+        
+        CCBigIntComponentsSub(Remainder, Remainder, RemainderCount, Divisor, Count);
+        CCBigIntComponentsAdd(Result, Result, Count + 2, &One, 1);
+    }
+    
+    CCFree(Temp);
+    
+    return TRUE;
+}
+
+typedef struct {
+    uint64_t *value;
+    uint64_t *normalized;
+    uint64_t *reciprocal;
+    size_t count;
+    size_t zeros;
+    unsigned int shift;
+} CCBigIntRadixPower;
+
+/*!
+ * @brief Create the powers 10^(19 * 2^n) used for decimal conversion.
+ * @param Powers Where to store the Level + 1 powers.
+ * @param Level The highest power to be created.
+ * @param Divide Whether the powers will be used for division.
+ * @return Whether the powers could be created.
+ */
+static _Bool CCBigIntRadixPowersCreate(CCBigIntRadixPower *Powers, size_t Level, _Bool Divide)
+{
+    for (size_t Loop = 0; Loop <= Level; Loop++)
+    {
+        const size_t Count = Loop ? (Powers[Loop - 1].count * 2) : 1;
+        const _Bool Reciprocal = Divide && (Count > CC_BIG_INT_RECIPROCAL_THRESHOLD);
+        
+        CCBigIntRadixPower *Power = Powers + Loop;
+        Power->value = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * (Reciprocal ? ((Count * 3) + 2) : Count), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        Power->normalized = NULL;
+        Power->reciprocal = NULL;
+        
+        if (!Power->value)
+        {
+            for (size_t Loop2 = 0; Loop2 < Loop; Loop2++) CCFree(Powers[Loop2].value);
+            
+            return FALSE;
+        }
+        
+        if (Loop) CCBigIntComponentsMul(Power->value, Powers[Loop - 1].value, Powers[Loop - 1].count, Powers[Loop - 1].value, Powers[Loop - 1].count);
+        else Power->value[0] = CC_BIG_INT_DECIMAL_BASE;
+        
+        Power->count = Count;
+        while (!Power->value[Power->count - 1]) Power->count--;
+        
+        Power->zeros = 0;
+        while (!Power->value[Power->zeros]) Power->zeros++;
+        
+        Power->shift = __builtin_clzll(Power->value[Power->count - 1]);
+        
+        if (Reciprocal)
+        {
+            Power->normalized = Power->value + Count;
+            Power->reciprocal = Power->normalized + Count;
+            
+            if (Power->shift) CCBigIntComponentsShiftLeft(Power->normalized, Power->value, Power->count, Power->shift);
+            else memcpy(Power->normalized, Power->value, sizeof(uint64_t) * Power->count);
+            
+            if (!CCBigIntComponentsReciprocal(Power->reciprocal, Power->normalized, Power->count))
+            {
+                for (size_t Loop2 = 0; Loop2 <= Loop; Loop2++) CCFree(Powers[Loop2].value);
+                
+                return FALSE;
+            }
+        }
+    }
+    
+    return TRUE;
+}
+
+static void CCBigIntRadixPowersDestroy(CCBigIntRadixPower *Powers, size_t Level)
+{
+    for (size_t Loop = 0; Loop <= Level; Loop++) CCFree(Powers[Loop].value);
+}
+
+/*!
+ * @brief Divide by a radix power.
+ * @param Quotient Where to store the Power->count + 1 components of the quotient.
+ * @param Remainder Where to store the Power->count + 1 components of the remainder.
+ * @param a The dividend. Must be less than the power squared.
+ * @return Whether the division could be performed.
+ */
+static _Bool CCBigIntRadixDivide(const CCBigIntRadixPower *Power, uint64_t *Quotient, uint64_t *Remainder, const uint64_t *a, size_t Count)
+{
+    const size_t PowerCount = Power->count;
+    
+    memset(Quotient, 0, sizeof(uint64_t) * (PowerCount + 1));
+    memset(Remainder, 0, sizeof(uint64_t) * (PowerCount + 1));
+    
+    if (Count < PowerCount)
+    {
+        memcpy(Remainder, a, sizeof(uint64_t) * Count);
+        
+        return TRUE;
+    }
+    
+    if (!Power->reciprocal) return CCBigIntComponentsDivide(Quotient, Remainder, a, Count, Power->value, PowerCount);
+    
+    //Barrett reduction (HAC 14.42), the estimated quotient is at most 2 less than the true quotient
+    uint64_t *Temp = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * ((PowerCount * 2) + ((PowerCount * 2) + 2) + ((PowerCount * 2) + 1)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Temp) return FALSE;
+    
+    uint64_t *Dividend = Temp, *Estimate = Dividend + (PowerCount * 2), *Product = Estimate + (PowerCount * 2) + 2;
+    
+    memset(Dividend + Count, 0, sizeof(uint64_t) * ((PowerCount * 2) - Count));
+    if (Power->shift)
+    {
+        const uint64_t Overflow = CCBigIntComponentsShiftLeft(Dividend, a, Count, Power->shift);
+        if (Count < (PowerCount * 2)) Dividend[Count] = Overflow;
+    }
+    
+    else memcpy(Dividend, a, sizeof(uint64_t) * Count);
+    
+    CCBigIntComponentsMul(Estimate, Dividend + (PowerCount - 1), PowerCount + 1, Power->reciprocal, PowerCount + 1);
+    memcpy(Quotient, Estimate + (PowerCount + 1), sizeof(uint64_t) * (PowerCount + 1));
+    
+    CCBigIntComponentsMul(Product, Quotient, PowerCount + 1, Power->normalized, PowerCount);
+    CCBigIntComponentsSub(Remainder, Dividend, PowerCount + 1, Product, PowerCount + 1);
+    
+    const uint64_t One = 1;
+    while ((Remainder[PowerCount]) || (CCBigIntComponentsCompare(Remainder, PowerCount, Power->normalized, PowerCount) != CCComparisonResultAscending))
+    {
+        Remainder[PowerCount] -= CCBigIntComponentsSub(Remainder, Remainder, PowerCount, Power->normalized, PowerCount);
+        CCBigIntComponentsAdd(Quotient, Quotient, PowerCount + 1, &One, 1);
+    }
+    
+    if (Power->shift) CCBigIntComponentsShiftRight(Remainder, Remainder, PowerCount, Power->shift);
+    
+    CCFree(Temp);
+    
+    return TRUE;
+}
+
+/*!
+ * @brief Write the decimal digits of a value.
+ * @param String Where to write the 19 * 2^(Level + 1) digits of the value, padded with leading zeros.
+ * @param a The value. Must be less than 10^(19 * 2^(Level + 1)).
+ * @return Whether the digits could be written.
+ */
+static _Bool CCBigIntRadixFormat(char *String, const uint64_t *a, size_t Count, const CCBigIntRadixPower *Powers, size_t Level)
+{
+    const size_t Length = (size_t)CC_BIG_INT_DECIMAL_BASE_DIGITS << (Level + 1);
+    
+    while ((Count > 1) && (!a[Count - 1])) Count--;
+    
+    if (Count <= CC_BIG_INT_DECIMAL_THRESHOLD)
+    {
+        uint64_t Value[CC_BIG_INT_DECIMAL_THRESHOLD];
+        memcpy(Value, a, sizeof(uint64_t) * Count);
+        
+        size_t Index = Length;
+        while ((Count > 1) || (Value[0]))
+        {
+            uint64_t Digits = CCBigIntComponentsDivide1(Value, Value, Count, CC_BIG_INT_DECIMAL_BASE);
+            if (!Value[Count - 1]) Count--;
+            if (!Count) Count = 1;
+            
+            for (size_t Loop = 0; Loop < CC_BIG_INT_DECIMAL_BASE_DIGITS; Loop++)
+            {
+                String[--Index] = '0' + (Digits % 10);
+                Digits /= 10;
+            }
+        }
+        
+        memset(String, '0', Index);
+        
+        return TRUE;
+    }
+    
+    const size_t PowerCount = Powers[Level].count;
+    
+    uint64_t *Temp = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * ((PowerCount + 1) * 2), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Temp) return FALSE;
+    
+    uint64_t *Quotient = Temp, *Remainder = Temp + PowerCount + 1;
+    
+    const _Bool Done = CCBigIntRadixDivide(Powers + Level, Quotient, Remainder, a, Count) &&
+                       CCBigIntRadixFormat(String, Quotient, PowerCount + 1, Powers, Level - 1) &&
+                       CCBigIntRadixFormat(String + (Length / 2), Remainder, PowerCount + 1, Powers, Level - 1);
+    
+    CCFree(Temp);
+    
+    return Done;
+}
+
+static uint64_t CCBigIntParseDigits(const char *String, size_t Length)
+{
+    uint64_t Value = 0;
+    for (size_t Loop = 0; Loop < Length; Loop++) Value = (Value * 10) + (String[Loop] - '0');
+    
+    return Value;
+}
+
+/*!
+ * @brief Read the value of a decimal string.
+ * @param Result Where to store the ceil(Length / 19) components of the value.
+ * @param Length The number of digits. Must be less than or equal to 19 * 2^(Level + 1).
+ * @return The number of components in the value, or 0 on failure.
+ */
+static size_t CCBigIntRadixParse(uint64_t *Result, const char *String, size_t Length, const CCBigIntRadixPower *Powers, size_t Level)
+{
+    if (Length <= (CC_BIG_INT_DECIMAL_BASE_DIGITS * CC_BIG_INT_DECIMAL_THRESHOLD))
+    {
+        size_t Chunk = Length % CC_BIG_INT_DECIMAL_BASE_DIGITS, Count = 1;
+        if (!Chunk) Chunk = CC_BIG_INT_DECIMAL_BASE_DIGITS;
+        
+        Result[0] = CCBigIntParseDigits(String, Chunk);
+        
+        for (size_t Loop = Chunk; Loop < Length; Loop += CC_BIG_INT_DECIMAL_BASE_DIGITS)
+        {
+            const uint64_t Digits = CCBigIntParseDigits(String + Loop, CC_BIG_INT_DECIMAL_BASE_DIGITS);
+            uint64_t Carry = CCBigIntComponentsMul1(Result, Result, Count, CC_BIG_INT_DECIMAL_BASE);
+            
+            Carry += CCBigIntComponentsAdd(Result, Result, Count, &Digits, 1);
+            if (Carry) Result[Count++] = Carry;
+        }
+        
+        return Count;
+    }
+    
+    const size_t LowLength = (size_t)CC_BIG_INT_DECIMAL_BASE_DIGITS << Level;
+    if (Length <= LowLength) return CCBigIntRadixParse(Result, String, Length, Powers, Level - 1);
+    
+    const size_t HighLength = Length - LowLength, HighCapacity = (HighLength + CC_BIG_INT_DECIMAL_BASE_DIGITS - 1) / CC_BIG_INT_DECIMAL_BASE_DIGITS;
+    
+    uint64_t *High = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * (HighCapacity + ((size_t)1 << Level)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!High) return 0;
+    
+    uint64_t *Low = High + HighCapacity;
+    
+    size_t Count = 0;
+    const size_t HighCount = CCBigIntRadixParse(High, String, HighLength, Powers, Level - 1);
+    const size_t LowCount = HighCount ? CCBigIntRadixParse(Low, String + HighLength, LowLength, Powers, Level - 1) : 0;
+    
+    if (LowCount)
+    {
+        //High * 10^(19 * 2^Level) + Low, skipping the trailing zero components of the power
+        const CCBigIntRadixPower *Power = Powers + Level;
+        
+        memset(Result, 0, sizeof(uint64_t) * Power->zeros);
+        CCBigIntComponentsMul(Result + Power->zeros, High, HighCount, Power->value + Power->zeros, Power->count - Power->zeros);
+        
+        Count = HighCount + Power->count;
+        CCBigIntComponentsAdd(Result, Result, Count, Low, LowCount);
+        
+        while ((Count > 1) && (!Result[Count - 1])) Count--;
+    }
+    
+    CCFree(High);
+    
+    return Count;
+}
+
+#pragma mark - Storage
+
+static _Bool CCBigIntReserve(CCBigInt Integer, size_t Count)
+{
+    if (Count <= Integer->capacity) return TRUE;
+    
+    const size_t Capacity = Count < (Integer->capacity * 2) ? (Integer->capacity * 2) : Count;
+    
+    uint64_t *Value = CCRealloc(Integer->allocator, Integer->value, sizeof(uint64_t) * Capacity, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Value) return FALSE;
+    
+    Integer->value = Value;
+    Integer->capacity = Capacity;
+    
+    return TRUE;
+}
+
+static void CCBigIntNormalize(CCBigInt Integer)
+{
+    size_t Count = Integer->count;
+    while ((Count > 1) && (!Integer->value[Count - 1])) Count--;
+    
+    Integer->count = Count;
+    
+    if ((Count == 1) && (!Integer->value[0])) Integer->sign = FALSE;
+}
+
+static CC_FORCE_INLINE _Bool CCBigIntIsZero(CCBigInt Integer)
+{
+    return (Integer->count == 1) && (!Integer->value[0]);
+}
+
+static void CCBigIntDestructor(CCBigInt Ptr)
+{
+    CCFree(Ptr->value);
+}
+
+CCBigInt CCBigIntCreate(CCAllocatorType Allocator)
+{
+    CCBigInt Integer = CCMalloc(Allocator, sizeof(CCBigIntInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Integer)
+    {
+        *Integer = (CCBigIntInfo){
+            .allocator = Allocator,
+            .value = CCMalloc(Allocator, sizeof(uint64_t) * 4, NULL, CC_DEFAULT_ERROR_CALLBACK),
+            .count = 1,
+            .capacity = 4,
+            .sign = FALSE
+        };
+        
+        if (!Integer->value)
+        {
+            CCFree(Integer);
+            return NULL;
+        }
+        
+        Integer->value[0] = 0;
+        
+        CCMemorySetDestructor(Integer, (CCMemoryDestructorCallback)CCBigIntDestructor);
+    }
+    
+    
+    return Integer;
+}
+
+void CCBigIntDestroy(CCBigInt Integer)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCFree(Integer);
+}
+
+void CCBigIntSetBigInt(CCBigInt Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (Integer == Value) return;
+    
+    if (!CCBigIntReserve(Integer, Value->count)) return;
+    
+    memcpy(Integer->value, Value->value, sizeof(uint64_t) * Value->count);
+    Integer->count = Value->count;
+    Integer->sign = Value->sign;
+}
+
+void CCBigIntSetBigIntFast(CCBigInt Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntSet(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntSet(Integer, (CCBigInt)Value);
+}
+
+void CCBigIntSetInt(CCBigInt Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const int64_t Mask = Value >> 63;
+    
+    Integer->sign = Mask;
+    Integer->value[0] = (Value ^ Mask) - Mask;
+    Integer->count = 1;
+}
+
+void CCBigIntSetComponents(CCBigInt Integer, const uint64_t *Components, size_t Count, _Bool Sign)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Components || !Count, "Components must not be null");
+    
+    if (!Count)
+    {
+        CCBigIntSetInt(Integer, 0);
+        return;
+    }
+    
+    if (!CCBigIntReserve(Integer, Count)) return;
+    
+    memmove(Integer->value, Components, sizeof(uint64_t) * Count);
+    Integer->count = Count;
+    Integer->sign = Sign;
+    
+    CCBigIntNormalize(Integer);
+}
+
+static uint64_t CCBigIntParseHex(const char *String, size_t Length)
+{
+    uint64_t Value = 0;
+    for (size_t Loop = 0; Loop < Length; Loop++)
+    {
+        const char Chr = String[Loop];
+        
+        uint64_t Bits = 0;
+        if ((Chr >= '0') && (Chr <= '9')) Bits = Chr - '0';
+        else if ((Chr >= 'a') && (Chr <= 'f')) Bits = Chr - 'a' + 10;
+        else if ((Chr >= 'A') && (Chr <= 'F')) Bits = Chr - 'A' + 10;
+        else return Value;
+        
+        Value |= (Bits << ((Length - Loop - 1) * 4));
+    }
+    
+    return Value;
+}
+
+static void CCBigIntParse(CCBigInt Integer, const char *String, size_t Length)
+{
+    CCAssertLog(String, "String must not be null");
+    CCAssertLog(Length, "Length must not be 0");
+    
+    if (*String == '-')
+    {
+        Integer->sign = TRUE;
+        String++;
+        Length--;
+    }
+    
+    else Integer->sign = FALSE;
+    
+    if ((Length > 2) && (String[0] == '0') && (String[1] == 'x'))
+    {
+        String += 2;
+        Length -= 2;
+        
+        const size_t Count = (Length + 15) / 16;
+        if (!CCBigIntReserve(Integer, Count)) return;
+        
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const size_t End = Length - (Loop * 16), Start = End > 16 ? End - 16 : 0;
+            Integer->value[Loop] = CCBigIntParseHex(String + Start, End - Start);
+        }
+        
+        Integer->count = Count;
+        CCBigIntNormalize(Integer);
+    }
+    
+    else if ((Length) && (strspn(String, "0123456789") >= Length))
+    {
+        while ((Length > 1) && (*String == '0'))
+        {
+            String++;
+            Length--;
+        }
+        
+        const size_t Count = (Length + CC_BIG_INT_DECIMAL_BASE_DIGITS - 1) / CC_BIG_INT_DECIMAL_BASE_DIGITS;
+        if (!CCBigIntReserve(Integer, Count)) return;
+        
+        CCBigIntRadixPower Powers[64];
+        size_t Level = 0;
+        while (((size_t)CC_BIG_INT_DECIMAL_BASE_DIGITS << (Level + 1)) < Length) Level++;
+        
+        const _Bool Recursive = Length > (CC_BIG_INT_DECIMAL_BASE_DIGITS * CC_BIG_INT_DECIMAL_THRESHOLD);
+        if ((Recursive) && (!CCBigIntRadixPowersCreate(Powers, Level, FALSE))) return;
+        
+        Integer->count = CCBigIntRadixParse(Integer->value, String, Length, Powers, Level);
+        
+        if (Recursive) CCBigIntRadixPowersDestroy(Powers, Level);
+        
+        if (!Integer->count) CCBigIntSetInt(Integer, 0);
+        else CCBigIntNormalize(Integer);
+    }
+    
+    else
+    {
+        CCAssertLog(0, "Unsupported big integer format");
+        
+        CCBigIntSetInt(Integer, 0);
+    }
+}
+
+void CCBigIntSetString(CCBigInt Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    CC_STRING_TEMP_BUFFER(Buffer, Value)
+    {
+        CCBigIntParse(Integer, Buffer, CCStringGetSize(Value));
+    }
+}
+
+CCString CCBigIntGetString(CCBigInt Integer)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const size_t Count = Integer->count;
+    
+    char *String;
+    CC_SAFE_Malloc(String, sizeof(char) * ((Count * 16) + 4),
+                   return 0;
+                   );
+    
+    size_t Index = 0;
+    if (Integer->sign) String[Index++] = '-';
+    String[Index++] = '0';
+    String[Index++] = 'x';
+    
+    const char * const Hex = "0123456789abcdef";
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const uint64_t Value = Integer->value[Count - Loop - 1];
+        
+        for (size_t Loop2 = 0; Loop2 < 16; Loop2++)
+        {
+            String[Index++] = Hex[(Value >> (60 - (Loop2 * 4))) & 0xf];
+        }
+    }
+    
+    String[Index] = 0;
+    
+    return CCStringCreateWithSize(CC_STD_ALLOCATOR, CCStringEncodingASCII | CCStringHintFree, String, Index);
+}
+
+CCString CCBigIntGetDecimalString(CCBigInt Integer)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const size_t Count = Integer->count;
+    
+    //Find a level where the value is known to be less than 10^(19 * 2^(Level + 1)) > 2^(126 * 2^Level)
+    CCBigIntRadixPower Powers[64];
+    size_t Level = 0;
+    while ((Count * 64) > ((size_t)126 << Level)) Level++;
+    
+    const _Bool Recursive = Count > CC_BIG_INT_DECIMAL_THRESHOLD;
+    if ((Recursive) && (!CCBigIntRadixPowersCreate(Powers, Level, TRUE))) return 0;
+    
+    const size_t Length = (size_t)CC_BIG_INT_DECIMAL_BASE_DIGITS << (Level + 1);
+    
+    char *String;
+    CC_SAFE_Malloc(String, sizeof(char) * (Length + 2),
+                   if (Recursive) CCBigIntRadixPowersDestroy(Powers, Level);
+                   return 0;
+                   );
+    
+    const _Bool Done = CCBigIntRadixFormat(String + 1, Integer->value, Count, Powers, Level);
+    
+    if (Recursive) CCBigIntRadixPowersDestroy(Powers, Level);
+    
+    if (!Done)
+    {
+        CC_SAFE_Free(String);
+        
+        return 0;
+    }
+    
+    size_t Start = 1;
+    while ((Start < Length) && (String[Start] == '0')) Start++;
+    
+    size_t Index = 0;
+    if (Integer->sign) String[Index++] = '-';
+    
+    memmove(String + Index, String + Start, Length + 1 - Start);
+    Index += Length + 1 - Start;
+    String[Index] = 0;
+    
+    return CCStringCreateWithSize(CC_STD_ALLOCATOR, CCStringEncodingASCII | CCStringHintFree, String, Index);
+}
+
+#pragma mark - Comparisons
+
+CCComparisonResult CCBigIntCompareBigInt(CCBigInt a, CCBigInt b)
+{
+    CCAssertLog(a, "a must not be null");
+    CCAssertLog(b, "b must not be null");
+    
+    if (a == b) return CCComparisonResultEqual;
+    
+    if (a->sign != b->sign) return a->sign ? CCComparisonResultAscending : CCComparisonResultDescending;
+    
+    const CCComparisonResult Result = CCBigIntComponentsCompare(a->value, a->count, b->value, b->count);
+    
+    return a->sign ? CCComparisonResultFlipOrder(Result) : Result;
+}
+
+CCComparisonResult CCBigIntCompareBigIntFast(CCBigInt a, CCBigIntFast b)
+{
+    if (CCBigIntFastIsTaggedValue(b)) return CCBigIntCompare(a, CCBigIntFastGetTaggedValue(b));
+    
+    return CCBigIntCompare(a, (CCBigInt)b);
+}
+
+CCComparisonResult CCBigIntCompareInt(CCBigInt Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const int64_t Mask = Value >> 63;
+    const uint64_t AbsValue = (Value ^ Mask) - Mask;
+    
+    if (Integer->sign != (_Bool)Mask) return Integer->sign ? CCComparisonResultAscending : CCComparisonResultDescending;
+    
+    const CCComparisonResult Result = CCBigIntComponentsCompare(Integer->value, Integer->count, &AbsValue, 1);
+    
+    return Integer->sign ? CCComparisonResultFlipOrder(Result) : Result;
+}
+
+CCComparisonResult CCBigIntCompareString(CCBigInt Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    CCBigInt IntegerB = CCBigIntCreate(CC_STD_ALLOCATOR);
+    CCBigIntSet(IntegerB, Value);
+    const CCComparisonResult Result = CCBigIntCompare(Integer, IntegerB);
+    CCBigIntDestroy(IntegerB);
+    
+    return Result;
+}
+
+#pragma mark - Addition/Subtraction
+
+static void CCBigIntApplyAdd(CCBigInt Integer, const uint64_t *Value, size_t Count)
+{
+    const size_t IntegerCount = Integer->count, Max = IntegerCount < Count ? Count : IntegerCount;
+    
+    const _Bool Aliased = Value == Integer->value;
+    if (!CCBigIntReserve(Integer, Max + 1)) return;
+    if (Aliased) Value = Integer->value;
+    
+    uint64_t Carry;
+    if (IntegerCount >= Count) Carry = CCBigIntComponentsAdd(Integer->value, Integer->value, IntegerCount, Value, Count);
+    else Carry = CCBigIntComponentsAdd(Integer->value, Value, Count, Integer->value, IntegerCount);
+    
+    Integer->value[Max] = Carry;
+    Integer->count = Max + Carry;
+}
+
+static void CCBigIntApplySub(CCBigInt Integer, const uint64_t *Value, size_t Count)
+{
+    if (CCBigIntComponentsCompare(Integer->value, Integer->count, Value, Count) != CCComparisonResultAscending)
+    {
+        CCBigIntComponentsSub(Integer->value, Integer->value, Integer->count, Value, Count);
+    }
+    
+    else
+    {
+        if (!CCBigIntReserve(Integer, Count)) return;
+        
+        CCBigIntComponentsSub(Integer->value, Value, Count, Integer->value, Integer->count);
+        Integer->count = Count;
+        Integer->sign = !Integer->sign;
+    }
+    
+    CCBigIntNormalize(Integer);
+}
+
+void CCBigIntAddBigInt(CCBigInt Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (Integer->sign == Value->sign) CCBigIntApplyAdd(Integer, Value->value, Value->count);
+    else CCBigIntApplySub(Integer, Value->value, Value->count);
+}
+
+void CCBigIntAddBigIntFast(CCBigInt Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntAdd(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntAdd(Integer, (CCBigInt)Value);
+}
+
+void CCBigIntAddInt(CCBigInt Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const int64_t Mask = Value >> 63;
+    const uint64_t AbsValue = (Value ^ Mask) - Mask;
+    
+    if (Integer->sign == (_Bool)Mask) CCBigIntApplyAdd(Integer, &AbsValue, 1);
+    else CCBigIntApplySub(Integer, &AbsValue, 1);
+}
+
+void CCBigIntAddString(CCBigInt Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    CCBigInt Source = CCBigIntCreate(CC_STD_ALLOCATOR);
+    CCBigIntSet(Source, Value);
+    CCBigIntAdd(Integer, Source);
+    CCBigIntDestroy(Source);
+}
+
+void CCBigIntSubBigInt(CCBigInt Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (Integer->sign != Value->sign) CCBigIntApplyAdd(Integer, Value->value, Value->count);
+    else CCBigIntApplySub(Integer, Value->value, Value->count);
 }
 
 void CCBigIntSubBigIntFast(CCBigInt Integer, CCBigIntFast Value)
@@ -456,12 +1421,10 @@ void CCBigIntSubInt(CCBigInt Integer, int64_t Value)
     CCAssertLog(Integer, "Integer must not be null");
     
     const int64_t Mask = Value >> 63;
-    uint64_t AbsValue = (Value ^ Mask) - Mask;
-    
-    CCEnumerable Enumerable = CCEnumerableCreate(&AbsValue, sizeof(typeof(AbsValue)), 1);
+    const uint64_t AbsValue = (Value ^ Mask) - Mask;
     
-    if (Integer->sign != (_Bool)Mask) CCBigIntApplyAdd(Integer, &Enumerable);
-    else CCBigIntApplySub(Integer, &Enumerable);
+    if (Integer->sign != (_Bool)Mask) CCBigIntApplyAdd(Integer, &AbsValue, 1);
+    else CCBigIntApplySub(Integer, &AbsValue, 1);
 }
 
 void CCBigIntSubString(CCBigInt Integer, CCString Value)
@@ -473,3 +1436,444 @@ void CCBigIntSubString(CCBigInt Integer, CCString Value)
     CCBigIntSub(Integer, Source);
     CCBigIntDestroy(Source);
 }
+
+#pragma mark - Multiplication
+
+static void CCBigIntApplyMul(CCBigInt Integer, const uint64_t *Value, size_t Count, _Bool Sign)
+{
+    const size_t IntegerCount = Integer->count;
+    
+    if (Count == 1)
+    {
+        const uint64_t Factor = Value[0];
+        if (!CCBigIntReserve(Integer, IntegerCount + 1)) return;
+        
+        Integer->value[IntegerCount] = CCBigIntComponentsMul1(Integer->value, Integer->value, IntegerCount, Factor);
+        Integer->count = IntegerCount + 1;
+    }
+    
+    else if (IntegerCount == 1)
+    {
+        const uint64_t Factor = Integer->value[0];
+        if (!CCBigIntReserve(Integer, Count + 1)) return;
+        
+        Integer->value[Count] = CCBigIntComponentsMul1(Integer->value, Value, Count, Factor);
+        Integer->count = Count + 1;
+    }
+    
+    else
+    {
+        const size_t Capacity = IntegerCount + Count;
+        uint64_t *Result = CCMalloc(Integer->allocator, sizeof(uint64_t) * Capacity, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Result) return;
+        
+        CCBigIntComponentsMul(Result, Integer->value, IntegerCount, Value, Count);
+        
+        CCFree(Integer->value);
+        Integer->value = Result;
+        Integer->count = Capacity;
+        Integer->capacity = Capacity;
+    }
+    
+    Integer->sign = Integer->sign != Sign;
+    
+    CCBigIntNormalize(Integer);
+}
+
+void CCBigIntMulBigInt(CCBigInt Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    CCBigIntApplyMul(Integer, Value->value, Value->count, Value->sign);
+}
+
+void CCBigIntMulBigIntFast(CCBigInt Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntMul(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntMul(Integer, (CCBigInt)Value);
+}
+
+void CCBigIntMulInt(CCBigInt Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const int64_t Mask = Value >> 63;
+    const uint64_t AbsValue = (Value ^ Mask) - Mask;
+    
+    CCBigIntApplyMul(Integer, &AbsValue, 1, Mask);
+}
+
+void CCBigIntMulString(CCBigInt Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    CCBigInt Source = CCBigIntCreate(CC_STD_ALLOCATOR);
+    CCBigIntSet(Source, Value);
+    CCBigIntMul(Integer, Source);
+    CCBigIntDestroy(Source);
+}
+
+#pragma mark - Division
+
+/*!
+ * @brief Divide the integer by value.
+ * @param Integer The dividend.
+ * @param Quotient The big integer to store the quotient in. May be NULL or Integer.
+ * @param Remainder The big integer to store the remainder in. May be NULL or Integer.
+ */
+static void CCBigIntApplyDivide(CCBigInt Integer, const uint64_t *Value, size_t Count, _Bool Sign, CCBigInt Quotient, CCBigInt Remainder)
+{
+    CCAssertLog((Count > 1) || (Value[0]), "Value must not be zero");
+    
+    const size_t IntegerCount = Integer->count;
+    const _Bool IntegerSign = Integer->sign;
+    
+    if (CCBigIntComponentsCompare(Integer->value, IntegerCount, Value, Count) == CCComparisonResultAscending)
+    {
+        if (Remainder) CCBigIntSetBigInt(Remainder, Integer);
+        
+        if (Quotient) CCBigIntSetInt(Quotient, 0);
+        
+        return;
+    }
+    
+    const size_t QuotientCount = IntegerCount - Count + 1;
+    if ((Quotient) && (!CCBigIntReserve(Quotient, QuotientCount))) return;
+    if ((Remainder) && (!CCBigIntReserve(Remainder, Count))) return;
+    
+    if (!CCBigIntComponentsDivide(Quotient ? Quotient->value : NULL, Remainder ? Remainder->value : NULL, Integer->value, IntegerCount, Value, Count)) return;
+    
+    if (Quotient)
+    {
+        Quotient->count = QuotientCount;
+        Quotient->sign = IntegerSign != Sign;
+        
+        CCBigIntNormalize(Quotient);
+    }
+    
+    if (Remainder)
+    {
+        Remainder->count = Count;
+        Remainder->sign = IntegerSign;
+        
+        CCBigIntNormalize(Remainder);
+    }
+}
+
+void CCBigIntDivBigInt(CCBigInt Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    CCBigIntApplyDivide(Integer, Value->value, Value->count, Value->sign, Integer, NULL);
+}
+
+void CCBigIntDivBigIntFast(CCBigInt Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntDiv(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntDiv(Integer, (CCBigInt)Value);
+}
+
+void CCBigIntDivInt(CCBigInt Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const int64_t Mask = Value >> 63;
+    const uint64_t AbsValue = (Value ^ Mask) - Mask;
+    
+    CCBigIntApplyDivide(Integer, &AbsValue, 1, Mask, Integer, NULL);
+}
+
+void CCBigIntDivString(CCBigInt Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    CCBigInt Source = CCBigIntCreate(CC_STD_ALLOCATOR);
+    CCBigIntSet(Source, Value);
+    CCBigIntDiv(Integer, Source);
+    CCBigIntDestroy(Source);
+}
+
+void CCBigIntModBigInt(CCBigInt Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    CCBigIntApplyDivide(Integer, Value->value, Value->count, Value->sign, NULL, Integer);
+}
+
+void CCBigIntModBigIntFast(CCBigInt Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntMod(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntMod(Integer, (CCBigInt)Value);
+}
+
+void CCBigIntModInt(CCBigInt Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const int64_t Mask = Value >> 63;
+    const uint64_t AbsValue = (Value ^ Mask) - Mask;
+    
+    CCBigIntApplyDivide(Integer, &AbsValue, 1, Mask, NULL, Integer);
+}
+
+void CCBigIntModString(CCBigInt Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    CCBigInt Source = CCBigIntCreate(CC_STD_ALLOCATOR);
+    CCBigIntSet(Source, Value);
+    CCBigIntMod(Integer, Source);
+    CCBigIntDestroy(Source);
+}
+
+void CCBigIntDivMod(CCBigInt Integer, CCBigInt Value, CCBigInt Remainder)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Value, "Value must not be null");
+    CCAssertLog(Remainder, "Remainder must not be null");
+    CCAssertLog((Remainder != Integer) && (Remainder != Value), "Remainder must not be the same as Integer or Value");
+    
+    CCBigIntApplyDivide(Integer, Value->value, Value->count, Value->sign, Integer, Remainder);
+}
+
+#pragma mark - Shifts
+
+void CCBigIntShiftLeft(CCBigInt Integer, size_t Bits)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    if (CCBigIntIsZero(Integer)) return;
+    
+    const size_t Count = Integer->count, Components = Bits / 64;
+    const unsigned int Shift = Bits % 64;
+    
+    if (!CCBigIntReserve(Integer, Count + Components + 1)) return;
+    
+    uint64_t *Value = Integer->value;
+    const uint64_t Overflow = Shift ? CCBigIntComponentsShiftLeft(Value, Value, Count, Shift) : 0;
+    
+    if (Components)
+    {
+        memmove(Value + Components, Value, sizeof(uint64_t) * Count);
+        memset(Value, 0, sizeof(uint64_t) * Components);
+    }
+    
+    Value[Count + Components] = Overflow;
+    Integer->count = Count + Components + 1;
+    
+    CCBigIntNormalize(Integer);
+}
+
+void CCBigIntShiftRight(CCBigInt Integer, size_t Bits)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    
+    const size_t Components = Bits / 64;
+    const unsigned int Shift = Bits % 64;
+    
+    if (Components >= Integer->count)
+    {
+        CCBigIntSetInt(Integer, 0);
+        
+        return;
+    }
+    
+    const size_t Count = Integer->count - Components;
+    uint64_t *Value = Integer->value;
+    
+    if (Components) memmove(Value, Value + Components, sizeof(uint64_t) * Count);
+    if (Shift) CCBigIntComponentsShiftRight(Value, Value, Count, Shift);
+    
+    Integer->count = Count;
+    
+    CCBigIntNormalize(Integer);
+}
+
+#pragma mark - Modular Exponentiation
+
+#define CC_BIG_INT_POW_MOD_WINDOW 4
+
+typedef struct {
+    const uint64_t *modulus;
+    size_t count;
+    uint64_t inverse;
+    uint64_t *product;
+} CCBigIntModulus;
+
+static void CCBigIntModulusMul(const CCBigIntModulus *Modulus, uint64_t *Result, const uint64_t *a, const uint64_t *b)
+{
+    const size_t Count = Modulus->count;
+    uint64_t *Product = Modulus->product;
+    
+    CCBigIntComponentsMul(Product, a, Count, b, Count);
+    
+    if (Modulus->inverse)
+    {
+        //Montgomery reduction, Result = a * b * B^-Count mod m
+        uint64_t Carry = 0;
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const uint64_t Overflow = CCBigIntComponentsMulAdd1(Product + Loop, Modulus->modulus, Count, Product[Loop] * Modulus->inverse);
+            const uint64_t Sum = Product[Loop + Count] + Overflow, Total = Sum + Carry;
+            
+            Carry = (Sum < Overflow) + (Total < Sum);
+            Product[Loop + Count] = Total;
+        }
+        
+        if ((Carry) || (CCBigIntComponentsCompare(Product + Count, Count, Modulus->modulus, Count) != CCComparisonResultAscending))
+        {
+            CCBigIntComponentsSub(Result, Product + Count, Count, Modulus->modulus, Count);
+        }
+        
+        else memcpy(Result, Product + Count, sizeof(uint64_t) * Count);
+    }
+    
+    else CCBigIntComponentsDivide(NULL, Result, Product, Count * 2, Modulus->modulus, Count);
+}
+
+void CCBigIntPowMod(CCBigInt Integer, CCBigInt Exponent, CCBigInt Modulus)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(Exponent, "Exponent must not be null");
+    CCAssertLog(Modulus, "Modulus must not be null");
+    CCAssertLog((!Exponent->sign) || (CCBigIntIsZero(Exponent)), "Exponent must not be negative");
+    CCAssertLog(!CCBigIntIsZero(Modulus), "Modulus must not be zero");
+    
+    if ((Integer == Exponent) || (Integer == Modulus))
+    {
+        CCBigInt Base = CCBigIntCreate(CC_STD_ALLOCATOR);
+        CCBigIntSet(Base, Integer);
+        CCBigIntPowMod(Base, Exponent, Modulus);
+        CCBigIntSet(Integer, Base);
+        CCBigIntDestroy(Base);
+        
+        return;
+    }
+    
+    const size_t Count = Modulus->count;
+    const uint64_t *Components = Modulus->value;
+    
+    CCBigIntMod(Integer, Modulus);
+    
+    if ((Count == 1) && (Components[0] == 1))
+    {
+        CCBigIntSetInt(Integer, 0);
+        return;
+    }
+    
+    if (CCBigIntIsZero(Exponent))
+    {
+        CCBigIntSetInt(Integer, 1);
+        return;
+    }
+    
+    if (!CCBigIntReserve(Integer, Count)) return;
+    
+    if (Integer->sign)
+    {
+        CCBigIntComponentsSub(Integer->value, Components, Count, Integer->value, Integer->count);
+        Integer->sign = FALSE;
+    }
+    
+    else memset(Integer->value + Integer->count, 0, sizeof(uint64_t) * (Count - Integer->count));
+    
+    const size_t TableSize = 1 << CC_BIG_INT_POW_MOD_WINDOW;
+    uint64_t *Temp = CCMalloc(CC_STD_ALLOCATOR, sizeof(uint64_t) * ((Count * (TableSize + 4)) + 1), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Temp) return;
+    
+    uint64_t *Table = Temp, *Result = Table + (Count * TableSize);
+    CCBigIntModulus Context = {
+        .modulus = Components,
+        .count = Count,
+        .inverse = 0,
+        .product = Result + Count
+    };
+    
+    if (Components[0] & 1)
+    {
+        //Newton iteration for m^-1 mod 2^64, each step doubles the number of correct bits
+        uint64_t Inverse = Components[0];
+        for (size_t Loop = 0; Loop < 5; Loop++) Inverse *= 2 - (Components[0] * Inverse);
+        
+        Context.inverse = -Inverse;
+        
+        //B^(2 * Count) mod m, converts values into Montgomery form
+        uint64_t *Power = Context.product;
+        memset(Power, 0, sizeof(uint64_t) * Count * 2);
+        Power[Count * 2] = 1;
+        
+        CCBigIntComponentsDivide(NULL, Result, Power, (Count * 2) + 1, Components, Count);
+        
+        memset(Table, 0, sizeof(uint64_t) * Count);
+        Table[0] = 1;
+        
+        CCBigIntModulusMul(&Context, Table + Count, Integer->value, Result);
+        CCBigIntModulusMul(&Context, Table, Table, Result);
+    }
+    
+    else
+    {
+        memcpy(Table + Count, Integer->value, sizeof(uint64_t) * Count);
+        memset(Table, 0, sizeof(uint64_t) * Count);
+        Table[0] = 1;
+    }
+    
+    for (size_t Loop = 2; Loop < TableSize; Loop++)
+    {
+        CCBigIntModulusMul(&Context, Table + (Count * Loop), Table + (Count * (Loop - 1)), Table + Count);
+    }
+    
+    //Fixed window exponentiation, most significant window first
+    const size_t Bits = (Exponent->count * 64) - __builtin_clzll(Exponent->value[Exponent->count - 1]);
+    
+    for (size_t Window = (Bits + CC_BIG_INT_POW_MOD_WINDOW - 1) / CC_BIG_INT_POW_MOD_WINDOW, Started = FALSE; Window--; )
+    {
+        size_t Digit = 0;
+        for (size_t Loop = CC_BIG_INT_POW_MOD_WINDOW; Loop--; )
+        {
+            const size_t Bit = (Window * CC_BIG_INT_POW_MOD_WINDOW) + Loop;
+            
+            Digit = (Digit << 1) | (Bit < Bits ? (Exponent->value[Bit / 64] >> (Bit % 64)) & 1 : 0);
+            
+            if (Started) CCBigIntModulusMul(&Context, Result, Result, Result);
+        }
+        
+        if (Started)
+        {
+            if (Digit) CCBigIntModulusMul(&Context, Result, Result, Table + (Count * Digit));
+        }
+        
+        else
+        {
+            memcpy(Result, Table + (Count * Digit), sizeof(uint64_t) * Count);
+            Started = TRUE;
+        }
+    }
+    
+    if (Context.inverse)
+    {
+        memset(Table, 0, sizeof(uint64_t) * Count);
+        Table[0] = 1;
+        
+        CCBigIntModulusMul(&Context, Result, Result, Table);
+    }
+    
+    memcpy(Integer->value, Result, sizeof(uint64_t) * Count);
+    Integer->count = Count;
+    
+    CCBigIntNormalize(Integer);
+    
+    CCFree(Temp);
+}
@@ -31,10 +31,48 @@
 #include <CommonC/Generics.h>
 #include <CommonC/Maths.h>
 #include <CommonC/CCString.h>
-#include <CommonC/List.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Assertion.h>
+
+/*!
+ * @define CC_BIG_INT_KARATSUBA_THRESHOLD
+ * @abstract The number of components at which multiplication switches from schoolbook to Karatsuba.
+ */
+#ifndef CC_BIG_INT_KARATSUBA_THRESHOLD
+#define CC_BIG_INT_KARATSUBA_THRESHOLD 24
+#endif
+
+/*!
+ * @define CC_BIG_INT_TOOM3_THRESHOLD
+ * @abstract The number of components at which multiplication switches from Karatsuba to Toom-3.
+ */
+#ifndef CC_BIG_INT_TOOM3_THRESHOLD
+#define CC_BIG_INT_TOOM3_THRESHOLD 128
+#endif
+
+/*!
+ * @define CC_BIG_INT_RECIPROCAL_THRESHOLD
+ * @abstract The number of components at which decimal conversion switches from long division to
+ *           division by a precomputed reciprocal.
+ */
+#ifndef CC_BIG_INT_RECIPROCAL_THRESHOLD
+#define CC_BIG_INT_RECIPROCAL_THRESHOLD 64
+#endif
+
+/*!
+ * @define CC_BIG_INT_DECIMAL_THRESHOLD
+ * @abstract The number of components at which decimal conversion switches from repeated
+ *           multiplication/division by 10^19 to divide and conquer.
+ */
+#ifndef CC_BIG_INT_DECIMAL_THRESHOLD
+#define CC_BIG_INT_DECIMAL_THRESHOLD 32
+#endif
 
 typedef struct CCBigIntInfo {
-    CCList(uint64_t) value;
+    CCAllocatorType allocator;
+    uint64_t *value;
+    size_t count;
+    size_t capacity;
     _Bool sign;
 } CCBigIntInfo;
 
@@ -105,7 +143,7 @@ static CC_FORCE_INLINE _Bool CCBigIntGetSign(CCBigInt Integer);
  *
  *        @b CCBigIntFast - to set the integer to the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  */
@@ -120,6 +158,17 @@ void CCBigIntSetBigIntFast(CCBigInt Integer, CCBigIntFast Value);
 void CCBigIntSetInt(CCBigInt Integer, int64_t Value);
 void CCBigIntSetString(CCBigInt Integer, CCString Value);
 
+/*!
+ * @brief Set the big integer to the value represented by the given components.
+ * @param Integer The big integer to be set.
+ * @param Components The components of the value. The lower the index the less significant the
+ *        component is to the overall value.
+ *
+ * @param Count The number of components.
+ * @param Sign Whether the value is negative.
+ */
+void CCBigIntSetComponents(CCBigInt Integer, const uint64_t *Components, size_t Count, _Bool Sign);
+
 /*!
  * @brief Get a hexadecimal string representation of the big integer.
  * @param Integer The big integer to convert to a string.
@@ -127,6 +176,13 @@ void CCBigIntSetString(CCBigInt Integer, CCString Value);
  */
 CC_NEW CCString CCBigIntGetString(CCBigInt Integer);
 
+/*!
+ * @brief Get a decimal string representation of the big integer.
+ * @param Integer The big integer to convert to a string.
+ * @return The decimal string. Must be destroyed to free the memory.
+ */
+CC_NEW CCString CCBigIntGetDecimalString(CCBigInt Integer);
+
 #pragma mark - Comparisons
 
 /*!
@@ -137,7 +193,7 @@ CC_NEW CCString CCBigIntGetString(CCBigInt Integer);
  *
  *        @b CCBigInt - to compare an integer to the value represented by another big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  *
@@ -211,7 +267,7 @@ CCComparisonResult CCBigIntCompareString(CCBigInt a, CCString b);
  *
  *        @b CCBigIntFast - to add an integer to the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  */
@@ -236,7 +292,7 @@ void CCBigIntAddString(CCBigInt Integer, CCString Value);
  *
  *        @b CCBigIntFast - to subtract an integer from the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  */
@@ -251,20 +307,142 @@ void CCBigIntSubBigIntFast(CCBigInt Integer, CCBigIntFast Value);
 void CCBigIntSubInt(CCBigInt Integer, int64_t Value);
 void CCBigIntSubString(CCBigInt Integer, CCString Value);
 
+/*!
+ * @define CCBigIntMul
+ * @abstract Generic macro to multiply the big integer by value.
+ * @description Uses schoolbook multiplication for small integers, and Karatsuba or Toom-3 once the
+ *              operands reach @b CC_BIG_INT_KARATSUBA_THRESHOLD or @b CC_BIG_INT_TOOM3_THRESHOLD
+ *              components.
+ *
+ * @param Integer The big integer to apply and store the result of the multiplication.
+ * @param Value The value to multiply the big integer by. The following types are allowed as inputs:
+ *
+ *        @b CCBigInt - to multiply an integer by the value represented by another big integer.
+ *
+ *        @b CCBigIntFast - to multiply an integer by the value represented by another fast big integer.
+ *
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
+ *
+ *        Otherwise will default to an @b int64_t.
+ */
+#define CCBigIntMul(integer, value) CC_GENERIC_EVALUATE(value, \
+CCBigInt: CCBigIntMulBigInt, \
+CCBigIntFast: CCBigIntMulBigIntFast, \
+CCString: CCBigIntMulString, \
+default: CCBigIntMulInt)(integer, value)
+
+void CCBigIntMulBigInt(CCBigInt Integer, CCBigInt Value);
+void CCBigIntMulBigIntFast(CCBigInt Integer, CCBigIntFast Value);
+void CCBigIntMulInt(CCBigInt Integer, int64_t Value);
+void CCBigIntMulString(CCBigInt Integer, CCString Value);
+
+/*!
+ * @define CCBigIntDiv
+ * @abstract Generic macro to divide the big integer by value.
+ * @description The quotient is truncated towards zero.
+ * @param Integer The big integer to apply and store the result of the division.
+ * @param Value The value to divide the big integer by. Must not be zero. The following types are
+ *        allowed as inputs:
+ *
+ *        @b CCBigInt - to divide an integer by the value represented by another big integer.
+ *
+ *        @b CCBigIntFast - to divide an integer by the value represented by another fast big integer.
+ *
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
+ *
+ *        Otherwise will default to an @b int64_t.
+ */
+#define CCBigIntDiv(integer, value) CC_GENERIC_EVALUATE(value, \
+CCBigInt: CCBigIntDivBigInt, \
+CCBigIntFast: CCBigIntDivBigIntFast, \
+CCString: CCBigIntDivString, \
+default: CCBigIntDivInt)(integer, value)
+
+void CCBigIntDivBigInt(CCBigInt Integer, CCBigInt Value);
+void CCBigIntDivBigIntFast(CCBigInt Integer, CCBigIntFast Value);
+void CCBigIntDivInt(CCBigInt Integer, int64_t Value);
+void CCBigIntDivString(CCBigInt Integer, CCString Value);
+
+/*!
+ * @define CCBigIntMod
+ * @abstract Generic macro to get the remainder of the big integer divided by value.
+ * @description The remainder takes the sign of the dividend, matching the behaviour of C's % operator.
+ * @param Integer The big integer to apply and store the remainder.
+ * @param Value The value to divide the big integer by. Must not be zero. The following types are
+ *        allowed as inputs:
+ *
+ *        @b CCBigInt - to divide an integer by the value represented by another big integer.
+ *
+ *        @b CCBigIntFast - to divide an integer by the value represented by another fast big integer.
+ *
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
+ *
+ *        Otherwise will default to an @b int64_t.
+ */
+#define CCBigIntMod(integer, value) CC_GENERIC_EVALUATE(value, \
+CCBigInt: CCBigIntModBigInt, \
+CCBigIntFast: CCBigIntModBigIntFast, \
+CCString: CCBigIntModString, \
+default: CCBigIntModInt)(integer, value)
+
+void CCBigIntModBigInt(CCBigInt Integer, CCBigInt Value);
+void CCBigIntModBigIntFast(CCBigInt Integer, CCBigIntFast Value);
+void CCBigIntModInt(CCBigInt Integer, int64_t Value);
+void CCBigIntModString(CCBigInt Integer, CCString Value);
+
+/*!
+ * @brief Divide the big integer by value, producing both the quotient and remainder.
+ * @description Has the same semantics as @b CCBigIntDiv and @b CCBigIntMod, but only performs the
+ *              division once.
+ *
+ * @param Integer The big integer to divide and store the quotient.
+ * @param Value The big integer to divide by. Must not be zero.
+ * @param Remainder The big integer to store the remainder. Must not be the same as Integer or Value.
+ */
+void CCBigIntDivMod(CCBigInt Integer, CCBigInt Value, CCBigInt Remainder);
+
+/*!
+ * @brief Shift the magnitude of the big integer left.
+ * @param Integer The big integer to be shifted.
+ * @param Bits The number of bits to shift by.
+ */
+void CCBigIntShiftLeft(CCBigInt Integer, size_t Bits);
+
+/*!
+ * @brief Shift the magnitude of the big integer right.
+ * @description This is equivalent to dividing by 2^Bits and truncating towards zero.
+ * @param Integer The big integer to be shifted.
+ * @param Bits The number of bits to shift by.
+ */
+void CCBigIntShiftRight(CCBigInt Integer, size_t Bits);
+
+/*!
+ * @brief Raise the big integer to a power modulo another big integer.
+ * @description Uses Montgomery multiplication when the modulus is odd.
+ * @param Integer The big integer to be used as the base and store the result. The result will be
+ *        in the range of 0 to |Modulus| - 1.
+ *
+ * @param Exponent The exponent. Must not be negative.
+ * @param Modulus The modulus. Must not be zero.
+ */
+void CCBigIntPowMod(CCBigInt Integer, CCBigInt Exponent, CCBigInt Modulus);
+
 #pragma mark -
 
 static CC_FORCE_INLINE uint64_t CCBigIntGetComponent(CCBigInt Integer, size_t Index)
 {
     CCAssertLog(Integer, "Integer must not be null");
     
-    return *(uint64_t*)CCListGetElementAtIndex(Integer->value, Index);
+    CCAssertLog(Index < Integer->count, "Index must not exceed component count");
+    
+    return Integer->value[Index];
 }
 
 static CC_FORCE_INLINE size_t CCBigIntGetComponentCount(CCBigInt Integer)
 {
     CCAssertLog(Integer, "Integer must not be null");
     
-    return CCListGetCount(Integer->value);
+    return Integer->count;
 }
 
 static CC_FORCE_INLINE _Bool CCBigIntGetSign(CCBigInt Integer)
@@ -128,7 +128,7 @@ static inline _Bool CCBigIntFastGetSign(CCBigIntFast Integer);
  *
  *        @b CCBigIntFast - to set the integer to the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  */
@@ -158,6 +158,13 @@ static inline CC_NEW CCBigInt CCBigIntFastGetBigInt(CCBigIntFast Integer);
  */
 static inline CC_NEW CCString CCBigIntFastGetString(CCBigIntFast Integer);
 
+/*!
+ * @brief Get a decimal string representation of the fast big integer.
+ * @param Integer The big integer to convert to a string.
+ * @return The decimal string. Must be destroyed to free the memory.
+ */
+static inline CC_NEW CCString CCBigIntFastGetDecimalString(CCBigIntFast Integer);
+
 #pragma mark - Comparisons
 
 /*!
@@ -170,7 +177,7 @@ static inline CC_NEW CCString CCBigIntFastGetString(CCBigIntFast Integer);
  *
  *        @b CCBigIntFast - to compare an integer to the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  *
@@ -244,7 +251,7 @@ static inline CCComparisonResult CCBigIntFastCompareString(CCBigIntFast a, CCStr
  *
  *        @b CCBigIntFast - to add an integer to the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  */
@@ -269,7 +276,7 @@ static inline void CCBigIntFastAddString(CCBigIntFast *Integer, CCString Value);
  *
  *        @b CCBigIntFast - to subtract an integer from the value represented by another fast big integer.
  *
- *        @b CCString - a hexadecimal formatted string.
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
  *
  *        Otherwise will default to an @b int64_t.
  */
@@ -284,6 +291,85 @@ static inline void CCBigIntFastSubBigIntFast(CCBigIntFast *Integer, CCBigIntFast
 static inline void CCBigIntFastSubInt(CCBigIntFast *Integer, int64_t Value);
 static inline void CCBigIntFastSubString(CCBigIntFast *Integer, CCString Value);
 
+/*!
+ * @define CCBigIntFastMul
+ * @abstract Generic macro to multiply the big integer by value.
+ * @param Integer The big integer to apply and store the result of the multiplication.
+ * @param Value The value to multiply the big integer by. The following types are allowed as inputs:
+ *
+ *        @b CCBigInt - to multiply an integer by the value represented by another big integer.
+ *
+ *        @b CCBigIntFast - to multiply an integer by the value represented by another fast big integer.
+ *
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
+ *
+ *        Otherwise will default to an @b int64_t.
+ */
+#define CCBigIntFastMul(integer, value) CC_GENERIC_EVALUATE(value, \
+CCBigInt: CCBigIntFastMulBigInt, \
+CCBigIntFast: CCBigIntFastMulBigIntFast, \
+CCString: CCBigIntFastMulString, \
+default: CCBigIntFastMulInt)(integer, value)
+
+static inline void CCBigIntFastMulBigInt(CCBigIntFast *Integer, CCBigInt Value);
+static inline void CCBigIntFastMulBigIntFast(CCBigIntFast *Integer, CCBigIntFast Value);
+static inline void CCBigIntFastMulInt(CCBigIntFast *Integer, int64_t Value);
+static inline void CCBigIntFastMulString(CCBigIntFast *Integer, CCString Value);
+
+/*!
+ * @define CCBigIntFastDiv
+ * @abstract Generic macro to divide the big integer by value.
+ * @description The quotient is truncated towards zero.
+ * @param Integer The big integer to apply and store the result of the division.
+ * @param Value The value to divide the big integer by. Must not be zero. The following types are
+ *        allowed as inputs:
+ *
+ *        @b CCBigInt - to divide an integer by the value represented by another big integer.
+ *
+ *        @b CCBigIntFast - to divide an integer by the value represented by another fast big integer.
+ *
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
+ *
+ *        Otherwise will default to an @b int64_t.
+ */
+#define CCBigIntFastDiv(integer, value) CC_GENERIC_EVALUATE(value, \
+CCBigInt: CCBigIntFastDivBigInt, \
+CCBigIntFast: CCBigIntFastDivBigIntFast, \
+CCString: CCBigIntFastDivString, \
+default: CCBigIntFastDivInt)(integer, value)
+
+static inline void CCBigIntFastDivBigInt(CCBigIntFast *Integer, CCBigInt Value);
+static inline void CCBigIntFastDivBigIntFast(CCBigIntFast *Integer, CCBigIntFast Value);
+static inline void CCBigIntFastDivInt(CCBigIntFast *Integer, int64_t Value);
+static inline void CCBigIntFastDivString(CCBigIntFast *Integer, CCString Value);
+
+/*!
+ * @define CCBigIntFastMod
+ * @abstract Generic macro to get the remainder of the big integer divided by value.
+ * @description The remainder takes the sign of the dividend, matching the behaviour of C's % operator.
+ * @param Integer The big integer to apply and store the remainder.
+ * @param Value The value to divide the big integer by. Must not be zero. The following types are
+ *        allowed as inputs:
+ *
+ *        @b CCBigInt - to divide an integer by the value represented by another big integer.
+ *
+ *        @b CCBigIntFast - to divide an integer by the value represented by another fast big integer.
+ *
+ *        @b CCString - a hexadecimal (0x prefixed) or decimal formatted string.
+ *
+ *        Otherwise will default to an @b int64_t.
+ */
+#define CCBigIntFastMod(integer, value) CC_GENERIC_EVALUATE(value, \
+CCBigInt: CCBigIntFastModBigInt, \
+CCBigIntFast: CCBigIntFastModBigIntFast, \
+CCString: CCBigIntFastModString, \
+default: CCBigIntFastModInt)(integer, value)
+
+static inline void CCBigIntFastModBigInt(CCBigIntFast *Integer, CCBigInt Value);
+static inline void CCBigIntFastModBigIntFast(CCBigIntFast *Integer, CCBigIntFast Value);
+static inline void CCBigIntFastModInt(CCBigIntFast *Integer, int64_t Value);
+static inline void CCBigIntFastModString(CCBigIntFast *Integer, CCString Value);
+
 #pragma mark -
 static inline CCBigIntFast CCBigIntFastCreate(CCAllocatorType Allocator)
 {
@@ -434,6 +520,20 @@ static inline CCString CCBigIntFastGetString(CCBigIntFast Integer)
     else return CCBigIntGetString((CCBigInt)Integer);
 }
 
+static inline CCString CCBigIntFastGetDecimalString(CCBigIntFast Integer)
+{
+    if (CCBigIntFastIsTaggedValue(Integer))
+    {
+        CCBigInt Temp = CCBigIntFastGetBigInt(Integer);
+        CCString String = CCBigIntGetDecimalString((CCBigInt)Temp);
+        CCBigIntDestroy(Temp);
+        
+        return String;
+    }
+    
+    else return CCBigIntGetDecimalString((CCBigInt)Integer);
+}
+
 static inline CCComparisonResult CCBigIntFastCompareBigInt(CCBigIntFast a, CCBigInt b)
 {
     return CCComparisonResultFlipOrder(CCBigIntCompare(b, a));
@@ -666,6 +766,215 @@ static inline void CCBigIntFastSubString(CCBigIntFast *Integer, CCString Value)
     else CCBigIntSub((CCBigInt)*Integer, Value);
 }
 
+static inline void CCBigIntFastMulBigInt(CCBigIntFast *Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        if (CCBigIntGetComponentCount(Value) == 1)
+        {
+            const uint64_t Component = CCBigIntGetComponent(Value, 0);
+            if ((Component & ~INT64_MAX) == 0)
+            {
+                CCBigIntFastMul(Integer, CCBigIntGetSign(Value) ? -Component : Component);
+                return;
+            }
+        }
+        
+        const int64_t IntegerValue = CCBigIntFastGetTaggedValue(*Integer);
+        
+        *Integer = (CCBigIntFast)CCBigIntCreate(CC_STD_ALLOCATOR);
+        CCBigIntSet((CCBigInt)*Integer, IntegerValue);
+    }
+    
+    CCBigIntMul((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastMulBigIntFast(CCBigIntFast *Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntFastMul(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntFastMul(Integer, (CCBigInt)Value);
+}
+
+static inline void CCBigIntFastMulInt(CCBigIntFast *Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        const int64_t IntegerValue = CCBigIntFastGetTaggedValue(*Integer);
+        
+        int64_t Result;
+        if ((!__builtin_mul_overflow(IntegerValue, Value, &Result)) && (Result <= CC_BIG_INT_FAST_TAGGED_MAX) && (Result >= CC_BIG_INT_FAST_TAGGED_MIN))
+        {
+            *Integer = CCBigIntFastTaggedValue(Result);
+            
+            return;
+        }
+        
+        *Integer = (CCBigIntFast)CCBigIntCreate(CC_STD_ALLOCATOR);
+        CCBigIntSet((CCBigInt)*Integer, IntegerValue);
+    }
+    
+    CCBigIntMul((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastMulString(CCBigIntFast *Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        CCBigInt ValueB = CCBigIntCreate(CC_STD_ALLOCATOR);
+        CCBigIntSet(ValueB, Value);
+        CCBigIntFastMul(Integer, ValueB);
+        CCBigIntDestroy(ValueB);
+    }
+    
+    else CCBigIntMul((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastDivBigInt(CCBigIntFast *Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        if (CCBigIntGetComponentCount(Value) == 1)
+        {
+            const uint64_t Component = CCBigIntGetComponent(Value, 0);
+            if ((Component & ~INT64_MAX) == 0)
+            {
+                CCBigIntFastDiv(Integer, CCBigIntGetSign(Value) ? -Component : Component);
+                return;
+            }
+        }
+        
+        //The magnitude of Value is larger than any tagged value
+        *Integer = CC_BIG_INT_FAST_0;
+        
+        return;
+    }
+    
+    CCBigIntDiv((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastDivBigIntFast(CCBigIntFast *Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntFastDiv(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntFastDiv(Integer, (CCBigInt)Value);
+}
+
+static inline void CCBigIntFastDivInt(CCBigIntFast *Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be zero");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        *Integer = CCBigIntFastTaggedValue(CCBigIntFastGetTaggedValue(*Integer) / Value);
+        
+        return;
+    }
+    
+    CCBigIntDiv((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastDivString(CCBigIntFast *Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        CCBigInt ValueB = CCBigIntCreate(CC_STD_ALLOCATOR);
+        CCBigIntSet(ValueB, Value);
+        CCBigIntFastDiv(Integer, ValueB);
+        CCBigIntDestroy(ValueB);
+    }
+    
+    else CCBigIntDiv((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastModBigInt(CCBigIntFast *Integer, CCBigInt Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        if (CCBigIntGetComponentCount(Value) == 1)
+        {
+            const uint64_t Component = CCBigIntGetComponent(Value, 0);
+            if ((Component & ~INT64_MAX) == 0) CCBigIntFastMod(Integer, CCBigIntGetSign(Value) ? -Component : Component);
+        }
+        
+        //Otherwise the magnitude of Value is larger than any tagged value, so it is the remainder
+        return;
+    }
+    
+    CCBigIntMod((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastModBigIntFast(CCBigIntFast *Integer, CCBigIntFast Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be null");
+    
+    if (CCBigIntFastIsTaggedValue(Value)) CCBigIntFastMod(Integer, CCBigIntFastGetTaggedValue(Value));
+    else CCBigIntFastMod(Integer, (CCBigInt)Value);
+}
+
+static inline void CCBigIntFastModInt(CCBigIntFast *Integer, int64_t Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    CCAssertLog(Value, "Value must not be zero");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        *Integer = CCBigIntFastTaggedValue(CCBigIntFastGetTaggedValue(*Integer) % Value);
+        
+        return;
+    }
+    
+    CCBigIntMod((CCBigInt)*Integer, Value);
+}
+
+static inline void CCBigIntFastModString(CCBigIntFast *Integer, CCString Value)
+{
+    CCAssertLog(Integer, "Integer must not be null");
+    CCAssertLog(*Integer, "Integer must not point to null");
+    
+    if (CCBigIntFastIsTaggedValue(*Integer))
+    {
+        CCBigInt ValueB = CCBigIntCreate(CC_STD_ALLOCATOR);
+        CCBigIntSet(ValueB, Value);
+        CCBigIntFastMod(Integer, ValueB);
+        CCBigIntDestroy(ValueB);
+    }
+    
+    else CCBigIntMod((CCBigInt)*Integer, Value);
+}
+
 #pragma mark -
 
 #define CC_TYPE_CCBigIntFast(...) CCBigIntFast
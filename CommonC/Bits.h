@@ -23,6 +23,12 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <CommonC/Platform.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON || CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <CommonC/Simd.h>
+#endif
+
 //generic_imp.rb: -pc 1 -n 'CC_BITS' -t CommonC/BitsTemplate.h -th '<CommonC/BitsTemplate.h>' -m 'Tbase' 'T=PTYPE(Tbase *)'
 #ifndef T
 #define T PTYPE(Tbase *)
@@ -44,6 +50,10 @@
 #define CCBitsAnd(seta, setb, index, count) CCBitsAnd_Ref(seta, setb, index, count)(seta, setb, index, count)
 #define CCBitsXor(seta, setb, index, count) CCBitsXor_Ref(seta, setb, index, count)(seta, setb, index, count)
 #define CCBitsCopy(seta, setb, index, count) CCBitsCopy_Ref(seta, setb, index, count)(seta, setb, index, count)
+#define CCBitsFindFirstSet(set, index, count) CCBitsFindFirstSet_Ref(set, index, count)(set, index, count)
+#define CCBitsFindFirstClear(set, index, count) CCBitsFindFirstClear_Ref(set, index, count)(set, index, count)
+#define CCBitsFindLastSet(set, index, count) CCBitsFindLastSet_Ref(set, index, count)(set, index, count)
+#define CCBitsFindLastClear(set, index, count) CCBitsFindLastClear_Ref(set, index, count)(set, index, count)
 
 #define CCBitsGet_Ref(set, index) CC_GENERIC((((typeof(set)){0})), CCBitsGet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
 #define CCBitsSet_Ref(set, index) CC_GENERIC((((typeof(set)){0})), CCBitsSet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
@@ -59,6 +69,10 @@
 #define CCBitsAnd_Ref(seta, setb, index, count) CC_GENERIC((((typeof(seta)){0})), CCBitsAnd_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
 #define CCBitsXor_Ref(seta, setb, index, count) CC_GENERIC((((typeof(seta)){0})), CCBitsXor_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
 #define CCBitsCopy_Ref(seta, setb, index, count) CC_GENERIC((((typeof(seta)){0})), CCBitsCopy_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
+#define CCBitsFindFirstSet_Ref(set, index, count) CC_GENERIC((((typeof(set)){0})), CCBitsFindFirstSet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
+#define CCBitsFindFirstClear_Ref(set, index, count) CC_GENERIC((((typeof(set)){0})), CCBitsFindFirstClear_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
+#define CCBitsFindLastSet_Ref(set, index, count) CC_GENERIC((((typeof(set)){0})), CCBitsFindLastSet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
+#define CCBitsFindLastClear_Ref(set, index, count) CC_GENERIC((((typeof(set)){0})), CCBitsFindLastClear_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_BITS_T))
 
 #define CC_BITS_T CC_GENERIC_INDEXED_TYPE_LIST(CC_BITS_T, CC_BITS_COUNT)
 
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "BitsEnumerable.h"
+
+void *CCBitsEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableAction Action)
+{
+    uint8_t *Set = Enumerator->state.internal.ptr;
+    const size_t Index = Enumerator->state.internal.extra[1], Count = Enumerator->state.internal.extra[2];
+    size_t *Current = (size_t*)&Enumerator->state.internal.extra[0];
+    
+    switch (Action)
+    {
+        case CCEnumerableActionHead:
+            *Current = CCBitsFindFirstSet(Set, Index, Count);
+            break;
+            
+        case CCEnumerableActionTail:
+            *Current = CCBitsFindLastSet(Set, Index, Count);
+            break;
+            
+        case CCEnumerableActionNext:
+            if (*Current != SIZE_MAX) *Current = CCBitsFindFirstSet(Set, *Current + 1, (Index + Count) - (*Current + 1));
+            break;
+            
+        case CCEnumerableActionPrevious:
+            if (*Current != SIZE_MAX) *Current = CCBitsFindLastSet(Set, Index, *Current - Index);
+            break;
+            
+        case CCEnumerableActionCurrent:
+            break;
+    }
+    
+    return *Current != SIZE_MAX ? Current : NULL;
+}
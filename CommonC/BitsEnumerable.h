@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_BitsEnumerable_h
+#define CommonC_BitsEnumerable_h
+
+#include <CommonC/Enumerable.h>
+#include <CommonC/BitSets.h>
+#include <CommonC/Assertion.h>
+
+
+/*!
+ * @brief Create an enumerable for the set bits of an array of bits.
+ * @description Each value of the enumerable is a pointer to a @b size_t containing the index of the
+ *              set bit. Enumerating skips over clear bits a word at a time.
+ *
+ * @param Set The array of bits. This must remain unchanged for the lifetime of the enumerable.
+ * @param Index The index of the first bit in the range to be enumerated.
+ * @param Count The number of bits in the range to be enumerated.
+ * @return The enumerable.
+ */
+static CC_FORCE_INLINE CCEnumerable CCBitsEnumerableCreate(const void *Set, size_t Index, size_t Count);
+
+void *CCBitsEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableAction Action);
+
+#pragma mark -
+
+static CC_FORCE_INLINE CCEnumerable CCBitsEnumerableCreate(const void *Set, size_t Index, size_t Count)
+{
+    CCAssertLog(Set || !Count, "Set must not be null");
+    
+    CCEnumerable Enumerable = {
+        .handler = CCBitsEnumerableHandler,
+        .enumerator = {
+            .ref = (void*)Set,
+            .state = {
+                .internal = {
+                    .ptr = (void*)Set,
+                    .extra = { SIZE_MAX, Index, Count }
+                },
+                .type = CCEnumeratorFormatInternal
+            }
+        }
+    };
+    
+    CCBitsEnumerableHandler(&Enumerable.enumerator, CCEnumerableActionHead);
+    
+    return Enumerable;
+}
+
+#endif
@@ -0,0 +1,273 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BitsRankSelect.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "BitTricks.h"
+#include "Maths.h"
+#include "Swap.h"
+#include "HardwareInfo.h"
+#include <string.h>
+#include <stdatomic.h>
+
+#if (CC_HARDWARE_ARCH_X86 || CC_HARDWARE_ARCH_X86_64) && __has_attribute(target)
+#include <immintrin.h>
+#define CC_BITS_RANK_SELECT_X86_DISPATCH 1
+#endif
+
+#define CC_BITS_RANK_SELECT_BLOCK_WORDS 8
+#define CC_BITS_RANK_SELECT_BLOCK_BITS (CC_BITS_RANK_SELECT_BLOCK_WORDS * 64)
+#define CC_BITS_RANK_SELECT_SAMPLE 4096
+
+typedef struct CCBitsRankSelectInfo {
+    const uint8_t *set;
+    size_t count;
+    size_t total;
+    size_t blocks;
+    size_t samples;
+    /// The cumulative rank before each block (plus a final entry for the total), followed by the block of every CC_BITS_RANK_SELECT_SAMPLE set bit.
+    size_t ranks[];
+} CCBitsRankSelectInfo;
+
+static CC_FORCE_INLINE uint64_t CCBitsRankSelectGetWord(const uint8_t *Set, size_t Count, size_t Word)
+{
+    const size_t Bit = Word * 64;
+    uint64_t Value = 0;
+    
+    if ((Bit + 64) <= Count)
+    {
+        memcpy(&Value, Set + (Bit / 8), sizeof(Value));
+        
+#if CC_HARDWARE_ENDIAN_BIG
+        CCSwap(&Value, sizeof(Value));
+#endif
+    }
+    
+    else
+    {
+        const size_t Remaining = Count - Bit;
+        
+        for (size_t Loop = 0; Loop < ((Remaining + 7) / 8); Loop++) Value |= (uint64_t)Set[(Bit / 8) + Loop] << (Loop * 8);
+        
+        Value &= CCBitSet(Remaining);
+    }
+    
+    return Value;
+}
+
+static size_t CCBitsRankSelectCountWordsGeneric(const uint8_t *Set, size_t Words)
+{
+    size_t Total = 0;
+    for (size_t Loop = 0; Loop < Words; Loop++)
+    {
+        uint64_t Value;
+        memcpy(&Value, Set + (Loop * sizeof(Value)), sizeof(Value));
+        
+        Total += CCBitCountSet(Value);
+    }
+    
+    return Total;
+}
+
+#if CC_BITS_RANK_SELECT_X86_DISPATCH
+static CC_TARGET("popcnt") size_t CCBitsRankSelectCountWordsPOPCNT(const uint8_t *Set, size_t Words)
+{
+    size_t Total = 0;
+    for (size_t Loop = 0; Loop < Words; Loop++)
+    {
+        uint64_t Value;
+        memcpy(&Value, Set + (Loop * sizeof(Value)), sizeof(Value));
+        
+        Total += __builtin_popcountll(Value);
+    }
+    
+    return Total;
+}
+
+static CC_TARGET("avx2,popcnt") size_t CCBitsRankSelectCountWordsAVX2(const uint8_t *Set, size_t Words)
+{
+    //Nibble lookup popcount, accumulated per 64-bit lane with a sum of absolute differences
+    const __m256i Lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i LowMask = _mm256_set1_epi8(0xf);
+    __m256i Sum = _mm256_setzero_si256();
+    
+    size_t Loop = 0;
+    for ( ; (Loop + 4) <= Words; Loop += 4)
+    {
+        const __m256i Value = _mm256_loadu_si256((const __m256i*)(Set + (Loop * sizeof(uint64_t))));
+        const __m256i Low = _mm256_shuffle_epi8(Lookup, _mm256_and_si256(Value, LowMask));
+        const __m256i High = _mm256_shuffle_epi8(Lookup, _mm256_and_si256(_mm256_srli_epi16(Value, 4), LowMask));
+        
+        Sum = _mm256_add_epi64(Sum, _mm256_sad_epu8(_mm256_add_epi8(Low, High), _mm256_setzero_si256()));
+    }
+    
+    uint64_t Counts[4];
+    _mm256_storeu_si256((__m256i*)Counts, Sum);
+    
+    return Counts[0] + Counts[1] + Counts[2] + Counts[3] + CCBitsRankSelectCountWordsPOPCNT(Set + (Loop * sizeof(uint64_t)), Words - Loop);
+}
+#endif
+
+static size_t CCBitsRankSelectCountWordsResolve(const uint8_t *Set, size_t Words);
+
+/// Counts the set bits in a number of complete words. Resolved to the best implementation for the CPU on startup (or on first use).
+static _Atomic(size_t (*)(const uint8_t *Set, size_t Words)) CCBitsRankSelectCountWords = CCBitsRankSelectCountWordsResolve;
+
+CC_CONSTRUCTOR static void CCBitsRankSelectDispatch(void)
+{
+    size_t (*CountWords)(const uint8_t *, size_t) = CCBitsRankSelectCountWordsGeneric;
+    
+#if CC_BITS_RANK_SELECT_X86_DISPATCH
+    const CCHardwareFeature Features = CCHardwareGetFeatures();
+    
+    if ((Features & (CCHardwareFeatureAVX2 | CCHardwareFeaturePOPCNT)) == (CCHardwareFeatureAVX2 | CCHardwareFeaturePOPCNT)) CountWords = CCBitsRankSelectCountWordsAVX2;
+    else if (Features & CCHardwareFeaturePOPCNT) CountWords = CCBitsRankSelectCountWordsPOPCNT;
+#endif
+    
+    atomic_store_explicit(&CCBitsRankSelectCountWords, CountWords, memory_order_relaxed);
+}
+
+static size_t CCBitsRankSelectCountWordsResolve(const uint8_t *Set, size_t Words)
+{
+    CCBitsRankSelectDispatch();
+    
+    return atomic_load_explicit(&CCBitsRankSelectCountWords, memory_order_relaxed)(Set, Words);
+}
+
+static CC_FORCE_INLINE size_t CCBitsRankSelectWordSelect(uint64_t Word, size_t N)
+{
+    size_t Offset = 0;
+    
+    for (size_t Bits; (Bits = CCBitCountSet(Word & 0xff)) <= N; Word >>= 8, Offset += 8) N -= Bits;
+    for ( ; N; N--) Word &= Word - 1;
+    
+    return Offset + CCBitCountLowestUnset(Word);
+}
+
+CCBitsRankSelect CCBitsRankSelectCreate(CCAllocatorType Allocator, const void *Set, size_t Count)
+{
+    CCAssertLog(Set || !Count, "Set must not be null");
+    
+    const size_t Words = (Count + 63) / 64;
+    const size_t Blocks = (Count + (CC_BITS_RANK_SELECT_BLOCK_BITS - 1)) / CC_BITS_RANK_SELECT_BLOCK_BITS;
+    
+    size_t Total = atomic_load_explicit(&CCBitsRankSelectCountWords, memory_order_relaxed)(Set, Count / 64);
+    if (Count % 64) Total += CCBitCountSet(CCBitsRankSelectGetWord(Set, Count, Count / 64));
+    
+    const size_t Samples = (Total + (CC_BITS_RANK_SELECT_SAMPLE - 1)) / CC_BITS_RANK_SELECT_SAMPLE;
+    
+    CCBitsRankSelect Index = CCMalloc(Allocator, sizeof(CCBitsRankSelectInfo) + (sizeof(size_t) * (Blocks + 1 + Samples)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Index)
+    {
+        *Index = (CCBitsRankSelectInfo){
+            .set = Set,
+            .count = Count,
+            .total = Total,
+            .blocks = Blocks,
+            .samples = Samples
+        };
+        
+        size_t * const Sampled = Index->ranks + Blocks + 1;
+        size_t Rank = 0, Sample = 0;
+        
+        for (size_t Loop = 0; Loop < Blocks; Loop++)
+        {
+            Index->ranks[Loop] = Rank;
+            
+            const size_t Word = Loop * CC_BITS_RANK_SELECT_BLOCK_WORDS, End = CCMin(Word + CC_BITS_RANK_SELECT_BLOCK_WORDS, Count / 64);
+            
+            Rank += atomic_load_explicit(&CCBitsRankSelectCountWords, memory_order_relaxed)((const uint8_t*)Set + (Word * sizeof(uint64_t)), End - Word);
+            if (End < CCMin(Word + CC_BITS_RANK_SELECT_BLOCK_WORDS, Words)) Rank += CCBitCountSet(CCBitsRankSelectGetWord(Set, Count, End));
+            
+            for ( ; (Sample < Samples) && ((Sample * CC_BITS_RANK_SELECT_SAMPLE) < Rank); Sample++) Sampled[Sample] = Loop;
+        }
+        
+        Index->ranks[Blocks] = Rank;
+    }
+    
+    return Index;
+}
+
+void CCBitsRankSelectDestroy(CCBitsRankSelect Index)
+{
+    CCAssertLog(Index, "Index must not be null");
+    
+    CCFree(Index);
+}
+
+size_t CCBitsRankSelectGetCount(CCBitsRankSelect Index)
+{
+    CCAssertLog(Index, "Index must not be null");
+    
+    return Index->total;
+}
+
+size_t CCBitsRank(CCBitsRankSelect Index, size_t Bit)
+{
+    CCAssertLog(Index, "Index must not be null");
+    CCAssertLog(Bit <= Index->count, "Bit must not exceed the number of bits");
+    
+    const size_t Block = Bit / CC_BITS_RANK_SELECT_BLOCK_BITS;
+    size_t Rank = Index->ranks[Block];
+    
+    const size_t Word = Block * CC_BITS_RANK_SELECT_BLOCK_WORDS;
+    Rank += atomic_load_explicit(&CCBitsRankSelectCountWords, memory_order_relaxed)(Index->set + (Word * sizeof(uint64_t)), (Bit / 64) - Word);
+    
+    if (Bit % 64) Rank += CCBitCountSet(CCBitsRankSelectGetWord(Index->set, Index->count, Bit / 64) & CCBitSet(Bit % 64));
+    
+    return Rank;
+}
+
+size_t CCBitsSelect(CCBitsRankSelect Index, size_t N)
+{
+    CCAssertLog(Index, "Index must not be null");
+    
+    if (N >= Index->total) return SIZE_MAX;
+    
+    const size_t * const Sampled = Index->ranks + Index->blocks + 1;
+    const size_t Sample = N / CC_BITS_RANK_SELECT_SAMPLE;
+    size_t Low = Sampled[Sample], High = (Sample + 1) < Index->samples ? Sampled[Sample + 1] + 1 : Index->blocks;
+    
+    while ((High - Low) > 1)
+    {
+        const size_t Mid = Low + ((High - Low) / 2);
+        
+        if (Index->ranks[Mid] <= N) Low = Mid;
+        else High = Mid;
+    }
+    
+    N -= Index->ranks[Low];
+    
+    for (size_t Word = Low * CC_BITS_RANK_SELECT_BLOCK_WORDS; ; Word++)
+    {
+        const uint64_t Value = CCBitsRankSelectGetWord(Index->set, Index->count, Word);
+        const size_t Bits = CCBitCountSet(Value);
+        
+        if (N < Bits) return (Word * 64) + CCBitsRankSelectWordSelect(Value, N);
+        
+        N -= Bits;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_BitsRankSelect_h
+#define CommonC_BitsRankSelect_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Allocator.h>
+
+/*!
+ * @brief A rank/select index over an array of bits.
+ * @description Stores the cumulative number of set bits at fixed intervals, so the number of
+ *              set bits preceding any index (rank), or the index of the nth set bit (select),
+ *              can be found without scanning the entire array.
+ *
+ *              The index references the array of bits, so the array must remain unchanged
+ *              and alive for the lifetime of the index.
+ */
+typedef struct CCBitsRankSelectInfo *CCBitsRankSelect;
+
+
+/*!
+ * @brief Create a rank/select index for an array of bits.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Set The array of bits. This must remain unchanged for the lifetime of the index.
+ * @param Count The number of bits in the array.
+ * @return The rank/select index, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCBitsRankSelect CCBitsRankSelectCreate(CCAllocatorType Allocator, const void *Set, size_t Count);
+
+/*!
+ * @brief Destroy a rank/select index.
+ * @param Index The rank/select index to be destroyed.
+ */
+void CCBitsRankSelectDestroy(CCBitsRankSelect CC_DESTROY(Index));
+
+/*!
+ * @brief Get the total number of set bits.
+ * @param Index The rank/select index.
+ * @return The number of set bits in the array.
+ */
+size_t CCBitsRankSelectGetCount(CCBitsRankSelect Index);
+
+/*!
+ * @brief Get the number of set bits preceding a bit.
+ * @performance O(1).
+ * @param Index The rank/select index.
+ * @param Bit The index of the bit. May be equal to the number of bits in the array.
+ * @return The number of set bits in the range [0, Bit).
+ */
+size_t CCBitsRank(CCBitsRankSelect Index, size_t Bit);
+
+/*!
+ * @brief Get the index of the nth set bit.
+ * @performance O(log n) in the worst case, though sampling keeps the search to a small range
+ *              for evenly distributed sets.
+ *
+ * @param Index The rank/select index.
+ * @param N The zero based occurrence of the set bit.
+ * @return The index of the set bit, or SIZE_MAX if there are not that many set bits.
+ */
+size_t CCBitsSelect(CCBitsRankSelect Index, size_t N);
+
+#endif
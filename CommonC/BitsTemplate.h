@@ -26,6 +26,12 @@
 #include <CommonC/Template.h>
 #include <CommonC/BitTricks.h>
 #include <CommonC/Swap.h>
+#include <CommonC/Platform.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON || CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <CommonC/Simd.h>
+#define CC_BITS_SIMD_128 1
+#endif
 
 #define CCBitsGet_T(t) CC_TEMPLATE_REF(CCBitsGet, _Bool, t, size_t)
 #define CCBitsSet_T(t) CC_TEMPLATE_REF(CCBitsSet, void, t, size_t)
@@ -41,6 +47,10 @@
 #define CCBitsAnd_T(t) CC_TEMPLATE_REF(CCBitsAnd, void, t, t, size_t, size_t)
 #define CCBitsXor_T(t) CC_TEMPLATE_REF(CCBitsXor, void, t, t, size_t, size_t)
 #define CCBitsCopy_T(t) CC_TEMPLATE_REF(CCBitsCopy, void, t, t, size_t, size_t)
+#define CCBitsFindFirstSet_T(t) CC_TEMPLATE_REF(CCBitsFindFirstSet, size_t, t, size_t, size_t)
+#define CCBitsFindFirstClear_T(t) CC_TEMPLATE_REF(CCBitsFindFirstClear, size_t, t, size_t, size_t)
+#define CCBitsFindLastSet_T(t) CC_TEMPLATE_REF(CCBitsFindLastSet, size_t, t, size_t, size_t)
+#define CCBitsFindLastClear_T(t) CC_TEMPLATE_REF(CCBitsFindLastClear, size_t, t, size_t, size_t)
 
 CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCBitsGet, (const T Set, const size_t Index));
 CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsSet, (T Set, const size_t Index));
@@ -56,6 +66,10 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsOr, (const T SetA, const T SetB,
 CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsAnd, (const T SetA, const T SetB, const size_t Index, const size_t Count));
 CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsXor, (const T SetA, const T SetB, const size_t Index, const size_t Count));
 CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsCopy, (const T SetA, const T SetB, const size_t Index, const size_t Count));
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindFirstSet, (const T Set, const size_t Index, const size_t Count));
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindFirstClear, (const T Set, const size_t Index, const size_t Count));
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindLastSet, (const T Set, const size_t Index, const size_t Count));
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindLastClear, (const T Set, const size_t Index, const size_t Count));
 
 #pragma mark -
 
@@ -423,7 +437,16 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsNot, (const T Set, const size_t I
     const size_t Count64 = IndexAdjustedCount / 64;
     uint64_t * const Set64 = (uint64_t*)(((uint8_t*)Set) + Offset8);
     
-    for (size_t Loop = 0; Loop < Count64; Loop++)
+    size_t Loop = 0;
+    
+#if CC_BITS_SIMD_128
+    for ( ; (Loop + 2) <= Count64; Loop += 2)
+    {
+        CCSimdStore_u8x16((uint8_t*)(Set64 + Loop), CCSimdNot_u8x16(CCSimdLoad_u8x16((uint8_t*)(Set64 + Loop))));
+    }
+#endif
+    
+    for ( ; Loop < Count64; Loop++)
     {
         Set64[Loop] = ~Set64[Loop];
     }
@@ -473,7 +496,16 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsOr, (const T SetA, const T SetB,
     uint64_t * const SetA64 = (uint64_t*)(((uint8_t*)SetA) + Offset8);
     uint64_t * const SetB64 = (uint64_t*)(((uint8_t*)SetB) + Offset8);
     
-    for (size_t Loop = 0; Loop < Count64; Loop++)
+    size_t Loop = 0;
+    
+#if CC_BITS_SIMD_128
+    for ( ; (Loop + 2) <= Count64; Loop += 2)
+    {
+        CCSimdStore_u8x16((uint8_t*)(SetA64 + Loop), CCSimdOr_u8x16(CCSimdLoad_u8x16((uint8_t*)(SetA64 + Loop)), CCSimdLoad_u8x16((uint8_t*)(SetB64 + Loop))));
+    }
+#endif
+    
+    for ( ; Loop < Count64; Loop++)
     {
         SetA64[Loop] |= SetB64[Loop];
     }
@@ -516,7 +548,16 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsAnd, (const T SetA, const T SetB,
     uint64_t * const SetA64 = (uint64_t*)(((uint8_t*)SetA) + Offset8);
     uint64_t * const SetB64 = (uint64_t*)(((uint8_t*)SetB) + Offset8);
     
-    for (size_t Loop = 0; Loop < Count64; Loop++)
+    size_t Loop = 0;
+    
+#if CC_BITS_SIMD_128
+    for ( ; (Loop + 2) <= Count64; Loop += 2)
+    {
+        CCSimdStore_u8x16((uint8_t*)(SetA64 + Loop), CCSimdAnd_u8x16(CCSimdLoad_u8x16((uint8_t*)(SetA64 + Loop)), CCSimdLoad_u8x16((uint8_t*)(SetB64 + Loop))));
+    }
+#endif
+    
+    for ( ; Loop < Count64; Loop++)
     {
         SetA64[Loop] &= SetB64[Loop];
     }
@@ -565,7 +606,16 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsXor, (const T SetA, const T SetB,
     uint64_t * const SetA64 = (uint64_t*)(((uint8_t*)SetA) + Offset8);
     uint64_t * const SetB64 = (uint64_t*)(((uint8_t*)SetB) + Offset8);
     
-    for (size_t Loop = 0; Loop < Count64; Loop++)
+    size_t Loop = 0;
+    
+#if CC_BITS_SIMD_128
+    for ( ; (Loop + 2) <= Count64; Loop += 2)
+    {
+        CCSimdStore_u8x16((uint8_t*)(SetA64 + Loop), CCSimdXor_u8x16(CCSimdLoad_u8x16((uint8_t*)(SetA64 + Loop)), CCSimdLoad_u8x16((uint8_t*)(SetB64 + Loop))));
+    }
+#endif
+    
+    for ( ; Loop < Count64; Loop++)
     {
         SetA64[Loop] ^= SetB64[Loop];
     }
@@ -608,7 +658,16 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsCopy, (const T SetA, const T SetB
     uint64_t * const SetA64 = (uint64_t*)(((uint8_t*)SetA) + Offset8);
     uint64_t * const SetB64 = (uint64_t*)(((uint8_t*)SetB) + Offset8);
     
-    for (size_t Loop = 0; Loop < Count64; Loop++)
+    size_t Loop = 0;
+    
+#if CC_BITS_SIMD_128
+    for ( ; (Loop + 2) <= Count64; Loop += 2)
+    {
+        CCSimdStore_u8x16((uint8_t*)(SetA64 + Loop), CCSimdLoad_u8x16((uint8_t*)(SetB64 + Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count64; Loop++)
     {
         SetA64[Loop] = SetB64[Loop];
     }
@@ -644,3 +703,185 @@ CC_TEMPLATE(static CC_FORCE_INLINE void, CCBitsCopy, (const T SetA, const T SetB
         SetA8[Count8] = SetB8[Count8];
     }
 }
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindFirstSet, (const T Set, const size_t Index, const size_t Count))
+{
+    const uint8_t * const Set8 = (uint8_t*)Set;
+    const size_t End = Index + Count;
+    size_t Bit = Index;
+    
+    if ((Bit % 8) && (Bit < End))
+    {
+        const uint8_t Byte = Set8[Bit / 8] & (0xff << (Bit % 8));
+        
+        if (Byte)
+        {
+            const size_t Found = (Bit - (Bit % 8)) + CCBitCountLowestUnset(Byte);
+            
+            return Found < End ? Found : SIZE_MAX;
+        }
+        
+        Bit += 8 - (Bit % 8);
+    }
+    
+    for ( ; (Bit + 64) <= End; Bit += 64)
+    {
+        uint64_t Word = *(uint64_t*)(Set8 + (Bit / 8));
+        
+#if CC_HARDWARE_ENDIAN_BIG
+        CCSwap(&Word, sizeof(Word));
+#endif
+        
+        if (Word) return Bit + CCBitCountLowestUnset(Word);
+    }
+    
+    for ( ; Bit < End; Bit += 8)
+    {
+        const uint8_t Byte = Set8[Bit / 8];
+        
+        if (Byte)
+        {
+            const size_t Found = Bit + CCBitCountLowestUnset(Byte);
+            
+            return Found < End ? Found : SIZE_MAX;
+        }
+    }
+    
+    return SIZE_MAX;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindFirstClear, (const T Set, const size_t Index, const size_t Count))
+{
+    const uint8_t * const Set8 = (uint8_t*)Set;
+    const size_t End = Index + Count;
+    size_t Bit = Index;
+    
+    if ((Bit % 8) && (Bit < End))
+    {
+        const uint8_t Byte = ~Set8[Bit / 8] & (0xff << (Bit % 8));
+        
+        if (Byte)
+        {
+            const size_t Found = (Bit - (Bit % 8)) + CCBitCountLowestUnset(Byte);
+            
+            return Found < End ? Found : SIZE_MAX;
+        }
+        
+        Bit += 8 - (Bit % 8);
+    }
+    
+    for ( ; (Bit + 64) <= End; Bit += 64)
+    {
+        uint64_t Word = ~*(uint64_t*)(Set8 + (Bit / 8));
+        
+#if CC_HARDWARE_ENDIAN_BIG
+        CCSwap(&Word, sizeof(Word));
+#endif
+        
+        if (Word) return Bit + CCBitCountLowestUnset(Word);
+    }
+    
+    for ( ; Bit < End; Bit += 8)
+    {
+        const uint8_t Byte = ~Set8[Bit / 8];
+        
+        if (Byte)
+        {
+            const size_t Found = Bit + CCBitCountLowestUnset(Byte);
+            
+            return Found < End ? Found : SIZE_MAX;
+        }
+    }
+    
+    return SIZE_MAX;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindLastSet, (const T Set, const size_t Index, const size_t Count))
+{
+    const uint8_t * const Set8 = (uint8_t*)Set;
+    size_t Bit = Index + Count;
+    
+    if ((Bit % 8) && (Bit > Index))
+    {
+        const uint8_t Byte = Set8[Bit / 8] & ((1 << (Bit % 8)) - 1);
+        
+        if (Byte)
+        {
+            const size_t Found = (Bit - (Bit % 8)) + CCBitCountLowestUnset(CCBitHighestSet(Byte));
+            
+            return Found >= Index ? Found : SIZE_MAX;
+        }
+        
+        Bit -= Bit % 8;
+    }
+    
+    for ( ; (Bit >= 64) && ((Bit - 64) >= Index); Bit -= 64)
+    {
+        uint64_t Word = *(uint64_t*)(Set8 + ((Bit - 64) / 8));
+        
+#if CC_HARDWARE_ENDIAN_BIG
+        CCSwap(&Word, sizeof(Word));
+#endif
+        
+        if (Word) return (Bit - 64) + CCBitCountLowestUnset(CCBitHighestSet(Word));
+    }
+    
+    for ( ; Bit > Index; Bit -= 8)
+    {
+        const uint8_t Byte = Set8[(Bit / 8) - 1];
+        
+        if (Byte)
+        {
+            const size_t Found = (Bit - 8) + CCBitCountLowestUnset(CCBitHighestSet(Byte));
+            
+            return Found >= Index ? Found : SIZE_MAX;
+        }
+    }
+    
+    return SIZE_MAX;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCBitsFindLastClear, (const T Set, const size_t Index, const size_t Count))
+{
+    const uint8_t * const Set8 = (uint8_t*)Set;
+    size_t Bit = Index + Count;
+    
+    if ((Bit % 8) && (Bit > Index))
+    {
+        const uint8_t Byte = ~Set8[Bit / 8] & ((1 << (Bit % 8)) - 1);
+        
+        if (Byte)
+        {
+            const size_t Found = (Bit - (Bit % 8)) + CCBitCountLowestUnset(CCBitHighestSet(Byte));
+            
+            return Found >= Index ? Found : SIZE_MAX;
+        }
+        
+        Bit -= Bit % 8;
+    }
+    
+    for ( ; (Bit >= 64) && ((Bit - 64) >= Index); Bit -= 64)
+    {
+        uint64_t Word = ~*(uint64_t*)(Set8 + ((Bit - 64) / 8));
+        
+#if CC_HARDWARE_ENDIAN_BIG
+        CCSwap(&Word, sizeof(Word));
+#endif
+        
+        if (Word) return (Bit - 64) + CCBitCountLowestUnset(CCBitHighestSet(Word));
+    }
+    
+    for ( ; Bit > Index; Bit -= 8)
+    {
+        const uint8_t Byte = ~Set8[(Bit / 8) - 1];
+        
+        if (Byte)
+        {
+            const size_t Found = (Bit - 8) + CCBitCountLowestUnset(CCBitHighestSet(Byte));
+            
+            return Found >= Index ? Found : SIZE_MAX;
+        }
+    }
+    
+    return SIZE_MAX;
+}
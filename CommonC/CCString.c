@@ -33,6 +33,13 @@
 #include "BitTricks.h"
 #include "CollectionEnumerator.h"
 #include "TypeCallbacks.h"
+#include "HardwareInfo.h"
+#include <stdatomic.h>
+
+#if (CC_HARDWARE_ARCH_X86 || CC_HARDWARE_ARCH_X86_64) && __has_attribute(target)
+#include <immintrin.h>
+#define CC_STRING_X86_DISPATCH 1
+#endif
 
 /* 
  CC_STRING_TAGGED_NUL_CHAR_ALWAYS_0 makes the guarantee that a nul char will be represented by 0 in the tagged strings.
@@ -1328,6 +1335,93 @@ CCChar CCStringGetCharacterAtIndex(CCString String, size_t Index)
     }
 }
 
+static const char *CCStringSearchGeneric(const char *String, size_t Size, const char *Substring, size_t SubstringSize)
+{
+    for (const char *End = String + (Size - SubstringSize) + 1; (String < End) && ((String = memchr(String, *Substring, End - String))); String++)
+    {
+        if (!memcmp(String + 1, Substring + 1, SubstringSize - 1)) return String;
+    }
+    
+    return NULL;
+}
+
+#if CC_STRING_X86_DISPATCH
+/*
+ Compares the first and last bytes of the substring against every candidate position in a block, and only then
+ compares the entire substring at the positions where both matched.
+ */
+static CC_TARGET("sse2") const char *CCStringSearchSSE2(const char *String, size_t Size, const char *Substring, size_t SubstringSize)
+{
+    const __m128i First = _mm_set1_epi8(Substring[0]), Last = _mm_set1_epi8(Substring[SubstringSize - 1]);
+    
+    size_t Index = 0;
+    for (const size_t Candidates = (Size - SubstringSize) + 1; (Index + 16) <= Candidates; Index += 16)
+    {
+        const __m128i BlockFirst = _mm_loadu_si128((const __m128i*)(String + Index));
+        const __m128i BlockLast = _mm_loadu_si128((const __m128i*)(String + Index + SubstringSize - 1));
+        
+        for (uint32_t Mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(First, BlockFirst), _mm_cmpeq_epi8(Last, BlockLast))); Mask; Mask &= Mask - 1)
+        {
+            const char *Found = String + Index + __builtin_ctz(Mask);
+            if (!memcmp(Found + 1, Substring + 1, SubstringSize - 1)) return Found;
+        }
+    }
+    
+    return CCStringSearchGeneric(String + Index, Size - Index, Substring, SubstringSize);
+}
+
+static CC_TARGET("avx2") const char *CCStringSearchAVX2(const char *String, size_t Size, const char *Substring, size_t SubstringSize)
+{
+    const __m256i First = _mm256_set1_epi8(Substring[0]), Last = _mm256_set1_epi8(Substring[SubstringSize - 1]);
+    
+    size_t Index = 0;
+    for (const size_t Candidates = (Size - SubstringSize) + 1; (Index + 32) <= Candidates; Index += 32)
+    {
+        const __m256i BlockFirst = _mm256_loadu_si256((const __m256i*)(String + Index));
+        const __m256i BlockLast = _mm256_loadu_si256((const __m256i*)(String + Index + SubstringSize - 1));
+        
+        for (uint32_t Mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(First, BlockFirst), _mm256_cmpeq_epi8(Last, BlockLast))); Mask; Mask &= Mask - 1)
+        {
+            const char *Found = String + Index + __builtin_ctz(Mask);
+            if (!memcmp(Found + 1, Substring + 1, SubstringSize - 1)) return Found;
+        }
+    }
+    
+    return CCStringSearchSSE2(String + Index, Size - Index, Substring, SubstringSize);
+}
+#endif
+
+static const char *CCStringSearchResolve(const char *String, size_t Size, const char *Substring, size_t SubstringSize);
+
+/// Finds the first occurrence of the substring bytes (SubstringSize > 0). Resolved to the best implementation for the CPU on startup (or on first use).
+static _Atomic(const char *(*)(const char *String, size_t Size, const char *Substring, size_t SubstringSize)) CCStringSearch = CCStringSearchResolve;
+
+CC_CONSTRUCTOR static void CCStringSearchDispatch(void)
+{
+    const char *(*Search)(const char *, size_t, const char *, size_t) = CCStringSearchGeneric;
+    
+#if CC_STRING_X86_DISPATCH
+    const CCHardwareFeature Features = CCHardwareGetFeatures();
+    
+    if (Features & CCHardwareFeatureAVX2) Search = CCStringSearchAVX2;
+    else if (Features & CCHardwareFeatureSSE2) Search = CCStringSearchSSE2;
+#endif
+    
+    atomic_store_explicit(&CCStringSearch, Search, memory_order_relaxed);
+}
+
+static const char *CCStringSearchResolve(const char *String, size_t Size, const char *Substring, size_t SubstringSize)
+{
+    CCStringSearchDispatch();
+    
+    return atomic_load_explicit(&CCStringSearch, memory_order_relaxed)(String, Size, Substring, SubstringSize);
+}
+
+static CC_FORCE_INLINE _Bool CCStringIsContinuationUTF8(char c)
+{
+    return (c & 0xc0) == 0x80;
+}
+
 size_t CCStringFindSubstring(CCString String, size_t Index, CCString Substring)
 {
     CCAssertLog(String && Substring, "Strings must not be null");
@@ -1352,6 +1446,40 @@ size_t CCStringFindSubstring(CCString String, size_t Index, CCString Substring)
             }
         }
         
+        else if ((SubstringLength) && (!CCStringIsTagged(String)) && (!CCStringIsTagged(Substring)) && ((((CCStringInfo*)String)->hint & CCStringHintEncodingMask) == (((CCStringInfo*)Substring)->hint & CCStringHintEncodingMask)))
+        {
+            //Both strings share an encoding, so a character match is a byte match (UTF-8 matches can only start on a codepoint)
+            const char *Characters = CCStringGetCharacters((CCStringInfo*)String);
+            const size_t Size = CCStringGetSize(String), SubstringSize = CCStringGetSize(Substring);
+            const _Bool UTF8 = (((CCStringInfo*)String)->hint & CCStringHintEncodingMask) == CCStringEncodingUTF8;
+            
+            size_t Offset = UTF8 ? 0 : Index;
+            if (UTF8)
+            {
+                for (size_t Skip = Index; Offset < Size; Offset++)
+                {
+                    if ((!CCStringIsContinuationUTF8(Characters[Offset])) && (!Skip--)) break;
+                }
+            }
+            
+            if ((Size - Offset) >= SubstringSize)
+            {
+                const char *Found = atomic_load_explicit(&CCStringSearch, memory_order_relaxed)(Characters + Offset, Size - Offset, CCStringGetCharacters((CCStringInfo*)Substring), SubstringSize);
+                
+                if (Found)
+                {
+                    if (!UTF8) return Found - Characters;
+                    
+                    for (const char *Start = Characters + Offset; Start < Found; Start++)
+                    {
+                        if (!CCStringIsContinuationUTF8(*Start)) Index++;
+                    }
+                    
+                    return Index;
+                }
+            }
+        }
+        
         else
         {
             for ( ; ((StringLength - Index) >= SubstringLength) && (Index < StringLength); Index++)
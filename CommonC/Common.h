@@ -66,10 +66,12 @@
 #include <CommonC/ProcessInfo.h>
 
 #include <CommonC/Maths.h>
+#include <CommonC/MathArray.h>
 #include <CommonC/BitTricks.h>
 #include <CommonC/Random.h>
 #include <CommonC/Vector.h>
 #include <CommonC/Matrix.h>
+#include <CommonC/VectorBatch.h>
 #include <CommonC/BigInt.h>
 #include <CommonC/BigIntFast.h>
 #include <CommonC/Decimal.h>
@@ -82,6 +84,7 @@
 #include <CommonC/Array.h>
 #include <CommonC/List.h>
 #include <CommonC/ConcurrentIndexMap.h>
+#include <CommonC/ConcurrentSkipList.h>
 #include <CommonC/Collection.h>
 #include <CommonC/OrderedCollection.h>
 #include <CommonC/CollectionEnumerator.h>
@@ -103,6 +106,9 @@
 #include <CommonC/Swap.h>
 
 #include <CommonC/BitSets.h>
+#include <CommonC/BitsEnumerable.h>
+#include <CommonC/BitsRankSelect.h>
+#include <CommonC/CompressedBitmap.h>
 
 #include <CommonC/CCString.h>
 #include <CommonC/CCStringEnumerator.h>
@@ -116,9 +122,11 @@
 #include <CommonC/Dictionary.h>
 #include <CommonC/DictionaryEnumerator.h>
 #include <CommonC/DictionaryHashMap.h>
+#include <CommonC/DictionaryBPlusTree.h>
 
 #include <CommonC/Queue.h>
 #include <CommonC/ConcurrentQueue.h>
+#include <CommonC/ConcurrentSPSCQueue.h>
 
 #include <CommonC/ConcurrentGarbageCollector.h>
 #include <CommonC/EpochGarbageCollector.h>
@@ -131,12 +139,15 @@
 
 #include <CommonC/ConcurrentBuffer.h>
 #include <CommonC/ConcurrentIndexBuffer.h>
+#include <CommonC/ConcurrentCache.h>
+#include <CommonC/ConcurrentWait.h>
 
 #include <CommonC/ConcurrentIDGenerator.h>
 #include <CommonC/ConsecutiveIDGenerator.h>
 
 #include <CommonC/Reflect.h>
 #include <CommonC/ReflectStream.h>
+#include <CommonC/ReflectChunked.h>
 #include <CommonC/ReflectedTypes.h>
 #include <CommonC/ValidateMinimum.h>
 #include <CommonC/ValidateMaximum.h>
@@ -0,0 +1,1355 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "CompressedBitmap.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "Logging.h"
+#include "BitSets.h"
+#include "BitTricks.h"
+#include "Maths.h"
+#include "OrderedCollection.h"
+#include <string.h>
+
+#define CC_COMPRESSED_BITMAP_ARRAY_MAX 4096
+#define CC_COMPRESSED_BITMAP_WORDS 1024
+#define CC_COMPRESSED_BITMAP_BITMAP_SIZE (sizeof(uint64_t) * CC_COMPRESSED_BITMAP_WORDS)
+
+typedef CC_ENUM(CCCompressedBitmapContainerType, uint8_t) {
+    CCCompressedBitmapContainerTypeArray,
+    CCCompressedBitmapContainerTypeBitmap,
+    CCCompressedBitmapContainerTypeRun
+};
+
+typedef struct {
+    uint16_t start;
+    /// The number of values in the run minus 1.
+    uint16_t length;
+} CCCompressedBitmapRun;
+
+typedef struct {
+    uint16_t key;
+    CCCompressedBitmapContainerType type;
+    uint32_t cardinality;
+    /// The number of values of an array, or the number of runs of a run container.
+    uint32_t count;
+    uint32_t capacity;
+    union {
+        void *data;
+        uint16_t *values;
+        uint64_t *words;
+        CCCompressedBitmapRun *runs;
+    };
+} CCCompressedBitmapContainer;
+
+typedef struct CCCompressedBitmapInfo {
+    CCAllocatorType allocator;
+    size_t count, capacity;
+    CCCompressedBitmapContainer *containers;
+} CCCompressedBitmapInfo;
+
+static void CCCompressedBitmapDestructor(CCCompressedBitmap Bitmap)
+{
+    for (size_t Loop = 0; Loop < Bitmap->count; Loop++) CCFree(Bitmap->containers[Loop].data);
+    
+    CCFree(Bitmap->containers);
+}
+
+CCCompressedBitmap CCCompressedBitmapCreate(CCAllocatorType Allocator)
+{
+    CCCompressedBitmap Bitmap = CCMalloc(Allocator, sizeof(CCCompressedBitmapInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Bitmap)
+    {
+        *Bitmap = (CCCompressedBitmapInfo){
+            .allocator = Allocator,
+            .count = 0,
+            .capacity = 0,
+            .containers = NULL
+        };
+        
+        CCMemorySetDestructor(Bitmap, (CCMemoryDestructorCallback)CCCompressedBitmapDestructor);
+    }
+    
+    return Bitmap;
+}
+
+void CCCompressedBitmapDestroy(CCCompressedBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    CCFree(Bitmap);
+}
+
+#pragma mark - Containers
+
+static size_t CCCompressedBitmapContainerArrayFind(const CCCompressedBitmapContainer *Container, uint16_t Value, _Bool *Found)
+{
+    size_t Low = 0, High = Container->count;
+    
+    while (Low < High)
+    {
+        const size_t Mid = Low + ((High - Low) / 2);
+        
+        if (Container->values[Mid] < Value) Low = Mid + 1;
+        else High = Mid;
+    }
+    
+    *Found = (Low < Container->count) && (Container->values[Low] == Value);
+    
+    return Low;
+}
+
+/// Get the index of the last run starting at or before the value, or SIZE_MAX if there is none.
+static size_t CCCompressedBitmapContainerRunFind(const CCCompressedBitmapContainer *Container, uint16_t Value)
+{
+    size_t Low = 0, High = Container->count;
+    
+    while (Low < High)
+    {
+        const size_t Mid = Low + ((High - Low) / 2);
+        
+        if (Container->runs[Mid].start <= Value) Low = Mid + 1;
+        else High = Mid;
+    }
+    
+    return Low - 1;
+}
+
+static _Bool CCCompressedBitmapContainerContains(const CCCompressedBitmapContainer *Container, uint16_t Value)
+{
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+        {
+            _Bool Found;
+            CCCompressedBitmapContainerArrayFind(Container, Value, &Found);
+            
+            return Found;
+        }
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            return (Container->words[Value / 64] >> (Value % 64)) & 1;
+            
+        case CCCompressedBitmapContainerTypeRun:
+        {
+            const size_t Run = CCCompressedBitmapContainerRunFind(Container, Value);
+            
+            return (Run != SIZE_MAX) && ((Value - Container->runs[Run].start) <= Container->runs[Run].length);
+        }
+    }
+    
+    return FALSE;
+}
+
+static void CCCompressedBitmapWordsSetRange(uint64_t *Words, size_t Start, size_t Count)
+{
+    for (const size_t End = Start + Count; Start < End; )
+    {
+        const size_t Bits = CCMin(64 - (Start % 64), End - Start);
+        
+        Words[Start / 64] |= CCBitSet(Bits) << (Start % 64);
+        
+        Start += Bits;
+    }
+}
+
+/// Add the values of the container to the words.
+static void CCCompressedBitmapContainerToWords(const CCCompressedBitmapContainer *Container, uint64_t *Words)
+{
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+            for (size_t Loop = 0; Loop < Container->count; Loop++) Words[Container->values[Loop] / 64] |= UINT64_C(1) << (Container->values[Loop] % 64);
+            break;
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            CCBitsOr(Words, Container->words, 0, CC_COMPRESSED_BITMAP_WORDS * 64);
+            break;
+            
+        case CCCompressedBitmapContainerTypeRun:
+            for (size_t Loop = 0; Loop < Container->count; Loop++) CCCompressedBitmapWordsSetRange(Words, Container->runs[Loop].start, (size_t)Container->runs[Loop].length + 1);
+            break;
+    }
+}
+
+/*!
+ * @brief Create the most compact container for the words.
+ * @param Allocator The allocator to be used for the container.
+ * @param Words The words of the container. This must be an allocation that the container will take
+ *        ownership of, if it is kept as a bitmap, otherwise it will be freed.
+ *
+ * @param Runs Whether runs should be considered.
+ * @param Container The container to be initialised. The key should already be set.
+ * @return Whether the container was created, or FALSE on failure. An empty container will have a
+ *         cardinality of 0.
+ */
+static _Bool CCCompressedBitmapContainerFromWords(CCAllocatorType Allocator, uint64_t *Words, _Bool Runs, CCCompressedBitmapContainer *Container)
+{
+    const size_t Cardinality = CCBitsCount(Words, 0, CC_COMPRESSED_BITMAP_WORDS * 64);
+    size_t RunCount = SIZE_MAX;
+    
+    if (Runs)
+    {
+        RunCount = 0;
+        
+        for (size_t Loop = 0, Carry = 0; Loop < CC_COMPRESSED_BITMAP_WORDS; Loop++)
+        {
+            RunCount += CCBitCountSet(Words[Loop] & ~((Words[Loop] << 1) | Carry));
+            Carry = Words[Loop] >> 63;
+        }
+    }
+    
+    Container->cardinality = (uint32_t)Cardinality;
+    
+    if (!Cardinality)
+    {
+        Container->type = CCCompressedBitmapContainerTypeArray;
+        Container->count = 0;
+        Container->capacity = 0;
+        Container->data = NULL;
+        
+        CCFree(Words);
+        
+        return TRUE;
+    }
+    
+    const size_t RunSize = RunCount != SIZE_MAX ? RunCount * sizeof(CCCompressedBitmapRun) : SIZE_MAX;
+    const size_t ArraySize = Cardinality <= CC_COMPRESSED_BITMAP_ARRAY_MAX ? Cardinality * sizeof(uint16_t) : SIZE_MAX;
+    
+    if ((RunSize < ArraySize) && (RunSize < CC_COMPRESSED_BITMAP_BITMAP_SIZE))
+    {
+        CCCompressedBitmapRun *Data = CCMalloc(Allocator, RunSize, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Data)
+        {
+            CCFree(Words);
+            
+            return FALSE;
+        }
+        
+        for (size_t Loop = 0, Start = CCBitsFindFirstSet(Words, 0, CC_COMPRESSED_BITMAP_WORDS * 64); Loop < RunCount; Loop++)
+        {
+            size_t End = CCBitsFindFirstClear(Words, Start, (CC_COMPRESSED_BITMAP_WORDS * 64) - Start);
+            if (End == SIZE_MAX) End = CC_COMPRESSED_BITMAP_WORDS * 64;
+            
+            Data[Loop] = (CCCompressedBitmapRun){ .start = (uint16_t)Start, .length = (uint16_t)(End - Start - 1) };
+            
+            if (End < (CC_COMPRESSED_BITMAP_WORDS * 64)) Start = CCBitsFindFirstSet(Words, End, (CC_COMPRESSED_BITMAP_WORDS * 64) - End);
+        }
+        
+        CCFree(Words);
+        
+        Container->type = CCCompressedBitmapContainerTypeRun;
+        Container->count = (uint32_t)RunCount;
+        Container->capacity = (uint32_t)RunCount;
+        Container->runs = Data;
+    }
+    
+    else if (ArraySize != SIZE_MAX)
+    {
+        uint16_t *Data = CCMalloc(Allocator, ArraySize, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Data)
+        {
+            CCFree(Words);
+            
+            return FALSE;
+        }
+        
+        size_t Count = 0;
+        for (size_t Loop = 0; Loop < CC_COMPRESSED_BITMAP_WORDS; Loop++)
+        {
+            for (uint64_t Word = Words[Loop]; Word; Word &= Word - 1) Data[Count++] = (uint16_t)((Loop * 64) + CCBitCountLowestUnset(Word));
+        }
+        
+        CCFree(Words);
+        
+        Container->type = CCCompressedBitmapContainerTypeArray;
+        Container->count = (uint32_t)Cardinality;
+        Container->capacity = (uint32_t)Cardinality;
+        Container->values = Data;
+    }
+    
+    else
+    {
+        Container->type = CCCompressedBitmapContainerTypeBitmap;
+        Container->count = 0;
+        Container->capacity = 0;
+        Container->words = Words;
+    }
+    
+    return TRUE;
+}
+
+static uint64_t *CCCompressedBitmapContainerCreateWords(CCAllocatorType Allocator, const CCCompressedBitmapContainer *Container)
+{
+    uint64_t *Words = CCMalloc(Allocator, CC_COMPRESSED_BITMAP_BITMAP_SIZE, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Words)
+    {
+        memset(Words, 0, CC_COMPRESSED_BITMAP_BITMAP_SIZE);
+        
+        if (Container) CCCompressedBitmapContainerToWords(Container, Words);
+    }
+    
+    return Words;
+}
+
+/// Convert the container to its most compact representation.
+static _Bool CCCompressedBitmapContainerRepack(CCAllocatorType Allocator, CCCompressedBitmapContainer *Container, _Bool Runs)
+{
+    uint64_t *Words = CCCompressedBitmapContainerCreateWords(Allocator, Container);
+    if (!Words) return FALSE;
+    
+    CCCompressedBitmapContainer Repacked = { .key = Container->key };
+    if (!CCCompressedBitmapContainerFromWords(Allocator, Words, Runs, &Repacked)) return FALSE;
+    
+    CCFree(Container->data);
+    *Container = Repacked;
+    
+    return TRUE;
+}
+
+static _Bool CCCompressedBitmapContainerReserve(CCAllocatorType Allocator, CCCompressedBitmapContainer *Container, size_t ElementSize)
+{
+    if (Container->count < Container->capacity) return TRUE;
+    
+    const size_t Capacity = Container->capacity ? Container->capacity * 2 : 4;
+    void *Data = CCRealloc(Allocator, Container->data, Capacity * ElementSize, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Data) return FALSE;
+    
+    Container->data = Data;
+    Container->capacity = (uint32_t)Capacity;
+    
+    return TRUE;
+}
+
+/// Add the value to the container. Returns 1 if added, 0 if already present, or -1 on failure.
+static int CCCompressedBitmapContainerAdd(CCAllocatorType Allocator, CCCompressedBitmapContainer *Container, uint16_t Value)
+{
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+        {
+            _Bool Found;
+            const size_t Index = CCCompressedBitmapContainerArrayFind(Container, Value, &Found);
+            
+            if (Found) return 0;
+            
+            if (Container->count == CC_COMPRESSED_BITMAP_ARRAY_MAX)
+            {
+                uint64_t *Words = CCCompressedBitmapContainerCreateWords(Allocator, Container);
+                if (!Words) return -1;
+                
+                Words[Value / 64] |= UINT64_C(1) << (Value % 64);
+                
+                CCCompressedBitmapContainer Bitmap = { .key = Container->key };
+                if (!CCCompressedBitmapContainerFromWords(Allocator, Words, FALSE, &Bitmap)) return -1;
+                
+                CCFree(Container->data);
+                *Container = Bitmap;
+                
+                return 1;
+            }
+            
+            if (!CCCompressedBitmapContainerReserve(Allocator, Container, sizeof(uint16_t))) return -1;
+            
+            memmove(Container->values + Index + 1, Container->values + Index, sizeof(uint16_t) * (Container->count - Index));
+            Container->values[Index] = Value;
+            Container->count++;
+            break;
+        }
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            if ((Container->words[Value / 64] >> (Value % 64)) & 1) return 0;
+            
+            Container->words[Value / 64] |= UINT64_C(1) << (Value % 64);
+            break;
+            
+        case CCCompressedBitmapContainerTypeRun:
+        {
+            const size_t Run = CCCompressedBitmapContainerRunFind(Container, Value);
+            
+            if ((Run != SIZE_MAX) && ((Value - Container->runs[Run].start) <= Container->runs[Run].length)) return 0;
+            
+            const _Bool ExtendsPrevious = (Run != SIZE_MAX) && ((Value - Container->runs[Run].start) == ((size_t)Container->runs[Run].length + 1));
+            const _Bool ExtendsNext = ((Run + 1) < Container->count) && ((Value + 1) == Container->runs[Run + 1].start);
+            
+            if ((ExtendsPrevious) && (ExtendsNext))
+            {
+                Container->runs[Run].length += Container->runs[Run + 1].length + 2;
+                
+                memmove(Container->runs + Run + 1, Container->runs + Run + 2, sizeof(CCCompressedBitmapRun) * (Container->count - (Run + 2)));
+                Container->count--;
+            }
+            
+            else if (ExtendsPrevious) Container->runs[Run].length++;
+            else if (ExtendsNext)
+            {
+                Container->runs[Run + 1].start--;
+                Container->runs[Run + 1].length++;
+            }
+            
+            else
+            {
+                if (!CCCompressedBitmapContainerReserve(Allocator, Container, sizeof(CCCompressedBitmapRun))) return -1;
+                
+                memmove(Container->runs + Run + 2, Container->runs + Run + 1, sizeof(CCCompressedBitmapRun) * (Container->count - (Run + 1)));
+                Container->runs[Run + 1] = (CCCompressedBitmapRun){ .start = Value, .length = 0 };
+                Container->count++;
+            }
+            
+            Container->cardinality++;
+            
+            if (((Container->count * sizeof(CCCompressedBitmapRun)) >= CC_COMPRESSED_BITMAP_BITMAP_SIZE) && (!CCCompressedBitmapContainerRepack(Allocator, Container, TRUE)))
+            {
+                CC_LOG_ERROR("Failed to convert run container (%p) to bitmap", Container);
+            }
+            
+            return 1;
+        }
+    }
+    
+    Container->cardinality++;
+    
+    return 1;
+}
+
+/// Remove the value from the container. Returns 1 if removed, 0 if not present, or -1 on failure.
+static int CCCompressedBitmapContainerRemove(CCAllocatorType Allocator, CCCompressedBitmapContainer *Container, uint16_t Value)
+{
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+        {
+            _Bool Found;
+            const size_t Index = CCCompressedBitmapContainerArrayFind(Container, Value, &Found);
+            
+            if (!Found) return 0;
+            
+            memmove(Container->values + Index, Container->values + Index + 1, sizeof(uint16_t) * (Container->count - (Index + 1)));
+            Container->count--;
+            break;
+        }
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            if (!((Container->words[Value / 64] >> (Value % 64)) & 1)) return 0;
+            
+            Container->words[Value / 64] &= ~(UINT64_C(1) << (Value % 64));
+            
+            if (--Container->cardinality <= CC_COMPRESSED_BITMAP_ARRAY_MAX)
+            {
+                if (!CCCompressedBitmapContainerRepack(Allocator, Container, FALSE)) CC_LOG_ERROR("Failed to convert bitmap container (%p) to array", Container);
+            }
+            
+            return 1;
+            
+        case CCCompressedBitmapContainerTypeRun:
+        {
+            const size_t Run = CCCompressedBitmapContainerRunFind(Container, Value);
+            
+            if ((Run == SIZE_MAX) || ((Value - Container->runs[Run].start) > Container->runs[Run].length)) return 0;
+            
+            const size_t Offset = Value - Container->runs[Run].start;
+            
+            if (!Container->runs[Run].length)
+            {
+                memmove(Container->runs + Run, Container->runs + Run + 1, sizeof(CCCompressedBitmapRun) * (Container->count - (Run + 1)));
+                Container->count--;
+            }
+            
+            else if (!Offset)
+            {
+                Container->runs[Run].start++;
+                Container->runs[Run].length--;
+            }
+            
+            else if (Offset == Container->runs[Run].length) Container->runs[Run].length--;
+            else
+            {
+                if (!CCCompressedBitmapContainerReserve(Allocator, Container, sizeof(CCCompressedBitmapRun))) return -1;
+                
+                memmove(Container->runs + Run + 2, Container->runs + Run + 1, sizeof(CCCompressedBitmapRun) * (Container->count - (Run + 1)));
+                Container->runs[Run + 1] = (CCCompressedBitmapRun){ .start = Value + 1, .length = (uint16_t)(Container->runs[Run].length - Offset - 1) };
+                Container->runs[Run].length = (uint16_t)(Offset - 1);
+                Container->count++;
+                
+                if (((Container->count * sizeof(CCCompressedBitmapRun)) >= CC_COMPRESSED_BITMAP_BITMAP_SIZE) && (!CCCompressedBitmapContainerRepack(Allocator, Container, TRUE)))
+                {
+                    CC_LOG_ERROR("Failed to convert run container (%p) to bitmap", Container);
+                }
+            }
+            
+            break;
+        }
+    }
+    
+    Container->cardinality--;
+    
+    return 1;
+}
+
+static _Bool CCCompressedBitmapContainerCopy(CCAllocatorType Allocator, const CCCompressedBitmapContainer *Container, CCCompressedBitmapContainer *Copy)
+{
+    size_t Size = 0;
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+            Size = sizeof(uint16_t) * Container->count;
+            break;
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            Size = CC_COMPRESSED_BITMAP_BITMAP_SIZE;
+            break;
+            
+        case CCCompressedBitmapContainerTypeRun:
+            Size = sizeof(CCCompressedBitmapRun) * Container->count;
+            break;
+    }
+    
+    *Copy = *Container;
+    Copy->capacity = Container->count;
+    Copy->data = CCMalloc(Allocator, Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Copy->data) return FALSE;
+    
+    memcpy(Copy->data, Container->data, Size);
+    
+    return TRUE;
+}
+
+static _Bool CCCompressedBitmapContainerUnion(CCAllocatorType Allocator, const CCCompressedBitmapContainer *A, const CCCompressedBitmapContainer *B, CCCompressedBitmapContainer *Result)
+{
+    *Result = (CCCompressedBitmapContainer){ .key = A->key };
+    
+    if ((A->type == CCCompressedBitmapContainerTypeArray) && (B->type == CCCompressedBitmapContainerTypeArray))
+    {
+        uint16_t *Values = CCMalloc(Allocator, sizeof(uint16_t) * (A->count + B->count), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Values) return FALSE;
+        
+        size_t IndexA = 0, IndexB = 0, Count = 0;
+        while ((IndexA < A->count) && (IndexB < B->count))
+        {
+            const uint16_t ValueA = A->values[IndexA], ValueB = B->values[IndexB];
+            
+            Values[Count++] = CCMin(ValueA, ValueB);
+            IndexA += ValueA <= ValueB;
+            IndexB += ValueB <= ValueA;
+        }
+        
+        for ( ; IndexA < A->count; IndexA++) Values[Count++] = A->values[IndexA];
+        for ( ; IndexB < B->count; IndexB++) Values[Count++] = B->values[IndexB];
+        
+        if (Count <= CC_COMPRESSED_BITMAP_ARRAY_MAX)
+        {
+            Result->type = CCCompressedBitmapContainerTypeArray;
+            Result->cardinality = (uint32_t)Count;
+            Result->count = (uint32_t)Count;
+            Result->capacity = A->count + B->count;
+            Result->values = Values;
+            
+            return TRUE;
+        }
+        
+        Result->type = CCCompressedBitmapContainerTypeArray;
+        Result->count = (uint32_t)Count;
+        Result->values = Values;
+        
+        const _Bool Success = CCCompressedBitmapContainerRepack(Allocator, Result, FALSE);
+        if (!Success) CCFree(Values);
+        
+        return Success;
+    }
+    
+    uint64_t *Words = CCCompressedBitmapContainerCreateWords(Allocator, A);
+    if (!Words) return FALSE;
+    
+    CCCompressedBitmapContainerToWords(B, Words);
+    
+    return CCCompressedBitmapContainerFromWords(Allocator, Words, (A->type == CCCompressedBitmapContainerTypeRun) || (B->type == CCCompressedBitmapContainerTypeRun), Result);
+}
+
+static _Bool CCCompressedBitmapContainerIntersection(CCAllocatorType Allocator, const CCCompressedBitmapContainer *A, const CCCompressedBitmapContainer *B, CCCompressedBitmapContainer *Result)
+{
+    *Result = (CCCompressedBitmapContainer){ .key = A->key };
+    
+    if (B->type == CCCompressedBitmapContainerTypeArray)
+    {
+        const CCCompressedBitmapContainer *Temp = A;
+        A = B;
+        B = Temp;
+    }
+    
+    if (A->type == CCCompressedBitmapContainerTypeArray)
+    {
+        uint16_t *Values = CCMalloc(Allocator, sizeof(uint16_t) * (A->count ? A->count : 1), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Values) return FALSE;
+        
+        size_t Count = 0;
+        if ((B->type == CCCompressedBitmapContainerTypeArray) && ((B->count / 32) <= A->count) && ((A->count / 32) <= B->count))
+        {
+            for (size_t IndexA = 0, IndexB = 0; (IndexA < A->count) && (IndexB < B->count); )
+            {
+                const uint16_t ValueA = A->values[IndexA], ValueB = B->values[IndexB];
+                
+                if (ValueA == ValueB) Values[Count++] = ValueA;
+                
+                IndexA += ValueA <= ValueB;
+                IndexB += ValueB <= ValueA;
+            }
+        }
+        
+        else
+        {
+            for (size_t Loop = 0; Loop < A->count; Loop++)
+            {
+                if (CCCompressedBitmapContainerContains(B, A->values[Loop])) Values[Count++] = A->values[Loop];
+            }
+        }
+        
+        Result->type = CCCompressedBitmapContainerTypeArray;
+        Result->cardinality = (uint32_t)Count;
+        Result->count = (uint32_t)Count;
+        Result->capacity = (A->count ? A->count : 1);
+        Result->values = Values;
+        
+        return TRUE;
+    }
+    
+    uint64_t *Words = CCCompressedBitmapContainerCreateWords(Allocator, A);
+    if (!Words) return FALSE;
+    
+    if (B->type == CCCompressedBitmapContainerTypeBitmap) CCBitsAnd(Words, B->words, 0, CC_COMPRESSED_BITMAP_WORDS * 64);
+    else
+    {
+        uint64_t *Mask = CCCompressedBitmapContainerCreateWords(Allocator, B);
+        if (!Mask)
+        {
+            CCFree(Words);
+            
+            return FALSE;
+        }
+        
+        CCBitsAnd(Words, Mask, 0, CC_COMPRESSED_BITMAP_WORDS * 64);
+        CCFree(Mask);
+    }
+    
+    return CCCompressedBitmapContainerFromWords(Allocator, Words, (A->type == CCCompressedBitmapContainerTypeRun) && (B->type == CCCompressedBitmapContainerTypeRun), Result);
+}
+
+#pragma mark - Bitmap
+
+static size_t CCCompressedBitmapFind(CCCompressedBitmap Bitmap, uint16_t Key, _Bool *Found)
+{
+    size_t Low = 0, High = Bitmap->count;
+    
+    while (Low < High)
+    {
+        const size_t Mid = Low + ((High - Low) / 2);
+        
+        if (Bitmap->containers[Mid].key < Key) Low = Mid + 1;
+        else High = Mid;
+    }
+    
+    *Found = (Low < Bitmap->count) && (Bitmap->containers[Low].key == Key);
+    
+    return Low;
+}
+
+static _Bool CCCompressedBitmapInsertContainer(CCCompressedBitmap Bitmap, size_t Index, const CCCompressedBitmapContainer *Container)
+{
+    if (Bitmap->count == Bitmap->capacity)
+    {
+        const size_t Capacity = Bitmap->capacity ? Bitmap->capacity * 2 : 4;
+        CCCompressedBitmapContainer *Containers = CCRealloc(Bitmap->allocator, Bitmap->containers, sizeof(CCCompressedBitmapContainer) * Capacity, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Containers)
+        {
+            CC_LOG_ERROR("Failed to add container to bitmap (%p), could not allocate (%zu)", Bitmap, sizeof(CCCompressedBitmapContainer) * Capacity);
+            
+            return FALSE;
+        }
+        
+        Bitmap->containers = Containers;
+        Bitmap->capacity = Capacity;
+    }
+    
+    memmove(Bitmap->containers + Index + 1, Bitmap->containers + Index, sizeof(CCCompressedBitmapContainer) * (Bitmap->count - Index));
+    Bitmap->containers[Index] = *Container;
+    Bitmap->count++;
+    
+    return TRUE;
+}
+
+static void CCCompressedBitmapRemoveContainer(CCCompressedBitmap Bitmap, size_t Index)
+{
+    CCFree(Bitmap->containers[Index].data);
+    
+    memmove(Bitmap->containers + Index, Bitmap->containers + Index + 1, sizeof(CCCompressedBitmapContainer) * (Bitmap->count - (Index + 1)));
+    Bitmap->count--;
+}
+
+/// Append a container with a key greater than any existing key. Empty containers are discarded.
+static _Bool CCCompressedBitmapAppendContainer(CCCompressedBitmap Bitmap, const CCCompressedBitmapContainer *Container)
+{
+    if (!Container->cardinality)
+    {
+        CCFree(Container->data);
+        
+        return TRUE;
+    }
+    
+    if (!CCCompressedBitmapInsertContainer(Bitmap, Bitmap->count, Container))
+    {
+        CCFree(Container->data);
+        
+        return FALSE;
+    }
+    
+    return TRUE;
+}
+
+_Bool CCCompressedBitmapAdd(CCCompressedBitmap Bitmap, uint32_t Value)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    _Bool Found;
+    const size_t Index = CCCompressedBitmapFind(Bitmap, (uint16_t)(Value >> 16), &Found);
+    
+    if (!Found)
+    {
+        uint16_t *Values = CCMalloc(Bitmap->allocator, sizeof(uint16_t) * 4, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Values) return FALSE;
+        
+        Values[0] = (uint16_t)Value;
+        
+        if (!CCCompressedBitmapInsertContainer(Bitmap, Index, &(CCCompressedBitmapContainer){
+            .key = (uint16_t)(Value >> 16),
+            .type = CCCompressedBitmapContainerTypeArray,
+            .cardinality = 1,
+            .count = 1,
+            .capacity = 4,
+            .values = Values
+        }))
+        {
+            CCFree(Values);
+            
+            return FALSE;
+        }
+        
+        return TRUE;
+    }
+    
+    const int Result = CCCompressedBitmapContainerAdd(Bitmap->allocator, &Bitmap->containers[Index], (uint16_t)Value);
+    if (Result < 0) CC_LOG_ERROR("Failed to add value (%" PRIu32 ") to bitmap (%p)", Value, Bitmap);
+    
+    return Result > 0;
+}
+
+void CCCompressedBitmapAddRange(CCCompressedBitmap Bitmap, uint32_t Value, size_t Count)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(((size_t)Value + Count) <= (UINT64_C(1) << 32), "Range must not exceed the 32-bit range");
+    
+    for (uint64_t Start = Value, End = (uint64_t)Value + Count; Start < End; )
+    {
+        const uint16_t Key = (uint16_t)(Start >> 16);
+        const size_t Low = Start & 0xffff, Length = CCMin((size_t)(End - Start), 0x10000 - Low);
+        
+        _Bool Found;
+        const size_t Index = CCCompressedBitmapFind(Bitmap, Key, &Found);
+        
+        CCCompressedBitmapContainer Container = { .key = Key };
+        
+        if (Length == 0x10000)
+        {
+            CCCompressedBitmapRun *Run = CCMalloc(Bitmap->allocator, sizeof(CCCompressedBitmapRun), NULL, CC_DEFAULT_ERROR_CALLBACK);
+            if (!Run)
+            {
+                CC_LOG_ERROR("Failed to add range to bitmap (%p)", Bitmap);
+                
+                return;
+            }
+            
+            *Run = (CCCompressedBitmapRun){ .start = 0, .length = UINT16_MAX };
+            Container = (CCCompressedBitmapContainer){
+                .key = Key,
+                .type = CCCompressedBitmapContainerTypeRun,
+                .cardinality = 0x10000,
+                .count = 1,
+                .capacity = 1,
+                .runs = Run
+            };
+        }
+        
+        else
+        {
+            uint64_t *Words = CCCompressedBitmapContainerCreateWords(Bitmap->allocator, Found ? &Bitmap->containers[Index] : NULL);
+            if (!Words)
+            {
+                CC_LOG_ERROR("Failed to add range to bitmap (%p)", Bitmap);
+                
+                return;
+            }
+            
+            CCCompressedBitmapWordsSetRange(Words, Low, Length);
+            
+            if (!CCCompressedBitmapContainerFromWords(Bitmap->allocator, Words, TRUE, &Container))
+            {
+                CC_LOG_ERROR("Failed to add range to bitmap (%p)", Bitmap);
+                
+                return;
+            }
+        }
+        
+        if (Found)
+        {
+            CCFree(Bitmap->containers[Index].data);
+            Bitmap->containers[Index] = Container;
+        }
+        
+        else if (!CCCompressedBitmapInsertContainer(Bitmap, Index, &Container))
+        {
+            CCFree(Container.data);
+            
+            return;
+        }
+        
+        Start += Length;
+    }
+}
+
+_Bool CCCompressedBitmapRemove(CCCompressedBitmap Bitmap, uint32_t Value)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    _Bool Found;
+    const size_t Index = CCCompressedBitmapFind(Bitmap, (uint16_t)(Value >> 16), &Found);
+    
+    if (!Found) return FALSE;
+    
+    const int Result = CCCompressedBitmapContainerRemove(Bitmap->allocator, &Bitmap->containers[Index], (uint16_t)Value);
+    if (Result < 0) CC_LOG_ERROR("Failed to remove value (%" PRIu32 ") from bitmap (%p)", Value, Bitmap);
+    
+    if (!Bitmap->containers[Index].cardinality) CCCompressedBitmapRemoveContainer(Bitmap, Index);
+    
+    return Result > 0;
+}
+
+void CCCompressedBitmapRemoveAll(CCCompressedBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    for (size_t Loop = 0; Loop < Bitmap->count; Loop++) CCFree(Bitmap->containers[Loop].data);
+    
+    Bitmap->count = 0;
+}
+
+void CCCompressedBitmapOptimize(CCCompressedBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    for (size_t Loop = 0; Loop < Bitmap->count; Loop++)
+    {
+        if (!CCCompressedBitmapContainerRepack(Bitmap->allocator, &Bitmap->containers[Loop], TRUE)) CC_LOG_ERROR("Failed to optimize container (%zu) of bitmap (%p)", Loop, Bitmap);
+    }
+}
+
+_Bool CCCompressedBitmapContains(CCCompressedBitmap Bitmap, uint32_t Value)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    _Bool Found;
+    const size_t Index = CCCompressedBitmapFind(Bitmap, (uint16_t)(Value >> 16), &Found);
+    
+    return Found && CCCompressedBitmapContainerContains(&Bitmap->containers[Index], (uint16_t)Value);
+}
+
+size_t CCCompressedBitmapGetCount(CCCompressedBitmap Bitmap)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    size_t Count = 0;
+    for (size_t Loop = 0; Loop < Bitmap->count; Loop++) Count += Bitmap->containers[Loop].cardinality;
+    
+    return Count;
+}
+
+CCCompressedBitmap CCCompressedBitmapCreateUnion(CCAllocatorType Allocator, CCCompressedBitmap A, CCCompressedBitmap B)
+{
+    CCAssertLog(A, "A must not be null");
+    CCAssertLog(B, "B must not be null");
+    
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(Allocator);
+    if (!Bitmap) return NULL;
+    
+    size_t IndexA = 0, IndexB = 0;
+    while ((IndexA < A->count) || (IndexB < B->count))
+    {
+        const CCCompressedBitmapContainer *ContainerA = IndexA < A->count ? &A->containers[IndexA] : NULL;
+        const CCCompressedBitmapContainer *ContainerB = IndexB < B->count ? &B->containers[IndexB] : NULL;
+        
+        CCCompressedBitmapContainer Container;
+        _Bool Success;
+        
+        if ((ContainerA) && (ContainerB) && (ContainerA->key == ContainerB->key))
+        {
+            Success = CCCompressedBitmapContainerUnion(Allocator, ContainerA, ContainerB, &Container);
+            IndexA++;
+            IndexB++;
+        }
+        
+        else if ((ContainerA) && ((!ContainerB) || (ContainerA->key < ContainerB->key)))
+        {
+            Success = CCCompressedBitmapContainerCopy(Allocator, ContainerA, &Container);
+            IndexA++;
+        }
+        
+        else
+        {
+            Success = CCCompressedBitmapContainerCopy(Allocator, ContainerB, &Container);
+            IndexB++;
+        }
+        
+        if ((!Success) || (!CCCompressedBitmapAppendContainer(Bitmap, &Container)))
+        {
+            CC_LOG_ERROR("Failed to create union of bitmaps (%p) and (%p)", A, B);
+            CCCompressedBitmapDestroy(Bitmap);
+            
+            return NULL;
+        }
+    }
+    
+    return Bitmap;
+}
+
+CCCompressedBitmap CCCompressedBitmapCreateIntersection(CCAllocatorType Allocator, CCCompressedBitmap A, CCCompressedBitmap B)
+{
+    CCAssertLog(A, "A must not be null");
+    CCAssertLog(B, "B must not be null");
+    
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(Allocator);
+    if (!Bitmap) return NULL;
+    
+    for (size_t IndexA = 0, IndexB = 0; (IndexA < A->count) && (IndexB < B->count); )
+    {
+        const CCCompressedBitmapContainer *ContainerA = &A->containers[IndexA], *ContainerB = &B->containers[IndexB];
+        
+        if (ContainerA->key < ContainerB->key) IndexA++;
+        else if (ContainerA->key > ContainerB->key) IndexB++;
+        else
+        {
+            CCCompressedBitmapContainer Container;
+            
+            if ((!CCCompressedBitmapContainerIntersection(Allocator, ContainerA, ContainerB, &Container)) || (!CCCompressedBitmapAppendContainer(Bitmap, &Container)))
+            {
+                CC_LOG_ERROR("Failed to create intersection of bitmaps (%p) and (%p)", A, B);
+                CCCompressedBitmapDestroy(Bitmap);
+                
+                return NULL;
+            }
+            
+            IndexA++;
+            IndexB++;
+        }
+    }
+    
+    return Bitmap;
+}
+
+#pragma mark - Enumeration
+
+/// Get the first value at or after the offset in the container, or SIZE_MAX if there is none.
+static size_t CCCompressedBitmapContainerNext(const CCCompressedBitmapContainer *Container, size_t Offset)
+{
+    if (Offset > UINT16_MAX) return SIZE_MAX;
+    
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+        {
+            _Bool Found;
+            const size_t Index = CCCompressedBitmapContainerArrayFind(Container, (uint16_t)Offset, &Found);
+            
+            return Index < Container->count ? Container->values[Index] : SIZE_MAX;
+        }
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            return CCBitsFindFirstSet(Container->words, Offset, (CC_COMPRESSED_BITMAP_WORDS * 64) - Offset);
+            
+        case CCCompressedBitmapContainerTypeRun:
+        {
+            const size_t Run = CCCompressedBitmapContainerRunFind(Container, (uint16_t)Offset);
+            
+            if ((Run != SIZE_MAX) && ((Offset - Container->runs[Run].start) <= Container->runs[Run].length)) return Offset;
+            
+            return (Run + 1) < Container->count ? Container->runs[Run + 1].start : SIZE_MAX;
+        }
+    }
+    
+    return SIZE_MAX;
+}
+
+/// Get the last value at or before the offset in the container, or SIZE_MAX if there is none.
+static size_t CCCompressedBitmapContainerPrevious(const CCCompressedBitmapContainer *Container, size_t Offset)
+{
+    if (Offset == SIZE_MAX) return SIZE_MAX;
+    
+    switch (Container->type)
+    {
+        case CCCompressedBitmapContainerTypeArray:
+        {
+            _Bool Found;
+            const size_t Index = CCCompressedBitmapContainerArrayFind(Container, (uint16_t)Offset, &Found);
+            
+            if (Found) return Offset;
+            
+            return Index ? Container->values[Index - 1] : SIZE_MAX;
+        }
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+            return CCBitsFindLastSet(Container->words, 0, Offset + 1);
+            
+        case CCCompressedBitmapContainerTypeRun:
+        {
+            const size_t Run = CCCompressedBitmapContainerRunFind(Container, (uint16_t)Offset);
+            
+            if (Run == SIZE_MAX) return SIZE_MAX;
+            
+            return CCMin(Offset, (size_t)Container->runs[Run].start + Container->runs[Run].length);
+        }
+    }
+    
+    return SIZE_MAX;
+}
+
+static void *CCCompressedBitmapEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableAction Action)
+{
+    CCCompressedBitmap Bitmap = Enumerator->ref;
+    uint32_t *Value = (uint32_t*)&Enumerator->state.internal.extra[0];
+    size_t *Index = (size_t*)&Enumerator->state.internal.extra[1];
+    
+    switch (Action)
+    {
+        case CCEnumerableActionHead:
+            *Index = 0;
+            if (*Index < Bitmap->count) *Value = ((uint32_t)Bitmap->containers[*Index].key << 16) | (uint32_t)CCCompressedBitmapContainerNext(&Bitmap->containers[*Index], 0);
+            break;
+            
+        case CCEnumerableActionTail:
+            *Index = Bitmap->count ? Bitmap->count - 1 : SIZE_MAX;
+            if (*Index != SIZE_MAX) *Value = ((uint32_t)Bitmap->containers[*Index].key << 16) | (uint32_t)CCCompressedBitmapContainerPrevious(&Bitmap->containers[*Index], UINT16_MAX);
+            break;
+            
+        case CCEnumerableActionNext:
+            if (*Index < Bitmap->count)
+            {
+                const size_t Next = CCCompressedBitmapContainerNext(&Bitmap->containers[*Index], (size_t)(*Value & 0xffff) + 1);
+                
+                if (Next != SIZE_MAX) *Value = (*Value & 0xffff0000) | (uint32_t)Next;
+                else if (++*Index < Bitmap->count) *Value = ((uint32_t)Bitmap->containers[*Index].key << 16) | (uint32_t)CCCompressedBitmapContainerNext(&Bitmap->containers[*Index], 0);
+            }
+            break;
+            
+        case CCEnumerableActionPrevious:
+            if (*Index < Bitmap->count)
+            {
+                const size_t Previous = CCCompressedBitmapContainerPrevious(&Bitmap->containers[*Index], (size_t)(*Value & 0xffff) - 1);
+                
+                if (Previous != SIZE_MAX) *Value = (*Value & 0xffff0000) | (uint32_t)Previous;
+                else if (*Index)
+                {
+                    --*Index;
+                    *Value = ((uint32_t)Bitmap->containers[*Index].key << 16) | (uint32_t)CCCompressedBitmapContainerPrevious(&Bitmap->containers[*Index], UINT16_MAX);
+                }
+                
+                else *Index = SIZE_MAX;
+            }
+            break;
+            
+        case CCEnumerableActionCurrent:
+            break;
+    }
+    
+    return *Index < Bitmap->count ? Value : NULL;
+}
+
+void CCCompressedBitmapGetEnumerable(CCCompressedBitmap Bitmap, CCEnumerable *Enumerable)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    *Enumerable = (CCEnumerable){
+        .handler = CCCompressedBitmapEnumerableHandler,
+        .enumerator = {
+            .ref = Bitmap,
+            .state = {
+                .internal = { .ptr = NULL },
+                .type = CCEnumeratorFormatInternal
+            }
+        }
+    };
+    
+    CCCompressedBitmapEnumerableHandler(&Enumerable->enumerator, CCEnumerableActionHead);
+}
+
+#pragma mark - Serialization
+
+size_t CCCompressedBitmapSerialize(CCCompressedBitmap Bitmap, uint16_t *Words)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    size_t Count = 0;
+    for (size_t Loop = 0; Loop < Bitmap->count; Loop++)
+    {
+        const CCCompressedBitmapContainer *Container = &Bitmap->containers[Loop];
+        
+        switch (Container->type)
+        {
+            case CCCompressedBitmapContainerTypeArray:
+                if (Words)
+                {
+                    Words[Count] = Container->key;
+                    Words[Count + 1] = Container->type;
+                    Words[Count + 2] = (uint16_t)(Container->count - 1);
+                    memcpy(Words + Count + 3, Container->values, sizeof(uint16_t) * Container->count);
+                }
+                
+                Count += 3 + Container->count;
+                break;
+                
+            case CCCompressedBitmapContainerTypeBitmap:
+                if (Words)
+                {
+                    Words[Count] = Container->key;
+                    Words[Count + 1] = Container->type;
+                    Words[Count + 2] = (uint16_t)(Container->cardinality - 1);
+                    
+                    for (size_t Word = 0; Word < CC_COMPRESSED_BITMAP_WORDS; Word++)
+                    {
+                        for (size_t Part = 0; Part < 4; Part++) Words[Count + 3 + (Word * 4) + Part] = (uint16_t)(Container->words[Word] >> (Part * 16));
+                    }
+                }
+                
+                Count += 3 + (CC_COMPRESSED_BITMAP_WORDS * 4);
+                break;
+                
+            case CCCompressedBitmapContainerTypeRun:
+                if (Words)
+                {
+                    Words[Count] = Container->key;
+                    Words[Count + 1] = Container->type;
+                    Words[Count + 2] = (uint16_t)(Container->count - 1);
+                    
+                    for (size_t Run = 0; Run < Container->count; Run++)
+                    {
+                        Words[Count + 3 + (Run * 2)] = Container->runs[Run].start;
+                        Words[Count + 4 + (Run * 2)] = Container->runs[Run].length;
+                    }
+                }
+                
+                Count += 3 + (Container->count * 2);
+                break;
+        }
+    }
+    
+    return Count;
+}
+
+static _Bool CCCompressedBitmapDeserializeContainer(CCAllocatorType Allocator, const uint16_t *Words, size_t Count, size_t *Offset, CCCompressedBitmapContainer *Container)
+{
+    if ((Count - *Offset) < 3) return FALSE;
+    
+    const uint16_t *Header = Words + *Offset;
+    const size_t N = (size_t)Header[2] + 1;
+    
+    *Offset += 3;
+    *Container = (CCCompressedBitmapContainer){ .key = Header[0], .type = (CCCompressedBitmapContainerType)Header[1] };
+    
+    switch (Header[1])
+    {
+        case CCCompressedBitmapContainerTypeArray:
+        {
+            if ((N > CC_COMPRESSED_BITMAP_ARRAY_MAX) || ((Count - *Offset) < N)) return FALSE;
+            
+            const uint16_t *Values = Words + *Offset;
+            for (size_t Loop = 1; Loop < N; Loop++)
+            {
+                if (Values[Loop - 1] >= Values[Loop]) return FALSE;
+            }
+            
+            if (!(Container->values = CCMalloc(Allocator, sizeof(uint16_t) * N, NULL, CC_DEFAULT_ERROR_CALLBACK))) return FALSE;
+            
+            memcpy(Container->values, Values, sizeof(uint16_t) * N);
+            
+            Container->cardinality = (uint32_t)N;
+            Container->count = (uint32_t)N;
+            Container->capacity = (uint32_t)N;
+            *Offset += N;
+            break;
+        }
+            
+        case CCCompressedBitmapContainerTypeBitmap:
+        {
+            if ((Count - *Offset) < (CC_COMPRESSED_BITMAP_WORDS * 4)) return FALSE;
+            
+            if (!(Container->words = CCMalloc(Allocator, CC_COMPRESSED_BITMAP_BITMAP_SIZE, NULL, CC_DEFAULT_ERROR_CALLBACK))) return FALSE;
+            
+            for (size_t Word = 0; Word < CC_COMPRESSED_BITMAP_WORDS; Word++)
+            {
+                uint64_t Value = 0;
+                for (size_t Part = 0; Part < 4; Part++) Value |= (uint64_t)Words[*Offset + (Word * 4) + Part] << (Part * 16);
+                
+                Container->words[Word] = Value;
+            }
+            
+            Container->cardinality = (uint32_t)CCBitsCount(Container->words, 0, CC_COMPRESSED_BITMAP_WORDS * 64);
+            *Offset += CC_COMPRESSED_BITMAP_WORDS * 4;
+            
+            if (Container->cardinality != N)
+            {
+                CCFree(Container->words);
+                
+                return FALSE;
+            }
+            break;
+        }
+            
+        case CCCompressedBitmapContainerTypeRun:
+        {
+            if ((Count - *Offset) < (N * 2)) return FALSE;
+            
+            const uint16_t *Runs = Words + *Offset;
+            size_t Cardinality = 0;
+            for (size_t Loop = 0; Loop < N; Loop++)
+            {
+                const size_t Start = Runs[Loop * 2], Length = Runs[(Loop * 2) + 1];
+                
+                if ((Start + Length) > UINT16_MAX) return FALSE;
+                if ((Loop) && (Start <= ((size_t)Runs[(Loop - 1) * 2] + Runs[((Loop - 1) * 2) + 1] + 1))) return FALSE;
+                
+                Cardinality += Length + 1;
+            }
+            
+            if (!(Container->runs = CCMalloc(Allocator, sizeof(CCCompressedBitmapRun) * N, NULL, CC_DEFAULT_ERROR_CALLBACK))) return FALSE;
+            
+            for (size_t Loop = 0; Loop < N; Loop++) Container->runs[Loop] = (CCCompressedBitmapRun){ .start = Runs[Loop * 2], .length = Runs[(Loop * 2) + 1] };
+            
+            Container->cardinality = (uint32_t)Cardinality;
+            Container->count = (uint32_t)N;
+            Container->capacity = (uint32_t)N;
+            *Offset += N * 2;
+            break;
+        }
+            
+        default:
+            return FALSE;
+    }
+    
+    return TRUE;
+}
+
+CCCompressedBitmap CCCompressedBitmapCreateWithSerialized(CCAllocatorType Allocator, const uint16_t *Words, size_t Count)
+{
+    CCAssertLog(Words || !Count, "Words must not be null");
+    
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(Allocator);
+    if (!Bitmap) return NULL;
+    
+    for (size_t Offset = 0; Offset < Count; )
+    {
+        CCCompressedBitmapContainer Container;
+        
+        if ((!CCCompressedBitmapDeserializeContainer(Allocator, Words, Count, &Offset, &Container)) || ((Bitmap->count) && (Bitmap->containers[Bitmap->count - 1].key >= Container.key)) || (!CCCompressedBitmapAppendContainer(Bitmap, &Container)))
+        {
+            CCCompressedBitmapDestroy(Bitmap);
+            
+            return NULL;
+        }
+    }
+    
+    return Bitmap;
+}
+
+#pragma mark - Interoperability
+
+void CCCompressedBitmapAddCollection(CCCompressedBitmap Bitmap, CCCollection(uint32_t) Collection)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Collection, "Collection must not be null");
+    
+    CCEnumerable Enumerable;
+    CCCollectionGetEnumerable(Collection, &Enumerable);
+    
+    for (const uint32_t *Value = CCEnumerableGetCurrent(&Enumerable); Value; Value = CCEnumerableNext(&Enumerable))
+    {
+        CCCompressedBitmapAdd(Bitmap, *Value);
+    }
+}
+
+CCCollection(uint32_t) CCCompressedBitmapCreateCollection(CCAllocatorType Allocator, CCCompressedBitmap Bitmap, CCCollectionHint Hint)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    
+    CCCollection(uint32_t) Collection = CCCollectionCreate(Allocator, Hint, sizeof(uint32_t), NULL);
+    if (Collection)
+    {
+        CCEnumerable Enumerable;
+        CCCompressedBitmapGetEnumerable(Bitmap, &Enumerable);
+        
+        for (const uint32_t *Value = CCEnumerableGetCurrent(&Enumerable); Value; Value = CCEnumerableNext(&Enumerable))
+        {
+            if (Hint & CCCollectionHintOrdered) CCOrderedCollectionAppendElement(Collection, Value);
+            else CCCollectionInsertElement(Collection, Value);
+        }
+    }
+    
+    return Collection;
+}
+
+_Bool CCCompressedBitmapTryAssignID(CCCompressedBitmap Bitmap, CCConcurrentIDGenerator Generator, uintptr_t *ID)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Generator, "Generator must not be null");
+    CCAssertLog(ID, "ID must not be null");
+    
+    if (!CCConcurrentIDGeneratorTryAssign(Generator, ID)) return FALSE;
+    
+    CCAssertLog(*ID <= UINT32_MAX, "ID must not exceed the 32-bit range");
+    
+    CCCompressedBitmapAdd(Bitmap, (uint32_t)*ID);
+    
+    return TRUE;
+}
+
+void CCCompressedBitmapRecycleIDs(CCCompressedBitmap Bitmap, CCConcurrentIDGenerator Generator)
+{
+    CCAssertLog(Bitmap, "Bitmap must not be null");
+    CCAssertLog(Generator, "Generator must not be null");
+    
+    CCEnumerable Enumerable;
+    CCCompressedBitmapGetEnumerable(Bitmap, &Enumerable);
+    
+    for (const uint32_t *Value = CCEnumerableGetCurrent(&Enumerable); Value; Value = CCEnumerableNext(&Enumerable))
+    {
+        CCConcurrentIDGeneratorRecycle(Generator, *Value);
+    }
+    
+    CCCompressedBitmapRemoveAll(Bitmap);
+}
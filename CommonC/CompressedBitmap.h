@@ -0,0 +1,259 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCCompressedBitmap
+ * CCCompressedBitmap implements a compressed set of 32-bit values.
+ *
+ * The value range is split into chunks of 65536 values keyed by the upper 16 bits. Each
+ * chunk is stored in whichever container is the most compact for its contents: a sorted
+ * array for sparse chunks (up to 4096 values), a bitmap for dense chunks, or runs of
+ * consecutive values for clustered chunks. Chunks without any values are not stored.
+ *
+ * Unlike @b CCBits, memory is proportional to the contents rather than the range of values,
+ * making it suited for sparse or clustered sets across a large universe.
+ */
+#ifndef CommonC_CompressedBitmap_h
+#define CommonC_CompressedBitmap_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Enumerable.h>
+#include <CommonC/Collection.h>
+#include <CommonC/ConcurrentIDGenerator.h>
+
+/*!
+ * @brief The compressed bitmap.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCCompressedBitmapInfo *CCCompressedBitmap;
+
+
+#pragma mark - Creation / Destruction
+
+/*!
+ * @brief Create an empty compressed bitmap.
+ * @param Allocator The allocator to be used for the allocations.
+ * @return The compressed bitmap, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCCompressedBitmap CCCompressedBitmapCreate(CCAllocatorType Allocator);
+
+/*!
+ * @brief Create a compressed bitmap from its serialized form.
+ * @param Allocator The allocator to be used for the allocations.
+ * @param Words The serialized words produced by @b CCCompressedBitmapSerialize.
+ * @param Count The number of serialized words.
+ * @return The compressed bitmap, or NULL if the words are malformed or on failure. Must be
+ *         destroyed to free the memory.
+ */
+CC_NEW CCCompressedBitmap CCCompressedBitmapCreateWithSerialized(CCAllocatorType Allocator, const uint16_t *Words, size_t Count);
+
+/*!
+ * @brief Create a compressed bitmap containing the values of either bitmap.
+ * @param Allocator The allocator to be used for the allocations.
+ * @param A The first bitmap.
+ * @param B The second bitmap.
+ * @return The compressed bitmap, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCCompressedBitmap CCCompressedBitmapCreateUnion(CCAllocatorType Allocator, CCCompressedBitmap A, CCCompressedBitmap B);
+
+/*!
+ * @brief Create a compressed bitmap containing the values present in both bitmaps.
+ * @param Allocator The allocator to be used for the allocations.
+ * @param A The first bitmap.
+ * @param B The second bitmap.
+ * @return The compressed bitmap, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCCompressedBitmap CCCompressedBitmapCreateIntersection(CCAllocatorType Allocator, CCCompressedBitmap A, CCCompressedBitmap B);
+
+/*!
+ * @brief Destroy a compressed bitmap.
+ * @param Bitmap The compressed bitmap to be destroyed.
+ */
+void CCCompressedBitmapDestroy(CCCompressedBitmap CC_DESTROY(Bitmap));
+
+
+#pragma mark - Modification
+
+/*!
+ * @brief Add a value to the bitmap.
+ * @param Bitmap The compressed bitmap.
+ * @param Value The value to be added.
+ * @return TRUE if the value was added, or FALSE if it was already present or on failure.
+ */
+_Bool CCCompressedBitmapAdd(CCCompressedBitmap Bitmap, uint32_t Value);
+
+/*!
+ * @brief Add a range of consecutive values to the bitmap.
+ * @description Fully covered chunks are stored as a single run.
+ * @param Bitmap The compressed bitmap.
+ * @param Value The first value to be added.
+ * @param Count The number of values to be added. Must not exceed the 32-bit range.
+ */
+void CCCompressedBitmapAddRange(CCCompressedBitmap Bitmap, uint32_t Value, size_t Count);
+
+/*!
+ * @brief Remove a value from the bitmap.
+ * @param Bitmap The compressed bitmap.
+ * @param Value The value to be removed.
+ * @return TRUE if the value was removed, or FALSE if it was not present.
+ */
+_Bool CCCompressedBitmapRemove(CCCompressedBitmap Bitmap, uint32_t Value);
+
+/*!
+ * @brief Remove all values from the bitmap.
+ * @param Bitmap The compressed bitmap.
+ */
+void CCCompressedBitmapRemoveAll(CCCompressedBitmap Bitmap);
+
+/*!
+ * @brief Convert any chunks to runs where they would be more compact.
+ * @description Runs are only created by ranges or this call, as checking for them on every
+ *              modification would slow down insertions.
+ *
+ * @param Bitmap The compressed bitmap.
+ */
+void CCCompressedBitmapOptimize(CCCompressedBitmap Bitmap);
+
+
+#pragma mark - Query
+
+/*!
+ * @brief Check whether a value is in the bitmap.
+ * @param Bitmap The compressed bitmap.
+ * @param Value The value to check for.
+ * @return TRUE if the value is present, otherwise FALSE.
+ */
+_Bool CCCompressedBitmapContains(CCCompressedBitmap Bitmap, uint32_t Value);
+
+/*!
+ * @brief Get the number of values in the bitmap.
+ * @param Bitmap The compressed bitmap.
+ * @return The number of values.
+ */
+size_t CCCompressedBitmapGetCount(CCCompressedBitmap Bitmap);
+
+/*!
+ * @brief Get an enumerable for the bitmap.
+ * @description Values are enumerated in ascending order. Each value of the enumerable is a
+ *              pointer to a @b uint32_t. The bitmap must not be modified while enumerating.
+ *
+ * @param Bitmap The compressed bitmap.
+ * @param Enumerable A pointer to the enumerable to use.
+ */
+void CCCompressedBitmapGetEnumerable(CCCompressedBitmap Bitmap, CCEnumerable *Enumerable);
+
+
+#pragma mark - Serialization
+
+/*!
+ * @brief Serialize the bitmap.
+ * @description Each chunk is written as its key, container type and size, followed by its
+ *              container contents.
+ *
+ * @param Bitmap The compressed bitmap.
+ * @param Words The words to write to, or NULL to only get the number of words needed.
+ * @return The number of serialized words.
+ */
+size_t CCCompressedBitmapSerialize(CCCompressedBitmap Bitmap, uint16_t *Words);
+
+
+#pragma mark - Interoperability
+
+/*!
+ * @brief Add the values of a collection to the bitmap.
+ * @param Bitmap The compressed bitmap.
+ * @param Collection The collection of values to be added.
+ */
+void CCCompressedBitmapAddCollection(CCCompressedBitmap Bitmap, CCCollection(uint32_t) Collection);
+
+/*!
+ * @brief Create a collection of the values in the bitmap.
+ * @param Allocator The allocator to be used for the collection.
+ * @param Bitmap The compressed bitmap.
+ * @param Hint The hints describing the intended usage of the collection. Ordered collections
+ *        will contain the values in ascending order.
+ *
+ * @return The collection, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCCollection(uint32_t) CCCompressedBitmapCreateCollection(CCAllocatorType Allocator, CCCompressedBitmap Bitmap, CCCollectionHint Hint);
+
+/*!
+ * @brief Assign an ID from a generator and add it to the bitmap.
+ * @description Allows the bitmap to track the membership of IDs assigned to an owner.
+ * @param Bitmap The compressed bitmap.
+ * @param Generator The ID generator. Must not assign IDs beyond the 32-bit range.
+ * @param ID The pointer to where the assigned ID should be stored.
+ * @return Whether an ID was assigned (TRUE), or not (FALSE).
+ */
+_Bool CCCompressedBitmapTryAssignID(CCCompressedBitmap Bitmap, CCConcurrentIDGenerator Generator, uintptr_t *ID);
+
+/*!
+ * @brief Recycle all the IDs in the bitmap back to a generator and remove them from the bitmap.
+ * @param Bitmap The compressed bitmap.
+ * @param Generator The ID generator that assigned the IDs.
+ */
+void CCCompressedBitmapRecycleIDs(CCCompressedBitmap Bitmap, CCConcurrentIDGenerator Generator);
+
+#pragma mark -
+
+#define CC_TYPE_CCCompressedBitmap(...) CCCompressedBitmap
+#define CC_TYPE_0_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_1_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_2_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_3_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_4_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_5_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_6_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_7_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_8_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+#define CC_TYPE_9_CCCompressedBitmap CC_TYPE_CCCompressedBitmap,
+
+#define CC_PRESERVE_CC_TYPE_CCCompressedBitmap CC_TYPE_CCCompressedBitmap
+
+#define CC_TYPE_DECL_CCCompressedBitmap(...) CCCompressedBitmap, __VA_ARGS__
+#define CC_TYPE_DECL_0_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_1_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_2_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_3_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_4_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_5_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_6_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_7_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_8_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+#define CC_TYPE_DECL_9_CCCompressedBitmap CC_TYPE_DECL_CCCompressedBitmap,
+
+#define CC_MANGLE_TYPE_0_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_1_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_2_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_3_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_4_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_5_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_6_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_7_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_8_CCCompressedBitmap CCCompressedBitmap
+#define CC_MANGLE_TYPE_9_CCCompressedBitmap CCCompressedBitmap
+
+#endif
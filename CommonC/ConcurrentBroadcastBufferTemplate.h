@@ -0,0 +1,234 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ A lock-free broadcast ring buffer implementation.
+ Allows for single producer-multiple consumer access, where every consumer sees every item.
+ 
+ This is a low level interface and should only be used in specific use case.
+ The buffer is a fixed size and will fail to add more items once the slowest consumer falls a full buffer behind.
+ 
+ Each consumer has its own read cursor. A consumer may additionally depend on other consumers, in which case it
+ will only see an item once all of those consumers have released it. This allows for processing pipelines (e.g.
+ a journaling consumer followed by a consumer that applies the items) without any additional queues.
+ 
+ The dependencies of the consumers should be set before the buffer is used.
+*/
+
+#include <CommonC/Template.h>
+#include <CommonC/Assertion.h>
+#include <CommonC/BitTricks.h>
+#include <CommonC/Enumerable.h>
+#include <CommonC/CircularEnumerable.h>
+
+#define CC_CONCURRENT_BROADCAST_BUFFER_INIT { .published = ATOMIC_VAR_INIT(0) }
+
+#define CCConcurrentBroadcastBufferSetDependencies_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferSetDependencies, void, PTYPE(t *), size_t, uint64_t)
+#define CCConcurrentBroadcastBufferClaim_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferClaim, size_t, PTYPE(t *), size_t)
+#define CCConcurrentBroadcastBufferGetClaimedItem_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferGetClaimedItem, PTYPE(void *), PTYPE(t *), size_t)
+#define CCConcurrentBroadcastBufferPublish_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferPublish, void, PTYPE(t *), size_t)
+#define CCConcurrentBroadcastBufferAddItem_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferAddItem, _Bool, PTYPE(t *), const PTYPE(void *))
+#define CCConcurrentBroadcastBufferAddItems_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferAddItems, size_t, PTYPE(t *), const PTYPE(void *), size_t)
+#define CCConcurrentBroadcastBufferGetAvailableCount_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferGetAvailableCount, size_t, PTYPE(t *), size_t)
+#define CCConcurrentBroadcastBufferGetEnumerable_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferGetEnumerable, void, PTYPE(t *), size_t, PTYPE(CCEnumerable *))
+#define CCConcurrentBroadcastBufferRelease_T(t) CC_TEMPLATE_REF(CCConcurrentBroadcastBufferRelease, void, PTYPE(t *), size_t, PTYPE(CCEnumerable *))
+
+#undef CCConcurrentBroadcastBuffer
+
+/*!
+ * @brief Set the consumers a consumer depends on.
+ * @description The consumer will only see items after all of the consumers it depends on have released them.
+ * @warning Should be set before the buffer is used. Dependencies must not form a cycle.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Consumer The index of the consumer.
+ * @param Dependencies A mask of the consumer indexes the consumer depends on, where bit N refers to consumer N.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferSetDependencies, (PTYPE(T *) Buffer, size_t Consumer, uint64_t Dependencies));
+
+/*!
+ * @brief Claim space for items in the broadcast buffer.
+ * @description The claimed items should be written using @b CCConcurrentBroadcastBufferGetClaimedItem and made
+ *              visible to the consumers using @b CCConcurrentBroadcastBufferPublish.
+ *
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Count The number of items wanting to be claimed.
+ * @return The number of items that were claimed. If fewer than requested, the slowest consumer has fallen behind.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentBroadcastBufferClaim, (PTYPE(T *) Buffer, size_t Count));
+
+/*!
+ * @brief Get a claimed item.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Index The index of the item relative to the first claimed item.
+ * @return A pointer to the item to be written.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE PTYPE(void *), CCConcurrentBroadcastBufferGetClaimedItem, (PTYPE(T *) Buffer, size_t Index));
+
+/*!
+ * @brief Publish the claimed items to the consumers.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Count The number of claimed items to be published.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferPublish, (PTYPE(T *) Buffer, size_t Count));
+
+/*!
+ * @brief Add an item to the broadcast buffer.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Item A pointer to the item that should be added to the broadcast buffer.
+ * @return Whether the item was successfully added (TRUE), or not (FALSE). If it was not, it means that the slowest
+ *         consumer has fallen behind.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentBroadcastBufferAddItem, (PTYPE(T *) Buffer, const PTYPE(void *) Item));
+
+/*!
+ * @brief Add items to the broadcast buffer.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Items A pointer to the items that should be added to the broadcast buffer.
+ * @param Count The number of items to be added.
+ * @return The number of items successfully added. If some items were not added it means that the slowest consumer has
+ *         fallen behind.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentBroadcastBufferAddItems, (PTYPE(T *) Buffer, const PTYPE(void *) Items, size_t Count));
+
+/*!
+ * @brief Get the number of items available to a consumer.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Consumer The index of the consumer.
+ * @return The number of items.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentBroadcastBufferGetAvailableCount, (PTYPE(T *) Buffer, size_t Consumer));
+
+/*!
+ * @brief Get the items available to a consumer.
+ * @description The enumerable may be used by many threads, but should not be used after the consumer releases it.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Consumer The index of the consumer.
+ * @param Enumerable A pointer to where the enumerable should be stored.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferGetEnumerable, (PTYPE(T *) Buffer, size_t Consumer, PTYPE(CCEnumerable *) Enumerable));
+
+/*!
+ * @brief Release the items in the enumerable, allowing the producer and dependent consumers to advance.
+ * @warning The enumerable should not be used after.
+ * @param Buffer The concurrent broadcast buffer.
+ * @param Consumer The index of the consumer.
+ * @param Enumerable A pointer to the enumerable to be released.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferRelease, (PTYPE(T *) Buffer, size_t Consumer, PTYPE(CCEnumerable *) Enumerable));
+
+#pragma mark -
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferSetDependencies, (PTYPE(T *) Buffer, size_t Consumer, uint64_t Dependencies))
+{
+    CCAssertLog(Consumer < Tconsumers, "Consumer must not be out of bounds");
+    CCAssertLog(!(Dependencies & (UINT64_C(1) << Consumer)), "Consumer must not depend on itself");
+    CCAssertLog((Tconsumers == 64) || !(Dependencies >> Tconsumers), "Dependencies must refer to valid consumers");
+    
+    Buffer->consumers[Consumer].dependencies = Dependencies;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentBroadcastBufferClaim, (PTYPE(T *) Buffer, size_t Count))
+{
+    const size_t Published = atomic_load_explicit(&Buffer->published, memory_order_relaxed);
+    
+    if ((Buffer->gate + Tmax - Published) < Count)
+    {
+        size_t Gate = Published;
+        for (size_t Loop = 0; Loop < Tconsumers; Loop++)
+        {
+            const size_t Cursor = atomic_load_explicit(&Buffer->consumers[Loop].cursor, memory_order_acquire);
+            
+            if (Cursor < Gate) Gate = Cursor;
+        }
+        
+        Buffer->gate = Gate;
+    }
+    
+    return CCMin(Count, Buffer->gate + Tmax - Published);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE PTYPE(void *), CCConcurrentBroadcastBufferGetClaimedItem, (PTYPE(T *) Buffer, size_t Index))
+{
+    CCAssertLog(Index < Tmax, "Index must not be out of bounds");
+    
+    return &Buffer->items[(atomic_load_explicit(&Buffer->published, memory_order_relaxed) + Index) % Tmax];
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferPublish, (PTYPE(T *) Buffer, size_t Count))
+{
+    atomic_store_explicit(&Buffer->published, atomic_load_explicit(&Buffer->published, memory_order_relaxed) + Count, memory_order_release);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentBroadcastBufferAddItem, (PTYPE(T *) Buffer, const PTYPE(void *) Item))
+{
+    return CCConcurrentBroadcastBufferAddItems_T(T)(Buffer, Item, 1);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentBroadcastBufferAddItems, (PTYPE(T *) Buffer, const PTYPE(void *) Items, size_t Count))
+{
+    Count = CCConcurrentBroadcastBufferClaim_T(T)(Buffer, Count);
+    
+    for (size_t Loop = 0; Loop < Count; Loop++) *(Titem*)CCConcurrentBroadcastBufferGetClaimedItem_T(T)(Buffer, Loop) = ((const Titem*)Items)[Loop];
+    
+    if (Count) CCConcurrentBroadcastBufferPublish_T(T)(Buffer, Count);
+    
+    return Count;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentBroadcastBufferGetAvailableCount, (PTYPE(T *) Buffer, size_t Consumer))
+{
+    CCAssertLog(Consumer < Tconsumers, "Consumer must not be out of bounds");
+    
+    size_t Limit = atomic_load_explicit(&Buffer->published, memory_order_acquire);
+    
+    for (uint64_t Dependencies = Buffer->consumers[Consumer].dependencies; Dependencies; Dependencies &= Dependencies - 1)
+    {
+        const size_t Cursor = atomic_load_explicit(&Buffer->consumers[CCBitCountLowestUnset(Dependencies)].cursor, memory_order_acquire);
+        
+        if (Cursor < Limit) Limit = Cursor;
+    }
+    
+    return Limit - atomic_load_explicit(&Buffer->consumers[Consumer].cursor, memory_order_relaxed);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferGetEnumerable, (PTYPE(T *) Buffer, size_t Consumer, PTYPE(CCEnumerable *) Enumerable))
+{
+    const size_t Count = CCConcurrentBroadcastBufferGetAvailableCount_T(T)(Buffer, Consumer);
+    const size_t Cursor = atomic_load_explicit(&Buffer->consumers[Consumer].cursor, memory_order_relaxed);
+    
+    *Enumerable = CCCircularEnumerableCreate(Buffer->items, sizeof(Titem), Count, Cursor % Tmax, Tmax);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentBroadcastBufferRelease, (PTYPE(T *) Buffer, size_t Consumer, PTYPE(CCEnumerable *) Enumerable))
+{
+    CCAssertLog(Consumer < Tconsumers, "Consumer must not be out of bounds");
+    CCAssertLog((Enumerable->enumerator.ref == Buffer->items) && ((Enumerable->enumerator.state.type & CCEnumeratorFormatMask) == CCEnumeratorFormatCircular), "Enumerable should be the broadcast buffer enumerable");
+    
+    const size_t Cursor = atomic_load_explicit(&Buffer->consumers[Consumer].cursor, memory_order_relaxed);
+    
+    atomic_store_explicit(&Buffer->consumers[Consumer].cursor, Cursor + Enumerable->enumerator.state.circular.count, memory_order_release);
+}
+
+#define CCConcurrentBroadcastBuffer(type, size, consumers) CC_CONCURRENT_BROADCAST_BUFFER(type, size, consumers)
@@ -0,0 +1,476 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "ConcurrentCache.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "BitTricks.h"
+#include "Alignment.h"
+#include "Array.h"
+#include "HashMapSeparateChainingArray.h"
+#include "ConcurrentWait.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#define CC_CONCURRENT_CACHE_SPIN_COUNT 64
+
+/*
+ The shard lock is a futex style mutex. The state is 0 when unlocked, 1 when locked, and 2 when
+ locked with other threads (possibly) waiting on it.
+ */
+typedef CC_ENUM(CCConcurrentCacheLockState, uint32_t) {
+    CCConcurrentCacheLockStateUnlocked,
+    CCConcurrentCacheLockStateLocked,
+    CCConcurrentCacheLockStateContended
+};
+
+typedef struct {
+    size_t cost;
+    _Bool referenced;
+    _Bool used;
+    _Alignas(uintmax_t) uint8_t data[];
+} CCConcurrentCacheSlot;
+
+typedef struct {
+    _Alignas(CC_HARDWARE_CACHE_LINE) _Atomic(uint32_t) lock;
+    CCHashMap map;
+    CCArray slots;
+    CCArray available;
+    size_t hand;
+    _Atomic(size_t) count;
+    _Atomic(size_t) cost;
+    _Atomic(size_t) hits;
+    _Atomic(size_t) misses;
+    _Atomic(size_t) evictions;
+} CCConcurrentCacheShard;
+
+typedef struct CCConcurrentCacheInfo {
+    CCAllocatorType allocator;
+    size_t keySize, valueSize, valueOffset;
+    size_t capacity, shardCapacity;
+    size_t shardMask;
+    CCConcurrentCacheEntryDestructor destructor;
+    CCConcurrentCacheShard *shards;
+} CCConcurrentCacheInfo;
+
+static void CCConcurrentCacheLock(CCConcurrentCacheShard *Shard)
+{
+    uint32_t State = CCConcurrentCacheLockStateUnlocked;
+    if (CC_LIKELY(atomic_compare_exchange_strong_explicit(&Shard->lock, &State, CCConcurrentCacheLockStateLocked, memory_order_acquire, memory_order_relaxed))) return;
+    
+    for (size_t Loop = 0; (Loop < CC_CONCURRENT_CACHE_SPIN_COUNT) && (State == CCConcurrentCacheLockStateLocked); Loop++)
+    {
+        CC_SPIN_WAIT();
+        
+        State = CCConcurrentCacheLockStateUnlocked;
+        if (atomic_compare_exchange_weak_explicit(&Shard->lock, &State, CCConcurrentCacheLockStateLocked, memory_order_acquire, memory_order_relaxed)) return;
+    }
+    
+    if (State != CCConcurrentCacheLockStateContended) State = atomic_exchange_explicit(&Shard->lock, CCConcurrentCacheLockStateContended, memory_order_acquire);
+    
+    while (State != CCConcurrentCacheLockStateUnlocked)
+    {
+        CCConcurrentWait(&Shard->lock, CCConcurrentCacheLockStateContended);
+        State = atomic_exchange_explicit(&Shard->lock, CCConcurrentCacheLockStateContended, memory_order_acquire);
+    }
+}
+
+static void CCConcurrentCacheUnlock(CCConcurrentCacheShard *Shard)
+{
+    if (CC_UNLIKELY(atomic_exchange_explicit(&Shard->lock, CCConcurrentCacheLockStateUnlocked, memory_order_release) == CCConcurrentCacheLockStateContended)) CCConcurrentWake(&Shard->lock, FALSE);
+}
+
+/*
+ The counters are only ever written while holding the shard lock, so they don't need an atomic
+ read-modify-write. They're only atomic so they can be read without the lock.
+ */
+static CC_FORCE_INLINE void CCConcurrentCacheCounterAdd(_Atomic(size_t) *Counter, size_t Value)
+{
+    atomic_store_explicit(Counter, atomic_load_explicit(Counter, memory_order_relaxed) + Value, memory_order_relaxed);
+}
+
+static CC_FORCE_INLINE void CCConcurrentCacheCounterSub(_Atomic(size_t) *Counter, size_t Value)
+{
+    atomic_store_explicit(Counter, atomic_load_explicit(Counter, memory_order_relaxed) - Value, memory_order_relaxed);
+}
+
+static CC_FORCE_INLINE CCConcurrentCacheShard *CCConcurrentCacheGetShard(CCConcurrentCache Cache, const void *Key)
+{
+    //The upper bits of the multiplied hash are used so the shard is independent of the bucket the key falls into
+    const uint64_t Hash = (uint64_t)CCHashMapGetKeyHash(Cache->shards[0].map, Key) * UINT64_C(0x9e3779b97f4a7c15);
+    
+    return &Cache->shards[(size_t)(Hash >> 32) & Cache->shardMask];
+}
+
+static CC_FORCE_INLINE CCConcurrentCacheSlot *CCConcurrentCacheGetSlot(CCConcurrentCacheShard *Shard, size_t Index)
+{
+    return CCArrayGetElementAtIndex(Shard->slots, Index);
+}
+
+static CC_FORCE_INLINE void *CCConcurrentCacheSlotValue(CCConcurrentCache Cache, CCConcurrentCacheSlot *Slot)
+{
+    return Slot->data + Cache->valueOffset;
+}
+
+static void CCConcurrentCacheReleaseSlot(CCConcurrentCache Cache, CCConcurrentCacheShard *Shard, size_t Index, CCConcurrentCacheSlot *Slot)
+{
+    if (Cache->destructor) Cache->destructor(Cache, Slot->data, CCConcurrentCacheSlotValue(Cache, Slot));
+    
+    CCConcurrentCacheCounterSub(&Shard->cost, Slot->cost);
+    CCConcurrentCacheCounterSub(&Shard->count, 1);
+    
+    Slot->used = FALSE;
+    CCArrayAppendElement(Shard->available, &Index);
+}
+
+/*!
+ * @brief Evict entries from the shard until the required cost fits.
+ * @description Sweeps the clock hand over the slots, evicting the unreferenced entries and clearing the
+ *              reference of the others. Must be called while holding the shard lock.
+ *
+ * @param Required The cost that needs to fit in the shard.
+ * @param Skip The index of the slot that must not be evicted, or SIZE_MAX if none.
+ */
+static void CCConcurrentCacheEvict(CCConcurrentCache Cache, CCConcurrentCacheShard *Shard, size_t Required, size_t Skip)
+{
+    const size_t Count = CCArrayGetCount(Shard->slots);
+    
+    while ((atomic_load_explicit(&Shard->cost, memory_order_relaxed) + Required) > Cache->shardCapacity)
+    {
+        if (atomic_load_explicit(&Shard->count, memory_order_relaxed) <= (Skip != SIZE_MAX)) break;
+        
+        const size_t Index = Shard->hand;
+        Shard->hand = (Index + 1) == Count ? 0 : (Index + 1);
+        
+        CCConcurrentCacheSlot *Slot = CCConcurrentCacheGetSlot(Shard, Index);
+        
+        if ((!Slot->used) || (Index == Skip)) continue;
+        
+        if (Slot->referenced)
+        {
+            Slot->referenced = FALSE;
+            continue;
+        }
+        
+        CCHashMapRemoveValue(Shard->map, Slot->data);
+        CCConcurrentCacheReleaseSlot(Cache, Shard, Index, Slot);
+        CCConcurrentCacheCounterAdd(&Shard->evictions, 1);
+    }
+}
+
+static void CCConcurrentCacheDestructor(CCConcurrentCache Cache)
+{
+    for (size_t Loop = 0; Loop <= Cache->shardMask; Loop++)
+    {
+        CCConcurrentCacheShard *Shard = &Cache->shards[Loop];
+        
+        if (Shard->slots)
+        {
+            if (Cache->destructor)
+            {
+                for (size_t Index = 0, Count = CCArrayGetCount(Shard->slots); Index < Count; Index++)
+                {
+                    CCConcurrentCacheSlot *Slot = CCConcurrentCacheGetSlot(Shard, Index);
+                    if (Slot->used) Cache->destructor(Cache, Slot->data, CCConcurrentCacheSlotValue(Cache, Slot));
+                }
+            }
+            
+            CCArrayDestroy(Shard->slots);
+        }
+        
+        if (Shard->available) CCArrayDestroy(Shard->available);
+        if (Shard->map) CCHashMapDestroy(Shard->map);
+    }
+}
+
+CCConcurrentCache CCConcurrentCacheCreate(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t ShardCount, size_t Capacity, CCHashMapKeyHasher Hasher, CCComparator KeyComparator, CCConcurrentCacheEntryDestructor Destructor)
+{
+    CCAssertLog(KeySize, "KeySize must not be 0");
+    CCAssertLog(ShardCount, "ShardCount must not be 0");
+    
+    ShardCount = CCBitNextPowerOf2(ShardCount);
+    
+    //The shards are placed after the cache, aligned to their own cache lines so they can't falsely share
+    const size_t Size = sizeof(CCConcurrentCacheInfo) + CC_HARDWARE_CACHE_LINE + (sizeof(CCConcurrentCacheShard) * ShardCount);
+    CCConcurrentCache Cache = CCMalloc(Allocator, Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Cache)
+    {
+        const size_t ValueOffset = CC_ALIGN(KeySize, sizeof(uintmax_t));
+        
+        *Cache = (CCConcurrentCacheInfo){
+            .allocator = Allocator,
+            .keySize = KeySize,
+            .valueSize = ValueSize,
+            .valueOffset = ValueOffset,
+            .capacity = Capacity,
+            .shardCapacity = (Capacity + (ShardCount - 1)) / ShardCount,
+            .shardMask = ShardCount - 1,
+            .destructor = Destructor,
+            .shards = (CCConcurrentCacheShard*)CC_ALIGN((uintptr_t)(Cache + 1), CC_HARDWARE_CACHE_LINE)
+        };
+        
+        _Bool Failed = FALSE;
+        for (size_t Loop = 0; Loop < ShardCount; Loop++)
+        {
+            CCConcurrentCacheShard *Shard = &Cache->shards[Loop];
+            
+            *Shard = (CCConcurrentCacheShard){
+                .lock = ATOMIC_VAR_INIT(CCConcurrentCacheLockStateUnlocked),
+                .map = CCHashMapCreate(Allocator, KeySize, sizeof(size_t), 16, Hasher, KeyComparator, CCHashMapSeparateChainingArray),
+                .slots = CCArrayCreate(Allocator, CC_ALIGN(sizeof(CCConcurrentCacheSlot) + ValueOffset + ValueSize, sizeof(uintmax_t)), 16),
+                .available = CCArrayCreate(Allocator, sizeof(size_t), 16),
+                .hand = 0,
+                .count = ATOMIC_VAR_INIT(0),
+                .cost = ATOMIC_VAR_INIT(0),
+                .hits = ATOMIC_VAR_INIT(0),
+                .misses = ATOMIC_VAR_INIT(0),
+                .evictions = ATOMIC_VAR_INIT(0)
+            };
+            
+            if ((!Shard->map) || (!Shard->slots) || (!Shard->available)) Failed = TRUE;
+        }
+        
+        CCMemorySetDestructor(Cache, (CCMemoryDestructorCallback)CCConcurrentCacheDestructor);
+        
+        if (Failed)
+        {
+            CC_LOG_ERROR("Failed to create concurrent cache, due to failure to create shards");
+            CCFree(Cache);
+            
+            return NULL;
+        }
+    }
+    
+    else CC_LOG_ERROR("Failed to create concurrent cache, due to allocation failure. Allocation size (%zu)", Size);
+    
+    return Cache;
+}
+
+void CCConcurrentCacheDestroy(CCConcurrentCache Cache)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    
+    CCFree(Cache);
+}
+
+_Bool CCConcurrentCacheSetValue(CCConcurrentCache Cache, const void *Key, const void *Value, size_t Cost)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    CCAssertLog(Value || !Cache->valueSize, "Value must not be null");
+    
+    if (Cost > Cache->shardCapacity) return FALSE;
+    
+    CCConcurrentCacheShard *Shard = CCConcurrentCacheGetShard(Cache, Key);
+    
+    CCConcurrentCacheLock(Shard);
+    
+    size_t *Existing = CCHashMapGetValue(Shard->map, Key);
+    if (Existing)
+    {
+        const size_t Index = *Existing;
+        CCConcurrentCacheSlot *Slot = CCConcurrentCacheGetSlot(Shard, Index);
+        
+        CCConcurrentCacheCounterSub(&Shard->cost, Slot->cost);
+        CCConcurrentCacheEvict(Cache, Shard, Cost, Index);
+        
+        if (Cache->destructor) Cache->destructor(Cache, Slot->data, CCConcurrentCacheSlotValue(Cache, Slot));
+        
+        memcpy(CCConcurrentCacheSlotValue(Cache, Slot), Value, Cache->valueSize);
+        Slot->cost = Cost;
+        Slot->referenced = TRUE;
+        
+        CCConcurrentCacheCounterAdd(&Shard->cost, Cost);
+        CCConcurrentCacheUnlock(Shard);
+        
+        return TRUE;
+    }
+    
+    CCConcurrentCacheEvict(Cache, Shard, Cost, SIZE_MAX);
+    
+    size_t Index;
+    const size_t Available = CCArrayGetCount(Shard->available);
+    if (Available)
+    {
+        Index = *(size_t*)CCArrayGetElementAtIndex(Shard->available, Available - 1);
+        CCArrayRemoveElementAtIndex(Shard->available, Available - 1);
+    }
+    
+    else if ((Index = CCArrayAppendElement(Shard->slots, NULL)) == SIZE_MAX)
+    {
+        CCConcurrentCacheUnlock(Shard);
+        
+        return FALSE;
+    }
+    
+    CCConcurrentCacheSlot *Slot = CCConcurrentCacheGetSlot(Shard, Index);
+    memcpy(Slot->data, Key, Cache->keySize);
+    memcpy(CCConcurrentCacheSlotValue(Cache, Slot), Value, Cache->valueSize);
+    Slot->cost = Cost;
+    Slot->referenced = FALSE;
+    Slot->used = TRUE;
+    
+    if (CCHashMapGetLoadFactor(Shard->map) >= 0.75f) CCHashMapRehash(Shard->map, CCHashMapGetBucketCount(Shard->map) * 2);
+    
+    const CCHashMapEntry Entry = CCHashMapEntryForKey(Shard->map, Key, NULL);
+    if (!Entry)
+    {
+        //Could not be added to the map (the key may still have been partially inserted), so return the slot untouched
+        CCHashMapRemoveValue(Shard->map, Key);
+        
+        Slot->used = FALSE;
+        CCArrayAppendElement(Shard->available, &Index);
+        
+        CCConcurrentCacheUnlock(Shard);
+        
+        return FALSE;
+    }
+    
+    CCHashMapSetEntry(Shard->map, Entry, &Index);
+    
+    CCConcurrentCacheCounterAdd(&Shard->cost, Cost);
+    CCConcurrentCacheCounterAdd(&Shard->count, 1);
+    CCConcurrentCacheUnlock(Shard);
+    
+    return TRUE;
+}
+
+_Bool CCConcurrentCacheRemoveValue(CCConcurrentCache Cache, const void *Key)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    
+    CCConcurrentCacheShard *Shard = CCConcurrentCacheGetShard(Cache, Key);
+    
+    CCConcurrentCacheLock(Shard);
+    
+    size_t *Existing = CCHashMapGetValue(Shard->map, Key);
+    const _Bool Removed = Existing;
+    if (Removed)
+    {
+        const size_t Index = *Existing;
+        
+        CCHashMapRemoveValue(Shard->map, Key);
+        CCConcurrentCacheReleaseSlot(Cache, Shard, Index, CCConcurrentCacheGetSlot(Shard, Index));
+    }
+    
+    CCConcurrentCacheUnlock(Shard);
+    
+    return Removed;
+}
+
+void CCConcurrentCacheRemoveAllValues(CCConcurrentCache Cache)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    
+    for (size_t Loop = 0; Loop <= Cache->shardMask; Loop++)
+    {
+        CCConcurrentCacheShard *Shard = &Cache->shards[Loop];
+        
+        CCConcurrentCacheLock(Shard);
+        
+        for (size_t Index = 0, Count = CCArrayGetCount(Shard->slots); Index < Count; Index++)
+        {
+            CCConcurrentCacheSlot *Slot = CCConcurrentCacheGetSlot(Shard, Index);
+            if (Slot->used)
+            {
+                CCHashMapRemoveValue(Shard->map, Slot->data);
+                CCConcurrentCacheReleaseSlot(Cache, Shard, Index, Slot);
+            }
+        }
+        
+        CCConcurrentCacheUnlock(Shard);
+    }
+}
+
+_Bool CCConcurrentCacheGetValue(CCConcurrentCache Cache, const void *Key, void *Value)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    
+    CCConcurrentCacheShard *Shard = CCConcurrentCacheGetShard(Cache, Key);
+    
+    CCConcurrentCacheLock(Shard);
+    
+    size_t *Index = CCHashMapGetValue(Shard->map, Key);
+    if (Index)
+    {
+        CCConcurrentCacheSlot *Slot = CCConcurrentCacheGetSlot(Shard, *Index);
+        Slot->referenced = TRUE;
+        
+        if (Value) memcpy(Value, CCConcurrentCacheSlotValue(Cache, Slot), Cache->valueSize);
+        
+        CCConcurrentCacheCounterAdd(&Shard->hits, 1);
+    }
+    
+    else CCConcurrentCacheCounterAdd(&Shard->misses, 1);
+    
+    CCConcurrentCacheUnlock(Shard);
+    
+    return Index;
+}
+
+size_t CCConcurrentCacheGetCount(CCConcurrentCache Cache)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    
+    size_t Count = 0;
+    for (size_t Loop = 0; Loop <= Cache->shardMask; Loop++) Count += atomic_load_explicit(&Cache->shards[Loop].count, memory_order_relaxed);
+    
+    return Count;
+}
+
+size_t CCConcurrentCacheGetCost(CCConcurrentCache Cache)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    
+    size_t Cost = 0;
+    for (size_t Loop = 0; Loop <= Cache->shardMask; Loop++) Cost += atomic_load_explicit(&Cache->shards[Loop].cost, memory_order_relaxed);
+    
+    return Cost;
+}
+
+size_t CCConcurrentCacheGetCapacity(CCConcurrentCache Cache)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    
+    return Cache->capacity;
+}
+
+CCConcurrentCacheStatistics CCConcurrentCacheGetStatistics(CCConcurrentCache Cache)
+{
+    CCAssertLog(Cache, "Cache must not be null");
+    
+    CCConcurrentCacheStatistics Statistics = { .hits = 0, .misses = 0, .evictions = 0 };
+    for (size_t Loop = 0; Loop <= Cache->shardMask; Loop++)
+    {
+        Statistics.hits += atomic_load_explicit(&Cache->shards[Loop].hits, memory_order_relaxed);
+        Statistics.misses += atomic_load_explicit(&Cache->shards[Loop].misses, memory_order_relaxed);
+        Statistics.evictions += atomic_load_explicit(&Cache->shards[Loop].evictions, memory_order_relaxed);
+    }
+    
+    return Statistics;
+}
@@ -0,0 +1,201 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_ConcurrentCache_h
+#define CommonC_ConcurrentCache_h
+
+/*
+ Bounded key/value cache. The entries are partitioned across a number of shards by the hash of
+ their key, where each shard has its own lock, hash map, share of the total capacity, and
+ counters. So a lookup only ever touches the single shard the key belongs to.
+ 
+ Every entry has a cost, and once a shard exceeds its share of the capacity it evicts entries
+ using the CLOCK algorithm. Newly inserted entries start out unreferenced, so entries that are
+ only ever inserted (such as from a scan) are evicted before entries that have been looked up.
+ 
+ Allows for many producer-consumer access.
+ */
+
+#include <CommonC/Base.h>
+#include <CommonC/Ownership.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Comparator.h>
+#include <CommonC/HashMap.h>
+
+
+/*!
+ * @brief The concurrent cache.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCConcurrentCacheInfo *CCConcurrentCache;
+
+/*!
+ * @brief A callback to handle custom destruction of an entry when it leaves the cache.
+ * @description This is called when an entry is evicted, replaced, removed, or the cache is
+ *              destroyed.
+ *
+ * @warning This is called while the shard of the entry is locked, so it must not use the cache.
+ * @param Cache The cache the entry belonged to.
+ * @param Key The key of the entry.
+ * @param Value The value of the entry.
+ */
+typedef void (*CCConcurrentCacheEntryDestructor)(CCConcurrentCache Cache, const void *Key, void *Value);
+
+/*!
+ * @brief The usage statistics of the cache.
+ */
+typedef struct {
+    /// The number of lookups that found an entry.
+    size_t hits;
+    /// The number of lookups that did not find an entry.
+    size_t misses;
+    /// The number of entries that were evicted to make room for other entries.
+    size_t evictions;
+} CCConcurrentCacheStatistics;
+
+
+#pragma mark - Creation / Destruction
+/*!
+ * @brief Create a concurrent cache.
+ * @description This cache allows for many producer-consumer access.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param KeySize The size of the keys.
+ * @param ValueSize The size of the values.
+ * @param ShardCount The number of shards to partition the cache into. This will be rounded up to
+ *        the next power of 2.
+ *
+ * @param Capacity The maximum total cost of the entries in the cache. This is split evenly across
+ *        the shards.
+ *
+ * @param Hasher The hashing function to be used to generate a hash for a given key. If NULL, the
+ *        default @b CCHashMap hashing is used.
+ *
+ * @param KeyComparator The key comparison function to be used to determine if two keys match. If
+ *        NULL, a byte level comparison is performed.
+ *
+ * @param Destructor The destructor to be called when an entry leaves the cache. May be NULL.
+ * @return A cache, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCConcurrentCache CCConcurrentCacheCreate(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, size_t ShardCount, size_t Capacity, CCHashMapKeyHasher Hasher, CCComparator KeyComparator, CCConcurrentCacheEntryDestructor Destructor);
+
+/*!
+ * @brief Destroy a cache.
+ * @description Calls the destructor for any entries still in the cache.
+ * @warning All usage by other threads must have finished before final destruction.
+ * @param Cache The cache to be destroyed.
+ */
+void CCConcurrentCacheDestroy(CCConcurrentCache CC_DESTROY(Cache));
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Set the value for a key in the cache.
+ * @description If an entry already exists for the key, its value is replaced (calling the
+ *              destructor on the old entry). Otherwise a new entry is inserted, evicting other
+ *              entries from the shard as necessary to fit its cost.
+ *
+ * @performance Locks the shard of the key.
+ * @param Cache The cache to set the value in.
+ * @param Key The pointer to the key to be copied into the cache. This must not be NULL.
+ * @param Value The pointer to the value to be copied into the cache. May be NULL if the value
+ *        size is 0.
+ *
+ * @param Cost The cost of the entry.
+ * @return Whether the entry was set (TRUE), or not (FALSE) because its cost exceeds the capacity
+ *         of a shard or the allocation failed. If it was not set, ownership of the value remains
+ *         with the caller and any existing entry for the key is left untouched.
+ */
+_Bool CCConcurrentCacheSetValue(CCConcurrentCache Cache, const void *Key, const void *Value, size_t Cost);
+
+/*!
+ * @brief Remove the entry for a key from the cache.
+ * @description Calls the destructor on the entry.
+ * @performance Locks the shard of the key.
+ * @param Cache The cache to remove the entry from.
+ * @param Key The pointer to the key of the entry to be removed. This must not be NULL.
+ * @return Whether or not an entry was removed.
+ */
+_Bool CCConcurrentCacheRemoveValue(CCConcurrentCache Cache, const void *Key);
+
+/*!
+ * @brief Remove all entries from the cache.
+ * @description Calls the destructor on every entry. This does not reset the statistics.
+ * @performance Locks each shard in turn.
+ * @param Cache The cache to remove the entries from.
+ */
+void CCConcurrentCacheRemoveAllValues(CCConcurrentCache Cache);
+
+#pragma mark - Query Info
+/*!
+ * @brief Get the value for a key.
+ * @description Marks the entry as referenced, protecting it from the next sweep of the eviction
+ *              clock.
+ *
+ * @performance Locks the shard of the key.
+ * @param Cache The cache to get the value of.
+ * @param Key The pointer to the key of the entry. This must not be NULL.
+ * @param Value A pointer to where the value should be copied to. If NULL this will be ignored.
+ * @return Whether the entry was in the cache (a hit), or not (a miss).
+ */
+_Bool CCConcurrentCacheGetValue(CCConcurrentCache Cache, const void *Key, void *Value);
+
+/*!
+ * @brief Get the current number of entries in the cache.
+ * @note This should only be used as a rough indicator if calling it during mutation operations on
+ *       other threads.
+ *
+ * @param Cache The cache to get the count of.
+ * @return The number of entries.
+ */
+size_t CCConcurrentCacheGetCount(CCConcurrentCache Cache);
+
+/*!
+ * @brief Get the current total cost of the entries in the cache.
+ * @note This should only be used as a rough indicator if calling it during mutation operations on
+ *       other threads.
+ *
+ * @param Cache The cache to get the cost of.
+ * @return The total cost.
+ */
+size_t CCConcurrentCacheGetCost(CCConcurrentCache Cache);
+
+/*!
+ * @brief Get the capacity of the cache.
+ * @param Cache The cache to get the capacity of.
+ * @return The maximum total cost of the cache.
+ */
+size_t CCConcurrentCacheGetCapacity(CCConcurrentCache Cache);
+
+/*!
+ * @brief Get the usage statistics of the cache.
+ * @description Sums the counters of every shard.
+ * @note This should only be used as a rough indicator if calling it during operations on other
+ *       threads.
+ *
+ * @param Cache The cache to get the statistics of.
+ * @return The statistics.
+ */
+CCConcurrentCacheStatistics CCConcurrentCacheGetStatistics(CCConcurrentCache Cache);
+
+#endif
@@ -32,6 +32,8 @@
  
  The intended usage for this structure is when a consumer will constantly clear out the buffer, and wants to process many items
  in one go.
+ 
+ For multiple producer-multiple consumer access use ConcurrentMPMCCircularBuffer.h instead.
 */
 
 #include <CommonC/Template.h>
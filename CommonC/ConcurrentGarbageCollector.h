@@ -74,4 +74,43 @@ void CCConcurrentGarbageCollectorEnd(CCConcurrentGarbageCollector GC);
  */
 void CCConcurrentGarbageCollectorManage(CCConcurrentGarbageCollector GC, void *Item, CCConcurrentGarbageCollectorReclaimer Reclaimer);
 
+#pragma mark -
+
+#define CC_TYPE_CCConcurrentGarbageCollector(...) CCConcurrentGarbageCollector
+#define CC_TYPE_0_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_1_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_2_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_3_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_4_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_5_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_6_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_7_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_8_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+#define CC_TYPE_9_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector,
+
+#define CC_PRESERVE_CC_TYPE_CCConcurrentGarbageCollector CC_TYPE_CCConcurrentGarbageCollector
+
+#define CC_TYPE_DECL_CCConcurrentGarbageCollector(...) CCConcurrentGarbageCollector, __VA_ARGS__
+#define CC_TYPE_DECL_0_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_1_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_2_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_3_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_4_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_5_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_6_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_7_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_8_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+#define CC_TYPE_DECL_9_CCConcurrentGarbageCollector CC_TYPE_DECL_CCConcurrentGarbageCollector,
+
+#define CC_MANGLE_TYPE_0_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_1_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_2_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_3_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_4_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_5_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_6_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_7_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_8_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+#define CC_MANGLE_TYPE_9_CCConcurrentGarbageCollector CCConcurrentGarbageCollector
+
 #endif
@@ -0,0 +1,264 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ A lock-free bounded FIFO buffer implementation.
+ Allows for multiple producer-multiple consumer access.
+ 
+ This is a low level interface and should only be used in specific use case.
+ The buffer is a fixed size and will fail to add more items once full, unless one of the waiting variants
+ is used, in which case the thread will block until space (or an item) becomes available.
+ 
+ Every slot carries a turn counter that is advanced as the slot is written and then read, so producers and
+ consumers only ever contend on the head or tail index. Consumers may claim disjoint batches of items, which
+ makes it suitable for fanning out a single stream of items to many worker threads.
+*/
+
+#include <CommonC/Template.h>
+#include <CommonC/Assertion.h>
+#include <CommonC/ConcurrentWait.h>
+
+#define CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_INIT { .head = ATOMIC_VAR_INIT(0), .tail = ATOMIC_VAR_INIT(0), .waiting = ATOMIC_VAR_INIT(0) }
+
+#define CCConcurrentMPMCCircularBufferAddItem_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferAddItem, _Bool, PTYPE(t *), const PTYPE(void *))
+#define CCConcurrentMPMCCircularBufferAddItems_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferAddItems, size_t, PTYPE(t *), const PTYPE(void *), size_t)
+#define CCConcurrentMPMCCircularBufferWaitAddItem_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferWaitAddItem, void, PTYPE(t *), const PTYPE(void *))
+#define CCConcurrentMPMCCircularBufferRemoveItem_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferRemoveItem, _Bool, PTYPE(t *), PTYPE(void *))
+#define CCConcurrentMPMCCircularBufferRemoveItems_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferRemoveItems, size_t, PTYPE(t *), PTYPE(void *), size_t)
+#define CCConcurrentMPMCCircularBufferWaitRemoveItem_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferWaitRemoveItem, void, PTYPE(t *), PTYPE(void *))
+#define CCConcurrentMPMCCircularBufferWaitRemoveItems_T(t) CC_TEMPLATE_REF(CCConcurrentMPMCCircularBufferWaitRemoveItems, size_t, PTYPE(t *), PTYPE(void *), size_t)
+
+#undef CCConcurrentMPMCCircularBuffer
+
+/*!
+ * @brief Add an item to the circular buffer.
+ * @param Buffer The concurrent circular buffer.
+ * @param Item A pointer to the item that should be added to the circular buffer.
+ * @return Whether the item was successfully added (TRUE), or not (FALSE). If it was not, it means that the buffer is
+ *         currently full.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentMPMCCircularBufferAddItem, (PTYPE(T *) Buffer, const PTYPE(void *) Item));
+
+/*!
+ * @brief Add items to the circular buffer.
+ * @description The items will be stored consecutively, they will not be interleaved with items added by other threads.
+ * @param Buffer The concurrent circular buffer.
+ * @param Items A pointer to the items that should be added to the circular buffer.
+ * @param Count The number of items to be added.
+ * @return The number of items successfully added. If some items were not added it means that the buffer is currently full.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentMPMCCircularBufferAddItems, (PTYPE(T *) Buffer, const PTYPE(void *) Items, size_t Count));
+
+/*!
+ * @brief Add an item to the circular buffer, waiting for space if the buffer is full.
+ * @param Buffer The concurrent circular buffer.
+ * @param Item A pointer to the item that should be added to the circular buffer.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentMPMCCircularBufferWaitAddItem, (PTYPE(T *) Buffer, const PTYPE(void *) Item));
+
+/*!
+ * @brief Remove an item from the circular buffer.
+ * @param Buffer The concurrent circular buffer.
+ * @param Item A pointer to where the item should be stored.
+ * @return Whether an item was removed (TRUE), or not (FALSE). If it was not, it means that the buffer is currently empty.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentMPMCCircularBufferRemoveItem, (PTYPE(T *) Buffer, PTYPE(void *) Item));
+
+/*!
+ * @brief Remove a batch of items from the circular buffer.
+ * @description The batch is claimed as a whole, so no other consumer will receive any of the items in it.
+ * @param Buffer The concurrent circular buffer.
+ * @param Items A pointer to where the items should be stored.
+ * @param Count The maximum number of items to be removed.
+ * @return The number of items removed.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentMPMCCircularBufferRemoveItems, (PTYPE(T *) Buffer, PTYPE(void *) Items, size_t Count));
+
+/*!
+ * @brief Remove an item from the circular buffer, waiting for an item if the buffer is empty.
+ * @param Buffer The concurrent circular buffer.
+ * @param Item A pointer to where the item should be stored.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentMPMCCircularBufferWaitRemoveItem, (PTYPE(T *) Buffer, PTYPE(void *) Item));
+
+/*!
+ * @brief Remove a batch of items from the circular buffer, waiting for an item if the buffer is empty.
+ * @param Buffer The concurrent circular buffer.
+ * @param Items A pointer to where the items should be stored.
+ * @param Count The maximum number of items to be removed. Must be greater than 0.
+ * @return The number of items removed. This will be at least 1.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentMPMCCircularBufferWaitRemoveItems, (PTYPE(T *) Buffer, PTYPE(void *) Items, size_t Count));
+
+#pragma mark -
+
+#define CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN(position) ((uint32_t)(((position) / Tmax) * 2))
+#define CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_READ_TURN(position) (CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN(position) + 1)
+
+#define CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WAIT(buffer, slot, expected) \
+for (uint32_t Turn_; (Turn_ = atomic_load_explicit(&(slot)->turn, memory_order_acquire)) != (expected); ) \
+{ \
+    atomic_fetch_add_explicit(&(buffer)->waiting, 1, memory_order_seq_cst); \
+    CCConcurrentWait(&(slot)->turn, Turn_); \
+    atomic_fetch_sub_explicit(&(buffer)->waiting, 1, memory_order_relaxed); \
+}
+
+#define CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_ADVANCE(buffer, slot, next) \
+atomic_store_explicit(&(slot)->turn, (next), memory_order_release); \
+atomic_thread_fence(memory_order_seq_cst); \
+if (atomic_load_explicit(&(buffer)->waiting, memory_order_relaxed)) CCConcurrentWake(&(slot)->turn, TRUE);
+
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentMPMCCircularBufferAddItem, (PTYPE(T *) Buffer, const PTYPE(void *) Item))
+{
+    return CCConcurrentMPMCCircularBufferAddItems_T(T)(Buffer, Item, 1);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentMPMCCircularBufferAddItems, (PTYPE(T *) Buffer, const PTYPE(void *) Items, size_t Count))
+{
+    size_t Tail = atomic_load_explicit(&Buffer->tail, memory_order_relaxed);
+    
+    while (Count)
+    {
+        size_t Available = 0;
+        while ((Available < Count) && (atomic_load_explicit(&Buffer->slots[(Tail + Available) % Tmax].turn, memory_order_acquire) == CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN(Tail + Available))) Available++;
+        
+        if (Available)
+        {
+            if (atomic_compare_exchange_weak_explicit(&Buffer->tail, &Tail, Tail + Available, memory_order_relaxed, memory_order_relaxed))
+            {
+                for (size_t Loop = 0; Loop < Available; Loop++)
+                {
+                    const size_t Position = Tail + Loop;
+                    
+                    Buffer->slots[Position % Tmax].item = ((const Titem*)Items)[Loop];
+                    
+                    CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_ADVANCE(Buffer, &Buffer->slots[Position % Tmax], CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_READ_TURN(Position));
+                }
+                
+                return Available;
+            }
+        }
+        
+        else
+        {
+            const size_t Previous = Tail;
+            
+            Tail = atomic_load_explicit(&Buffer->tail, memory_order_relaxed);
+            
+            if (Tail == Previous) break;
+        }
+    }
+    
+    return 0;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentMPMCCircularBufferWaitAddItem, (PTYPE(T *) Buffer, const PTYPE(void *) Item))
+{
+    const size_t Position = atomic_fetch_add_explicit(&Buffer->tail, 1, memory_order_relaxed);
+    
+    CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WAIT(Buffer, &Buffer->slots[Position % Tmax], CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN(Position));
+    
+    Buffer->slots[Position % Tmax].item = *(const Titem*)Item;
+    
+    CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_ADVANCE(Buffer, &Buffer->slots[Position % Tmax], CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_READ_TURN(Position));
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentMPMCCircularBufferRemoveItem, (PTYPE(T *) Buffer, PTYPE(void *) Item))
+{
+    return CCConcurrentMPMCCircularBufferRemoveItems_T(T)(Buffer, Item, 1);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentMPMCCircularBufferRemoveItems, (PTYPE(T *) Buffer, PTYPE(void *) Items, size_t Count))
+{
+    size_t Head = atomic_load_explicit(&Buffer->head, memory_order_relaxed);
+    
+    while (Count)
+    {
+        size_t Available = 0;
+        while ((Available < Count) && (atomic_load_explicit(&Buffer->slots[(Head + Available) % Tmax].turn, memory_order_acquire) == CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_READ_TURN(Head + Available))) Available++;
+        
+        if (Available)
+        {
+            if (atomic_compare_exchange_weak_explicit(&Buffer->head, &Head, Head + Available, memory_order_relaxed, memory_order_relaxed))
+            {
+                for (size_t Loop = 0; Loop < Available; Loop++)
+                {
+                    const size_t Position = Head + Loop;
+                    
+                    ((Titem*)Items)[Loop] = Buffer->slots[Position % Tmax].item;
+                    
+                    CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_ADVANCE(Buffer, &Buffer->slots[Position % Tmax], CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN(Position + Tmax));
+                }
+                
+                return Available;
+            }
+        }
+        
+        else
+        {
+            const size_t Previous = Head;
+            
+            Head = atomic_load_explicit(&Buffer->head, memory_order_relaxed);
+            
+            if (Head == Previous) break;
+        }
+    }
+    
+    return 0;
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentMPMCCircularBufferWaitRemoveItem, (PTYPE(T *) Buffer, PTYPE(void *) Item))
+{
+    const size_t Position = atomic_fetch_add_explicit(&Buffer->head, 1, memory_order_relaxed);
+    
+    CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WAIT(Buffer, &Buffer->slots[Position % Tmax], CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_READ_TURN(Position));
+    
+    *(Titem*)Item = Buffer->slots[Position % Tmax].item;
+    
+    CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_ADVANCE(Buffer, &Buffer->slots[Position % Tmax], CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN(Position + Tmax));
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE size_t, CCConcurrentMPMCCircularBufferWaitRemoveItems, (PTYPE(T *) Buffer, PTYPE(void *) Items, size_t Count))
+{
+    CCAssertLog(Count, "Count must be greater than 0");
+    
+    size_t Removed = CCConcurrentMPMCCircularBufferRemoveItems_T(T)(Buffer, Items, Count);
+    
+    if (!Removed)
+    {
+        CCConcurrentMPMCCircularBufferWaitRemoveItem_T(T)(Buffer, Items);
+        
+        Removed = 1 + CCConcurrentMPMCCircularBufferRemoveItems_T(T)(Buffer, (Titem*)Items + 1, Count - 1);
+    }
+    
+    return Removed;
+}
+
+#undef CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WRITE_TURN
+#undef CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_READ_TURN
+#undef CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_WAIT
+#undef CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_ADVANCE
+
+#define CCConcurrentMPMCCircularBuffer(type, size) CC_CONCURRENT_MPMC_CIRCULAR_BUFFER(type, size)
@@ -0,0 +1,962 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CommonC/Template.h>
+#include <CommonC/Maths.h>
+
+#undef CCConcurrentPublishedPointer
+
+#ifndef Treclaimer
+#define Treclaimer CCFree
+#endif
+
+#define CC_CONCURRENT_PUBLISHED_POINTER(type, reclaimer) CC_CONCURRENT_PUBLISHED_POINTER_(type, reclaimer)
+#define CC_CONCURRENT_PUBLISHED_POINTER_(type, reclaimer) CCConcurrentPublishedPointer_##type##_##reclaimer
+
+typedef struct {
+    _Atomic(CC_TYPE_DECL(Titem)) pointer;
+} CC_CONCURRENT_PUBLISHED_POINTER(Titem, Treclaimer);
+
+#define CC_TYPE_CCConcurrentPublishedPointer(x, y, ...) CCConcurrentPublishedPointer_##x##_##y
+#define CC_TYPE_0_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_1_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_2_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_3_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_4_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_5_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_6_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_7_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_8_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_9_CCConcurrentPublishedPointer(...) CC_TYPE_CCConcurrentPublishedPointer, __VA_ARGS__,
+
+#define CC_PRESERVE_CC_TYPE_CCConcurrentPublishedPointer(x, y, ...) CC_TYPE_CCConcurrentPublishedPointer(x, y), __VA_ARGS__
+
+#define CC_TYPE_DECL_CCConcurrentPublishedPointer(x, y, ...) CCConcurrentPublishedPointer_##x##_##y, __VA_ARGS__
+#define CC_TYPE_DECL_0_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_1_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_2_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_3_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_4_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_5_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_6_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_7_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_8_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+#define CC_TYPE_DECL_9_CCConcurrentPublishedPointer(...) CC_TYPE_DECL_CCConcurrentPublishedPointer, __VA_ARGS__,
+
+#define CC_MANGLE_TYPE_0_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_1_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_2_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_3_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_4_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_5_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_6_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_7_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_8_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+#define CC_MANGLE_TYPE_9_CCConcurrentPublishedPointer(x, y) CCConcurrentPublishedPointer_##x##_##y
+
+//generic_imp.rb: -pc 1 -n 'CC_CONCURRENT_PUBLISHED_POINTER' -t CommonC/ConcurrentPublishedPointerTemplate.h -th '<CommonC/ConcurrentPublishedPointerTemplate.h>' -m 'Titem' 'Treclaimer' 'T=CCConcurrentPublishedPointer(Titem, Treclaimer)'
+#ifndef T
+#define T CCConcurrentPublishedPointer(Titem, Treclaimer)
+#endif
+
+#include <CommonC/Generics.h>
+
+#define CCConcurrentPublishedPointerGet(publishedpointer) CCConcurrentPublishedPointerGet_Ref(publishedpointer)(publishedpointer)
+#define CCConcurrentPublishedPointerSet(publishedpointer, gc, data) CCConcurrentPublishedPointerSet_Ref(publishedpointer, gc, data)(publishedpointer, gc, data)
+#define CCConcurrentPublishedPointerCompareAndSet(publishedpointer, gc, expected, data) CCConcurrentPublishedPointerCompareAndSet_Ref(publishedpointer, gc, expected, data)(publishedpointer, gc, expected, data)
+
+#define CCConcurrentPublishedPointerGet_Ref(publishedpointer) CC_GENERIC((((typeof(publishedpointer)){0})), CCConcurrentPublishedPointerGet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_MAP_WITH(CC_GENERIC_FORMAT, *, CC_CONCURRENT_PUBLISHED_POINTER_T)))
+#define CCConcurrentPublishedPointerSet_Ref(publishedpointer, gc, data) CC_GENERIC((((typeof(publishedpointer)){0})), CCConcurrentPublishedPointerSet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_MAP_WITH(CC_GENERIC_FORMAT, *, CC_CONCURRENT_PUBLISHED_POINTER_T)))
+#define CCConcurrentPublishedPointerCompareAndSet_Ref(publishedpointer, gc, expected, data) CC_GENERIC((((typeof(publishedpointer)){0})), CCConcurrentPublishedPointerCompareAndSet_T, CC_GENERIC_MATCH, CC_GENERIC_ERROR, (CC_MAP_WITH(CC_GENERIC_FORMAT, *, CC_CONCURRENT_PUBLISHED_POINTER_T)))
+
+#define CC_CONCURRENT_PUBLISHED_POINTER_T CC_GENERIC_INDEXED_TYPE_LIST(CC_CONCURRENT_PUBLISHED_POINTER_T, CC_CONCURRENT_PUBLISHED_POINTER_COUNT)
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_CONCURRENT_PUBLISHED_POINTER_T0
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_CONCURRENT_PUBLISHED_POINTER_T1
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_CONCURRENT_PUBLISHED_POINTER_T2
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_CONCURRENT_PUBLISHED_POINTER_T3
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_CONCURRENT_PUBLISHED_POINTER_T4
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_CONCURRENT_PUBLISHED_POINTER_T5
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_CONCURRENT_PUBLISHED_POINTER_T6
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_CONCURRENT_PUBLISHED_POINTER_T7
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_CONCURRENT_PUBLISHED_POINTER_T8
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_CONCURRENT_PUBLISHED_POINTER_T9
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_CONCURRENT_PUBLISHED_POINTER_T10
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_CONCURRENT_PUBLISHED_POINTER_T11
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_CONCURRENT_PUBLISHED_POINTER_T12
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_CONCURRENT_PUBLISHED_POINTER_T13
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_CONCURRENT_PUBLISHED_POINTER_T14
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_CONCURRENT_PUBLISHED_POINTER_T15
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_CONCURRENT_PUBLISHED_POINTER_T16
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_CONCURRENT_PUBLISHED_POINTER_T17
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_CONCURRENT_PUBLISHED_POINTER_T18
+#endif
+
+#ifndef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_CONCURRENT_PUBLISHED_POINTER_T19
+#endif
+
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_MANGLE_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_MANGLE_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0(...) CC_CONCURRENT_PUBLISHED_POINTER_T0, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1(...) CC_CONCURRENT_PUBLISHED_POINTER_T1, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2(...) CC_CONCURRENT_PUBLISHED_POINTER_T2, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3(...) CC_CONCURRENT_PUBLISHED_POINTER_T3, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4(...) CC_CONCURRENT_PUBLISHED_POINTER_T4, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5(...) CC_CONCURRENT_PUBLISHED_POINTER_T5, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6(...) CC_CONCURRENT_PUBLISHED_POINTER_T6, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7(...) CC_CONCURRENT_PUBLISHED_POINTER_T7, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8(...) CC_CONCURRENT_PUBLISHED_POINTER_T8, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9(...) CC_CONCURRENT_PUBLISHED_POINTER_T9, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10(...) CC_CONCURRENT_PUBLISHED_POINTER_T10, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11(...) CC_CONCURRENT_PUBLISHED_POINTER_T11, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12(...) CC_CONCURRENT_PUBLISHED_POINTER_T12, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13(...) CC_CONCURRENT_PUBLISHED_POINTER_T13, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14(...) CC_CONCURRENT_PUBLISHED_POINTER_T14, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15(...) CC_CONCURRENT_PUBLISHED_POINTER_T15, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16(...) CC_CONCURRENT_PUBLISHED_POINTER_T16, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17(...) CC_CONCURRENT_PUBLISHED_POINTER_T17, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18(...) CC_CONCURRENT_PUBLISHED_POINTER_T18, __VA_ARGS__
+#define CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19(...) CC_CONCURRENT_PUBLISHED_POINTER_T19, __VA_ARGS__
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_DECL_0_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_1_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_2_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_3_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_4_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_5_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_6_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_7_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_8_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_DECL_9_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_DECL_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+
+#ifdef CC_CONCURRENT_PUBLISHED_POINTER_COUNT
+#define CC_GENERIC_COUNT CC_CONCURRENT_PUBLISHED_POINTER_COUNT
+#endif
+
+#ifndef CC_GENERIC_TEMPLATE
+#define CC_GENERIC_TEMPLATE <CommonC/ConcurrentPublishedPointerTemplate.h>
+#endif
+
+#undef CC_GENERIC_TYPE
+#define CC_GENERIC_TYPE CC_CONCURRENT_PUBLISHED_POINTER
+#include <CommonC/Generic1.h>
+
+#if CC_GENERIC_COUNT < 1
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0
+#endif
+
+#if CC_GENERIC_COUNT < 2
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1
+#endif
+
+#if CC_GENERIC_COUNT < 3
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2
+#endif
+
+#if CC_GENERIC_COUNT < 4
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3
+#endif
+
+#if CC_GENERIC_COUNT < 5
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4
+#endif
+
+#if CC_GENERIC_COUNT < 6
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5
+#endif
+
+#if CC_GENERIC_COUNT < 7
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6
+#endif
+
+#if CC_GENERIC_COUNT < 8
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7
+#endif
+
+#if CC_GENERIC_COUNT < 9
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8
+#endif
+
+#if CC_GENERIC_COUNT < 10
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9
+#endif
+
+#if CC_GENERIC_COUNT < 11
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10
+#endif
+
+#if CC_GENERIC_COUNT < 12
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11
+#endif
+
+#if CC_GENERIC_COUNT < 13
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12
+#endif
+
+#if CC_GENERIC_COUNT < 14
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13
+#endif
+
+#if CC_GENERIC_COUNT < 15
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14
+#endif
+
+#if CC_GENERIC_COUNT < 16
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15
+#endif
+
+#if CC_GENERIC_COUNT < 17
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16
+#endif
+
+#if CC_GENERIC_COUNT < 18
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17
+#endif
+
+#if CC_GENERIC_COUNT < 19
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18
+#endif
+
+#if CC_GENERIC_COUNT < 20
+#undef CC_MANGLE_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19
+#endif
+
+#undef CC_CONCURRENT_PUBLISHED_POINTER_COUNT
+
+#if CC_GENERIC_COUNT == 1
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 1
+#elif CC_GENERIC_COUNT == 2
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 2
+#elif CC_GENERIC_COUNT == 3
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 3
+#elif CC_GENERIC_COUNT == 4
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 4
+#elif CC_GENERIC_COUNT == 5
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 5
+#elif CC_GENERIC_COUNT == 6
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 6
+#elif CC_GENERIC_COUNT == 7
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 7
+#elif CC_GENERIC_COUNT == 8
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 8
+#elif CC_GENERIC_COUNT == 9
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 9
+#elif CC_GENERIC_COUNT == 10
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 10
+#elif CC_GENERIC_COUNT == 11
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 11
+#elif CC_GENERIC_COUNT == 12
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 12
+#elif CC_GENERIC_COUNT == 13
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 13
+#elif CC_GENERIC_COUNT == 14
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 14
+#elif CC_GENERIC_COUNT == 15
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 15
+#elif CC_GENERIC_COUNT == 16
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 16
+#elif CC_GENERIC_COUNT == 17
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 17
+#elif CC_GENERIC_COUNT == 18
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 18
+#elif CC_GENERIC_COUNT == 19
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 19
+#elif CC_GENERIC_COUNT == 20
+#define CC_CONCURRENT_PUBLISHED_POINTER_COUNT 20
+#else
+#error Add additional cases
+#endif
+
+#undef CC_GENERIC_COUNT
+
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0(...) CC_CONCURRENT_PUBLISHED_POINTER_T0
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1(...) CC_CONCURRENT_PUBLISHED_POINTER_T1
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2(...) CC_CONCURRENT_PUBLISHED_POINTER_T2
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3(...) CC_CONCURRENT_PUBLISHED_POINTER_T3
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4(...) CC_CONCURRENT_PUBLISHED_POINTER_T4
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5(...) CC_CONCURRENT_PUBLISHED_POINTER_T5
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6(...) CC_CONCURRENT_PUBLISHED_POINTER_T6
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7(...) CC_CONCURRENT_PUBLISHED_POINTER_T7
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8(...) CC_CONCURRENT_PUBLISHED_POINTER_T8
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9(...) CC_CONCURRENT_PUBLISHED_POINTER_T9
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10(...) CC_CONCURRENT_PUBLISHED_POINTER_T10
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11(...) CC_CONCURRENT_PUBLISHED_POINTER_T11
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12(...) CC_CONCURRENT_PUBLISHED_POINTER_T12
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13(...) CC_CONCURRENT_PUBLISHED_POINTER_T13
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14(...) CC_CONCURRENT_PUBLISHED_POINTER_T14
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15(...) CC_CONCURRENT_PUBLISHED_POINTER_T15
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16(...) CC_CONCURRENT_PUBLISHED_POINTER_T16
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17(...) CC_CONCURRENT_PUBLISHED_POINTER_T17
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18(...) CC_CONCURRENT_PUBLISHED_POINTER_T18
+#define CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19(...) CC_CONCURRENT_PUBLISHED_POINTER_T19
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T0 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T0,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T1 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T1,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T2 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T2,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T3 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T3,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T4 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T4,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T5 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T5,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T6 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T6,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T7 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T7,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T8 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T8,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T9 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T9,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T10 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T10,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T11 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T11,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T12 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T12,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T13 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T13,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T14 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T14,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T15 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T15,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T16 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T16,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T17 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T17,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T18 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T18,
+#define CC_TYPE_0_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_1_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_2_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_3_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_4_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_5_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_6_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_7_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_8_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+#define CC_TYPE_9_CC_CONCURRENT_PUBLISHED_POINTER_T19 CC_TYPE_CC_CONCURRENT_PUBLISHED_POINTER_T19,
+
+#ifndef CC_GENERIC_PRESERVE_TYPE
+#undef Titem
+#undef Treclaimer
+#endif
@@ -0,0 +1,116 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ A read-copy-update (RCU) published pointer implementation.
+ Allows for many reader-writer access.
+ 
+ This is a low level interface and should only be used in specific use cases.
+ 
+ Get operations are wait-free and perform no writes to shared memory, so readers never contend with each other. The
+ returned pointer is only valid for the duration of the garbage collector section it was retrieved in.
+ 
+ Set operations are wait-free, and compare and set operations are lock-free. Replaced pointers are retired to the
+ garbage collector, which will call the reclaimer once no readers could still be referencing them.
+ 
+ The intended usage for this structure is when we want to share read mostly data (e.g. configs or routing tables), where
+ updates copy the current data, modify the copy, and then publish it. Titem is expected to be a pointer type.
+*/
+
+#include <CommonC/Template.h>
+#include <CommonC/Assertion.h>
+#include <CommonC/ConcurrentGarbageCollector.h>
+
+#define CC_CONCURRENT_PUBLISHED_POINTER_INIT { .pointer = ATOMIC_VAR_INIT(NULL) }
+
+#define CCConcurrentPublishedPointerGet_T(t) CC_TEMPLATE_REF(CCConcurrentPublishedPointerGet, PRIVATE(Titem, item), PTYPE(t *))
+#define CCConcurrentPublishedPointerSet_T(t) CC_TEMPLATE_REF(CCConcurrentPublishedPointerSet, void, PTYPE(t *), CCConcurrentGarbageCollector, PRIVATE(Titem, item))
+#define CCConcurrentPublishedPointerCompareAndSet_T(t) CC_TEMPLATE_REF(CCConcurrentPublishedPointerCompareAndSet, _Bool, PTYPE(t *), CCConcurrentGarbageCollector, PRIVATE(Titem, item), PRIVATE(Titem, item))
+
+#undef CCConcurrentPublishedPointer
+
+/*!
+ * @brief Get the current pointer.
+ * @warning Must be called between @b CCConcurrentGarbageCollectorBegin and @b CCConcurrentGarbageCollectorEnd of the
+ *          garbage collector used to replace the pointer. The pointer should not be accessed after the section has ended.
+ *
+ * @param PublishedPointer The concurrent published pointer.
+ * @return The current pointer. Ownership is not passed to the caller.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE PRIVATE(Titem, item), CCConcurrentPublishedPointerGet, (PTYPE(T *) PublishedPointer));
+
+/*!
+ * @brief Set the pointer to publish.
+ * @description The previous pointer will be retired to the garbage collector.
+ * @warning Must be called between @b CCConcurrentGarbageCollectorBegin and @b CCConcurrentGarbageCollectorEnd.
+ * @param PublishedPointer The concurrent published pointer.
+ * @param GC The garbage collector to manage the previous pointer.
+ * @param Data The pointer to publish. Ownership is passed to the function, and the data should not be modified after
+ *        it has been published.
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentPublishedPointerSet, (PTYPE(T *) PublishedPointer, CCConcurrentGarbageCollector GC, PRIVATE(Titem, item) Data));
+
+/*!
+ * @brief Set the pointer to publish if the current pointer has not changed.
+ * @description Allows for multiple writers to perform read-copy-update operations, where the update is retried if
+ *              another writer published first. On success the previous pointer will be retired to the garbage collector.
+ *
+ * @warning Must be called within the same garbage collector section that @b Expected was retrieved in.
+ * @param PublishedPointer The concurrent published pointer.
+ * @param GC The garbage collector to manage the previous pointer.
+ * @param Expected The pointer expected to be current.
+ * @param Data The pointer to publish. Ownership is passed to the function only if it was successfully published.
+ * @return Whether the pointer was published (TRUE), or not (FALSE).
+ */
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentPublishedPointerCompareAndSet, (PTYPE(T *) PublishedPointer, CCConcurrentGarbageCollector GC, PRIVATE(Titem, item) Expected, PRIVATE(Titem, item) Data));
+
+#pragma mark -
+
+CC_TEMPLATE(static CC_FORCE_INLINE PRIVATE(Titem, item), CCConcurrentPublishedPointerGet, (PTYPE(T *) PublishedPointer))
+{
+    return atomic_load_explicit(&PublishedPointer->pointer, memory_order_acquire);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE void, CCConcurrentPublishedPointerSet, (PTYPE(T *) PublishedPointer, CCConcurrentGarbageCollector GC, PRIVATE(Titem, item) Data))
+{
+    CCAssertLog(GC, "GC must not be null");
+    
+    Titem Prev = atomic_exchange_explicit(&PublishedPointer->pointer, Data, memory_order_acq_rel);
+    
+    if (Prev) CCConcurrentGarbageCollectorManage(GC, (void*)Prev, (CCConcurrentGarbageCollectorReclaimer)Treclaimer);
+}
+
+CC_TEMPLATE(static CC_FORCE_INLINE _Bool, CCConcurrentPublishedPointerCompareAndSet, (PTYPE(T *) PublishedPointer, CCConcurrentGarbageCollector GC, PRIVATE(Titem, item) Expected, PRIVATE(Titem, item) Data))
+{
+    CCAssertLog(GC, "GC must not be null");
+    
+    if (!atomic_compare_exchange_strong_explicit(&PublishedPointer->pointer, &Expected, Data, memory_order_acq_rel, memory_order_relaxed)) return FALSE;
+    
+    if (Expected) CCConcurrentGarbageCollectorManage(GC, (void*)Expected, (CCConcurrentGarbageCollectorReclaimer)Treclaimer);
+    
+    return TRUE;
+}
+
+#define CCConcurrentPublishedPointer(type, reclaimer) CC_CONCURRENT_PUBLISHED_POINTER(type, reclaimer)
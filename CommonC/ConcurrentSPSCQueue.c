@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "ConcurrentSPSCQueue.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include <stdatomic.h>
+#include <string.h>
+
+typedef struct CCConcurrentSPSCQueueSegment {
+    struct CCConcurrentSPSCQueueSegment *next;
+    _Alignas(uintmax_t) uint8_t data[];
+} CCConcurrentSPSCQueueSegment;
+
+/*
+ The padding keeps the producer's and consumer's state on separate cache lines, regardless of the
+ alignment of the allocation.
+ 
+ Segments from first up to (but not including) the consumer's published head have been fully
+ consumed, and are reused by the producer before allocating new ones.
+ */
+typedef struct CCConcurrentSPSCQueueInfo {
+    CCAllocatorType allocator;
+    size_t elementSize;
+    size_t segmentCount;
+    uint8_t producerPadding[CC_HARDWARE_CACHE_LINE];
+    struct {
+        _Atomic(size_t) written;
+        CCConcurrentSPSCQueueSegment *tail;
+        size_t index;
+        CCConcurrentSPSCQueueSegment *first;
+        CCConcurrentSPSCQueueSegment *cachedHead;
+    } producer;
+    uint8_t consumerPadding[CC_HARDWARE_CACHE_LINE];
+    struct {
+        _Atomic(CCConcurrentSPSCQueueSegment*) published;
+        CCConcurrentSPSCQueueSegment *head;
+        size_t index;
+        size_t read;
+        size_t cachedWritten;
+    } consumer;
+    uint8_t endPadding[CC_HARDWARE_CACHE_LINE];
+} CCConcurrentSPSCQueueInfo;
+
+static void CCConcurrentSPSCQueueDestructor(CCConcurrentSPSCQueue Queue)
+{
+    for (CCConcurrentSPSCQueueSegment *Segment = Queue->producer.first; Segment; )
+    {
+        CCConcurrentSPSCQueueSegment *Next = Segment->next;
+        
+        CCFree(Segment);
+        
+        Segment = Next;
+    }
+}
+
+CCConcurrentSPSCQueue CCConcurrentSPSCQueueCreate(CCAllocatorType Allocator, size_t ElementSize, size_t SegmentCount)
+{
+    CCAssertLog(ElementSize, "ElementSize must not be 0");
+    CCAssertLog(SegmentCount, "SegmentCount must not be 0");
+    
+    CCConcurrentSPSCQueue Queue = CCMalloc(Allocator, sizeof(CCConcurrentSPSCQueueInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Queue)
+    {
+        CCConcurrentSPSCQueueSegment *Segment = CCMalloc(Allocator, sizeof(CCConcurrentSPSCQueueSegment) + (ElementSize * SegmentCount), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Segment)
+        {
+            CC_LOG_ERROR("Failed to create concurrent SPSC queue, due to allocation failure. Allocation size (%zu)", sizeof(CCConcurrentSPSCQueueSegment) + (ElementSize * SegmentCount));
+            CCFree(Queue);
+            
+            return NULL;
+        }
+        
+        Segment->next = NULL;
+        
+        Queue->allocator = Allocator;
+        Queue->elementSize = ElementSize;
+        Queue->segmentCount = SegmentCount;
+        
+        atomic_init(&Queue->producer.written, 0);
+        Queue->producer.tail = Segment;
+        Queue->producer.index = 0;
+        Queue->producer.first = Segment;
+        Queue->producer.cachedHead = Segment;
+        
+        atomic_init(&Queue->consumer.published, Segment);
+        Queue->consumer.head = Segment;
+        Queue->consumer.index = 0;
+        Queue->consumer.read = 0;
+        Queue->consumer.cachedWritten = 0;
+        
+        CCMemorySetDestructor(Queue, (CCMemoryDestructorCallback)CCConcurrentSPSCQueueDestructor);
+    }
+    
+    else CC_LOG_ERROR("Failed to create concurrent SPSC queue, due to allocation failure. Allocation size (%zu)", sizeof(CCConcurrentSPSCQueueInfo));
+    
+    return Queue;
+}
+
+void CCConcurrentSPSCQueueDestroy(CCConcurrentSPSCQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    CCFree(Queue);
+}
+
+/*!
+ * @brief Get a segment for the producer to append to the queue.
+ * @description Reuses a consumed segment if one is available, otherwise allocates a new one.
+ */
+static CCConcurrentSPSCQueueSegment *CCConcurrentSPSCQueueAcquireSegment(CCConcurrentSPSCQueue Queue)
+{
+    if (Queue->producer.first == Queue->producer.cachedHead)
+    {
+        //Acquire so the consumer's reads of the segments it has moved past happen before they're overwritten
+        Queue->producer.cachedHead = atomic_load_explicit(&Queue->consumer.published, memory_order_acquire);
+    }
+    
+    if (Queue->producer.first != Queue->producer.cachedHead)
+    {
+        CCConcurrentSPSCQueueSegment *Segment = Queue->producer.first;
+        Queue->producer.first = Segment->next;
+        Segment->next = NULL;
+        
+        return Segment;
+    }
+    
+    CCConcurrentSPSCQueueSegment *Segment = CCMalloc(Queue->allocator, sizeof(CCConcurrentSPSCQueueSegment) + (Queue->elementSize * Queue->segmentCount), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Segment) Segment->next = NULL;
+    
+    return Segment;
+}
+
+_Bool CCConcurrentSPSCQueuePush(CCConcurrentSPSCQueue Queue, const void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    CCAssertLog(Element, "Element must not be null");
+    
+    if (Queue->producer.index == Queue->segmentCount)
+    {
+        CCConcurrentSPSCQueueSegment *Segment = CCConcurrentSPSCQueueAcquireSegment(Queue);
+        if (!Segment) return FALSE;
+        
+        //The link is made visible to the consumer by the release of the written count below
+        Queue->producer.tail->next = Segment;
+        Queue->producer.tail = Segment;
+        Queue->producer.index = 0;
+    }
+    
+    memcpy(Queue->producer.tail->data + (Queue->producer.index++ * Queue->elementSize), Element, Queue->elementSize);
+    
+    atomic_store_explicit(&Queue->producer.written, atomic_load_explicit(&Queue->producer.written, memory_order_relaxed) + 1, memory_order_release);
+    
+    return TRUE;
+}
+
+/*!
+ * @brief Get the next element for the consumer.
+ * @description Advances the consumer onto the next segment if the current one has been fully consumed.
+ * @return The element, or NULL if the queue is empty.
+ */
+static void *CCConcurrentSPSCQueueFront(CCConcurrentSPSCQueue Queue)
+{
+    if (Queue->consumer.read == Queue->consumer.cachedWritten)
+    {
+        Queue->consumer.cachedWritten = atomic_load_explicit(&Queue->producer.written, memory_order_acquire);
+        
+        if (Queue->consumer.read == Queue->consumer.cachedWritten) return NULL;
+    }
+    
+    if (Queue->consumer.index == Queue->segmentCount)
+    {
+        Queue->consumer.head = Queue->consumer.head->next;
+        Queue->consumer.index = 0;
+        
+        //Release the previous segment back to the producer
+        atomic_store_explicit(&Queue->consumer.published, Queue->consumer.head, memory_order_release);
+    }
+    
+    return Queue->consumer.head->data + (Queue->consumer.index * Queue->elementSize);
+}
+
+_Bool CCConcurrentSPSCQueuePop(CCConcurrentSPSCQueue Queue, void *Element)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    void *Front = CCConcurrentSPSCQueueFront(Queue);
+    if (!Front) return FALSE;
+    
+    if (Element) memcpy(Element, Front, Queue->elementSize);
+    
+    Queue->consumer.index++;
+    Queue->consumer.read++;
+    
+    return TRUE;
+}
+
+void *CCConcurrentSPSCQueuePeek(CCConcurrentSPSCQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    return CCConcurrentSPSCQueueFront(Queue);
+}
+
+_Bool CCConcurrentSPSCQueueIsEmpty(CCConcurrentSPSCQueue Queue)
+{
+    CCAssertLog(Queue, "Queue must not be null");
+    
+    if (Queue->consumer.read != Queue->consumer.cachedWritten) return FALSE;
+    
+    Queue->consumer.cachedWritten = atomic_load_explicit(&Queue->producer.written, memory_order_acquire);
+    
+    return Queue->consumer.read == Queue->consumer.cachedWritten;
+}
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_ConcurrentSPSCQueue_h
+#define CommonC_ConcurrentSPSCQueue_h
+
+/*
+ Wait-free unbounded FIFO queue. The elements are stored in a linked list of fixed size segments,
+ where segments that have been fully consumed are recycled by the producer instead of being freed,
+ so once the queue has grown to its working size no further allocations are made.
+ 
+ The producer and consumer each keep a cached copy of the other's position and only reload it when
+ the cached copy says the queue is empty (for the consumer) or that no segment is free (for the
+ producer), so in the common case neither thread touches the other's cache lines.
+ 
+ Allows for single producer-consumer access.
+ */
+
+#include <CommonC/Base.h>
+#include <CommonC/Ownership.h>
+#include <CommonC/Allocator.h>
+
+
+/*!
+ * @brief The concurrent SPSC queue.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCConcurrentSPSCQueueInfo *CCConcurrentSPSCQueue;
+
+
+#pragma mark - Creation / Destruction
+/*!
+ * @brief Create a concurrent SPSC queue.
+ * @description This queue allows for a single producer and a single consumer.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param ElementSize The size of the elements.
+ * @param SegmentCount The number of elements stored in each segment.
+ * @return A FIFO queue, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCConcurrentSPSCQueue CCConcurrentSPSCQueueCreate(CCAllocatorType Allocator, size_t ElementSize, size_t SegmentCount);
+
+/*!
+ * @brief Destroy a queue.
+ * @warning Both the producer and the consumer must have finished before final destruction.
+ * @param Queue The queue to be destroyed.
+ */
+void CCConcurrentSPSCQueueDestroy(CCConcurrentSPSCQueue CC_DESTROY(Queue));
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Push an element onto the end of the queue.
+ * @warning Must only be called from the producer thread.
+ * @performance Wait-free. Only allocates when the current segment is full and no consumed segment
+ *              is available for reuse.
+ *
+ * @param Queue The queue to push the element onto.
+ * @param Element The pointer to the element to be copied into the queue.
+ * @return Whether the element was pushed (TRUE), or not (FALSE) because a new segment could not be
+ *         allocated.
+ */
+_Bool CCConcurrentSPSCQueuePush(CCConcurrentSPSCQueue Queue, const void *Element);
+
+/*!
+ * @brief Pop an element from the front of the queue.
+ * @warning Must only be called from the consumer thread.
+ * @performance Wait-free.
+ * @param Queue The queue to pop the element from.
+ * @param Element A pointer to where the element should be copied to. If NULL this will be ignored.
+ * @return Whether an element was popped (TRUE), or not (FALSE) because the queue is empty.
+ */
+_Bool CCConcurrentSPSCQueuePop(CCConcurrentSPSCQueue Queue, void *Element);
+
+#pragma mark - Query Info
+/*!
+ * @brief Get the element at the front of the queue without removing it.
+ * @warning Must only be called from the consumer thread.
+ * @performance Wait-free.
+ * @param Queue The queue to peek at.
+ * @return A pointer to the element, or NULL if the queue is empty. This pointer is only valid
+ *         until the element is popped.
+ */
+void *CCConcurrentSPSCQueuePeek(CCConcurrentSPSCQueue Queue);
+
+/*!
+ * @brief Check whether the queue is empty.
+ * @warning Must only be called from the consumer thread.
+ * @param Queue The queue to check.
+ * @return Whether the queue is empty (TRUE), or not (FALSE).
+ */
+_Bool CCConcurrentSPSCQueueIsEmpty(CCConcurrentSPSCQueue Queue);
+
+#endif
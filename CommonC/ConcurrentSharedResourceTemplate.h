@@ -40,6 +40,8 @@
  has ownership constraints, or data that is too large to be shared atomically. When a thread gets the resource it is guaranteed
  to be the latest resource at that point in time, but after that point there is no guarantees that the resource is still the
  latest.
+ 
+ For read mostly data where readers should not write to shared memory, see the concurrent published pointer.
 */
 
 #include <CommonC/Template.h>
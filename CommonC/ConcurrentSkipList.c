@@ -0,0 +1,514 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "ConcurrentSkipList.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "BitTricks.h"
+#include "Random.h"
+#include <stdatomic.h>
+#include <string.h>
+
+#define CC_CONCURRENT_SKIP_LIST_MAX_LEVEL 32
+
+/*
+ The lowest bit of a next pointer is used to mark the node as removed at that level. Once marked
+ the pointer is never changed again, so threads still traversing a removed node can continue
+ through it.
+ */
+#define CC_CONCURRENT_SKIP_LIST_MARK 1
+
+typedef CC_FLAG_ENUM(CCConcurrentSkipListNodeState, uint8_t) {
+    CCConcurrentSkipListNodeStateLinked = (1 << 0),
+    CCConcurrentSkipListNodeStateRemoved = (1 << 1)
+};
+
+typedef struct {
+    _Atomic(CCConcurrentSkipListNodeState) state;
+    uint8_t level;
+    _Atomic(uintptr_t) next[];
+} CCConcurrentSkipListNode;
+
+typedef struct CCConcurrentSkipListInfo {
+    CCAllocatorType allocator;
+    size_t keySize, valueSize;
+    CCComparator comparator;
+    _Atomic(size_t) count;
+    CCConcurrentGarbageCollector gc;
+    CCConcurrentSkipListNode *head;
+} CCConcurrentSkipListInfo;
+
+typedef CC_ENUM(CCConcurrentSkipListEnumerableOption, uint32_t) {
+    CCConcurrentSkipListEnumerableOptionKey,
+    CCConcurrentSkipListEnumerableOptionValue
+};
+
+static _Thread_local CCRandomState_xorshift CCConcurrentSkipListLevelState = 0;
+
+static CC_FORCE_INLINE CCConcurrentSkipListNode *CCConcurrentSkipListNodePointer(uintptr_t Next)
+{
+    return (CCConcurrentSkipListNode*)(Next & ~(uintptr_t)CC_CONCURRENT_SKIP_LIST_MARK);
+}
+
+static CC_FORCE_INLINE void *CCConcurrentSkipListNodeKey(CCConcurrentSkipListNode *Node)
+{
+    return &Node->next[Node->level];
+}
+
+static CC_FORCE_INLINE void *CCConcurrentSkipListNodeValue(CCConcurrentSkipList SkipList, CCConcurrentSkipListNode *Node)
+{
+    return (uint8_t*)CCConcurrentSkipListNodeKey(Node) + SkipList->keySize;
+}
+
+static CC_FORCE_INLINE _Bool CCConcurrentSkipListNodeIsRemoved(CCConcurrentSkipListNode *Node)
+{
+    return atomic_load_explicit(&Node->next[0], memory_order_acquire) & CC_CONCURRENT_SKIP_LIST_MARK;
+}
+
+static CC_FORCE_INLINE CCComparisonResult CCConcurrentSkipListCompare(CCConcurrentSkipList SkipList, CCConcurrentSkipListNode *Node, const void *Key)
+{
+    return SkipList->comparator(CCConcurrentSkipListNodeKey(Node), Key);
+}
+
+static size_t CCConcurrentSkipListRandomLevel(void)
+{
+    if (CC_UNLIKELY(!CCConcurrentSkipListLevelState)) CCRandomSeed_xorshift(&CCConcurrentSkipListLevelState, (uint32_t)(uintptr_t)&CCConcurrentSkipListLevelState | 1);
+    
+    //Each level has a 1 in 2 chance of being promoted to the next level
+    return 1 + CCBitCountLowestUnset(~(uint64_t)CCRandom_xorshift(&CCConcurrentSkipListLevelState) | (UINT64_C(1) << (CC_CONCURRENT_SKIP_LIST_MAX_LEVEL - 1)));
+}
+
+static void CCConcurrentSkipListDestructor(CCConcurrentSkipList SkipList)
+{
+    for (CCConcurrentSkipListNode *Node = SkipList->head; Node; )
+    {
+        CCConcurrentSkipListNode *Next = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Node->next[0], memory_order_relaxed));
+        
+        CCFree(Node);
+        
+        Node = Next;
+    }
+    
+    CCConcurrentGarbageCollectorDestroy(SkipList->gc);
+}
+
+CCConcurrentSkipList CCConcurrentSkipListCreate(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, CCComparator KeyComparator, CCConcurrentGarbageCollector GC)
+{
+    CCAssertLog(KeySize, "KeySize must not be 0");
+    CCAssertLog(KeyComparator, "KeyComparator must not be null");
+    CCAssertLog(GC, "GC must not be null");
+    
+    CCConcurrentSkipList SkipList = CCMalloc(Allocator, sizeof(CCConcurrentSkipListInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (SkipList)
+    {
+        CCConcurrentSkipListNode *Head = CCMalloc(Allocator, sizeof(CCConcurrentSkipListNode) + (sizeof(_Atomic(uintptr_t)) * CC_CONCURRENT_SKIP_LIST_MAX_LEVEL), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (!Head)
+        {
+            CC_LOG_ERROR("Failed to create concurrent skip list, due to allocation failure. Allocation size (%zu)", sizeof(CCConcurrentSkipListNode) + (sizeof(_Atomic(uintptr_t)) * CC_CONCURRENT_SKIP_LIST_MAX_LEVEL));
+            CCFree(SkipList);
+            
+            return NULL;
+        }
+        
+        atomic_init(&Head->state, CCConcurrentSkipListNodeStateLinked);
+        Head->level = CC_CONCURRENT_SKIP_LIST_MAX_LEVEL;
+        for (size_t Loop = 0; Loop < CC_CONCURRENT_SKIP_LIST_MAX_LEVEL; Loop++) atomic_init(&Head->next[Loop], 0);
+        
+        *SkipList = (CCConcurrentSkipListInfo){
+            .allocator = Allocator,
+            .keySize = KeySize,
+            .valueSize = ValueSize,
+            .comparator = KeyComparator,
+            .count = ATOMIC_VAR_INIT(0),
+            .gc = GC,
+            .head = Head
+        };
+        
+        CCMemorySetDestructor(SkipList, (CCMemoryDestructorCallback)CCConcurrentSkipListDestructor);
+    }
+    
+    else CC_LOG_ERROR("Failed to create concurrent skip list, due to allocation failure. Allocation size (%zu)", sizeof(CCConcurrentSkipListInfo));
+    
+    return SkipList;
+}
+
+void CCConcurrentSkipListDestroy(CCConcurrentSkipList SkipList)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    
+    CCFree(SkipList);
+}
+
+/*!
+ * @brief Find the predecessors and successors of a key at every level.
+ * @description Unlinks any removed nodes encountered along the way. Must be called inside of a
+ *              garbage collector section.
+ *
+ * @return Whether the successor at the lowest level has the key.
+ */
+static _Bool CCConcurrentSkipListFind(CCConcurrentSkipList SkipList, const void *Key, CCConcurrentSkipListNode **Predecessors, CCConcurrentSkipListNode **Successors)
+{
+Retry:;
+    CCConcurrentSkipListNode *Predecessor = SkipList->head;
+    
+    for (size_t Level = CC_CONCURRENT_SKIP_LIST_MAX_LEVEL; Level--; )
+    {
+        CCConcurrentSkipListNode *Current = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Predecessor->next[Level], memory_order_acquire));
+        
+        while (Current)
+        {
+            uintptr_t Next = atomic_load_explicit(&Current->next[Level], memory_order_acquire);
+            
+            if (Next & CC_CONCURRENT_SKIP_LIST_MARK)
+            {
+                uintptr_t Expected = (uintptr_t)Current;
+                if (!atomic_compare_exchange_strong_explicit(&Predecessor->next[Level], &Expected, Next & ~(uintptr_t)CC_CONCURRENT_SKIP_LIST_MARK, memory_order_acq_rel, memory_order_relaxed)) goto Retry;
+                
+                Current = CCConcurrentSkipListNodePointer(Next);
+            }
+            
+            else if (CCConcurrentSkipListCompare(SkipList, Current, Key) == CCComparisonResultAscending)
+            {
+                Predecessor = Current;
+                Current = (CCConcurrentSkipListNode*)Next;
+            }
+            
+            else break;
+        }
+        
+        Predecessors[Level] = Predecessor;
+        Successors[Level] = Current;
+    }
+    
+    return (Successors[0]) && (CCConcurrentSkipListCompare(SkipList, Successors[0], Key) == CCComparisonResultEqual);
+}
+
+/*!
+ * @brief Reclaim a node once it has been both linked and removed.
+ * @description Whichever of the inserting or removing thread finishes last is responsible for
+ *              unlinking the node from every level and passing it to the garbage collector.
+ */
+static void CCConcurrentSkipListReclaim(CCConcurrentSkipList SkipList, CCConcurrentSkipListNode *Node, CCConcurrentSkipListNodeState State)
+{
+    if (atomic_fetch_or_explicit(&Node->state, State, memory_order_acq_rel) != (CCConcurrentSkipListNodeStateLinked | CCConcurrentSkipListNodeStateRemoved) - State) return;
+    
+    CCConcurrentSkipListNode *Predecessors[CC_CONCURRENT_SKIP_LIST_MAX_LEVEL], *Successors[CC_CONCURRENT_SKIP_LIST_MAX_LEVEL];
+    CCConcurrentSkipListFind(SkipList, CCConcurrentSkipListNodeKey(Node), Predecessors, Successors);
+    
+    CCConcurrentGarbageCollectorManage(SkipList->gc, Node, CCFree);
+}
+
+_Bool CCConcurrentSkipListInsert(CCConcurrentSkipList SkipList, const void *Key, const void *Value)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    CCAssertLog(Value || !SkipList->valueSize, "Value must not be null");
+    
+    CCConcurrentSkipListNode *Predecessors[CC_CONCURRENT_SKIP_LIST_MAX_LEVEL], *Successors[CC_CONCURRENT_SKIP_LIST_MAX_LEVEL];
+    CCConcurrentSkipListNode *Node = NULL;
+    const size_t Level = CCConcurrentSkipListRandomLevel();
+    
+    CCConcurrentGarbageCollectorBegin(SkipList->gc);
+    
+    for ( ; ; )
+    {
+        if (CCConcurrentSkipListFind(SkipList, Key, Predecessors, Successors))
+        {
+            CCConcurrentGarbageCollectorEnd(SkipList->gc);
+            
+            if (Node) CCFree(Node);
+            
+            return FALSE;
+        }
+        
+        if (!Node)
+        {
+            const size_t Size = sizeof(CCConcurrentSkipListNode) + (sizeof(_Atomic(uintptr_t)) * Level) + SkipList->keySize + SkipList->valueSize;
+            
+            Node = CCMalloc(SkipList->allocator, Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+            if (!Node)
+            {
+                CC_LOG_ERROR("Failed to insert into concurrent skip list, due to allocation failure. Allocation size (%zu)", Size);
+                CCConcurrentGarbageCollectorEnd(SkipList->gc);
+                
+                return FALSE;
+            }
+            
+            atomic_init(&Node->state, 0);
+            Node->level = (uint8_t)Level;
+            memcpy(CCConcurrentSkipListNodeKey(Node), Key, SkipList->keySize);
+            if (SkipList->valueSize) memcpy(CCConcurrentSkipListNodeValue(SkipList, Node), Value, SkipList->valueSize);
+        }
+        
+        for (size_t Loop = 0; Loop < Level; Loop++) atomic_store_explicit(&Node->next[Loop], (uintptr_t)Successors[Loop], memory_order_relaxed);
+        
+        uintptr_t Expected = (uintptr_t)Successors[0];
+        if (atomic_compare_exchange_strong_explicit(&Predecessors[0]->next[0], &Expected, (uintptr_t)Node, memory_order_release, memory_order_relaxed)) break;
+    }
+    
+    atomic_fetch_add_explicit(&SkipList->count, 1, memory_order_relaxed);
+    
+    for (size_t Loop = 1; Loop < Level; Loop++)
+    {
+        for ( ; ; )
+        {
+            uintptr_t Next = atomic_load_explicit(&Node->next[Loop], memory_order_acquire);
+            
+            //If the node has started to be removed or its successor has changed and the node is now marked, stop linking
+            if ((Next & CC_CONCURRENT_SKIP_LIST_MARK) || ((Next != (uintptr_t)Successors[Loop]) && (!atomic_compare_exchange_strong_explicit(&Node->next[Loop], &Next, (uintptr_t)Successors[Loop], memory_order_release, memory_order_relaxed)))) goto Linked;
+            
+            uintptr_t Expected = (uintptr_t)Successors[Loop];
+            if (atomic_compare_exchange_strong_explicit(&Predecessors[Loop]->next[Loop], &Expected, (uintptr_t)Node, memory_order_release, memory_order_relaxed)) break;
+            
+            CCConcurrentSkipListFind(SkipList, Key, Predecessors, Successors);
+            
+            if (Successors[0] != Node) goto Linked;
+        }
+    }
+    
+Linked:
+    CCConcurrentSkipListReclaim(SkipList, Node, CCConcurrentSkipListNodeStateLinked);
+    
+    CCConcurrentGarbageCollectorEnd(SkipList->gc);
+    
+    return TRUE;
+}
+
+_Bool CCConcurrentSkipListRemove(CCConcurrentSkipList SkipList, const void *Key, void *RemovedValue)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    
+    CCConcurrentSkipListNode *Predecessors[CC_CONCURRENT_SKIP_LIST_MAX_LEVEL], *Successors[CC_CONCURRENT_SKIP_LIST_MAX_LEVEL];
+    
+    CCConcurrentGarbageCollectorBegin(SkipList->gc);
+    
+    if (!CCConcurrentSkipListFind(SkipList, Key, Predecessors, Successors))
+    {
+        CCConcurrentGarbageCollectorEnd(SkipList->gc);
+        
+        return FALSE;
+    }
+    
+    CCConcurrentSkipListNode *Node = Successors[0];
+    
+    for (size_t Loop = Node->level; --Loop; )
+    {
+        uintptr_t Next = atomic_load_explicit(&Node->next[Loop], memory_order_relaxed);
+        while ((!(Next & CC_CONCURRENT_SKIP_LIST_MARK)) && (!atomic_compare_exchange_weak_explicit(&Node->next[Loop], &Next, Next | CC_CONCURRENT_SKIP_LIST_MARK, memory_order_acq_rel, memory_order_relaxed)));
+    }
+    
+    for (uintptr_t Next = atomic_load_explicit(&Node->next[0], memory_order_relaxed); ; )
+    {
+        if (Next & CC_CONCURRENT_SKIP_LIST_MARK)
+        {
+            //Another thread removed the node first
+            CCConcurrentGarbageCollectorEnd(SkipList->gc);
+            
+            return FALSE;
+        }
+        
+        if (atomic_compare_exchange_weak_explicit(&Node->next[0], &Next, Next | CC_CONCURRENT_SKIP_LIST_MARK, memory_order_acq_rel, memory_order_relaxed)) break;
+    }
+    
+    atomic_fetch_sub_explicit(&SkipList->count, 1, memory_order_relaxed);
+    
+    if ((RemovedValue) && (SkipList->valueSize)) memcpy(RemovedValue, CCConcurrentSkipListNodeValue(SkipList, Node), SkipList->valueSize);
+    
+    CCConcurrentSkipListReclaim(SkipList, Node, CCConcurrentSkipListNodeStateRemoved);
+    
+    CCConcurrentGarbageCollectorEnd(SkipList->gc);
+    
+    return TRUE;
+}
+
+size_t CCConcurrentSkipListGetCount(CCConcurrentSkipList SkipList)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    
+    return atomic_load_explicit(&SkipList->count, memory_order_relaxed);
+}
+
+/*!
+ * @brief Find the first node with a key that is equal to or greater than the key.
+ * @description Does not modify the skip list, removed nodes are skipped over. Must be called inside
+ *              of a garbage collector section.
+ *
+ * @param Key The key to search for, or NULL to get the first node.
+ * @return The node, or NULL if there is none.
+ */
+static CCConcurrentSkipListNode *CCConcurrentSkipListSearchFirst(CCConcurrentSkipList SkipList, const void *Key)
+{
+    CCConcurrentSkipListNode *Predecessor = SkipList->head, *Current = NULL;
+    
+    if (Key)
+    {
+        for (size_t Level = CC_CONCURRENT_SKIP_LIST_MAX_LEVEL; Level--; )
+        {
+            Current = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Predecessor->next[Level], memory_order_acquire));
+            
+            while ((Current) && (CCConcurrentSkipListCompare(SkipList, Current, Key) == CCComparisonResultAscending))
+            {
+                Predecessor = Current;
+                Current = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Current->next[Level], memory_order_acquire));
+            }
+        }
+    }
+    
+    else Current = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Predecessor->next[0], memory_order_acquire));
+    
+    while ((Current) && (CCConcurrentSkipListNodeIsRemoved(Current))) Current = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Current->next[0], memory_order_acquire));
+    
+    return Current;
+}
+
+/*!
+ * @brief Find the last node with a key that is less than the key.
+ * @description Does not modify the skip list, removed nodes are skipped over. Must be called inside
+ *              of a garbage collector section.
+ *
+ * @param Key The key to search for, or NULL to get the last node.
+ * @return The node, or NULL if there is none.
+ */
+static CCConcurrentSkipListNode *CCConcurrentSkipListSearchLast(CCConcurrentSkipList SkipList, const void *Key)
+{
+    for ( ; ; )
+    {
+        CCConcurrentSkipListNode *Predecessor = SkipList->head;
+        
+        for (size_t Level = CC_CONCURRENT_SKIP_LIST_MAX_LEVEL; Level--; )
+        {
+            for (CCConcurrentSkipListNode *Current; (Current = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Predecessor->next[Level], memory_order_acquire))); Predecessor = Current)
+            {
+                if ((Key) && (CCConcurrentSkipListCompare(SkipList, Current, Key) != CCComparisonResultAscending)) break;
+            }
+        }
+        
+        if (Predecessor == SkipList->head) return NULL;
+        if (!CCConcurrentSkipListNodeIsRemoved(Predecessor)) return Predecessor;
+        
+        Key = CCConcurrentSkipListNodeKey(Predecessor);
+    }
+}
+
+_Bool CCConcurrentSkipListGetValue(CCConcurrentSkipList SkipList, const void *Key, void *Value)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    
+    CCConcurrentGarbageCollectorBegin(SkipList->gc);
+    
+    CCConcurrentSkipListNode *Node = CCConcurrentSkipListSearchFirst(SkipList, Key);
+    const _Bool Exists = (Node) && (CCConcurrentSkipListCompare(SkipList, Node, Key) == CCComparisonResultEqual);
+    
+    if ((Exists) && (Value) && (SkipList->valueSize)) memcpy(Value, CCConcurrentSkipListNodeValue(SkipList, Node), SkipList->valueSize);
+    
+    CCConcurrentGarbageCollectorEnd(SkipList->gc);
+    
+    return Exists;
+}
+
+static void *CCConcurrentSkipListEnumerableHandler(CCEnumerator *Enumerator, CCEnumerableAction Action)
+{
+    CCConcurrentSkipList SkipList = Enumerator->ref;
+    CCConcurrentSkipListNode *Node = Enumerator->state.internal.ptr;
+    const void *Min = (const void*)Enumerator->state.internal.extra[0], *Max = (const void*)Enumerator->state.internal.extra[1];
+    
+    switch (Action)
+    {
+        case CCEnumerableActionHead:
+            Node = CCConcurrentSkipListSearchFirst(SkipList, Min);
+            break;
+            
+        case CCEnumerableActionTail:
+            Node = CCConcurrentSkipListSearchLast(SkipList, Max);
+            break;
+            
+        case CCEnumerableActionNext:
+            if (Node)
+            {
+                do {
+                    Node = CCConcurrentSkipListNodePointer(atomic_load_explicit(&Node->next[0], memory_order_acquire));
+                } while ((Node) && (CCConcurrentSkipListNodeIsRemoved(Node)));
+            }
+            break;
+            
+        case CCEnumerableActionPrevious:
+            if (Node) Node = CCConcurrentSkipListSearchLast(SkipList, CCConcurrentSkipListNodeKey(Node));
+            break;
+            
+        case CCEnumerableActionCurrent:
+            break;
+    }
+    
+    if ((Node) && (((Min) && (CCConcurrentSkipListCompare(SkipList, Node, Min) == CCComparisonResultAscending)) || ((Max) && (CCConcurrentSkipListCompare(SkipList, Node, Max) != CCComparisonResultAscending)))) Node = NULL;
+    
+    Enumerator->state.internal.ptr = Node;
+    
+    if (!Node) return NULL;
+    
+    return Enumerator->option == CCConcurrentSkipListEnumerableOptionValue ? CCConcurrentSkipListNodeValue(SkipList, Node) : CCConcurrentSkipListNodeKey(Node);
+}
+
+static void CCConcurrentSkipListGetEnumerable(CCConcurrentSkipList SkipList, const void *Min, const void *Max, CCConcurrentSkipListEnumerableOption Option, CCEnumerable *Enumerable)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    CCAssertLog(Enumerable, "Enumerable must not be null");
+    
+    CCConcurrentGarbageCollectorBegin(SkipList->gc);
+    
+    *Enumerable = (CCEnumerable){
+        .handler = CCConcurrentSkipListEnumerableHandler,
+        .enumerator = {
+            .ref = SkipList,
+            .option = Option,
+            .state = {
+                .internal = { .ptr = NULL, .extra = { (uintptr_t)Min, (uintptr_t)Max } },
+                .type = CCEnumeratorFormatInternal
+            }
+        }
+    };
+    
+    CCConcurrentSkipListEnumerableHandler(&Enumerable->enumerator, CCEnumerableActionHead);
+}
+
+void CCConcurrentSkipListGetKeyEnumerable(CCConcurrentSkipList SkipList, const void *Min, const void *Max, CCEnumerable *Enumerable)
+{
+    CCConcurrentSkipListGetEnumerable(SkipList, Min, Max, CCConcurrentSkipListEnumerableOptionKey, Enumerable);
+}
+
+void CCConcurrentSkipListGetValueEnumerable(CCConcurrentSkipList SkipList, const void *Min, const void *Max, CCEnumerable *Enumerable)
+{
+    CCConcurrentSkipListGetEnumerable(SkipList, Min, Max, CCConcurrentSkipListEnumerableOptionValue, Enumerable);
+}
+
+void CCConcurrentSkipListReleaseEnumerable(CCConcurrentSkipList SkipList, CCEnumerable *Enumerable)
+{
+    CCAssertLog(SkipList, "SkipList must not be null");
+    CCAssertLog((Enumerable->enumerator.ref == SkipList) && (Enumerable->handler == CCConcurrentSkipListEnumerableHandler), "Enumerable should be the skip list enumerable");
+    
+    CCConcurrentGarbageCollectorEnd(SkipList->gc);
+}
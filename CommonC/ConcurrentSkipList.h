@@ -0,0 +1,172 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_ConcurrentSkipList_h
+#define CommonC_ConcurrentSkipList_h
+
+/*
+ Lock-free ordered map. This is a skip list that keeps its entries sorted by key using the
+ supplied comparator, giving O(log n) expected lookups, insertions and removals. Removed
+ nodes are reclaimed through the garbage collector, so readers never block writers and
+ enumerating a range does not prevent concurrent mutation.
+ 
+ Allows for many producer-consumer access.
+ */
+
+#include <CommonC/Base.h>
+#include <CommonC/Ownership.h>
+#include <CommonC/Allocator.h>
+#include <CommonC/Comparator.h>
+#include <CommonC/Enumerable.h>
+#include <CommonC/ConcurrentGarbageCollector.h>
+
+
+/*!
+ * @brief The concurrent skip list.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCConcurrentSkipListInfo *CCConcurrentSkipList;
+
+
+#pragma mark - Creation / Destruction
+/*!
+ * @brief Create a concurrent skip list.
+ * @description This skip list allows for many producer-consumer access.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param KeySize The size of the keys.
+ * @param ValueSize The size of the values.
+ * @param KeyComparator The comparator used to order the keys. Must not be NULL.
+ * @param GC The garbage collector to be used in this skip list.
+ * @return A skip list, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCConcurrentSkipList CCConcurrentSkipListCreate(CCAllocatorType Allocator, size_t KeySize, size_t ValueSize, CCComparator KeyComparator, CCConcurrentGarbageCollector CC_OWN(GC));
+
+/*!
+ * @brief Destroy a skip list.
+ * @warning All usage by other threads must have finished before final destruction.
+ * @param SkipList The skip list to be destroyed.
+ */
+void CCConcurrentSkipListDestroy(CCConcurrentSkipList CC_DESTROY(SkipList));
+
+#pragma mark - Insertions/Deletions
+/*!
+ * @brief Insert an entry into the skip list.
+ * @performance Lock-free O(log n) expected operation.
+ * @param SkipList The skip list to insert the entry into.
+ * @param Key The pointer to the key to be copied into the skip list. This must not be NULL.
+ * @param Value The pointer to the value to be copied into the skip list. May be NULL if the
+ *        value size is 0.
+ *
+ * @return Whether the entry was inserted (TRUE), or not (FALSE) because an entry with the same
+ *         key already exists or the allocation failed.
+ */
+_Bool CCConcurrentSkipListInsert(CCConcurrentSkipList SkipList, const void *Key, const void *Value);
+
+/*!
+ * @brief Remove an entry from the skip list.
+ * @performance Lock-free O(log n) expected operation.
+ * @param SkipList The skip list to remove the entry from.
+ * @param Key The pointer to the key of the entry to be removed. This must not be NULL.
+ * @param RemovedValue A pointer to where the value that was removed can be written to. If NULL
+ *        this will be ignored.
+ *
+ * @return Whether or not an entry was removed.
+ */
+_Bool CCConcurrentSkipListRemove(CCConcurrentSkipList SkipList, const void *Key, void *RemovedValue);
+
+#pragma mark - Query Info
+/*!
+ * @brief Get the current number of entries in the skip list.
+ * @note This should only be used as a rough indicator of the current number of entries if calling
+ *       it during mutation operations on other threads.
+ *
+ * @param SkipList The skip list to get the count of.
+ * @return The number of entries.
+ */
+size_t CCConcurrentSkipListGetCount(CCConcurrentSkipList SkipList);
+
+/*!
+ * @brief Get the value for a key.
+ * @performance Lock-free O(log n) expected operation that performs no writes to the skip list.
+ * @param SkipList The skip list to get the value of.
+ * @param Key The pointer to the key of the entry. This must not be NULL.
+ * @param Value A pointer to where the value should be written to. If NULL this will be ignored.
+ * @return Whether or not an entry existed for the key.
+ */
+_Bool CCConcurrentSkipListGetValue(CCConcurrentSkipList SkipList, const void *Key, void *Value);
+
+#pragma mark - Enumeration
+/*!
+ * @brief Get an enumerable for the keys in a range of the skip list.
+ * @description Enumerates the keys in ascending order. Entries inserted or removed during
+ *              enumeration may or may not be visited.
+ *
+ * @warning The enumerable must be released using @b CCConcurrentSkipListReleaseEnumerable, and
+ *          must only be used by the calling thread. As the enumerable holds a garbage collector
+ *          section, the calling thread must not use the skip list (or anything else sharing its
+ *          garbage collector) until the enumerable is released.
+ *
+ * @param SkipList The skip list to enumerate.
+ * @param Min The pointer to the smallest key (inclusive) of the range, or NULL if unbounded. This
+ *        must remain valid until the enumerable is released.
+ *
+ * @param Max The pointer to the largest key (exclusive) of the range, or NULL if unbounded. This
+ *        must remain valid until the enumerable is released.
+ *
+ * @param Enumerable A pointer to the enumerable to use.
+ */
+void CCConcurrentSkipListGetKeyEnumerable(CCConcurrentSkipList SkipList, const void *Min, const void *Max, CCEnumerable *Enumerable);
+
+/*!
+ * @brief Get an enumerable for the values in a range of the skip list.
+ * @description Enumerates the values in ascending order of their keys. Entries inserted or removed
+ *              during enumeration may or may not be visited.
+ *
+ * @warning The enumerable must be released using @b CCConcurrentSkipListReleaseEnumerable, and
+ *          must only be used by the calling thread. As the enumerable holds a garbage collector
+ *          section, the calling thread must not use the skip list (or anything else sharing its
+ *          garbage collector) until the enumerable is released.
+ *
+ * @param SkipList The skip list to enumerate.
+ * @param Min The pointer to the smallest key (inclusive) of the range, or NULL if unbounded. This
+ *        must remain valid until the enumerable is released.
+ *
+ * @param Max The pointer to the largest key (exclusive) of the range, or NULL if unbounded. This
+ *        must remain valid until the enumerable is released.
+ *
+ * @param Enumerable A pointer to the enumerable to use.
+ */
+void CCConcurrentSkipListGetValueEnumerable(CCConcurrentSkipList SkipList, const void *Min, const void *Max, CCEnumerable *Enumerable);
+
+/*!
+ * @brief Release an enumerable of the skip list.
+ * @description Allows the entries that were removed during enumeration to be reclaimed.
+ * @warning The enumerable should not be used after.
+ * @param SkipList The skip list the enumerable belongs to.
+ * @param Enumerable A pointer to the enumerable to be released.
+ */
+void CCConcurrentSkipListReleaseEnumerable(CCConcurrentSkipList SkipList, CCEnumerable *Enumerable);
+
+#endif
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ConcurrentWait.h"
+#include "Platform.h"
+#include "Extensions.h"
+
+#if CC_PLATFORM_UNIX && defined(__linux__)
+#define CC_CONCURRENT_WAIT_USING_FUTEX 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif CC_PLATFORM_WINDOWS
+#define CC_CONCURRENT_WAIT_USING_WAIT_ON_ADDRESS 1
+#include <windows.h>
+#elif CC_PLATFORM_APPLE
+#define CC_CONCURRENT_WAIT_USING_ULOCK 1
+
+#if defined(__has_include) && __has_include(<os/os_sync_wait_on_address.h>)
+#define CC_CONCURRENT_WAIT_USING_OS_SYNC 1
+#include <os/os_sync_wait_on_address.h>
+#endif
+
+#define CC_ULOCK_COMPARE_AND_WAIT 1
+#define CC_ULOCK_WAKE_ALL 0x00000100
+#define CC_ULOCK_NO_ERRNO 0x01000000
+
+extern int __ulock_wait(uint32_t Operation, void *Address, uint64_t Value, uint32_t Timeout);
+extern int __ulock_wake(uint32_t Operation, void *Address, uint64_t WakeValue);
+#elif CC_PLATFORM_POSIX_COMPLIANT
+#define CC_CONCURRENT_WAIT_USING_PTHREADS 1
+#include <pthread.h>
+
+#define CC_CONCURRENT_WAIT_BUCKET_COUNT 64
+
+/*
+ Waiters park on a condition variable selected by hashing the address. As several addresses can share
+ a bucket, wakes always broadcast and waiters re-check their value.
+ */
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t condition;
+} CCConcurrentWaitBuckets[CC_CONCURRENT_WAIT_BUCKET_COUNT];
+
+static pthread_once_t CCConcurrentWaitBucketsOnce = PTHREAD_ONCE_INIT;
+
+static void CCConcurrentWaitBucketsInit(void)
+{
+    for (size_t Loop = 0; Loop < CC_CONCURRENT_WAIT_BUCKET_COUNT; Loop++)
+    {
+        pthread_mutex_init(&CCConcurrentWaitBuckets[Loop].lock, NULL);
+        pthread_cond_init(&CCConcurrentWaitBuckets[Loop].condition, NULL);
+    }
+}
+
+static size_t CCConcurrentWaitBucket(_Atomic(uint32_t) *Address)
+{
+    pthread_once(&CCConcurrentWaitBucketsOnce, CCConcurrentWaitBucketsInit);
+    
+    return (size_t)(((uint64_t)(uintptr_t)Address * UINT64_C(0x9e3779b97f4a7c15)) >> 32) % CC_CONCURRENT_WAIT_BUCKET_COUNT;
+}
+#endif
+
+void CCConcurrentWait(_Atomic(uint32_t) *Address, uint32_t Value)
+{
+#if CC_CONCURRENT_WAIT_USING_FUTEX
+    syscall(SYS_futex, (uint32_t*)Address, FUTEX_WAIT_PRIVATE, Value, NULL, NULL, 0);
+#elif CC_CONCURRENT_WAIT_USING_WAIT_ON_ADDRESS
+    WaitOnAddress((volatile VOID*)Address, &Value, sizeof(uint32_t), INFINITE);
+#elif CC_CONCURRENT_WAIT_USING_ULOCK
+#if CC_CONCURRENT_WAIT_USING_OS_SYNC
+    if (CC_AVAILABLE(macOS 14.4, iOS 17.4, tvOS 17.4, watchOS 10.4, *))
+    {
+        os_sync_wait_on_address((void*)Address, Value, sizeof(uint32_t), OS_SYNC_WAIT_ON_ADDRESS_NONE);
+        return;
+    }
+#endif
+    
+    __ulock_wait(CC_ULOCK_COMPARE_AND_WAIT | CC_ULOCK_NO_ERRNO, (void*)Address, Value, 0);
+#elif CC_CONCURRENT_WAIT_USING_PTHREADS
+    const size_t Index = CCConcurrentWaitBucket(Address);
+    
+    pthread_mutex_lock(&CCConcurrentWaitBuckets[Index].lock);
+    
+    if (atomic_load_explicit(Address, memory_order_relaxed) == Value) pthread_cond_wait(&CCConcurrentWaitBuckets[Index].condition, &CCConcurrentWaitBuckets[Index].lock);
+    
+    pthread_mutex_unlock(&CCConcurrentWaitBuckets[Index].lock);
+#else
+    while (atomic_load_explicit(Address, memory_order_relaxed) == Value) CC_SPIN_WAIT();
+#endif
+}
+
+void CCConcurrentWake(_Atomic(uint32_t) *Address, _Bool All)
+{
+#if CC_CONCURRENT_WAIT_USING_FUTEX
+    syscall(SYS_futex, (uint32_t*)Address, FUTEX_WAKE_PRIVATE, All ? INT32_MAX : 1, NULL, NULL, 0);
+#elif CC_CONCURRENT_WAIT_USING_WAIT_ON_ADDRESS
+    if (All) WakeByAddressAll((PVOID)Address);
+    else WakeByAddressSingle((PVOID)Address);
+#elif CC_CONCURRENT_WAIT_USING_ULOCK
+#if CC_CONCURRENT_WAIT_USING_OS_SYNC
+    if (CC_AVAILABLE(macOS 14.4, iOS 17.4, tvOS 17.4, watchOS 10.4, *))
+    {
+        if (All) os_sync_wake_by_address_all((void*)Address, sizeof(uint32_t), OS_SYNC_WAKE_BY_ADDRESS_NONE);
+        else os_sync_wake_by_address_any((void*)Address, sizeof(uint32_t), OS_SYNC_WAKE_BY_ADDRESS_NONE);
+        
+        return;
+    }
+#endif
+    
+    __ulock_wake(CC_ULOCK_COMPARE_AND_WAIT | CC_ULOCK_NO_ERRNO | (All ? CC_ULOCK_WAKE_ALL : 0), (void*)Address, 0);
+#elif CC_CONCURRENT_WAIT_USING_PTHREADS
+    const size_t Index = CCConcurrentWaitBucket(Address);
+    
+    pthread_mutex_lock(&CCConcurrentWaitBuckets[Index].lock);
+    pthread_cond_broadcast(&CCConcurrentWaitBuckets[Index].condition);
+    pthread_mutex_unlock(&CCConcurrentWaitBuckets[Index].lock);
+#endif
+}
@@ -0,0 +1,52 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_ConcurrentWait_h
+#define CommonC_ConcurrentWait_h
+
+#include <CommonC/Base.h>
+#include <stdatomic.h>
+
+/*!
+ * @brief Block the calling thread while the value at the address is equal to the expected value.
+ * @description Uses the platform's address based wait (futex on Linux, WaitOnAddress on Windows,
+ *              os_sync_wait_on_address/__ulock_wait on Apple platforms) where available, otherwise
+ *              parks the thread on a condition variable.
+ *
+ * @warning The thread may be woken spuriously, so the caller should re-check its condition on return.
+ * @param Address The address to wait on.
+ * @param Value The value the address is expected to hold. If it does not hold this value the function
+ *        returns immediately.
+ */
+void CCConcurrentWait(_Atomic(uint32_t) *Address, uint32_t Value);
+
+/*!
+ * @brief Wake the threads waiting on the address.
+ * @param Address The address the threads are waiting on.
+ * @param All Whether all of the waiting threads should be woken (TRUE), or only one (FALSE).
+ */
+void CCConcurrentWake(_Atomic(uint32_t) *Address, _Bool All);
+
+#endif
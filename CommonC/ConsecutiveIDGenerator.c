@@ -27,49 +27,54 @@
 #include "ConsecutiveIDGenerator.h"
 #include "MemoryAllocation.h"
 #include "Assertion.h"
+#include "BitTricks.h"
 #include <stdatomic.h>
 
+#if CC_HARDWARE_PTR_64
+typedef uint64_t CCConsecutiveIDGeneratorWord;
+#define CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX UINT64_MAX
+#else
+typedef uint32_t CCConsecutiveIDGeneratorWord;
+#define CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX UINT32_MAX
+#endif
+
+#define CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS (sizeof(CCConsecutiveIDGeneratorWord) * 8)
+
 /*
- CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE enforces standard compliant usage of atomic types. This however will
- result in no batched operations.
+ The maximum number of levels needed to cover the entire address space.
  */
-#ifndef CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-#define CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE 0
-#endif
+#define CC_CONSECUTIVE_ID_GENERATOR_MAX_LEVELS 16
 
-#if !CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-#if !CC_HARDWARE_PTR_64 && !CC_HARDWARE_PTR_32
-#undef CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-#define CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE 1
-#endif
+/*
+ The number of words the initial per-thread hints will be spread across.
+ */
+#ifndef CC_CONSECUTIVE_ID_GENERATOR_HINT_SPREAD
+#define CC_CONSECUTIVE_ID_GENERATOR_HINT_SPREAD 64
 #endif
 
+#define CC_CONSECUTIVE_ID_GENERATOR_NONE SIZE_MAX
+
+/*
+ The IDs are stored in a hierarchical bitmap. Level 0 contains a bit per ID (set if assigned), while each bit of a
+ higher level summarises whether the corresponding word in the level below it is full. So finding an available ID
+ only needs to visit O(log64 n) words.
+ 
+ The summaries are only used as hints, so they're allowed to temporarily disagree with the level below. A summary
+ bit is only set after its word is observed to be full, and is rechecked after being set to catch a concurrent
+ recycle, so a free ID can never be hidden indefinitely.
+ */
 typedef struct {
     size_t size;
-#if CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-    atomic_flag pool[];
-#else
-    _Atomic(uint8_t) pool[];
-#endif
+    size_t levels;
+    struct {
+        _Atomic(CCConsecutiveIDGeneratorWord) *words;
+        /// The number of bits (entries in the level below, or IDs for level 0).
+        size_t count;
+    } level[CC_CONSECUTIVE_ID_GENERATOR_MAX_LEVELS];
+    _Atomic(CCConsecutiveIDGeneratorWord) words[];
 } CCConsecutiveIDGeneratorInternal;
 
-#if !CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-#if CC_HARDWARE_PTR_64
-typedef uint64_t CCConsecutiveIDGeneratorSample;
-#define CC_CONCURRENT_ID_POOL_SAMPLE_MAX UINT64_MAX
-#else
-typedef uint32_t CCConsecutiveIDGeneratorSample;
-#define CC_CONCURRENT_ID_POOL_SAMPLE_MAX UINT32_MAX
-#endif
-#endif
-
-#if !CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-#if CC_HARDWARE_PTR_64
-_Static_assert(sizeof(_Atomic(CCConsecutiveIDGeneratorSample)) == 8, "Native types are not atomic, please set CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE");
-#elif CC_HARDWARE_PTR_32
-_Static_assert(sizeof(_Atomic(CCConsecutiveIDGeneratorSample)) == 4, "Native types are not atomic, please set CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE");
-#endif
-#endif
+static _Thread_local size_t CCConsecutiveIDGeneratorHint = SIZE_MAX;
 
 
 static void *CCConsecutiveIDGeneratorConstructor(CCAllocatorType Allocator, size_t Count);
@@ -89,24 +94,47 @@ const CCConcurrentIDGeneratorInterface CCConsecutiveIDGeneratorInterface = {
 
 const CCConcurrentIDGeneratorInterface * const CCConsecutiveIDGenerator = &CCConsecutiveIDGeneratorInterface;
 
+static inline size_t CCConsecutiveIDGeneratorWordCount(size_t Count)
+{
+    return ((Count - 1) / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS) + 1;
+}
+
 void *CCConsecutiveIDGeneratorConstructor(CCAllocatorType Allocator, size_t PoolSize)
 {
-    CCConsecutiveIDGeneratorInternal *IDPool;
-#if CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-    const size_t PaddedPoolCount = PoolSize;
-#else
-    const size_t PaddedPoolCount = ((((PoolSize - 1) / (sizeof(CCConsecutiveIDGeneratorSample) / sizeof(typeof(IDPool->pool[0])))) + 1) * (sizeof(CCConsecutiveIDGeneratorSample) / sizeof(typeof(IDPool->pool[0]))));
-#endif
-    IDPool = CCMalloc(Allocator, sizeof(CCConsecutiveIDGeneratorInternal) + (PaddedPoolCount * sizeof(typeof(IDPool->pool[0]))), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    CCAssertLog(PoolSize, "PoolSize must not be 0");
+    
+    size_t Levels = 0, WordCount = 0;
+    for (size_t Count = PoolSize; ; Count = CCConsecutiveIDGeneratorWordCount(Count))
+    {
+        WordCount += CCConsecutiveIDGeneratorWordCount(Count);
+        Levels++;
+        
+        if (Count <= CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS) break;
+    }
+    
+    CCConsecutiveIDGeneratorInternal *IDPool = CCMalloc(Allocator, sizeof(CCConsecutiveIDGeneratorInternal) + (WordCount * sizeof(typeof(IDPool->words[0]))), NULL, CC_DEFAULT_ERROR_CALLBACK);
     if (IDPool)
     {
         IDPool->size = PoolSize;
-#if CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-        for (size_t Loop = 0; Loop < PoolSize; Loop++) atomic_flag_clear_explicit(&IDPool->pool[Loop], memory_order_relaxed);
-#else
-        for (size_t Loop = 0; Loop < PoolSize; Loop++) atomic_init(&IDPool->pool[Loop], 0);
-        for (size_t Loop = PoolSize, PadCount = PaddedPoolCount; Loop < PadCount; Loop++) atomic_init(&IDPool->pool[Loop], UINT8_MAX);
-#endif
+        IDPool->levels = Levels;
+        
+        _Atomic(CCConsecutiveIDGeneratorWord) *Words = IDPool->words;
+        for (size_t Level = 0, Count = PoolSize; Level < Levels; Level++)
+        {
+            const size_t LevelWordCount = CCConsecutiveIDGeneratorWordCount(Count);
+            
+            IDPool->level[Level].words = Words;
+            IDPool->level[Level].count = Count;
+            
+            for (size_t Loop = 0; Loop < LevelWordCount; Loop++) atomic_init(&Words[Loop], 0);
+            
+            // Padding bits are permanently marked as assigned/full
+            const size_t Remainder = Count % CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS;
+            if (Remainder) atomic_init(&Words[LevelWordCount - 1], CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX << Remainder);
+            
+            Words += LevelWordCount;
+            Count = LevelWordCount;
+        }
     }
     
     return IDPool;
@@ -117,36 +145,106 @@ void CCConsecutiveIDGeneratorDestructor(CCConsecutiveIDGeneratorInternal *IDPool
     CCFree(IDPool);
 }
 
-_Bool CCConsecutiveIDGeneratorTryAssign(CCConsecutiveIDGeneratorInternal *IDPool, uintptr_t *ID)
+static void CCConsecutiveIDGeneratorMarkAvailable(CCConsecutiveIDGeneratorInternal *IDPool, size_t Level, size_t Index)
 {
-#if CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-    for (size_t Loop = 0, Count = IDPool->size; Loop < Count; Loop++)
+    for ( ; Level < IDPool->levels; Level++, Index /= CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS)
     {
-        if (!atomic_flag_test_and_set_explicit(&IDPool->pool[Loop], memory_order_relaxed))
-        {
-            *ID = Loop;
-            atomic_thread_fence(memory_order_acquire);
-            return TRUE;
-        }
+        const CCConsecutiveIDGeneratorWord Bit = (CCConsecutiveIDGeneratorWord)1 << (Index % CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS);
+        
+        if (atomic_fetch_and(&IDPool->level[Level].words[Index / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS], ~Bit) != CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX) break;
     }
-#else
-    for (size_t Loop = 0, Count = IDPool->size; Loop < Count; Loop += (sizeof(CCConsecutiveIDGeneratorSample) / sizeof(typeof(IDPool->pool[0]))))
+}
+
+static void CCConsecutiveIDGeneratorMarkFull(CCConsecutiveIDGeneratorInternal *IDPool, size_t Level, size_t Index)
+{
+    if (Level >= IDPool->levels) return;
+    
+    const CCConsecutiveIDGeneratorWord Bit = (CCConsecutiveIDGeneratorWord)1 << (Index % CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS);
+    
+    if ((atomic_fetch_or(&IDPool->level[Level].words[Index / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS], Bit) | Bit) == CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX)
+    {
+        CCConsecutiveIDGeneratorMarkFull(IDPool, Level + 1, Index / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS);
+    }
+    
+    // Recheck in case the word was recycled before the summary was set
+    if (atomic_load(&IDPool->level[Level - 1].words[Index]) != CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX) CCConsecutiveIDGeneratorMarkAvailable(IDPool, Level, Index);
+}
+
+/*!
+ * @brief Find the first entry at or after the start index of a level that is not full.
+ * @return The index of the entry, or CC_CONSECUTIVE_ID_GENERATOR_NONE if there are none.
+ */
+static size_t CCConsecutiveIDGeneratorFindAvailable(CCConsecutiveIDGeneratorInternal *IDPool, size_t Level, size_t Index)
+{
+    const size_t Count = IDPool->level[Level].count;
+    
+    while (Index < Count)
+    {
+        const size_t WordIndex = Index / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS;
+        const CCConsecutiveIDGeneratorWord Word = atomic_load_explicit(&IDPool->level[Level].words[WordIndex], memory_order_relaxed) | ~(CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX << (Index % CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS));
+        
+        if (Word != CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX) return (WordIndex * CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS) + CCBitCountLowestUnset(~(uint64_t)Word);
+        
+        if ((Level + 1) == IDPool->levels) break;
+        
+        const size_t Next = CCConsecutiveIDGeneratorFindAvailable(IDPool, Level + 1, WordIndex + 1);
+        if (Next == CC_CONSECUTIVE_ID_GENERATOR_NONE) break;
+        
+        Index = Next * CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS;
+    }
+    
+    return CC_CONSECUTIVE_ID_GENERATOR_NONE;
+}
+
+static _Bool CCConsecutiveIDGeneratorTryAssignFrom(CCConsecutiveIDGeneratorInternal *IDPool, size_t Start, uintptr_t *ID)
+{
+    for (size_t Index = Start; (Index = CCConsecutiveIDGeneratorFindAvailable(IDPool, 0, Index)) != CC_CONSECUTIVE_ID_GENERATOR_NONE; )
     {
-        CCConsecutiveIDGeneratorSample Sample = atomic_load_explicit(((_Atomic(CCConsecutiveIDGeneratorSample)*){ (_Atomic(CCConsecutiveIDGeneratorSample)*)&IDPool->pool[Loop] }), memory_order_relaxed);
-        if (Sample != CC_CONCURRENT_ID_POOL_SAMPLE_MAX)
+        const size_t WordIndex = Index / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS;
+        _Atomic(CCConsecutiveIDGeneratorWord) *Word = &IDPool->level[0].words[WordIndex];
+        
+        CCConsecutiveIDGeneratorWord Value = atomic_load_explicit(Word, memory_order_relaxed);
+        while (Value != CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX)
         {
-            for (size_t Loop2 = Loop, SampleCount = Loop + (sizeof(CCConsecutiveIDGeneratorSample) / sizeof(typeof(IDPool->pool[0]))); Loop2 < SampleCount; Loop2++)
+            const size_t BitIndex = CCBitCountLowestUnset(~(uint64_t)Value);
+            const CCConsecutiveIDGeneratorWord Bit = (CCConsecutiveIDGeneratorWord)1 << BitIndex;
+            
+            if (atomic_compare_exchange_weak_explicit(Word, &Value, Value | Bit, memory_order_acquire, memory_order_relaxed))
             {
-                if (atomic_exchange_explicit(&IDPool->pool[Loop2], UINT8_MAX, memory_order_relaxed) == 0)
-                {
-                    *ID = Loop2;
-                    atomic_thread_fence(memory_order_acquire);
-                    return TRUE;
-                }
+                if ((Value | Bit) == CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX) CCConsecutiveIDGeneratorMarkFull(IDPool, 1, WordIndex);
+                
+                *ID = (WordIndex * CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS) + BitIndex;
+                
+                return TRUE;
             }
         }
+        
+        CCConsecutiveIDGeneratorMarkFull(IDPool, 1, WordIndex);
+        
+        Index = (WordIndex + 1) * CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS;
+    }
+    
+    return FALSE;
+}
+
+_Bool CCConsecutiveIDGeneratorTryAssign(CCConsecutiveIDGeneratorInternal *IDPool, uintptr_t *ID)
+{
+    size_t Hint = CCConsecutiveIDGeneratorHint;
+    
+    if (Hint == SIZE_MAX)
+    {
+        // Spread the threads across different words to reduce contention
+        Hint = (((uintptr_t)&CCConsecutiveIDGeneratorHint >> 6) * UINT32_C(2654435761)) % CC_CONSECUTIVE_ID_GENERATOR_HINT_SPREAD * CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS;
+    }
+    
+    if (Hint >= IDPool->size) Hint %= IDPool->size;
+    
+    if ((CCConsecutiveIDGeneratorTryAssignFrom(IDPool, Hint, ID)) || ((Hint) && (CCConsecutiveIDGeneratorTryAssignFrom(IDPool, 0, ID))))
+    {
+        CCConsecutiveIDGeneratorHint = *ID;
+        
+        return TRUE;
     }
-#endif
     
     return FALSE;
 }
@@ -155,13 +253,12 @@ void CCConsecutiveIDGeneratorRecycle(CCConsecutiveIDGeneratorInternal *IDPool, u
 {
     CCAssertLog(ID < IDPool->size, "ID must have been assigned from this pool");
     
-#if CC_CONSECUTIVE_ID_GENERATOR_STRICT_COMPLIANCE
-    CCAssertLog(atomic_flag_test_and_set_explicit(&IDPool->pool[ID], memory_order_relaxed), "ID must be assigned");
-    atomic_flag_clear_explicit(&IDPool->pool[ID], memory_order_release);
-#else
-    CCAssertLog(atomic_load_explicit(&IDPool->pool[ID], memory_order_relaxed), "ID must be assigned");
-    atomic_store_explicit(&IDPool->pool[ID], 0, memory_order_release);
-#endif
+    const CCConsecutiveIDGeneratorWord Bit = (CCConsecutiveIDGeneratorWord)1 << (ID % CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS);
+    const CCConsecutiveIDGeneratorWord Value = atomic_fetch_and(&IDPool->level[0].words[ID / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS], ~Bit);
+    
+    CCAssertLog(Value & Bit, "ID must be assigned");
+    
+    if (Value == CC_CONSECUTIVE_ID_GENERATOR_WORD_MAX) CCConsecutiveIDGeneratorMarkAvailable(IDPool, 1, ID / CC_CONSECUTIVE_ID_GENERATOR_WORD_BITS);
 }
 
 size_t CCConsecutiveIDGeneratorGetMaxID(CCConsecutiveIDGeneratorInternal *IDPool)
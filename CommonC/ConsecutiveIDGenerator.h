@@ -33,9 +33,9 @@
  *
  * This ID creation pattern is not suited for small pools where IDs are not recycled frequently,
  * but lots of threads are attempting to retrieve an ID, as this will result in many threads
- * being starved. Nor is it suited for situations where a large number of IDs needs to be
- * distributed, as this will result in retrieval time taking too long (if those IDs are not being
- * recycled frequently enough).
+ * being starved. Available IDs are tracked in a hierarchical bitmap, so large pools can be
+ * distributed efficiently, and each thread starts searching from where its last ID was assigned
+ * to spread contention.
  *
  * Allows for many producer-consumer access.
  */
@@ -49,8 +49,9 @@
  * @description The base ID will start at 0 and go up to (Count - 1). Due to this if the
  *              Count = 2^8 then the ID will be one that can fit within an uint8_t.
  *
- * @performance Assigning is lock-free and has a worst case of O(n + n/8). While recycling
- *              is a wait-free O(1) operation.
+ * @performance Assigning is lock-free and visits O(log64 n) words to find an available ID.
+ *              While recycling is a lock-free O(log64 n) operation, which is O(1) unless the
+ *              ID belonged to a full word.
  */
 extern const CCConcurrentIDGeneratorInterface * const CCConsecutiveIDGenerator;
 
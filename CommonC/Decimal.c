@@ -0,0 +1,277 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Decimal.h"
+#include <string.h>
+
+#pragma mark - Fixed-Point Strings
+
+_Bool CCFixedDecimalParse(const char *String, size_t Length, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result)
+{
+    CCAssertLog(String, "String must not be null");
+    CCAssertLog(Result, "Result must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    size_t Index = 0;
+    _Bool Negative = FALSE;
+    if ((Length) && ((String[0] == '-') || (String[0] == '+')))
+    {
+        Negative = String[0] == '-';
+        Index++;
+    }
+    
+    //Digits past the scale only matter for rounding, so are reduced to the first one and whether any others are non-zero
+    _BitInt(128) Units = 0;
+    size_t Digits = 0, Places = 0;
+    int First = 0;
+    _Bool Point = FALSE, Sticky = FALSE;
+    
+    for ( ; Index < Length; Index++)
+    {
+        const char Chr = String[Index];
+        
+        if (Chr == '.')
+        {
+            if (Point) return FALSE;
+            
+            Point = TRUE;
+        }
+        
+        else if ((Chr >= '0') && (Chr <= '9'))
+        {
+            Digits++;
+            
+            if ((!Point) || (Places < Scale))
+            {
+                Units = (Units * 10) + (Chr - '0');
+                if (Units > ((_BitInt(128))INT64_MAX + 1)) return FALSE;
+                
+                if (Point) Places++;
+            }
+            
+            else if (Places++ == Scale) First = Chr - '0';
+            else Sticky |= Chr != '0';
+        }
+        
+        else return FALSE;
+    }
+    
+    if (!Digits) return FALSE;
+    
+    if (Negative) Units = -Units;
+    
+    int64_t Value;
+    if (Places > Scale)
+    {
+        //With a divisor of 20 the remainder 2 * first + sticky compares against half (10) the same as the discarded digits would
+        if (!CCFixedDecimalDivideUnits((Units * 20) + (Negative ? -1 : 1) * ((First * 2) + Sticky), 20, Rounding, &Value)) return FALSE;
+    }
+    
+    else if (!CCFixedDecimalRoundUnits(Units, (unsigned int)Places, Scale, Rounding, &Value)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Value, .scale = Scale };
+    
+    return TRUE;
+}
+
+size_t CCFixedDecimalFormat(CCFixedDecimal Value, char *Buffer, size_t Size)
+{
+    CCAssertLog(Buffer, "Buffer must not be null");
+    CCAssertLog(Value.scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    if (Value.scale > CC_FIXED_DECIMAL_SCALE_MAX) return 0;
+    
+    char Digits[CC_FIXED_DECIMAL_STRING_SIZE];
+    size_t Index = sizeof(Digits);
+    
+    uint64_t Units = Value.units < 0 ? -(uint64_t)Value.units : (uint64_t)Value.units;
+    for (size_t Loop = 0; (Units) || (Loop <= Value.scale); Loop++)
+    {
+        if ((Loop == Value.scale) && (Loop)) Digits[--Index] = '.';
+        
+        Digits[--Index] = '0' + (Units % 10);
+        Units /= 10;
+    }
+    
+    if (Value.units < 0) Digits[--Index] = '-';
+    
+    const size_t Length = sizeof(Digits) - Index;
+    if (Length >= Size) return 0;
+    
+    memcpy(Buffer, Digits + Index, Length);
+    Buffer[Length] = 0;
+    
+    return Length;
+}
+
+#pragma mark - Fixed-Point Arrays
+
+static CC_FORCE_INLINE int64_t CCFixedDecimalDivideUnits64(int64_t Value, int64_t Divisor, CCDecimalRounding Rounding)
+{
+    int64_t Quotient = Value / Divisor;
+    const int64_t Remainder = Value % Divisor;
+    
+    if (Remainder)
+    {
+        const int64_t Magnitude = Remainder < 0 ? -Remainder : Remainder, Other = Divisor - Magnitude;
+        
+        if (CCFixedDecimalRoundAway(Rounding, Value < 0, (Magnitude > Other) - (Magnitude < Other), Quotient & 1)) Quotient += Value < 0 ? -1 : 1;
+    }
+    
+    return Quotient;
+}
+
+_Bool CCFixedDecimalSumArray(const int64_t *In, size_t Count, uint8_t Scale, CCFixedDecimal *Result)
+{
+    CCAssertLog(In || !Count, "In must not be null");
+    CCAssertLog(Result, "Result must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    /*
+     Each element is split into a signed high and unsigned low 32-bit half, which are summed in separate 64-bit
+     accumulators. Neither accumulator can overflow within a block of 2^31 elements, and the independent lanes
+     vectorize.
+     */
+    _BitInt(128) Sum = 0;
+    
+    while (Count)
+    {
+        const size_t Block = Count < ((size_t)1 << 31) ? Count : ((size_t)1 << 31);
+        
+        int64_t High[4] = { 0, 0, 0, 0 };
+        uint64_t Low[4] = { 0, 0, 0, 0 };
+        
+        size_t Loop = 0;
+        for ( ; Loop + 4 <= Block; Loop += 4)
+        {
+            for (size_t Lane = 0; Lane < 4; Lane++)
+            {
+                High[Lane] += In[Loop + Lane] >> 32;
+                Low[Lane] += (uint32_t)In[Loop + Lane];
+            }
+        }
+        
+        for ( ; Loop < Block; Loop++)
+        {
+            High[0] += In[Loop] >> 32;
+            Low[0] += (uint32_t)In[Loop];
+        }
+        
+        for (size_t Lane = 0; Lane < 4; Lane++) Sum += ((_BitInt(128))High[Lane] * ((_BitInt(128))1 << 32)) + Low[Lane];
+        
+        In += Block;
+        Count -= Block;
+    }
+    
+    int64_t Units;
+    if (!CCFixedDecimalStoreUnits(Sum, &Units)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+_Bool CCFixedDecimalAddArray(const int64_t *a, const int64_t *b, int64_t *Out, size_t Count)
+{
+    CCAssertLog((a && b && Out) || !Count, "Arrays must not be null");
+    
+    uint64_t Overflow = 0;
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        //Overflowed if both operands have the same sign and the sum's sign differs
+        const uint64_t ValueA = (uint64_t)a[Loop], ValueB = (uint64_t)b[Loop], Sum = ValueA + ValueB;
+        
+        Overflow |= (ValueA ^ Sum) & (ValueB ^ Sum);
+        Out[Loop] = (int64_t)Sum;
+    }
+    
+    return !(Overflow >> 63);
+}
+
+_Bool CCFixedDecimalMulArray(const int64_t *In, uint8_t Scale, CCFixedDecimal Factor, int64_t *Out, uint8_t OutScale, size_t Count, CCDecimalRounding Rounding)
+{
+    CCAssertLog((In && Out) || !Count, "Arrays must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    CCAssertLog(OutScale <= CC_FIXED_DECIMAL_SCALE_MAX, "OutScale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    const unsigned int ProductScale = Scale + Factor.scale;
+    
+    _Bool Representable = TRUE;
+    if (ProductScale <= OutScale)
+    {
+        //Exact, scale the factor up front so each element is a single multiply
+        _BitInt(128) Multiplier;
+        if ((CCFixedDecimalScaleUnits(Factor.units, OutScale - ProductScale, &Multiplier)) && (Multiplier <= INT64_MAX) && (Multiplier >= INT64_MIN))
+        {
+            const int64_t Multiplier64 = (int64_t)Multiplier;
+            
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                int64_t Product;
+                Representable &= !__builtin_mul_overflow(In[Loop], Multiplier64, &Product);
+                Out[Loop] = Product;
+            }
+        }
+        
+        else
+        {
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                Representable &= !In[Loop];
+                Out[Loop] = 0;
+            }
+        }
+    }
+    
+    else
+    {
+        const unsigned int Exponent = ProductScale - OutScale;
+        
+        if (Exponent <= 18)
+        {
+            //Products that fit in 64 bits can use 64-bit division, which is much cheaper than the 128-bit fallback
+            const int64_t Divisor = (int64_t)CCFixedDecimalPow10(Exponent);
+            
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                int64_t Product;
+                if (!__builtin_mul_overflow(In[Loop], Factor.units, &Product)) Out[Loop] = CCFixedDecimalDivideUnits64(Product, Divisor, Rounding);
+                else Representable &= CCFixedDecimalDivideUnits((_BitInt(128))In[Loop] * Factor.units, Divisor, Rounding, Out + Loop);
+            }
+        }
+        
+        else
+        {
+            const _BitInt(128) Divisor = (_BitInt(128))CCFixedDecimalPow10(Exponent);
+            
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                Representable &= CCFixedDecimalDivideUnits((_BitInt(128))In[Loop] * Factor.units, Divisor, Rounding, Out + Loop);
+            }
+        }
+    }
+    
+    return Representable;
+}
@@ -28,6 +28,8 @@
 
 #include <CommonC/Base.h>
 #include <CommonC/Extensions.h>
+#include <CommonC/Comparator.h>
+#include <CommonC/Assertion.h>
 
 typedef struct {
     uint32_t coef;
@@ -46,6 +48,203 @@ typedef CCDecimal64 CCDecimal;
 static inline uint64_t CCDecimal32MultiplyU64(uint64_t Value, CCDecimal32 Decimal);
 static inline uint64_t CCDecimal64MultiplyU64(uint64_t Value, CCDecimal64 Decimal);
 
+#pragma mark - Fixed-Point
+
+/*!
+ * @brief The maximum scale of a fixed-point decimal.
+ */
+#define CC_FIXED_DECIMAL_SCALE_MAX 18
+
+/*!
+ * @brief The size of a buffer large enough to hold any formatted fixed-point decimal.
+ */
+#define CC_FIXED_DECIMAL_STRING_SIZE 24
+
+/*!
+ * @brief How to round results that can't be represented exactly.
+ */
+typedef CC_ENUM(CCDecimalRounding, uint8_t) {
+    /// Round towards zero.
+    CCDecimalRoundingDown,
+    /// Round away from zero.
+    CCDecimalRoundingUp,
+    /// Round towards negative infinity.
+    CCDecimalRoundingFloor,
+    /// Round towards positive infinity.
+    CCDecimalRoundingCeiling,
+    /// Round to the nearest, ties away from zero.
+    CCDecimalRoundingHalfUp,
+    /// Round to the nearest, ties towards zero.
+    CCDecimalRoundingHalfDown,
+    /// Round to the nearest, ties to the even neighbour.
+    CCDecimalRoundingHalfEven
+};
+
+/*!
+ * @brief A signed fixed-point decimal.
+ * @description Represents the value @b units * 10^-scale. Operations are exact integer arithmetic, only rounding
+ *              where the result has fewer decimal places than the exact value. Operations that overflow the
+ *              @b units of the result fail rather than saturate.
+ */
+typedef struct {
+    int64_t units;
+    uint8_t scale;
+} CCFixedDecimal;
+
+/*!
+ * @brief Create a fixed-point decimal.
+ * @param Units The value in units of 10^-scale.
+ * @param Scale The number of decimal places. Must not exceed @b CC_FIXED_DECIMAL_SCALE_MAX.
+ * @return The fixed-point decimal.
+ */
+static inline CCFixedDecimal CCFixedDecimalMake(int64_t Units, uint8_t Scale);
+
+/*!
+ * @brief Convert a fixed-point decimal to a different scale.
+ * @param Value The value to convert.
+ * @param Scale The scale of the result.
+ * @param Rounding How to round when reducing the scale.
+ * @param Result Where to store the converted value.
+ * @return Whether the value could be represented at the scale. FALSE on overflow.
+ */
+static inline _Bool CCFixedDecimalRescale(CCFixedDecimal Value, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result);
+
+/*!
+ * @brief Add two fixed-point decimals.
+ * @description The result has the larger scale of the two, so is exact.
+ * @param a The first value.
+ * @param b The second value.
+ * @param Result Where to store the sum.
+ * @return Whether the sum could be represented. FALSE on overflow.
+ */
+static inline _Bool CCFixedDecimalAdd(CCFixedDecimal a, CCFixedDecimal b, CCFixedDecimal *Result);
+
+/*!
+ * @brief Subtract two fixed-point decimals.
+ * @description The result has the larger scale of the two, so is exact.
+ * @param a The value to subtract from.
+ * @param b The value to subtract.
+ * @param Result Where to store the difference.
+ * @return Whether the difference could be represented. FALSE on overflow.
+ */
+static inline _Bool CCFixedDecimalSub(CCFixedDecimal a, CCFixedDecimal b, CCFixedDecimal *Result);
+
+/*!
+ * @brief Multiply two fixed-point decimals.
+ * @param a The first value.
+ * @param b The second value.
+ * @param Scale The scale of the result.
+ * @param Rounding How to round the exact product to the scale.
+ * @param Result Where to store the product.
+ * @return Whether the product could be represented. FALSE on overflow.
+ */
+static inline _Bool CCFixedDecimalMul(CCFixedDecimal a, CCFixedDecimal b, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result);
+
+/*!
+ * @brief Divide two fixed-point decimals.
+ * @param a The dividend.
+ * @param b The divisor.
+ * @param Scale The scale of the result.
+ * @param Rounding How to round the exact quotient to the scale.
+ * @param Result Where to store the quotient.
+ * @return Whether the quotient could be represented. FALSE on overflow or division by zero.
+ */
+static inline _Bool CCFixedDecimalDiv(CCFixedDecimal a, CCFixedDecimal b, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result);
+
+/*!
+ * @brief Compare two fixed-point decimals.
+ * @description Values are compared exactly, regardless of their scales.
+ * @param a The first value.
+ * @param b The second value.
+ * @return The comparison order.
+ */
+static inline CCComparisonResult CCFixedDecimalCompare(CCFixedDecimal a, CCFixedDecimal b);
+
+/*!
+ * @brief Convert a decimal to a fixed-point decimal.
+ * @param Decimal The decimal to convert.
+ * @param Scale The scale of the result.
+ * @param Rounding How to round when the decimal has more decimal places than the scale.
+ * @param Result Where to store the converted value.
+ * @return Whether the value could be represented. FALSE on overflow.
+ */
+#define CCFixedDecimalFromDecimal(decimal, scale, rounding, result) _Generic((decimal), CCDecimal32: CCFixedDecimalFromDecimal32, CCDecimal64: CCFixedDecimalFromDecimal64, default: CCFixedDecimalFromDecimal64)((decimal), (scale), (rounding), (result))
+
+static inline _Bool CCFixedDecimalFromDecimal32(CCDecimal32 Decimal, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result);
+static inline _Bool CCFixedDecimalFromDecimal64(CCDecimal64 Decimal, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result);
+
+/*!
+ * @brief Convert a fixed-point decimal to a decimal.
+ * @param Value The value to convert. Must not be negative.
+ * @return The decimal.
+ */
+static inline CCDecimal64 CCFixedDecimalToDecimal64(CCFixedDecimal Value);
+
+/*!
+ * @brief Parse a fixed-point decimal from a string.
+ * @description Accepts an optional sign, followed by digits with an optional decimal point.
+ * @param String The string to parse.
+ * @param Length The length of the string.
+ * @param Scale The scale of the result.
+ * @param Rounding How to round when the string has more decimal places than the scale.
+ * @param Result Where to store the value.
+ * @return Whether the string could be parsed. FALSE if it's malformed or overflows.
+ */
+_Bool CCFixedDecimalParse(const char *String, size_t Length, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result);
+
+/*!
+ * @brief Format a fixed-point decimal as a string.
+ * @description Writes all of the decimal places of the scale, e.g. "-12.50" for a scale of 2.
+ * @param Value The value to format.
+ * @param Buffer The buffer to write the null terminated string to.
+ * @param Size The size of the buffer. @b CC_FIXED_DECIMAL_STRING_SIZE is always large enough.
+ * @return The length of the string, or 0 if the buffer is too small.
+ */
+size_t CCFixedDecimalFormat(CCFixedDecimal Value, char *Buffer, size_t Size);
+
+#pragma mark - Fixed-Point Arrays
+
+/*
+ The array functions operate on arrays of units that share a scale, so the values are packed as plain int64_t. The
+ arrays do not need to be aligned, and @b Out may be the same as one of the inputs but must not otherwise overlap them.
+ */
+
+/*!
+ * @brief Sum an array of fixed-point units.
+ * @description The sum is accumulated exactly, so only fails if the final total doesn't fit.
+ * @param In The units.
+ * @param Count The number of elements.
+ * @param Scale The scale of the units.
+ * @param Result Where to store the sum.
+ * @return Whether the sum could be represented. FALSE on overflow.
+ */
+_Bool CCFixedDecimalSumArray(const int64_t *In, size_t Count, uint8_t Scale, CCFixedDecimal *Result);
+
+/*!
+ * @brief Add the elements of two arrays of fixed-point units.
+ * @param a The first units.
+ * @param b The second units.
+ * @param Out The array to store the sums.
+ * @param Count The number of elements.
+ * @return Whether all of the sums could be represented. FALSE if any overflowed, in which case the elements that
+ *         overflowed are undefined.
+ */
+_Bool CCFixedDecimalAddArray(const int64_t *a, const int64_t *b, int64_t *Out, size_t Count);
+
+/*!
+ * @brief Multiply each element of an array of fixed-point units by a fixed-point decimal.
+ * @param In The units.
+ * @param Scale The scale of the units.
+ * @param Factor The value to multiply each element by.
+ * @param Out The array to store the products.
+ * @param OutScale The scale of the products.
+ * @param Count The number of elements.
+ * @param Rounding How to round the exact products to the scale.
+ * @return Whether all of the products could be represented. FALSE if any overflowed, in which case the elements that
+ *         overflowed are undefined.
+ */
+_Bool CCFixedDecimalMulArray(const int64_t *In, uint8_t Scale, CCFixedDecimal Factor, int64_t *Out, uint8_t OutScale, size_t Count, CCDecimalRounding Rounding);
+
 #pragma mark -
 
 static inline uint64_t CCDecimal32MultiplyU64(uint64_t Value, CCDecimal32 Decimal)
@@ -155,4 +354,239 @@ static inline uint64_t CCDecimal64MultiplyU64(uint64_t Value, CCDecimal64 Decima
     return Result;
 }
 
+#pragma mark - Fixed-Point
+
+static inline unsigned _BitInt(128) CCFixedDecimalPow10(unsigned int Exponent)
+{
+    CCAssertLog(Exponent <= 38, "Exponent must not exceed 38");
+    
+    static const uint64_t Powers[20] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+        10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+        10000000000000000000ULL
+    };
+    
+    if (Exponent < 20) return Powers[Exponent];
+    
+    return (unsigned _BitInt(128))Powers[19] * Powers[Exponent - 19];
+}
+
+static inline _Bool CCFixedDecimalStoreUnits(_BitInt(128) Value, int64_t *Result)
+{
+    if ((Value > INT64_MAX) || (Value < INT64_MIN)) return FALSE;
+    
+    *Result = (int64_t)Value;
+    
+    return TRUE;
+}
+
+static inline _Bool CCFixedDecimalScaleUnits(_BitInt(128) Value, unsigned int Exponent, _BitInt(128) *Result)
+{
+    //Values that overflow the intermediate would also overflow the units
+    const _BitInt(128) Max = (_BitInt(128))(((unsigned _BitInt(128))1 << 126) / CCFixedDecimalPow10(Exponent));
+    if ((Value > Max) || (Value < -Max)) return FALSE;
+    
+    *Result = Value * (_BitInt(128))CCFixedDecimalPow10(Exponent);
+    
+    return TRUE;
+}
+
+/*!
+ * @brief Whether a truncated quotient with a non-zero remainder should be moved away from zero.
+ * @param Negative Whether the exact quotient is negative.
+ * @param Half The remainder compared to half the divisor, -1 if less, 0 if equal, 1 if greater.
+ * @param Odd Whether the truncated quotient is odd.
+ */
+static inline _Bool CCFixedDecimalRoundAway(CCDecimalRounding Rounding, _Bool Negative, int Half, _Bool Odd)
+{
+    switch (Rounding)
+    {
+        case CCDecimalRoundingDown:
+            return FALSE;
+            
+        case CCDecimalRoundingUp:
+            return TRUE;
+            
+        case CCDecimalRoundingFloor:
+            return Negative;
+            
+        case CCDecimalRoundingCeiling:
+            return !Negative;
+            
+        case CCDecimalRoundingHalfUp:
+            return Half >= 0;
+            
+        case CCDecimalRoundingHalfDown:
+            return Half > 0;
+            
+        case CCDecimalRoundingHalfEven:
+            return (Half > 0) || ((Half == 0) && (Odd));
+    }
+    
+    return FALSE;
+}
+
+static inline _Bool CCFixedDecimalDivideUnits(_BitInt(128) Value, _BitInt(128) Divisor, CCDecimalRounding Rounding, int64_t *Result)
+{
+    CCAssertLog(Divisor > 0, "Divisor must be positive");
+    
+    _BitInt(128) Quotient = Value / Divisor;
+    const _BitInt(128) Remainder = Value % Divisor;
+    
+    if (Remainder)
+    {
+        const _BitInt(128) Magnitude = Remainder < 0 ? -Remainder : Remainder, Other = Divisor - Magnitude;
+        
+        if (CCFixedDecimalRoundAway(Rounding, Value < 0, (Magnitude > Other) - (Magnitude < Other), Quotient & 1)) Quotient += Value < 0 ? -1 : 1;
+    }
+    
+    return CCFixedDecimalStoreUnits(Quotient, Result);
+}
+
+static inline _Bool CCFixedDecimalRoundUnits(_BitInt(128) Value, unsigned int ValueScale, unsigned int Scale, CCDecimalRounding Rounding, int64_t *Result)
+{
+    if (ValueScale <= Scale)
+    {
+        _BitInt(128) Scaled;
+        
+        return CCFixedDecimalScaleUnits(Value, Scale - ValueScale, &Scaled) && CCFixedDecimalStoreUnits(Scaled, Result);
+    }
+    
+    return CCFixedDecimalDivideUnits(Value, (_BitInt(128))CCFixedDecimalPow10(ValueScale - Scale), Rounding, Result);
+}
+
+static inline CCFixedDecimal CCFixedDecimalMake(int64_t Units, uint8_t Scale)
+{
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    return (CCFixedDecimal){ .units = Units, .scale = Scale };
+}
+
+static inline _Bool CCFixedDecimalRescale(CCFixedDecimal Value, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result)
+{
+    CCAssertLog(Result, "Result must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    int64_t Units;
+    if (!CCFixedDecimalRoundUnits(Value.units, Value.scale, Scale, Rounding, &Units)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+static inline _Bool CCFixedDecimalAdd(CCFixedDecimal a, CCFixedDecimal b, CCFixedDecimal *Result)
+{
+    CCAssertLog(Result, "Result must not be null");
+    
+    const uint8_t Scale = a.scale > b.scale ? a.scale : b.scale;
+    const _BitInt(128) Sum = ((_BitInt(128))a.units * (_BitInt(128))CCFixedDecimalPow10(Scale - a.scale)) + ((_BitInt(128))b.units * (_BitInt(128))CCFixedDecimalPow10(Scale - b.scale));
+    
+    int64_t Units;
+    if (!CCFixedDecimalStoreUnits(Sum, &Units)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+static inline _Bool CCFixedDecimalSub(CCFixedDecimal a, CCFixedDecimal b, CCFixedDecimal *Result)
+{
+    CCAssertLog(Result, "Result must not be null");
+    
+    const uint8_t Scale = a.scale > b.scale ? a.scale : b.scale;
+    const _BitInt(128) Difference = ((_BitInt(128))a.units * (_BitInt(128))CCFixedDecimalPow10(Scale - a.scale)) - ((_BitInt(128))b.units * (_BitInt(128))CCFixedDecimalPow10(Scale - b.scale));
+    
+    int64_t Units;
+    if (!CCFixedDecimalStoreUnits(Difference, &Units)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+static inline _Bool CCFixedDecimalMul(CCFixedDecimal a, CCFixedDecimal b, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result)
+{
+    CCAssertLog(Result, "Result must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    int64_t Units;
+    if (!CCFixedDecimalRoundUnits((_BitInt(128))a.units * b.units, a.scale + b.scale, Scale, Rounding, &Units)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+static inline _Bool CCFixedDecimalDiv(CCFixedDecimal a, CCFixedDecimal b, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result)
+{
+    CCAssertLog(Result, "Result must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    if (!b.units) return FALSE;
+    
+    //a / b = (a.units * 10^(Scale + b.scale - a.scale)) / b.units in units of the result
+    _BitInt(128) Dividend = a.units, Divisor = b.units;
+    if (Divisor < 0)
+    {
+        Dividend = -Dividend;
+        Divisor = -Divisor;
+    }
+    
+    const int Exponent = (int)Scale + b.scale - a.scale;
+    if (Exponent >= 0)
+    {
+        if (!CCFixedDecimalScaleUnits(Dividend, Exponent, &Dividend)) return FALSE;
+    }
+    
+    else Divisor *= (_BitInt(128))CCFixedDecimalPow10(-Exponent);
+    
+    int64_t Units;
+    if (!CCFixedDecimalDivideUnits(Dividend, Divisor, Rounding, &Units)) return FALSE;
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+static inline CCComparisonResult CCFixedDecimalCompare(CCFixedDecimal a, CCFixedDecimal b)
+{
+    const uint8_t Scale = a.scale > b.scale ? a.scale : b.scale;
+    const _BitInt(128) ValueA = (_BitInt(128))a.units * (_BitInt(128))CCFixedDecimalPow10(Scale - a.scale);
+    const _BitInt(128) ValueB = (_BitInt(128))b.units * (_BitInt(128))CCFixedDecimalPow10(Scale - b.scale);
+    
+    return ValueA < ValueB ? CCComparisonResultAscending : (ValueA > ValueB ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+static inline _Bool CCFixedDecimalFromDecimal64(CCDecimal64 Decimal, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result)
+{
+    CCAssertLog(Result, "Result must not be null");
+    CCAssertLog(Scale <= CC_FIXED_DECIMAL_SCALE_MAX, "Scale must not exceed CC_FIXED_DECIMAL_SCALE_MAX");
+    
+    int64_t Units = 0;
+    if (Decimal.coef)
+    {
+        if (Decimal.exp > (38 - Scale)) return FALSE;
+        else if (Decimal.exp < -(38 + Scale)) Units = (Rounding == CCDecimalRoundingUp) || (Rounding == CCDecimalRoundingCeiling); //Less than half a unit
+        else if (!CCFixedDecimalRoundUnits(Decimal.coef, 38, (unsigned int)(Decimal.exp + Scale + 38), Rounding, &Units)) return FALSE; //coef * 10^(exp + Scale)
+    }
+    
+    *Result = (CCFixedDecimal){ .units = Units, .scale = Scale };
+    
+    return TRUE;
+}
+
+static inline _Bool CCFixedDecimalFromDecimal32(CCDecimal32 Decimal, uint8_t Scale, CCDecimalRounding Rounding, CCFixedDecimal *Result)
+{
+    return CCFixedDecimalFromDecimal64((CCDecimal64){ .coef = Decimal.coef, .exp = Decimal.exp }, Scale, Rounding, Result);
+}
+
+static inline CCDecimal64 CCFixedDecimalToDecimal64(CCFixedDecimal Value)
+{
+    CCAssertLog(Value.units >= 0, "Value must not be negative");
+    
+    return (CCDecimal64){ .coef = (uint64_t)Value.units, .exp = -(int64_t)Value.scale };
+}
+
 #endif
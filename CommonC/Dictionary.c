@@ -57,9 +57,10 @@ int CCDictionaryHintWeightCreate(CCDictionaryHint Hint, CCDictionaryHint FastHin
     return ((int)CCBitCountSet(FastHints) * 10 * Size) + ((int)CCBitCountSet(ModerateHints) * -1 * Size) + ((int)CCBitCountSet(SlowHints) * -100 * Size);
 }
 
-extern const CCDictionaryInterface CCDictionaryHashMapInterface;
+extern const CCDictionaryInterface CCDictionaryHashMapInterface, CCDictionaryBPlusTreeInterface;
 static CCDictionaryInternalInterfaceNode InternalInterfaces[] = {
-    { .header = { .allocator = -1 }, .data = { .node = { .prev = NULL, .next = NULL }, .interface = &CCDictionaryHashMapInterface } }
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = NULL, .next = (void*)(InternalInterfaces + 1) + offsetof(CCDictionaryInternalInterfaceNode, data) }, .interface = &CCDictionaryHashMapInterface } },
+    { .header = { .allocator = -1 }, .data = { .node = { .prev = (void*)InternalInterfaces + offsetof(CCDictionaryInternalInterfaceNode, data), .next = NULL }, .interface = &CCDictionaryBPlusTreeInterface } }
 };
 static CCDictionaryInterfaceNode *Interfaces = (void*)InternalInterfaces + offsetof(CCDictionaryInternalInterfaceNode, data);
 void CCDictionaryRegisterInterface(const CCDictionaryInterface *Interface)
@@ -223,6 +224,20 @@ void CCDictionarySetValue(CCDictionary Dictionary, const void *Key, const void *
     }
 }
 
+void CCDictionarySetSortedValues(CCDictionary Dictionary, const void *Keys, const void *Values, size_t Count)
+{
+    CCAssertLog(Dictionary, "Dictionary must not be null");
+    
+    if ((Dictionary->interface->optional.setSortedValues) && ((!Dictionary->callbacks.valueDestructor) || (!CCDictionaryGetCount(Dictionary)))) Dictionary->interface->optional.setSortedValues(Dictionary->internal, Keys, Values, Count, Dictionary->keySize, Dictionary->valueSize, Dictionary->callbacks.getHash, Dictionary->callbacks.compareKeys, Dictionary->allocator);
+    else
+    {
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            CCDictionarySetValue(Dictionary, Keys + (Loop * Dictionary->keySize), Values + (Loop * Dictionary->valueSize));
+        }
+    }
+}
+
 void CCDictionaryRemoveValue(CCDictionary Dictionary, const void *Key)
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
@@ -332,6 +347,7 @@ void CCDictionaryGetKeyEnumerator(CCDictionary Dictionary, CCEnumerator *Enumera
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
     
+    Enumerator->state.type = CCEnumeratorFormatInternal;
     Dictionary->interface->enumerator(Dictionary->internal, &Enumerator->state, CCDictionaryEnumeratorActionHead, CCDictionaryEnumeratorTypeKey);
     Enumerator->ref = Dictionary;
     Enumerator->option = CCDictionaryEnumeratorTypeKey;
@@ -341,6 +357,7 @@ void CCDictionaryGetValueEnumerator(CCDictionary Dictionary, CCEnumerator *Enume
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
     
+    Enumerator->state.type = CCEnumeratorFormatInternal;
     Dictionary->interface->enumerator(Dictionary->internal, &Enumerator->state, CCDictionaryEnumeratorActionHead, CCDictionaryEnumeratorTypeValue);
     Enumerator->ref = Dictionary;
     Enumerator->option = CCDictionaryEnumeratorTypeValue;
@@ -367,6 +384,28 @@ void CCDictionaryGetValueEnumerable(CCDictionary Dictionary, CCEnumerable *Enume
     Enumerable->handler = CCDictionaryEnumerableHandler;
 }
 
+void CCDictionaryGetKeyEnumerableInRange(CCDictionary Dictionary, const void *Min, const void *Max, CCEnumerable *Enumerable)
+{
+    CCAssertLog(Dictionary, "Dictionary must not be null");
+    CCAssertLog(Dictionary->interface->optional.rangeEnumerator, "Dictionary implementation must maintain key order");
+    
+    Dictionary->interface->optional.rangeEnumerator(Dictionary->internal, &Enumerable->enumerator.state, Min, Max, CCDictionaryEnumeratorTypeKey, Dictionary->callbacks.compareKeys);
+    Enumerable->enumerator.ref = Dictionary;
+    Enumerable->enumerator.option = CCDictionaryEnumeratorTypeKey;
+    Enumerable->handler = CCDictionaryEnumerableHandler;
+}
+
+void CCDictionaryGetValueEnumerableInRange(CCDictionary Dictionary, const void *Min, const void *Max, CCEnumerable *Enumerable)
+{
+    CCAssertLog(Dictionary, "Dictionary must not be null");
+    CCAssertLog(Dictionary->interface->optional.rangeEnumerator, "Dictionary implementation must maintain key order");
+    
+    Dictionary->interface->optional.rangeEnumerator(Dictionary->internal, &Enumerable->enumerator.state, Min, Max, CCDictionaryEnumeratorTypeValue, Dictionary->callbacks.compareKeys);
+    Enumerable->enumerator.ref = Dictionary;
+    Enumerable->enumerator.option = CCDictionaryEnumeratorTypeValue;
+    Enumerable->handler = CCDictionaryEnumerableHandler;
+}
+
 size_t CCDictionaryGetCount(CCDictionary Dictionary)
 {
     CCAssertLog(Dictionary, "Dictionary must not be null");
@@ -208,6 +208,20 @@ void CCDictionaryRemoveEntry(CCDictionary Dictionary, CCDictionaryEntry Entry);
  */
 void CCDictionarySetValue(CCDictionary Dictionary, const void *Key, const void *Value);
 
+/*!
+ * @brief Sets the values for a sequence of keys that are in ascending order.
+ * @description Implementations that maintain key order (@b CCDictionaryHintOrdered) may bulk-load
+ *              these entries when the dictionary is empty, otherwise it's equivalent to setting each
+ *              value individually.
+ *
+ * @warning The size of keys/values must be the same size as specified in the dictionary creation.
+ * @param Dictionary The dictionary to set the values of.
+ * @param Keys The pointer to the keys, these must be unique and in ascending order.
+ * @param Values The pointer to the values to be copied to the map, corresponding to each key.
+ * @param Count The number of keys/values.
+ */
+void CCDictionarySetSortedValues(CCDictionary Dictionary, const void *Keys, const void *Values, size_t Count);
+
 /*!
  * @brief Remove the value at a given key.
  * @warning The size of key must be the same size as specified in the dictionary creation.
@@ -276,7 +290,8 @@ void *CCDictionaryGetKey(CCDictionary Dictionary, CCDictionaryEntry Entry);
  * @brief Get the keys in a dictionary.
  * @description Will produce the same order (corresponding pairs) when calling @b CCDictionaryGetValues
  *              if no mutation occurs in-between the two calls. After mutation occurs there is no
- *              guarantee that the order will stay the same.
+ *              guarantee that the order will stay the same. Implementations that maintain key order
+ *              will produce them in ascending key order.
  *
  * @param Dictionary The dictionary to get the keys of.
  * @return The ordered collection of keys. The collection must be destroyed.
@@ -287,7 +302,8 @@ CC_NEW CCOrderedCollection CCDictionaryGetKeys(CCDictionary Dictionary);
  * @brief Get the values in a dictionary.
  * @description Will produce the same order (corresponding pairs) when calling @b CCDictionaryGetKeys
  *              if no mutation occurs in-between the two calls. After mutation occurs there is no
- *              guarantee that the order will stay the same.
+ *              guarantee that the order will stay the same. Implementations that maintain key order
+ *              will produce them in ascending key order.
  *
  * @param Dictionary The dictionary to get the values of.
  * @return The ordered collection of values. The collection must be destroyed.
@@ -322,6 +338,36 @@ void CCDictionaryGetKeyEnumerable(CCDictionary Dictionary, CCEnumerable *Enumera
  */
 void CCDictionaryGetValueEnumerable(CCDictionary Dictionary, CCEnumerable *Enumerable);
 
+/*!
+ * @brief Get a key enumerable for a range of keys in the dictionary.
+ * @description Only supported by implementations that maintain key order (@b CCDictionaryHintOrdered).
+ * @warning The size of the keys must be the same size as specified in the dictionary creation.
+ * @param Dictionary The dictionary to obtain a key enumerable for.
+ * @param Min The pointer to the lowest key (inclusive) of the range. If NULL the range starts from
+ *        the first key.
+ *
+ * @param Max The pointer to the highest key (exclusive) of the range. If NULL the range ends at the
+ *        last key.
+ *
+ * @param Enumerable A pointer to the enumerable to use.
+ */
+void CCDictionaryGetKeyEnumerableInRange(CCDictionary Dictionary, const void *Min, const void *Max, CCEnumerable *Enumerable);
+
+/*!
+ * @brief Get a value enumerable for a range of keys in the dictionary.
+ * @description Only supported by implementations that maintain key order (@b CCDictionaryHintOrdered).
+ * @warning The size of the keys must be the same size as specified in the dictionary creation.
+ * @param Dictionary The dictionary to obtain a value enumerable for.
+ * @param Min The pointer to the lowest key (inclusive) of the range. If NULL the range starts from
+ *        the first key.
+ *
+ * @param Max The pointer to the highest key (exclusive) of the range. If NULL the range ends at the
+ *        last key.
+ *
+ * @param Enumerable A pointer to the enumerable to use.
+ */
+void CCDictionaryGetValueEnumerableInRange(CCDictionary Dictionary, const void *Min, const void *Max, CCEnumerable *Enumerable);
+
 /*!
  * @brief Get the current number of key/values in the dictionary.
  * @param Dictionary The dictionary to get the count of.
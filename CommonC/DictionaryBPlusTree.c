@@ -0,0 +1,1121 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define CC_QUICK_COMPILE
+#include "DictionaryBPlusTree.h"
+#include "MemoryAllocation.h"
+#include "Assertion.h"
+#include "Array.h"
+#include "Alignment.h"
+#include <string.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON || CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include "Simd.h"
+#define CC_DICTIONARY_BPLUS_TREE_SIMD_128 1
+#endif
+
+#define CC_DICTIONARY_BPLUS_TREE_NODE_SIZE (CC_HARDWARE_CACHE_LINE * 4)
+#define CC_DICTIONARY_BPLUS_TREE_MIN_CAPACITY 4
+#define CC_DICTIONARY_BPLUS_TREE_MAX_CAPACITY 255
+#define CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH 64
+#define CC_DICTIONARY_BPLUS_TREE_ENUMERATOR_RANGE (1 << 2)
+
+typedef CC_ENUM(CCDictionaryBPlusTreeRecordState, uint8_t) {
+    CCDictionaryBPlusTreeRecordStateAvailable,
+    CCDictionaryBPlusTreeRecordStateUninitialized,
+    CCDictionaryBPlusTreeRecordStateInitialized
+};
+
+/*
+ Nodes hold their keys contiguously (followed by their record indexes when a leaf, or their children
+ when a branch), and have room for one more key than their capacity so an insertion can be made
+ before the node is split.
+ */
+typedef struct CCDictionaryBPlusTreeNode {
+    struct CCDictionaryBPlusTreeNode *prev, *next;
+    uint16_t count;
+    _Bool leaf;
+    _Alignas(uintmax_t) uint8_t data[];
+} CCDictionaryBPlusTreeNode;
+
+/*
+ Entries reference records (key, value, state) which don't move when the tree is restructured, the
+ key is duplicated in the leaves so searches don't leave the node.
+ */
+typedef struct {
+    CCAllocatorType allocator;
+    CCDictionaryBPlusTreeNode *root, *head, *tail;
+    CCArray records;
+    CCArray available;
+    CCComparator comparator;
+    size_t count;
+    size_t keySize, valueOffset, stateOffset;
+    size_t integer;
+    size_t capacity, minimum, keysSize;
+} CCDictionaryBPlusTreeInternal;
+
+static int CCDictionaryBPlusTreeHintWeight(CCDictionaryHint Hint);
+static void *CCDictionaryBPlusTreeConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static size_t CCDictionaryBPlusTreeGetCount(CCDictionaryBPlusTreeInternal *Internal);
+static _Bool CCDictionaryBPlusTreeEntryIsInitialized(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry);
+static CCDictionaryEntry CCDictionaryBPlusTreeFindKey(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static CCDictionaryEntry CCDictionaryBPlusTreeEntryForKey(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void *CCDictionaryBPlusTreeGetKey(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry);
+static void *CCDictionaryBPlusTreeGetEntry(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry);
+static void CCDictionaryBPlusTreeSetEntry(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator);
+static void CCDictionaryBPlusTreeRemoveEntry(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry, CCAllocatorType Allocator);
+static void *CCDictionaryBPlusTreeEnumerator(CCDictionaryBPlusTreeInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type);
+static CCDictionaryEntry CCDictionaryBPlusTreeEnumeratorEntry(CCDictionaryBPlusTreeInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type);
+static void *CCDictionaryBPlusTreeGetValue(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator);
+static void CCDictionaryBPlusTreeSetValue(CCDictionaryBPlusTreeInternal *Internal, const void *Key, const void *Value, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void CCDictionaryBPlusTreeRemoveValue(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void CCDictionaryBPlusTreeSetSortedValues(CCDictionaryBPlusTreeInternal *Internal, const void *Keys, const void *Values, size_t Count, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+static void *CCDictionaryBPlusTreeRangeEnumerator(CCDictionaryBPlusTreeInternal *Internal, CCEnumeratorState *Enumerator, const void *Min, const void *Max, CCDictionaryEnumeratorType Type, CCComparator KeyComparator);
+
+const CCDictionaryInterface CCDictionaryBPlusTreeInterface = {
+    .hintWeight = CCDictionaryBPlusTreeHintWeight,
+    .create = CCDictionaryBPlusTreeConstructor,
+    .destroy = (CCDictionaryDestructorCallback)CCFree,
+    .count = (CCDictionaryGetCountCallback)CCDictionaryBPlusTreeGetCount,
+    .initialized = (CCDictionaryEntryIsInitializedCallback)CCDictionaryBPlusTreeEntryIsInitialized,
+    .findKey = (CCDictionaryFindKeyCallback)CCDictionaryBPlusTreeFindKey,
+    .entryForKey = (CCDictionaryEntryForKeyCallback)CCDictionaryBPlusTreeEntryForKey,
+    .getKey = (CCDictionaryGetKeyCallback)CCDictionaryBPlusTreeGetKey,
+    .getEntry = (CCDictionaryGetEntryCallback)CCDictionaryBPlusTreeGetEntry,
+    .setEntry = (CCDictionarySetEntryCallback)CCDictionaryBPlusTreeSetEntry,
+    .removeEntry = (CCDictionaryRemoveEntryCallback)CCDictionaryBPlusTreeRemoveEntry,
+    .enumerator = (CCDictionaryEnumeratorCallback)CCDictionaryBPlusTreeEnumerator,
+    .enumeratorReference = (CCDictionaryEnumeratorEntryCallback)CCDictionaryBPlusTreeEnumeratorEntry,
+    .optional = {
+        .getValue = (CCDictionaryGetValueCallback)CCDictionaryBPlusTreeGetValue,
+        .setValue = (CCDictionarySetValueCallback)CCDictionaryBPlusTreeSetValue,
+        .removeValue = (CCDictionaryRemoveValueCallback)CCDictionaryBPlusTreeRemoveValue,
+        .keys = NULL,
+        .values = NULL,
+        .setSortedValues = (CCDictionarySetSortedValuesCallback)CCDictionaryBPlusTreeSetSortedValues,
+        .rangeEnumerator = (CCDictionaryRangeEnumeratorCallback)CCDictionaryBPlusTreeRangeEnumerator
+    }
+};
+
+
+#pragma mark - Nodes
+
+static CC_FORCE_INLINE void *CCDictionaryBPlusTreeNodeKey(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Node, size_t Index)
+{
+    return (void*)Node->data + (Index * Tree->keySize);
+}
+
+static CC_FORCE_INLINE size_t *CCDictionaryBPlusTreeNodeRecords(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Node)
+{
+    return (size_t*)((void*)Node->data + Tree->keysSize);
+}
+
+static CC_FORCE_INLINE CCDictionaryBPlusTreeNode **CCDictionaryBPlusTreeNodeChildren(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Node)
+{
+    return (CCDictionaryBPlusTreeNode**)((void*)Node->data + Tree->keysSize);
+}
+
+static CCDictionaryBPlusTreeNode *CCDictionaryBPlusTreeNodeCreate(CCDictionaryBPlusTreeInternal *Tree, _Bool Leaf)
+{
+    const size_t Size = sizeof(CCDictionaryBPlusTreeNode) + Tree->keysSize + (sizeof(CCDictionaryBPlusTreeNode*) * (Tree->capacity + 2));
+    CCDictionaryBPlusTreeNode *Node = CCMalloc(Tree->allocator, Size, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Node) *Node = (CCDictionaryBPlusTreeNode){ .prev = NULL, .next = NULL, .count = 0, .leaf = Leaf };
+    else CC_LOG_ERROR("Failed to create B+ tree node: Failed to allocate memory of size (%zu)", Size);
+    
+    return Node;
+}
+
+static void CCDictionaryBPlusTreeNodeDestroy(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Node)
+{
+    if (!Node->leaf)
+    {
+        CCDictionaryBPlusTreeNode **Children = CCDictionaryBPlusTreeNodeChildren(Tree, Node);
+        for (size_t Loop = 0; Loop <= Node->count; Loop++) CCDictionaryBPlusTreeNodeDestroy(Tree, Children[Loop]);
+    }
+    
+    CCFree(Node);
+}
+
+static void *CCDictionaryBPlusTreeFirstKey(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Node)
+{
+    while (!Node->leaf) Node = CCDictionaryBPlusTreeNodeChildren(Tree, Node)[0];
+    
+    return CCDictionaryBPlusTreeNodeKey(Tree, Node, 0);
+}
+
+
+#pragma mark - Records
+
+static CC_FORCE_INLINE uint8_t *CCDictionaryBPlusTreeRecord(const CCDictionaryBPlusTreeInternal *Tree, size_t Index)
+{
+    return CCArrayGetElementAtIndex(Tree->records, Index);
+}
+
+static size_t CCDictionaryBPlusTreeRecordCreate(CCDictionaryBPlusTreeInternal *Tree, const void *Key)
+{
+    size_t Index;
+    const size_t Available = CCArrayGetCount(Tree->available);
+    if (Available)
+    {
+        Index = *(size_t*)CCArrayGetElementAtIndex(Tree->available, Available - 1);
+        CCArrayRemoveElementAtIndex(Tree->available, Available - 1);
+    }
+    
+    else if ((Index = CCArrayAppendElement(Tree->records, NULL)) == SIZE_MAX) return SIZE_MAX;
+    
+    uint8_t *Record = CCDictionaryBPlusTreeRecord(Tree, Index);
+    memcpy(Record, Key, Tree->keySize);
+    Record[Tree->stateOffset] = CCDictionaryBPlusTreeRecordStateUninitialized;
+    
+    return Index;
+}
+
+static void CCDictionaryBPlusTreeRecordDestroy(CCDictionaryBPlusTreeInternal *Tree, size_t Index)
+{
+    CCDictionaryBPlusTreeRecord(Tree, Index)[Tree->stateOffset] = CCDictionaryBPlusTreeRecordStateAvailable;
+    CCArrayAppendElement(Tree->available, &Index);
+}
+
+
+#pragma mark - Key Ordering
+
+static CCComparisonResult CCDictionaryBPlusTreeCompare(const CCDictionaryBPlusTreeInternal *Tree, const void *Left, const void *Right)
+{
+    if (Tree->comparator) return Tree->comparator(Left, Right);
+    
+    switch (Tree->integer)
+    {
+#define CC_DICTIONARY_BPLUS_TREE_COMPARE(type) \
+{ \
+    type A, B; \
+    memcpy(&A, Left, sizeof(type)); \
+    memcpy(&B, Right, sizeof(type)); \
+    return A < B ? CCComparisonResultAscending : (A > B ? CCComparisonResultDescending : CCComparisonResultEqual); \
+}
+            
+        case sizeof(uint8_t):
+            CC_DICTIONARY_BPLUS_TREE_COMPARE(uint8_t);
+            
+        case sizeof(uint16_t):
+            CC_DICTIONARY_BPLUS_TREE_COMPARE(uint16_t);
+            
+        case sizeof(uint32_t):
+            CC_DICTIONARY_BPLUS_TREE_COMPARE(uint32_t);
+            
+        case sizeof(uint64_t):
+            CC_DICTIONARY_BPLUS_TREE_COMPARE(uint64_t);
+            
+#undef CC_DICTIONARY_BPLUS_TREE_COMPARE
+    }
+    
+    const int Result = memcmp(Left, Right, Tree->keySize);
+    
+    return Result < 0 ? CCComparisonResultAscending : (Result > 0 ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+#define CC_DICTIONARY_BPLUS_TREE_LINEAR_RANK(type) \
+{ \
+    type Target; \
+    memcpy(&Target, Key, sizeof(type)); \
+    \
+    const type *Keys = (const type*)Node->data; \
+    for ( ; Loop < Count; Loop++) Rank += Keys[Loop] < Target; \
+    \
+    return Rank; \
+}
+
+/*
+ Returns the number of keys in the node that are less than the key. Integer keys use a branchless
+ linear scan (as a node spans only a few cache lines), otherwise a binary search is used.
+ */
+static size_t CCDictionaryBPlusTreeRank(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Node, const void *Key)
+{
+    const size_t Count = Node->count;
+    size_t Loop = 0, Rank = 0;
+    
+    switch (Tree->comparator ? 0 : Tree->integer)
+    {
+        case sizeof(uint8_t):
+            CC_DICTIONARY_BPLUS_TREE_LINEAR_RANK(uint8_t);
+            
+        case sizeof(uint16_t):
+            CC_DICTIONARY_BPLUS_TREE_LINEAR_RANK(uint16_t);
+            
+        case sizeof(uint32_t):
+        {
+#if CC_DICTIONARY_BPLUS_TREE_SIMD_128
+            uint32_t Target;
+            memcpy(&Target, Key, sizeof(uint32_t));
+            
+            const CCSimd_u32x4 Targets = CCSimdFill_u32x4(Target);
+            CCSimd_u32x4 Ranks = CCSimdZero_u32x4();
+            for ( ; (Loop + 4) <= Count; Loop += 4)
+            {
+                Ranks = CCSimdAdd_u32x4(Ranks, CCSimdCompareLessThan_u32x4(CCSimdLoad_u32x4((const uint32_t*)Node->data + Loop), Targets));
+            }
+            
+            Rank = CCSimdSum_u32x4(Ranks);
+#endif
+            CC_DICTIONARY_BPLUS_TREE_LINEAR_RANK(uint32_t);
+        }
+            
+        case sizeof(uint64_t):
+        {
+#if CC_DICTIONARY_BPLUS_TREE_SIMD_128
+            uint64_t Target;
+            memcpy(&Target, Key, sizeof(uint64_t));
+            
+            const CCSimd_u64x2 Targets = CCSimdFill_u64x2(Target);
+            CCSimd_u64x2 Ranks = CCSimdZero_u64x2();
+            for ( ; (Loop + 2) <= Count; Loop += 2)
+            {
+                Ranks = CCSimdAdd_u64x2(Ranks, CCSimdCompareLessThan_u64x2(CCSimdLoad_u64x2((const uint64_t*)Node->data + Loop), Targets));
+            }
+            
+            Rank = (size_t)CCSimdSum_u64x2(Ranks);
+#endif
+            CC_DICTIONARY_BPLUS_TREE_LINEAR_RANK(uint64_t);
+        }
+    }
+    
+    size_t High = Count;
+    while (Loop < High)
+    {
+        const size_t Mid = (Loop + High) / 2;
+        
+        if (CCDictionaryBPlusTreeCompare(Tree, CCDictionaryBPlusTreeNodeKey(Tree, Node, Mid), Key) == CCComparisonResultAscending) Loop = Mid + 1;
+        else High = Mid;
+    }
+    
+    return Loop;
+}
+
+#undef CC_DICTIONARY_BPLUS_TREE_LINEAR_RANK
+
+static CC_FORCE_INLINE _Bool CCDictionaryBPlusTreeNodeKeyEqual(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Node, size_t Index, const void *Key)
+{
+    return (Index < Node->count) && (CCDictionaryBPlusTreeCompare(Tree, CCDictionaryBPlusTreeNodeKey(Tree, Node, Index), Key) == CCComparisonResultEqual);
+}
+
+static CC_FORCE_INLINE size_t CCDictionaryBPlusTreeChildIndex(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Node, const void *Key)
+{
+    const size_t Rank = CCDictionaryBPlusTreeRank(Tree, Node, Key);
+    
+    return Rank + CCDictionaryBPlusTreeNodeKeyEqual(Tree, Node, Rank, Key);
+}
+
+/*
+ Descends to the leaf the key belongs in, recording the path (if Path is not NULL). Returns the index
+ of the first key in the leaf that is not less than the key.
+ */
+static CCDictionaryBPlusTreeNode *CCDictionaryBPlusTreeSearch(const CCDictionaryBPlusTreeInternal *Tree, const void *Key, CCDictionaryBPlusTreeNode **Path, size_t *Slots, size_t *Depth, size_t *Index)
+{
+    CCDictionaryBPlusTreeNode *Node = Tree->root;
+    size_t Level = 0;
+    
+    while (!Node->leaf)
+    {
+        const size_t Slot = CCDictionaryBPlusTreeChildIndex(Tree, Node, Key);
+        
+        if (Path)
+        {
+            Path[Level] = Node;
+            Slots[Level] = Slot;
+        }
+        
+        Level++;
+        Node = CCDictionaryBPlusTreeNodeChildren(Tree, Node)[Slot];
+    }
+    
+    if (Depth) *Depth = Level;
+    *Index = CCDictionaryBPlusTreeRank(Tree, Node, Key);
+    
+    return Node;
+}
+
+static size_t CCDictionaryBPlusTreeFind(const CCDictionaryBPlusTreeInternal *Tree, const void *Key)
+{
+    if (!Tree->root) return SIZE_MAX;
+    
+    size_t Index;
+    CCDictionaryBPlusTreeNode *Leaf = CCDictionaryBPlusTreeSearch(Tree, Key, NULL, NULL, NULL, &Index);
+    
+    return CCDictionaryBPlusTreeNodeKeyEqual(Tree, Leaf, Index, Key) ? CCDictionaryBPlusTreeNodeRecords(Tree, Leaf)[Index] : SIZE_MAX;
+}
+
+
+#pragma mark - Insertion
+
+static void CCDictionaryBPlusTreeBranchInsert(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Node, size_t Slot, const void *Key, CCDictionaryBPlusTreeNode *Child)
+{
+    CCDictionaryBPlusTreeNode **Children = CCDictionaryBPlusTreeNodeChildren(Tree, Node);
+    
+    memmove(CCDictionaryBPlusTreeNodeKey(Tree, Node, Slot + 1), CCDictionaryBPlusTreeNodeKey(Tree, Node, Slot), (Node->count - Slot) * Tree->keySize);
+    memmove(Children + Slot + 2, Children + Slot + 1, (Node->count - Slot) * sizeof(CCDictionaryBPlusTreeNode*));
+    
+    memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Node, Slot), Key, Tree->keySize);
+    Children[Slot + 1] = Child;
+    Node->count++;
+}
+
+/*
+ Splits the overflowing leaf, and any ancestors that overflow as a result. The nodes needed for the
+ split are allocated beforehand so the tree is never left in a partially split state.
+ */
+static void CCDictionaryBPlusTreeSplit(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Leaf, CCDictionaryBPlusTreeNode **Path, size_t *Slots, size_t Depth, CCDictionaryBPlusTreeNode **Nodes)
+{
+    CCDictionaryBPlusTreeNode *Left = Leaf, *Right = *Nodes++;
+    
+    const size_t Count = Left->count / 2;
+    Right->leaf = TRUE;
+    Right->count = Left->count - Count;
+    memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), CCDictionaryBPlusTreeNodeKey(Tree, Left, Count), Right->count * Tree->keySize);
+    memcpy(CCDictionaryBPlusTreeNodeRecords(Tree, Right), CCDictionaryBPlusTreeNodeRecords(Tree, Left) + Count, Right->count * sizeof(size_t));
+    Left->count = Count;
+    
+    Right->prev = Left;
+    Right->next = Left->next;
+    if (Left->next) Left->next->prev = Right;
+    else Tree->tail = Right;
+    Left->next = Right;
+    
+    const void *Separator = CCDictionaryBPlusTreeNodeKey(Tree, Right, 0);
+    
+    for (size_t Level = Depth; ; )
+    {
+        if (!Level)
+        {
+            CCDictionaryBPlusTreeNode *Root = *Nodes;
+            Root->leaf = FALSE;
+            Root->count = 1;
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Root, 0), Separator, Tree->keySize);
+            CCDictionaryBPlusTreeNodeChildren(Tree, Root)[0] = Left;
+            CCDictionaryBPlusTreeNodeChildren(Tree, Root)[1] = Right;
+            Tree->root = Root;
+            break;
+        }
+        
+        CCDictionaryBPlusTreeNode *Parent = Path[--Level];
+        CCDictionaryBPlusTreeBranchInsert(Tree, Parent, Slots[Level], Separator, Right);
+        
+        if (Parent->count <= Tree->capacity) break;
+        
+        Left = Parent;
+        Right = *Nodes++;
+        
+        const size_t Keys = Left->count / 2;
+        Right->leaf = FALSE;
+        Right->count = Left->count - Keys - 1;
+        memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), CCDictionaryBPlusTreeNodeKey(Tree, Left, Keys + 1), Right->count * Tree->keySize);
+        memcpy(CCDictionaryBPlusTreeNodeChildren(Tree, Right), CCDictionaryBPlusTreeNodeChildren(Tree, Left) + Keys + 1, (Right->count + 1) * sizeof(CCDictionaryBPlusTreeNode*));
+        Left->count = Keys;
+        
+        //The separator is left in the upper (now unused) part of the left node until it's copied into the parent
+        Separator = CCDictionaryBPlusTreeNodeKey(Tree, Left, Keys);
+    }
+}
+
+static size_t CCDictionaryBPlusTreeInsert(CCDictionaryBPlusTreeInternal *Tree, const void *Key)
+{
+    if (!Tree->root)
+    {
+        if (!(Tree->root = CCDictionaryBPlusTreeNodeCreate(Tree, TRUE))) return SIZE_MAX;
+        
+        Tree->head = Tree->tail = Tree->root;
+    }
+    
+    CCDictionaryBPlusTreeNode *Path[CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH];
+    size_t Slots[CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH], Depth, Index;
+    CCDictionaryBPlusTreeNode *Leaf = CCDictionaryBPlusTreeSearch(Tree, Key, Path, Slots, &Depth, &Index);
+    
+    if (CCDictionaryBPlusTreeNodeKeyEqual(Tree, Leaf, Index, Key)) return CCDictionaryBPlusTreeNodeRecords(Tree, Leaf)[Index];
+    
+    CCDictionaryBPlusTreeNode *Nodes[CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH + 1];
+    size_t Needed = 0;
+    if (Leaf->count == Tree->capacity)
+    {
+        Needed = 1;
+        
+        size_t Level = Depth;
+        while ((Level) && (Path[Level - 1]->count == Tree->capacity)) Level--, Needed++;
+        
+        if (!Level) Needed++;
+        
+        CCAssertLog(Needed <= (CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH + 1), "Tree must not exceed the maximum depth");
+    }
+    
+    for (size_t Loop = 0; Loop < Needed; Loop++)
+    {
+        if (!(Nodes[Loop] = CCDictionaryBPlusTreeNodeCreate(Tree, FALSE)))
+        {
+            while (Loop--) CCFree(Nodes[Loop]);
+            
+            return SIZE_MAX;
+        }
+    }
+    
+    const size_t Record = CCDictionaryBPlusTreeRecordCreate(Tree, Key);
+    if (Record == SIZE_MAX)
+    {
+        for (size_t Loop = 0; Loop < Needed; Loop++) CCFree(Nodes[Loop]);
+        
+        return SIZE_MAX;
+    }
+    
+    size_t *Records = CCDictionaryBPlusTreeNodeRecords(Tree, Leaf);
+    memmove(CCDictionaryBPlusTreeNodeKey(Tree, Leaf, Index + 1), CCDictionaryBPlusTreeNodeKey(Tree, Leaf, Index), (Leaf->count - Index) * Tree->keySize);
+    memmove(Records + Index + 1, Records + Index, (Leaf->count - Index) * sizeof(size_t));
+    memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Leaf, Index), Key, Tree->keySize);
+    Records[Index] = Record;
+    Leaf->count++;
+    Tree->count++;
+    
+    if (Needed) CCDictionaryBPlusTreeSplit(Tree, Leaf, Path, Slots, Depth, Nodes);
+    
+    return Record;
+}
+
+
+#pragma mark - Deletion
+
+static void CCDictionaryBPlusTreeBranchRemove(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Node, size_t Index)
+{
+    CCDictionaryBPlusTreeNode **Children = CCDictionaryBPlusTreeNodeChildren(Tree, Node);
+    
+    memmove(CCDictionaryBPlusTreeNodeKey(Tree, Node, Index), CCDictionaryBPlusTreeNodeKey(Tree, Node, Index + 1), (Node->count - Index - 1) * Tree->keySize);
+    memmove(Children + Index + 1, Children + Index + 2, (Node->count - Index - 1) * sizeof(CCDictionaryBPlusTreeNode*));
+    Node->count--;
+}
+
+static void CCDictionaryBPlusTreeLeafMerge(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Left, CCDictionaryBPlusTreeNode *Right)
+{
+    memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Left, Left->count), CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), Right->count * Tree->keySize);
+    memcpy(CCDictionaryBPlusTreeNodeRecords(Tree, Left) + Left->count, CCDictionaryBPlusTreeNodeRecords(Tree, Right), Right->count * sizeof(size_t));
+    Left->count += Right->count;
+    
+    Left->next = Right->next;
+    if (Right->next) Right->next->prev = Left;
+    else Tree->tail = Left;
+    
+    CCFree(Right);
+}
+
+static void CCDictionaryBPlusTreeBranchMerge(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Left, const void *Separator, CCDictionaryBPlusTreeNode *Right)
+{
+    memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Left, Left->count), Separator, Tree->keySize);
+    memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Left, Left->count + 1), CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), Right->count * Tree->keySize);
+    memcpy(CCDictionaryBPlusTreeNodeChildren(Tree, Left) + Left->count + 1, CCDictionaryBPlusTreeNodeChildren(Tree, Right), (Right->count + 1) * sizeof(CCDictionaryBPlusTreeNode*));
+    Left->count += Right->count + 1;
+    
+    CCFree(Right);
+}
+
+/*
+ Restores the minimum occupancy of the node by borrowing from a sibling, otherwise merges it with a
+ sibling. Returns TRUE if a merge occurred (the parent has lost a key).
+ */
+static _Bool CCDictionaryBPlusTreeRebalance(CCDictionaryBPlusTreeInternal *Tree, CCDictionaryBPlusTreeNode *Node, CCDictionaryBPlusTreeNode *Parent, size_t Slot)
+{
+    CCDictionaryBPlusTreeNode **Siblings = CCDictionaryBPlusTreeNodeChildren(Tree, Parent);
+    CCDictionaryBPlusTreeNode *Left = Slot ? Siblings[Slot - 1] : NULL, *Right = Slot < Parent->count ? Siblings[Slot + 1] : NULL;
+    
+    if (Node->leaf)
+    {
+        size_t *Records = CCDictionaryBPlusTreeNodeRecords(Tree, Node);
+        
+        if ((Left) && (Left->count > Tree->minimum))
+        {
+            memmove(CCDictionaryBPlusTreeNodeKey(Tree, Node, 1), CCDictionaryBPlusTreeNodeKey(Tree, Node, 0), Node->count * Tree->keySize);
+            memmove(Records + 1, Records, Node->count * sizeof(size_t));
+            
+            Left->count--;
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Node, 0), CCDictionaryBPlusTreeNodeKey(Tree, Left, Left->count), Tree->keySize);
+            Records[0] = CCDictionaryBPlusTreeNodeRecords(Tree, Left)[Left->count];
+            Node->count++;
+            
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot - 1), CCDictionaryBPlusTreeNodeKey(Tree, Node, 0), Tree->keySize);
+            
+            return FALSE;
+        }
+        
+        else if ((Right) && (Right->count > Tree->minimum))
+        {
+            size_t *RightRecords = CCDictionaryBPlusTreeNodeRecords(Tree, Right);
+            
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Node, Node->count), CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), Tree->keySize);
+            Records[Node->count] = RightRecords[0];
+            Node->count++;
+            
+            Right->count--;
+            memmove(CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), CCDictionaryBPlusTreeNodeKey(Tree, Right, 1), Right->count * Tree->keySize);
+            memmove(RightRecords, RightRecords + 1, Right->count * sizeof(size_t));
+            
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot), CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), Tree->keySize);
+            
+            return FALSE;
+        }
+        
+        else if (Left)
+        {
+            CCDictionaryBPlusTreeLeafMerge(Tree, Left, Node);
+            CCDictionaryBPlusTreeBranchRemove(Tree, Parent, Slot - 1);
+        }
+        
+        else
+        {
+            CCDictionaryBPlusTreeLeafMerge(Tree, Node, Right);
+            CCDictionaryBPlusTreeBranchRemove(Tree, Parent, Slot);
+        }
+    }
+    
+    else
+    {
+        CCDictionaryBPlusTreeNode **Children = CCDictionaryBPlusTreeNodeChildren(Tree, Node);
+        
+        if ((Left) && (Left->count > Tree->minimum))
+        {
+            memmove(CCDictionaryBPlusTreeNodeKey(Tree, Node, 1), CCDictionaryBPlusTreeNodeKey(Tree, Node, 0), Node->count * Tree->keySize);
+            memmove(Children + 1, Children, (Node->count + 1) * sizeof(CCDictionaryBPlusTreeNode*));
+            
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Node, 0), CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot - 1), Tree->keySize);
+            Children[0] = CCDictionaryBPlusTreeNodeChildren(Tree, Left)[Left->count];
+            Node->count++;
+            
+            Left->count--;
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot - 1), CCDictionaryBPlusTreeNodeKey(Tree, Left, Left->count), Tree->keySize);
+            
+            return FALSE;
+        }
+        
+        else if ((Right) && (Right->count > Tree->minimum))
+        {
+            CCDictionaryBPlusTreeNode **RightChildren = CCDictionaryBPlusTreeNodeChildren(Tree, Right);
+            
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Node, Node->count), CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot), Tree->keySize);
+            Children[Node->count + 1] = RightChildren[0];
+            Node->count++;
+            
+            memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot), CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), Tree->keySize);
+            
+            Right->count--;
+            memmove(CCDictionaryBPlusTreeNodeKey(Tree, Right, 0), CCDictionaryBPlusTreeNodeKey(Tree, Right, 1), Right->count * Tree->keySize);
+            memmove(RightChildren, RightChildren + 1, (Right->count + 1) * sizeof(CCDictionaryBPlusTreeNode*));
+            
+            return FALSE;
+        }
+        
+        else if (Left)
+        {
+            CCDictionaryBPlusTreeBranchMerge(Tree, Left, CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot - 1), Node);
+            CCDictionaryBPlusTreeBranchRemove(Tree, Parent, Slot - 1);
+        }
+        
+        else
+        {
+            CCDictionaryBPlusTreeBranchMerge(Tree, Node, CCDictionaryBPlusTreeNodeKey(Tree, Parent, Slot), Right);
+            CCDictionaryBPlusTreeBranchRemove(Tree, Parent, Slot);
+        }
+    }
+    
+    return TRUE;
+}
+
+static void CCDictionaryBPlusTreeRemove(CCDictionaryBPlusTreeInternal *Tree, const void *Key)
+{
+    if (!Tree->root) return;
+    
+    CCDictionaryBPlusTreeNode *Path[CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH];
+    size_t Slots[CC_DICTIONARY_BPLUS_TREE_MAX_DEPTH], Depth, Index;
+    CCDictionaryBPlusTreeNode *Leaf = CCDictionaryBPlusTreeSearch(Tree, Key, Path, Slots, &Depth, &Index);
+    
+    if (!CCDictionaryBPlusTreeNodeKeyEqual(Tree, Leaf, Index, Key)) return;
+    
+    size_t *Records = CCDictionaryBPlusTreeNodeRecords(Tree, Leaf);
+    CCDictionaryBPlusTreeRecordDestroy(Tree, Records[Index]);
+    
+    Leaf->count--;
+    memmove(CCDictionaryBPlusTreeNodeKey(Tree, Leaf, Index), CCDictionaryBPlusTreeNodeKey(Tree, Leaf, Index + 1), (Leaf->count - Index) * Tree->keySize);
+    memmove(Records + Index, Records + Index + 1, (Leaf->count - Index) * sizeof(size_t));
+    Tree->count--;
+    
+    CCDictionaryBPlusTreeNode *Node = Leaf;
+    while ((Depth) && (Node->count < Tree->minimum))
+    {
+        Depth--;
+        
+        if (!CCDictionaryBPlusTreeRebalance(Tree, Node, Path[Depth], Slots[Depth])) break;
+        
+        Node = Path[Depth];
+    }
+    
+    if ((!Tree->root->leaf) && (!Tree->root->count))
+    {
+        CCDictionaryBPlusTreeNode *Root = Tree->root;
+        Tree->root = CCDictionaryBPlusTreeNodeChildren(Tree, Root)[0];
+        CCFree(Root);
+    }
+    
+    else if ((Tree->root->leaf) && (!Tree->root->count))
+    {
+        CCFree(Tree->root);
+        Tree->root = Tree->head = Tree->tail = NULL;
+    }
+}
+
+
+#pragma mark - Bulk Loading
+
+/*
+ Builds the tree from the bottom up, distributing the entries evenly across the leaves (and the
+ children evenly across the branches) so every node satisfies the minimum occupancy.
+ */
+static _Bool CCDictionaryBPlusTreeBulkLoad(CCDictionaryBPlusTreeInternal *Tree, const void *Keys, const void *Values, size_t Count, size_t ValueSize)
+{
+    const size_t LeafCount = (Count + Tree->capacity - 1) / Tree->capacity, Fanout = Tree->capacity + 1;
+    
+    size_t NodeCount = LeafCount;
+    for (size_t Level = LeafCount; Level > 1; )
+    {
+        Level = (Level + Fanout - 1) / Fanout;
+        NodeCount += Level;
+    }
+    
+    CCDictionaryBPlusTreeNode **Nodes = CCMalloc(CC_STD_ALLOCATOR, sizeof(CCDictionaryBPlusTreeNode*) * NodeCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (!Nodes)
+    {
+        CC_LOG_ERROR("Failed to bulk-load B+ tree: Failed to allocate memory of size (%zu)", sizeof(CCDictionaryBPlusTreeNode*) * NodeCount);
+        
+        return FALSE;
+    }
+    
+    for (size_t Loop = 0; Loop < NodeCount; Loop++)
+    {
+        if (!(Nodes[Loop] = CCDictionaryBPlusTreeNodeCreate(Tree, Loop < LeafCount)))
+        {
+            while (Loop--) CCFree(Nodes[Loop]);
+            CCFree(Nodes);
+            
+            return FALSE;
+        }
+    }
+    
+    const size_t FirstRecord = CCArrayGetCount(Tree->records);
+    if (CCArrayAppendElements(Tree->records, NULL, Count) == SIZE_MAX)
+    {
+        for (size_t Loop = 0; Loop < NodeCount; Loop++) CCFree(Nodes[Loop]);
+        CCFree(Nodes);
+        
+        return FALSE;
+    }
+    
+    for (size_t Loop = 0, Entry = 0; Loop < LeafCount; Loop++)
+    {
+        CCDictionaryBPlusTreeNode *Leaf = Nodes[Loop];
+        Leaf->count = (Count / LeafCount) + (Loop < (Count % LeafCount));
+        Leaf->prev = Loop ? Nodes[Loop - 1] : NULL;
+        Leaf->next = (Loop + 1) < LeafCount ? Nodes[Loop + 1] : NULL;
+        
+        memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Leaf, 0), Keys + (Entry * Tree->keySize), Leaf->count * Tree->keySize);
+        
+        size_t *Records = CCDictionaryBPlusTreeNodeRecords(Tree, Leaf);
+        for (size_t Index = 0; Index < Leaf->count; Index++, Entry++)
+        {
+            CCAssertLog((!Entry) || (CCDictionaryBPlusTreeCompare(Tree, Keys + ((Entry - 1) * Tree->keySize), Keys + (Entry * Tree->keySize)) == CCComparisonResultAscending), "Keys must be unique and in ascending order");
+            
+            Records[Index] = FirstRecord + Entry;
+            
+            uint8_t *Record = CCDictionaryBPlusTreeRecord(Tree, Records[Index]);
+            memcpy(Record, Keys + (Entry * Tree->keySize), Tree->keySize);
+            memcpy(Record + Tree->valueOffset, Values + (Entry * ValueSize), ValueSize);
+            Record[Tree->stateOffset] = CCDictionaryBPlusTreeRecordStateInitialized;
+        }
+    }
+    
+    Tree->head = Nodes[0];
+    Tree->tail = Nodes[LeafCount - 1];
+    
+    CCDictionaryBPlusTreeNode **Level = Nodes, **Parents = Nodes + LeafCount;
+    for (size_t LevelCount = LeafCount; LevelCount > 1; )
+    {
+        const size_t ParentCount = (LevelCount + Fanout - 1) / Fanout;
+        
+        for (size_t Loop = 0; Loop < ParentCount; Loop++)
+        {
+            CCDictionaryBPlusTreeNode *Parent = Parents[Loop], **Children = CCDictionaryBPlusTreeNodeChildren(Tree, Parent);
+            const size_t ChildCount = (LevelCount / ParentCount) + (Loop < (LevelCount % ParentCount));
+            
+            memcpy(Children, Level, ChildCount * sizeof(CCDictionaryBPlusTreeNode*));
+            Parent->count = ChildCount - 1;
+            
+            for (size_t Index = 1; Index < ChildCount; Index++)
+            {
+                memcpy(CCDictionaryBPlusTreeNodeKey(Tree, Parent, Index - 1), CCDictionaryBPlusTreeFirstKey(Tree, Children[Index]), Tree->keySize);
+            }
+            
+            Level += ChildCount;
+        }
+        
+        Level = Parents;
+        Parents += ParentCount;
+        LevelCount = ParentCount;
+    }
+    
+    Tree->root = *Level;
+    Tree->count = Count;
+    
+    CCFree(Nodes);
+    
+    return TRUE;
+}
+
+
+#pragma mark - Enumeration
+
+static CC_FORCE_INLINE void *CCDictionaryBPlusTreeElement(const CCDictionaryBPlusTreeInternal *Tree, const CCDictionaryBPlusTreeNode *Leaf, size_t Index, CCDictionaryEnumeratorType Type)
+{
+    if (!Leaf) return NULL;
+    
+    return Type == CCDictionaryEnumeratorTypeKey ? CCDictionaryBPlusTreeNodeKey(Tree, Leaf, Index) : CCDictionaryBPlusTreeRecord(Tree, CCDictionaryBPlusTreeNodeRecords(Tree, Leaf)[Index]) + Tree->valueOffset;
+}
+
+/*
+ Positions of the first key not less than the key, a position past the end of a leaf is normalized
+ to the start of the next leaf (or NULL when past the last leaf).
+ */
+static CCDictionaryBPlusTreeNode *CCDictionaryBPlusTreeLowerBound(const CCDictionaryBPlusTreeInternal *Tree, const void *Key, size_t *Index)
+{
+    *Index = 0;
+    
+    if (!Tree->count) return NULL;
+    
+    if (!Key) return Tree->head;
+    
+    CCDictionaryBPlusTreeNode *Leaf = CCDictionaryBPlusTreeSearch(Tree, Key, NULL, NULL, NULL, Index);
+    if (*Index == Leaf->count)
+    {
+        Leaf = Leaf->next;
+        *Index = 0;
+    }
+    
+    return Leaf;
+}
+
+/*
+ The enumerator's state is:
+ extra[0]: the current leaf (NULL if the enumerator is past the range).
+ extra[1]: the index in the current leaf.
+ extra[2]: the first leaf of the range.
+ extra[3]: the leaf the range ends at (exclusive).
+ extra[4]: the index in the first leaf, and the index in the end leaf.
+ */
+static void CCDictionaryBPlusTreeEnumeratorSetRange(CCEnumeratorState *Enumerator, CCDictionaryBPlusTreeNode *Start, size_t StartIndex, CCDictionaryBPlusTreeNode *End, size_t EndIndex)
+{
+    Enumerator->internal.extra[2] = (uintptr_t)Start;
+    Enumerator->internal.extra[3] = (uintptr_t)End;
+    Enumerator->internal.extra[4] = StartIndex | (EndIndex << 16);
+}
+
+static void *CCDictionaryBPlusTreeEnumerator(CCDictionaryBPlusTreeInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorAction Action, CCDictionaryEnumeratorType Type)
+{
+    if ((Action == CCDictionaryEnumeratorActionHead) || (Action == CCDictionaryEnumeratorActionTail))
+    {
+        if (!(Enumerator->type & CC_DICTIONARY_BPLUS_TREE_ENUMERATOR_RANGE))
+        {
+            Enumerator->type = CCEnumeratorFormatInternal;
+            CCDictionaryBPlusTreeEnumeratorSetRange(Enumerator, Internal->count ? Internal->head : NULL, 0, NULL, 0);
+        }
+    }
+    
+    CCDictionaryBPlusTreeNode *Leaf = (CCDictionaryBPlusTreeNode*)Enumerator->internal.extra[0];
+    size_t Index = Enumerator->internal.extra[1];
+    
+    CCDictionaryBPlusTreeNode *Start = (CCDictionaryBPlusTreeNode*)Enumerator->internal.extra[2], *End = (CCDictionaryBPlusTreeNode*)Enumerator->internal.extra[3];
+    const size_t StartIndex = Enumerator->internal.extra[4] & UINT16_MAX, EndIndex = Enumerator->internal.extra[4] >> 16;
+    
+    switch (Action)
+    {
+        case CCDictionaryEnumeratorActionHead:
+            Leaf = Start;
+            Index = StartIndex;
+            
+            if ((Leaf == End) && (Index == EndIndex)) Leaf = NULL;
+            break;
+            
+        case CCDictionaryEnumeratorActionTail:
+            if ((Start == End) && (StartIndex == EndIndex)) Leaf = NULL;
+            else if (!End)
+            {
+                Leaf = Internal->tail;
+                Index = Leaf->count - 1;
+            }
+            
+            else if (EndIndex)
+            {
+                Leaf = End;
+                Index = EndIndex - 1;
+            }
+            
+            else
+            {
+                Leaf = End->prev;
+                Index = Leaf->count - 1;
+            }
+            break;
+            
+        case CCDictionaryEnumeratorActionNext:
+            if (Leaf)
+            {
+                if (++Index == Leaf->count)
+                {
+                    Leaf = Leaf->next;
+                    Index = 0;
+                }
+                
+                if ((Leaf == End) && (Index == EndIndex)) Leaf = NULL;
+            }
+            break;
+            
+        case CCDictionaryEnumeratorActionPrevious:
+            if (Leaf)
+            {
+                if ((Leaf == Start) && (Index == StartIndex)) Leaf = NULL;
+                else if (Index) Index--;
+                else
+                {
+                    Leaf = Leaf->prev;
+                    Index = Leaf->count - 1;
+                }
+            }
+            break;
+            
+        case CCDictionaryEnumeratorActionCurrent:
+            break;
+    }
+    
+    Enumerator->internal.extra[0] = (uintptr_t)Leaf;
+    Enumerator->internal.extra[1] = Index;
+    
+    return (Enumerator->internal.ptr = CCDictionaryBPlusTreeElement(Internal, Leaf, Index, Type));
+}
+
+static CCDictionaryEntry CCDictionaryBPlusTreeEnumeratorEntry(CCDictionaryBPlusTreeInternal *Internal, CCEnumeratorState *Enumerator, CCDictionaryEnumeratorType Type)
+{
+    CCDictionaryBPlusTreeNode *Leaf = (CCDictionaryBPlusTreeNode*)Enumerator->internal.extra[0];
+    
+    return Leaf ? CCDictionaryBPlusTreeNodeRecords(Internal, Leaf)[Enumerator->internal.extra[1]] + 1 : 0;
+}
+
+static void *CCDictionaryBPlusTreeRangeEnumerator(CCDictionaryBPlusTreeInternal *Internal, CCEnumeratorState *Enumerator, const void *Min, const void *Max, CCDictionaryEnumeratorType Type, CCComparator KeyComparator)
+{
+    size_t StartIndex, EndIndex;
+    CCDictionaryBPlusTreeNode *Start = CCDictionaryBPlusTreeLowerBound(Internal, Min, &StartIndex);
+    CCDictionaryBPlusTreeNode *End = Max ? CCDictionaryBPlusTreeLowerBound(Internal, Max, &EndIndex) : NULL;
+    
+    if (!Max) EndIndex = 0;
+    else if ((Min) && (CCDictionaryBPlusTreeCompare(Internal, Min, Max) != CCComparisonResultAscending))
+    {
+        End = Start;
+        EndIndex = StartIndex;
+    }
+    
+    Enumerator->type = CCEnumeratorFormatInternal | CC_DICTIONARY_BPLUS_TREE_ENUMERATOR_RANGE;
+    CCDictionaryBPlusTreeEnumeratorSetRange(Enumerator, Start, StartIndex, End, EndIndex);
+    
+    return CCDictionaryBPlusTreeEnumerator(Internal, Enumerator, CCDictionaryEnumeratorActionHead, Type);
+}
+
+
+#pragma mark - Interface
+
+static int CCDictionaryBPlusTreeHintWeight(CCDictionaryHint Hint)
+{
+    //Only chosen when ordering is requested, as it requires the key comparator to produce a total order
+    if (!(Hint & CCDictionaryHintOrdered)) return -CCDictionaryHintWeightMax;
+    
+    return CCDictionaryHintWeightCreate(Hint,
+                                        CCDictionaryHintOrdered
+                                        | CCDictionaryHintHeavyEnumerating
+                                        | CCDictionaryHintConstantElements,
+                                        CCDictionaryHintHeavyFinding
+                                        | CCDictionaryHintHeavyInserting
+                                        | CCDictionaryHintHeavyDeleting
+                                        | CCDictionaryHintConstantLength,
+                                        0);
+}
+
+static void CCDictionaryBPlusTreeDestructor(CCDictionaryBPlusTreeInternal *Internal)
+{
+    if (Internal->root) CCDictionaryBPlusTreeNodeDestroy(Internal, Internal->root);
+    
+    CCArrayDestroy(Internal->records);
+    CCArrayDestroy(Internal->available);
+}
+
+static void *CCDictionaryBPlusTreeConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    CCDictionaryBPlusTreeInternal *Internal = CCMalloc(Allocator, sizeof(CCDictionaryBPlusTreeInternal), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Internal)
+    {
+        size_t ChunkSize = 64;
+        switch ((Hint & CCDictionaryHintSizeMask))
+        {
+            case CCDictionaryHintSizeSmall:
+                ChunkSize = 4;
+                break;
+                
+            case CCDictionaryHintSizeLarge:
+                ChunkSize = 1024;
+                break;
+        }
+        
+        size_t Capacity = CC_DICTIONARY_BPLUS_TREE_NODE_SIZE / KeySize;
+        if (Capacity < CC_DICTIONARY_BPLUS_TREE_MIN_CAPACITY) Capacity = CC_DICTIONARY_BPLUS_TREE_MIN_CAPACITY;
+        else if (Capacity > CC_DICTIONARY_BPLUS_TREE_MAX_CAPACITY) Capacity = CC_DICTIONARY_BPLUS_TREE_MAX_CAPACITY;
+        
+        const size_t ValueOffset = CC_ALIGN(KeySize, sizeof(uintmax_t));
+        
+        *Internal = (CCDictionaryBPlusTreeInternal){
+            .allocator = Allocator,
+            .root = NULL,
+            .head = NULL,
+            .tail = NULL,
+            .records = CCArrayCreate(Allocator, CC_ALIGN(ValueOffset + ValueSize + 1, sizeof(uintmax_t)), ChunkSize),
+            .available = CCArrayCreate(Allocator, sizeof(size_t), 16),
+            .comparator = KeyComparator,
+            .count = 0,
+            .keySize = KeySize,
+            .valueOffset = ValueOffset,
+            .stateOffset = ValueOffset + ValueSize,
+            .integer = ((KeySize == sizeof(uint8_t)) || (KeySize == sizeof(uint16_t)) || (KeySize == sizeof(uint32_t)) || (KeySize == sizeof(uint64_t))) ? KeySize : 0,
+            .capacity = Capacity,
+            .minimum = Capacity / 2,
+            .keysSize = CC_ALIGN((Capacity + 1) * KeySize, sizeof(uintmax_t))
+        };
+        
+        if ((!Internal->records) || (!Internal->available))
+        {
+            CC_LOG_ERROR("Failed to create B+ tree dictionary: Failed to create records");
+            
+            if (Internal->records) CCArrayDestroy(Internal->records);
+            if (Internal->available) CCArrayDestroy(Internal->available);
+            
+            CCFree(Internal);
+            Internal = NULL;
+        }
+        
+        else CCMemorySetDestructor(Internal, (CCMemoryDestructorCallback)CCDictionaryBPlusTreeDestructor);
+    }
+    
+    else
+    {
+        CC_LOG_ERROR("Failed to create B+ tree dictionary: Failed to allocate memory of size (%zu)", sizeof(CCDictionaryBPlusTreeInternal));
+    }
+    
+    return Internal;
+}
+
+static size_t CCDictionaryBPlusTreeGetCount(CCDictionaryBPlusTreeInternal *Internal)
+{
+    return Internal->count;
+}
+
+static _Bool CCDictionaryBPlusTreeEntryIsInitialized(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry)
+{
+    return CCDictionaryBPlusTreeRecord(Internal, Entry - 1)[Internal->stateOffset] == CCDictionaryBPlusTreeRecordStateInitialized;
+}
+
+static CCDictionaryEntry CCDictionaryBPlusTreeFindKey(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    return CCDictionaryBPlusTreeFind(Internal, Key) + 1;
+}
+
+static CCDictionaryEntry CCDictionaryBPlusTreeEntryForKey(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    return CCDictionaryBPlusTreeInsert(Internal, Key) + 1;
+}
+
+static void *CCDictionaryBPlusTreeGetKey(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry)
+{
+    uint8_t *Record = CCDictionaryBPlusTreeRecord(Internal, Entry - 1);
+    
+    return Record[Internal->stateOffset] != CCDictionaryBPlusTreeRecordStateAvailable ? Record : NULL;
+}
+
+static void *CCDictionaryBPlusTreeGetEntry(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry)
+{
+    return CCDictionaryBPlusTreeRecord(Internal, Entry - 1) + Internal->valueOffset;
+}
+
+static void CCDictionaryBPlusTreeSetEntry(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry, const void *Value, size_t ValueSize, CCAllocatorType Allocator)
+{
+    uint8_t *Record = CCDictionaryBPlusTreeRecord(Internal, Entry - 1);
+    
+    memcpy(Record + Internal->valueOffset, Value, ValueSize);
+    Record[Internal->stateOffset] = CCDictionaryBPlusTreeRecordStateInitialized;
+}
+
+static void CCDictionaryBPlusTreeRemoveEntry(CCDictionaryBPlusTreeInternal *Internal, CCDictionaryEntry Entry, CCAllocatorType Allocator)
+{
+    uint8_t *Record = CCDictionaryBPlusTreeRecord(Internal, Entry - 1);
+    
+    if (Record[Internal->stateOffset] != CCDictionaryBPlusTreeRecordStateAvailable) CCDictionaryBPlusTreeRemove(Internal, Record);
+}
+
+static void *CCDictionaryBPlusTreeGetValue(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
+{
+    const size_t Record = CCDictionaryBPlusTreeFind(Internal, Key);
+    
+    return Record != SIZE_MAX ? CCDictionaryBPlusTreeRecord(Internal, Record) + Internal->valueOffset : NULL;
+}
+
+static void CCDictionaryBPlusTreeSetValue(CCDictionaryBPlusTreeInternal *Internal, const void *Key, const void *Value, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    const size_t Record = CCDictionaryBPlusTreeInsert(Internal, Key);
+    
+    if (Record != SIZE_MAX) CCDictionaryBPlusTreeSetEntry(Internal, Record + 1, Value, ValueSize, Allocator);
+}
+
+static void CCDictionaryBPlusTreeRemoveValue(CCDictionaryBPlusTreeInternal *Internal, const void *Key, size_t KeySize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    CCDictionaryBPlusTreeRemove(Internal, Key);
+}
+
+static void CCDictionaryBPlusTreeSetSortedValues(CCDictionaryBPlusTreeInternal *Internal, const void *Keys, const void *Values, size_t Count, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator)
+{
+    if (!Count) return;
+    
+    if (!Internal->root)
+    {
+        CCArrayRemoveAllElements(Internal->records);
+        CCArrayRemoveAllElements(Internal->available);
+        
+        if (CCDictionaryBPlusTreeBulkLoad(Internal, Keys, Values, Count, ValueSize)) return;
+    }
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        CCDictionaryBPlusTreeSetValue(Internal, Keys + (Loop * KeySize), Values + (Loop * ValueSize), KeySize, ValueSize, Hasher, KeyComparator, Allocator);
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*!
+ * @header CCDictionaryBPlusTree
+ * CCDictionaryBPlusTree is an interface for a B+ tree backed dictionary implementation, that keeps
+ * its keys in ascending order. It's chosen for dictionaries that are created with the
+ * @b CCDictionaryHintOrdered hint.
+ *
+ * Nodes are sized to a few hardware cache lines, keys are stored contiguously within a node and
+ * the leaves are linked to allow ordered enumeration and range queries. Keys of 1, 2, 4, or 8 bytes
+ * with no key comparator are ordered as unsigned integers (and are searched with vector comparisons
+ * where supported), other keys without a comparator are ordered by their bytes. A key comparator
+ * must produce a total order of the keys.
+ *
+ * Fast Operations:
+ * - Enumerating of keys (in order).
+ * - Enumerating of a range of keys.
+ * - Bulk-loading sorted keys.
+ *
+ * Moderate Operations:
+ * - Lookup.
+ * - Insertion.
+ * - Deletion.
+ * - Enumerating of values.
+ */
+#ifndef CommonC_DictionaryBPlusTree_h
+#define CommonC_DictionaryBPlusTree_h
+
+#include <CommonC/DictionaryInterface.h>
+
+extern const CCDictionaryInterface CCDictionaryBPlusTreeInterface;
+
+#define CCDictionaryBPlusTree &CCDictionaryBPlusTreeInterface
+
+#endif
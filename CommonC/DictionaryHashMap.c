@@ -90,7 +90,7 @@ static int CCDictionaryHashMapHintWeight(CCDictionaryHint Hint)
                                         | CCDictionaryHintConstantElements
                                         | CCDictionaryHintHeavyDeleting,
                                         CCDictionaryHintHeavyEnumerating,
-                                        0);
+                                        CCDictionaryHintOrdered);
 }
 
 static void *CCDictionaryHashMapConstructor(CCAllocatorType Allocator, CCDictionaryHint Hint, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator)
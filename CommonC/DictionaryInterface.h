@@ -65,6 +65,8 @@ typedef CC_EXTENSIBLE_FLAG_ENUM(CCDictionaryHint, uint32_t) {
     CCDictionaryHintConstantLength = (1 << 4),
     ///The elements won't change (unlikely to do any deleting/replacing).
     CCDictionaryHintConstantElements = (1 << 5),
+    ///Dictionary must keep its keys in ascending order (enumerating, and querying ranges of keys in order).
+    CCDictionaryHintOrdered = (1 << 6),
     
     ///Mask for size hints.
     CCDictionaryHintSizeMask = 0xc0000000,
@@ -316,6 +318,49 @@ typedef CCOrderedCollection (*CCDictionaryGetKeysCallback)(void *Internal, CCAll
  */
 typedef CCOrderedCollection (*CCDictionaryGetValuesCallback)(void *Internal, CCAllocatorType Allocator);
 
+/*!
+ * @brief An optional callback to set the values for a sequence of keys that are in ascending order.
+ * @description Allows implementations that maintain key order to bulk-load the entries. If not
+ *              implemented each value will be set individually.
+ *
+ * @param Internal The pointer to the internal of the dictionary.
+ * @param Keys The pointer to the keys, these must be unique and in ascending order.
+ * @param Values The pointer to the values to be copied to the map, corresponding to each key.
+ * @param Count The number of keys/values.
+ * @param KeySize The size of a key.
+ * @param ValueSize The size of a value.
+ * @param Hasher The hashing function to be used to generate a hash for a given key. If
+ *        NULL, the implementation will use some default hashing behaviour.
+ *
+ * @param KeyComparator The key comparison function to be used to order the keys. If NULL,
+ *        the implementation will use some default comparison behaviour.
+ *
+ * @param Allocator The allocator to be used for any internal allocation needed.
+ */
+typedef void (*CCDictionarySetSortedValuesCallback)(void *Internal, const void *Keys, const void *Values, size_t Count, size_t KeySize, size_t ValueSize, CCDictionaryKeyHasher Hasher, CCComparator KeyComparator, CCAllocatorType Allocator);
+
+/*!
+ * @brief An optional callback to set the enumerator to the head of a range of keys.
+ * @description Subsequent actions on the enumerator are performed using the @b CCDictionaryEnumeratorCallback,
+ *              which must keep the enumerator within the range. There is no fallback for this callback,
+ *              implementations that do not maintain key order should leave it unimplemented.
+ *
+ * @param Internal The pointer to the internal of the dictionary.
+ * @param Enumerator The pointer to the enumerator to be used.
+ * @param Min The pointer to the lowest key (inclusive) of the range. If NULL the range starts
+ *        from the first key.
+ *
+ * @param Max The pointer to the highest key (exclusive) of the range. If NULL the range ends
+ *        at the last key.
+ *
+ * @param Type The type of enumerator.
+ * @param KeyComparator The key comparison function to be used to order the keys. If NULL,
+ *        the implementation will use some default comparison behaviour.
+ *
+ * @return The first element in the range, or NULL if the range is empty.
+ */
+typedef void *(*CCDictionaryRangeEnumeratorCallback)(void *Internal, CCEnumeratorState *Enumerator, const void *Min, const void *Max, CCDictionaryEnumeratorType Type, CCComparator KeyComparator);
+
 
 #pragma mark -
 
@@ -344,6 +389,8 @@ typedef struct {
         CCDictionaryRemoveValueCallback removeValue;
         CCDictionaryGetKeysCallback keys;
         CCDictionaryGetValuesCallback values;
+        CCDictionarySetSortedValuesCallback setSortedValues;
+        CCDictionaryRangeEnumeratorCallback rangeEnumerator;
     } optional;
 } CCDictionaryInterface;
 
@@ -35,6 +35,7 @@
  CC_FORMAT_SCANF(fmt, args): Treats the function usage as if the format and arguments followed that of scanf's, and so will give warnings appropriately. fmt = index of the format string, args = the index of the arguments
  CC_PURE_FUNCTION: Marks the function as having no side effects. Can help the compiler with optimization.
  CC_CONSTANT_FUNCTION: A more strict version of CC_PURE_FUNCTION, it does not allow pointer arguments or global variable access.
+ CC_TARGET(features): Compiles the function for the given instruction set extensions (e.g. "avx2,popcnt"), regardless of the flags the rest of the file is compiled with. It must only be called after checking those features are available.
  
  Optional usage:
  CC_SUPPORT_BLOCKS(...): Allows for code specific to blocks to be used.
@@ -192,6 +193,12 @@
 #define CC_DESTRUCTOR
 #endif
 
+#if __has_attribute(target)
+#define CC_TARGET(features) __attribute__((target(features)))
+#else
+#define CC_TARGET(features)
+#endif
+
 #ifndef CC_OPEN_ENUM
 #define CC_OPEN_ENUM
 #define CC_CLOSED_ENUM
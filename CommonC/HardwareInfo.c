@@ -27,6 +27,14 @@
 #include "Platform.h"
 #include "CCString.h"
 #include "Assertion.h"
+#include <stdatomic.h>
+
+#if (CC_HARDWARE_ARCH_X86 || CC_HARDWARE_ARCH_X86_64) && __has_include(<cpuid.h>)
+#include <cpuid.h>
+#elif (CC_HARDWARE_ARCH_ARM || CC_HARDWARE_ARCH_ARM_64) && __linux__ && __has_include(<sys/auxv.h>)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
 
 #if CC_PLATFORM_APPLE
 #include <mach/mach.h>
@@ -280,3 +288,109 @@ _Bool CCHardwareGetGPUs(CCHardwareGPU *Processors, size_t *Count)
     return FALSE;
 }
 #endif
+
+#pragma mark - Features
+
+#if (CC_HARDWARE_ARCH_X86 || CC_HARDWARE_ARCH_X86_64) && __has_include(<cpuid.h>)
+static uint64_t CCHardwareGetXCR0(void)
+{
+    uint32_t Low, High;
+    __asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+    
+    return ((uint64_t)High << 32) | Low;
+}
+
+static CCHardwareFeature CCHardwareDetectFeatures(void)
+{
+    CCHardwareFeature Features = 0;
+    
+    unsigned int Max = __get_cpuid_max(0, NULL), a, b, c, d;
+    if ((Max >= 1) && (__get_cpuid(1, &a, &b, &c, &d)))
+    {
+        if (d & (1 << 25)) Features |= CCHardwareFeatureSSE;
+        if (d & (1 << 26)) Features |= CCHardwareFeatureSSE2;
+        if (c & (1 << 0)) Features |= CCHardwareFeatureSSE3;
+        if (c & (1 << 9)) Features |= CCHardwareFeatureSSSE3;
+        if (c & (1 << 19)) Features |= CCHardwareFeatureSSE4_1;
+        if (c & (1 << 20)) Features |= CCHardwareFeatureSSE4_2;
+        if (c & (1 << 23)) Features |= CCHardwareFeaturePOPCNT;
+        
+        //The YMM (and ZMM) state must be enabled by the OS (OSXSAVE + XCR0) before any AVX instructions can be used
+        const uint64_t XCR0 = (c & (1 << 27)) ? CCHardwareGetXCR0() : 0;
+        const _Bool YMM = (XCR0 & 0x6) == 0x6, ZMM = (XCR0 & 0xe6) == 0xe6;
+        
+        if (YMM)
+        {
+            if (c & (1 << 28)) Features |= CCHardwareFeatureAVX;
+            if (c & (1 << 12)) Features |= CCHardwareFeatureFMA;
+        }
+        
+        if ((Max >= 7) && (__get_cpuid_count(7, 0, &a, &b, &c, &d)))
+        {
+            if (b & (1 << 3)) Features |= CCHardwareFeatureBMI1;
+            if (b & (1 << 8)) Features |= CCHardwareFeatureBMI2;
+            
+            if (YMM)
+            {
+                if (b & (1 << 5)) Features |= CCHardwareFeatureAVX2;
+            }
+            
+            if (ZMM)
+            {
+                if (b & (1 << 16)) Features |= CCHardwareFeatureAVX512F;
+                if (b & (1 << 30)) Features |= CCHardwareFeatureAVX512BW;
+            }
+        }
+    }
+    
+    if ((__get_cpuid_max(0x80000000, NULL) >= 0x80000001) && (__get_cpuid(0x80000001, &a, &b, &c, &d)))
+    {
+        if (c & (1 << 5)) Features |= CCHardwareFeatureLZCNT;
+    }
+    
+    return Features;
+}
+#elif CC_HARDWARE_ARCH_ARM || CC_HARDWARE_ARCH_ARM_64
+static CCHardwareFeature CCHardwareDetectFeatures(void)
+{
+    CCHardwareFeature Features = 0;
+    
+#if CC_HARDWARE_ARCH_ARM_64 || CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
+    Features |= CCHardwareFeatureNEON;
+#endif
+    
+#if __ARM_FEATURE_CRC32
+    Features |= CCHardwareFeatureCRC32;
+#elif CC_PLATFORM_APPLE
+    int32_t CRC32 = 0;
+    if ((!sysctlbyname("hw.optional.armv8_crc32", &CRC32, &(size_t){ sizeof(CRC32) }, NULL, 0)) && (CRC32)) Features |= CCHardwareFeatureCRC32;
+#elif __linux__ && __has_include(<sys/auxv.h>) && CC_HARDWARE_ARCH_ARM_64 && defined(HWCAP_CRC32)
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) Features |= CCHardwareFeatureCRC32;
+#elif __linux__ && __has_include(<sys/auxv.h>) && defined(HWCAP2_CRC32)
+    if (getauxval(AT_HWCAP2) & HWCAP2_CRC32) Features |= CCHardwareFeatureCRC32;
+#endif
+    
+    return Features;
+}
+#else
+static CCHardwareFeature CCHardwareDetectFeatures(void)
+{
+    return 0;
+}
+#endif
+
+#define CC_HARDWARE_FEATURES_DETECTED (UINT64_C(1) << 63)
+
+static _Atomic(uint64_t) CCHardwareFeatures = ATOMIC_VAR_INIT(0);
+
+CCHardwareFeature CCHardwareGetFeatures(void)
+{
+    uint64_t Features = atomic_load_explicit(&CCHardwareFeatures, memory_order_relaxed);
+    if (!Features)
+    {
+        Features = CCHardwareDetectFeatures() | CC_HARDWARE_FEATURES_DETECTED;
+        atomic_store_explicit(&CCHardwareFeatures, Features, memory_order_relaxed);
+    }
+    
+    return Features & ~CC_HARDWARE_FEATURES_DETECTED;
+}
@@ -27,6 +27,7 @@
 #define CommonC_HardwareInfo_h
 
 #include <CommonC/Base.h>
+#include <CommonC/Extensions.h>
 
 typedef struct {
     /// The model name of the CPU. Empty if one could not be found.
@@ -50,6 +51,48 @@ typedef struct {
     size_t vram;
 } CCHardwareGPU;
 
+/*!
+ * @brief The instruction set extensions supported by the CPU.
+ * @description Only the extensions that are both supported by the CPU and enabled by the OS
+ *              will be set.
+ */
+typedef CC_FLAG_ENUM(CCHardwareFeature, uint64_t) {
+    /// x86 SSE
+    CCHardwareFeatureSSE = (1 << 0),
+    /// x86 SSE2
+    CCHardwareFeatureSSE2 = (1 << 1),
+    /// x86 SSE3
+    CCHardwareFeatureSSE3 = (1 << 2),
+    /// x86 SSSE3
+    CCHardwareFeatureSSSE3 = (1 << 3),
+    /// x86 SSE4.1
+    CCHardwareFeatureSSE4_1 = (1 << 4),
+    /// x86 SSE4.2 (includes the CRC32 instruction)
+    CCHardwareFeatureSSE4_2 = (1 << 5),
+    /// x86 POPCNT
+    CCHardwareFeaturePOPCNT = (1 << 6),
+    /// x86 AVX
+    CCHardwareFeatureAVX = (1 << 7),
+    /// x86 AVX2
+    CCHardwareFeatureAVX2 = (1 << 8),
+    /// x86 FMA3
+    CCHardwareFeatureFMA = (1 << 9),
+    /// x86 BMI1
+    CCHardwareFeatureBMI1 = (1 << 10),
+    /// x86 BMI2
+    CCHardwareFeatureBMI2 = (1 << 11),
+    /// x86 LZCNT
+    CCHardwareFeatureLZCNT = (1 << 12),
+    /// x86 AVX-512 Foundation
+    CCHardwareFeatureAVX512F = (1 << 13),
+    /// x86 AVX-512 Byte and Word
+    CCHardwareFeatureAVX512BW = (1 << 14),
+    /// ARM NEON
+    CCHardwareFeatureNEON = (1 << 15),
+    /// ARM CRC32
+    CCHardwareFeatureCRC32 = (1 << 16)
+};
+
 /*!
  * @brief Get information on the available CPUs.
  * @param Processors A pointer to where to store the CPU information.
@@ -70,4 +113,14 @@ _Bool CCHardwareGetCPUs(CCHardwareCPU *Processors, size_t *Count);
  */
 _Bool CCHardwareGetGPUs(CCHardwareGPU *Processors, size_t *Count);
 
+/*!
+ * @brief Get the instruction set extensions supported by the CPU the process is running on.
+ * @description The features are detected on first use and cached. Library routines that
+ *              have specialised implementations (hashing, string search, bit counting) select
+ *              them from this set.
+ *
+ * @return The supported features.
+ */
+CCHardwareFeature CCHardwareGetFeatures(void);
+
 #endif
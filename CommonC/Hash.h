@@ -45,4 +45,15 @@ uint32_t CCHashJenkins32(CCData Data);
  */
 uint32_t CCHashMurmur32(CCData Data);
 
+/*!
+ * @brief An implementation of CRC-32C (Castagnoli)
+ * @description Uses the CRC32 instructions when they're supported by the CPU (SSE4.2 or ARMv8 CRC32),
+ *              otherwise falls back to a table driven implementation.
+ *
+ * @see https://en.wikipedia.org/wiki/Cyclic_redundancy_check
+ * @param Data The data to obtain the hash for.
+ * @return The hash.
+ */
+uint32_t CCHashCRC32C(CCData Data);
+
 #endif
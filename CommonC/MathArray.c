@@ -0,0 +1,524 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MathArray.h"
+#include "Assertion.h"
+#include "MemoryAllocation.h"
+#include "Maths.h"
+#include <string.h>
+#include <float.h>
+
+#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON || CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include "Simd.h"
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX
+#define CC_MATH_ARRAY_LANES 8
+#define CC_MATH_ARRAY_F32(op) CCSimd##op##_f32x8
+#define CC_MATH_ARRAY_U32(op) CCSimd##op##_u32x8
+#define CC_MATH_ARRAY_U32_F32(op) CCSimd_u32x8_##op##_f32x8
+#define CC_MATH_ARRAY_F32_U32(op) CCSimd_f32x8_##op##_u32x8
+#define CC_MATH_ARRAY_S32_F32(op) CCSimd_s32x8_##op##_f32x8
+#define CC_MATH_ARRAY_F32_S32(op) CCSimd_f32x8_##op##_s32x8
+#define CC_MATH_ARRAY_U32_S32(op) CCSimd_u32x8_##op##_s32x8
+#define CC_MATH_ARRAY_S32_U32(op) CCSimd_s32x8_##op##_u32x8
+typedef CCSimd_f32x8 CCMathArraySimd;
+typedef CCSimd_u32x8 CCMathArrayMask;
+#else
+#define CC_MATH_ARRAY_LANES 4
+#define CC_MATH_ARRAY_F32(op) CCSimd##op##_f32x4
+#define CC_MATH_ARRAY_U32(op) CCSimd##op##_u32x4
+#define CC_MATH_ARRAY_U32_F32(op) CCSimd_u32x4_##op##_f32x4
+#define CC_MATH_ARRAY_F32_U32(op) CCSimd_f32x4_##op##_u32x4
+#define CC_MATH_ARRAY_S32_F32(op) CCSimd_s32x4_##op##_f32x4
+#define CC_MATH_ARRAY_F32_S32(op) CCSimd_f32x4_##op##_s32x4
+#define CC_MATH_ARRAY_U32_S32(op) CCSimd_u32x4_##op##_s32x4
+#define CC_MATH_ARRAY_S32_U32(op) CCSimd_s32x4_##op##_u32x4
+typedef CCSimd_f32x4 CCMathArraySimd;
+typedef CCSimd_u32x4 CCMathArrayMask;
+#endif
+
+/// Element wise (Mask ? a : b).
+static CC_FORCE_INLINE CCMathArraySimd CCMathArraySelect(const CCMathArrayMask Mask, const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32_U32(Reinterpret)(CC_MATH_ARRAY_U32(Or)(CC_MATH_ARRAY_U32(And)(Mask, CC_MATH_ARRAY_U32_F32(Reinterpret)(a)), CC_MATH_ARRAY_U32(AndNot)(Mask, CC_MATH_ARRAY_U32_F32(Reinterpret)(b))));
+}
+
+/// Truncates the (non-negative) floats to integers.
+static CC_FORCE_INLINE CCMathArrayMask CCMathArrayToInteger(const CCMathArraySimd a)
+{
+    return CC_MATH_ARRAY_U32_S32(Reinterpret)(CC_MATH_ARRAY_S32_F32(Cast)(a));
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayFromInteger(const CCMathArrayMask a)
+{
+    return CC_MATH_ARRAY_F32_S32(Cast)(CC_MATH_ARRAY_S32_U32(Reinterpret)(a));
+}
+
+#pragma mark Bounded Kernels
+
+/*
+ The bounded kernels are based off the single precision Cephes implementations (sinf, cosf, expf, logf) by Stephen
+ L. Moshier, evaluated across lanes. They only handle the input range where their error bound holds, any other
+ elements are replaced by the standard library result.
+ */
+
+#define CC_MATH_ARRAY_SINCOS_LIMIT 8192.0f
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArraySinCosBounded(const CCMathArraySimd a, const _Bool Cos)
+{
+    const CCMathArrayMask SignMask = CC_MATH_ARRAY_U32(Fill)(0x80000000);
+    const CCMathArrayMask One = CC_MATH_ARRAY_U32(Fill)(1), Two = CC_MATH_ARRAY_U32(Fill)(2), Four = CC_MATH_ARRAY_U32(Fill)(4);
+    
+    CCMathArrayMask Sign = Cos ? CC_MATH_ARRAY_U32(Fill)(0) : CC_MATH_ARRAY_U32(And)(CC_MATH_ARRAY_U32_F32(Reinterpret)(a), SignMask);
+    CCMathArraySimd x = CC_MATH_ARRAY_F32(Abs)(a);
+    
+    // Octant rounded up to an even number, so the remainder lies in -pi/4 to pi/4
+    CCMathArrayMask j = CCMathArrayToInteger(CC_MATH_ARRAY_F32(Mul)(x, CC_MATH_ARRAY_F32(Fill)(1.27323954473516f)));
+    j = CC_MATH_ARRAY_U32(AndNot)(One, CC_MATH_ARRAY_U32(Add)(j, One));
+    
+    const CCMathArraySimd y = CCMathArrayFromInteger(j);
+    
+    if (Cos)
+    {
+        j = CC_MATH_ARRAY_U32(Sub)(j, Two);
+        Sign = CC_MATH_ARRAY_U32(ShiftLeftN)(CC_MATH_ARRAY_U32(AndNot)(j, Four), 29);
+    }
+    
+    else Sign = CC_MATH_ARRAY_U32(Xor)(Sign, CC_MATH_ARRAY_U32(ShiftLeftN)(CC_MATH_ARRAY_U32(And)(j, Four), 29));
+    
+    const CCMathArrayMask SinPoly = CC_MATH_ARRAY_U32(MaskCompareEqual)(CC_MATH_ARRAY_U32(And)(j, Two), CC_MATH_ARRAY_U32(Fill)(0));
+    
+    /*
+     Extended precision modular arithmetic (Cody-Waite). Pi/4 is split into parts of at most 10 significant bits
+     followed by the rounded remainder, so for octants below 2^14 every product but the last is exact and the
+     remainder keeps its relative precision even when the input lies close to a multiple of pi/2.
+     */
+    x = CC_MATH_ARRAY_F32(Sub)(x, CC_MATH_ARRAY_F32(Mul)(y, CC_MATH_ARRAY_F32(Fill)(0.78515625f)));
+    x = CC_MATH_ARRAY_F32(Sub)(x, CC_MATH_ARRAY_F32(Mul)(y, CC_MATH_ARRAY_F32(Fill)(2.41756439208984375e-4f)));
+    
+    const CCMathArraySimd Part = CC_MATH_ARRAY_F32(Mul)(y, CC_MATH_ARRAY_F32(Fill)(1.569278538227081298828125e-7f));
+    const CCMathArraySimd High = CC_MATH_ARRAY_F32(Sub)(x, Part);
+    
+    CCMathArraySimd Low = CC_MATH_ARRAY_F32(Sub)(CC_MATH_ARRAY_F32(Sub)(x, High), Part);
+    Low = CC_MATH_ARRAY_F32(Sub)(Low, CC_MATH_ARRAY_F32(Mul)(y, CC_MATH_ARRAY_F32(Fill)(3.03543856716714799404144287109375e-11f)));
+    Low = CC_MATH_ARRAY_F32(Sub)(Low, CC_MATH_ARRAY_F32(Mul)(y, CC_MATH_ARRAY_F32(Fill)(3.1116859848349943e-14f)));
+    
+    x = CC_MATH_ARRAY_F32(Add)(High, Low);
+    
+    const CCMathArraySimd z = CC_MATH_ARRAY_F32(Mul)(x, x);
+    
+    CCMathArraySimd CosResult = CC_MATH_ARRAY_F32(Madd)(z, CC_MATH_ARRAY_F32(Fill)(2.443315711809948e-5f), CC_MATH_ARRAY_F32(Fill)(-1.388731625493765e-3f));
+    CosResult = CC_MATH_ARRAY_F32(Madd)(CosResult, z, CC_MATH_ARRAY_F32(Fill)(4.166664568298827e-2f));
+    CosResult = CC_MATH_ARRAY_F32(Mul)(CC_MATH_ARRAY_F32(Mul)(CosResult, z), z);
+    CosResult = CC_MATH_ARRAY_F32(Sub)(CosResult, CC_MATH_ARRAY_F32(Mul)(z, CC_MATH_ARRAY_F32(Fill)(0.5f)));
+    CosResult = CC_MATH_ARRAY_F32(Add)(CosResult, CC_MATH_ARRAY_F32(Fill)(1.0f));
+    
+    CCMathArraySimd SinResult = CC_MATH_ARRAY_F32(Madd)(z, CC_MATH_ARRAY_F32(Fill)(-1.9515295891e-4f), CC_MATH_ARRAY_F32(Fill)(8.3321608736e-3f));
+    SinResult = CC_MATH_ARRAY_F32(Madd)(SinResult, z, CC_MATH_ARRAY_F32(Fill)(-1.6666654611e-1f));
+    SinResult = CC_MATH_ARRAY_F32(Madd)(CC_MATH_ARRAY_F32(Mul)(SinResult, z), x, x);
+    
+    const CCMathArraySimd Result = CCMathArraySelect(SinPoly, SinResult, CosResult);
+    
+    return CC_MATH_ARRAY_F32_U32(Reinterpret)(CC_MATH_ARRAY_U32(Xor)(CC_MATH_ARRAY_U32_F32(Reinterpret)(Result), Sign));
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArraySinBounded(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CCMathArraySinCosBounded(a, FALSE);
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayCosBounded(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CCMathArraySinCosBounded(a, TRUE);
+}
+
+static CC_FORCE_INLINE CCMathArrayMask CCMathArraySinCosValid(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32(MaskCompareLessThanEqual)(CC_MATH_ARRAY_F32(Abs)(a), CC_MATH_ARRAY_F32(Fill)(CC_MATH_ARRAY_SINCOS_LIMIT));
+}
+
+#define CC_MATH_ARRAY_EXP_MIN -87.0f
+#define CC_MATH_ARRAY_EXP_MAX 88.0f
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayExpBounded(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    // Express e^x = e^g * 2^n, where g is the remainder after removing n * ln(2)
+    const CCMathArraySimd n = CC_MATH_ARRAY_F32(Floor)(CC_MATH_ARRAY_F32(Madd)(a, CC_MATH_ARRAY_F32(Fill)(1.44269504088896341f), CC_MATH_ARRAY_F32(Fill)(0.5f)));
+    
+    CCMathArraySimd x = CC_MATH_ARRAY_F32(Sub)(a, CC_MATH_ARRAY_F32(Mul)(n, CC_MATH_ARRAY_F32(Fill)(0.693359375f)));
+    x = CC_MATH_ARRAY_F32(Sub)(x, CC_MATH_ARRAY_F32(Mul)(n, CC_MATH_ARRAY_F32(Fill)(-2.12194440e-4f)));
+    
+    const CCMathArraySimd z = CC_MATH_ARRAY_F32(Mul)(x, x);
+    
+    CCMathArraySimd Result = CC_MATH_ARRAY_F32(Madd)(x, CC_MATH_ARRAY_F32(Fill)(1.9875691500e-4f), CC_MATH_ARRAY_F32(Fill)(1.3981999507e-3f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(8.3334519073e-3f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(4.1665795894e-2f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(1.6666665459e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(5.0000001201e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, z, x);
+    Result = CC_MATH_ARRAY_F32(Add)(Result, CC_MATH_ARRAY_F32(Fill)(1.0f));
+    
+    // 2^n, n lies within the normal exponent range for the supported inputs
+    const CCMathArrayMask Exponent = CC_MATH_ARRAY_U32(ShiftLeftN)(CC_MATH_ARRAY_U32_S32(Reinterpret)(CC_MATH_ARRAY_S32_F32(Cast)(CC_MATH_ARRAY_F32(Add)(n, CC_MATH_ARRAY_F32(Fill)(127.0f)))), 23);
+    
+    return CC_MATH_ARRAY_F32(Mul)(Result, CC_MATH_ARRAY_F32_U32(Reinterpret)(Exponent));
+}
+
+static CC_FORCE_INLINE CCMathArrayMask CCMathArrayExpValid(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_U32(And)(CC_MATH_ARRAY_F32(MaskCompareGreaterThanEqual)(a, CC_MATH_ARRAY_F32(Fill)(CC_MATH_ARRAY_EXP_MIN)), CC_MATH_ARRAY_F32(MaskCompareLessThanEqual)(a, CC_MATH_ARRAY_F32(Fill)(CC_MATH_ARRAY_EXP_MAX)));
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayLogBounded(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    // Split the (normal, positive) value into its exponent and a mantissa in the range 0.5 to 1
+    const CCMathArrayMask Bits = CC_MATH_ARRAY_U32_F32(Reinterpret)(a);
+    
+    CCMathArraySimd e = CC_MATH_ARRAY_F32(Sub)(CCMathArrayFromInteger(CC_MATH_ARRAY_U32(ShiftRightN)(Bits, 23)), CC_MATH_ARRAY_F32(Fill)(126.0f));
+    CCMathArraySimd x = CC_MATH_ARRAY_F32_U32(Reinterpret)(CC_MATH_ARRAY_U32(Or)(CC_MATH_ARRAY_U32(And)(Bits, CC_MATH_ARRAY_U32(Fill)(0x7fffff)), CC_MATH_ARRAY_U32(Fill)(0x3f000000)));
+    
+    // Move mantissas below sqrt(0.5) to the range sqrt(0.5) to 1 to centre the remainder around 0
+    const CCMathArrayMask Small = CC_MATH_ARRAY_F32(MaskCompareLessThan)(x, CC_MATH_ARRAY_F32(Fill)(0.707106781186547524f));
+    
+    e = CC_MATH_ARRAY_F32(Sub)(e, CCMathArraySelect(Small, CC_MATH_ARRAY_F32(Fill)(1.0f), CC_MATH_ARRAY_F32(Fill)(0.0f)));
+    x = CC_MATH_ARRAY_F32(Add)(CC_MATH_ARRAY_F32(Sub)(x, CC_MATH_ARRAY_F32(Fill)(1.0f)), CCMathArraySelect(Small, x, CC_MATH_ARRAY_F32(Fill)(0.0f)));
+    
+    const CCMathArraySimd z = CC_MATH_ARRAY_F32(Mul)(x, x);
+    
+    CCMathArraySimd Result = CC_MATH_ARRAY_F32(Madd)(x, CC_MATH_ARRAY_F32(Fill)(7.0376836292e-2f), CC_MATH_ARRAY_F32(Fill)(-1.1514610310e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(1.1676998740e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(-1.2420140846e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(1.4249322787e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(-1.6668057665e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(2.0000714765e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(-2.4999993993e-1f));
+    Result = CC_MATH_ARRAY_F32(Madd)(Result, x, CC_MATH_ARRAY_F32(Fill)(3.3333331174e-1f));
+    Result = CC_MATH_ARRAY_F32(Mul)(CC_MATH_ARRAY_F32(Mul)(Result, x), z);
+    
+    // log(2) split into a high part (exact when multiplied by e) and a low part
+    Result = CC_MATH_ARRAY_F32(Madd)(e, CC_MATH_ARRAY_F32(Fill)(-2.12194440e-4f), Result);
+    Result = CC_MATH_ARRAY_F32(Sub)(Result, CC_MATH_ARRAY_F32(Mul)(z, CC_MATH_ARRAY_F32(Fill)(0.5f)));
+    
+    return CC_MATH_ARRAY_F32(Madd)(e, CC_MATH_ARRAY_F32(Fill)(0.693359375f), CC_MATH_ARRAY_F32(Add)(x, Result));
+}
+
+static CC_FORCE_INLINE CCMathArrayMask CCMathArrayLogValid(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_U32(And)(CC_MATH_ARRAY_F32(MaskCompareGreaterThanEqual)(a, CC_MATH_ARRAY_F32(Fill)(FLT_MIN)), CC_MATH_ARRAY_F32(MaskCompareLessThanEqual)(a, CC_MATH_ARRAY_F32(Fill)(FLT_MAX)));
+}
+
+#pragma mark Fast Kernels
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArraySinFast(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32(Sin)(a);
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayCosFast(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32(Cos)(a);
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayExpFast(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32(Exp)(a);
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayLogFast(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32(Log)(a);
+}
+
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayPowFast(const CCMathArraySimd a, const CCMathArraySimd b)
+{
+    return CC_MATH_ARRAY_F32(Pow)(a, b);
+}
+#endif
+
+#pragma mark - Scalar
+
+static float CCMathArraySinScalar(const float a, const float b)
+{
+    return sinf(a);
+}
+
+static float CCMathArrayCosScalar(const float a, const float b)
+{
+    return cosf(a);
+}
+
+static float CCMathArrayExpScalar(const float a, const float b)
+{
+    return expf(a);
+}
+
+static float CCMathArrayLogScalar(const float a, const float b)
+{
+    return logf(a);
+}
+
+static float CCMathArrayPowScalar(const float a, const float b)
+{
+    return powf(a, b);
+}
+
+#pragma mark - Apply
+
+typedef float (*CCMathArrayScalarFunction)(const float a, const float b);
+typedef void (*CCMathArrayApplyFunction)(const float *a, const float *b, float *Out, size_t Count);
+
+#if CC_MATH_ARRAY_LANES
+typedef CCMathArraySimd (*CCMathArrayKernel)(const CCMathArraySimd a, const CCMathArraySimd b);
+typedef CCMathArrayMask (*CCMathArrayValidFunction)(const CCMathArraySimd a, const CCMathArraySimd b);
+
+/// Compute a vector of elements, any elements the kernel can't handle are replaced by the scalar result.
+static CC_FORCE_INLINE CCMathArraySimd CCMathArrayApplyVector(const CCMathArraySimd a, const CCMathArraySimd b, CCMathArrayKernel Kernel, CCMathArrayValidFunction Valid, CCMathArrayScalarFunction Scalar)
+{
+    CCMathArraySimd Result = Kernel(a, b);
+    
+    if ((Valid) && (CC_MATH_ARRAY_U32(Sum)(CC_MATH_ARRAY_U32(And)(Valid(a, b), CC_MATH_ARRAY_U32(Fill)(1))) != CC_MATH_ARRAY_LANES))
+    {
+        float A[CC_MATH_ARRAY_LANES], B[CC_MATH_ARRAY_LANES], R[CC_MATH_ARRAY_LANES];
+        uint32_t Mask[CC_MATH_ARRAY_LANES];
+        
+        CC_MATH_ARRAY_F32(Store)(A, a);
+        CC_MATH_ARRAY_F32(Store)(B, b);
+        CC_MATH_ARRAY_F32(Store)(R, Result);
+        CC_MATH_ARRAY_U32(Store)(Mask, Valid(a, b));
+        
+        for (size_t Loop = 0; Loop < CC_MATH_ARRAY_LANES; Loop++)
+        {
+            if (!Mask[Loop]) R[Loop] = Scalar(A[Loop], B[Loop]);
+        }
+        
+        Result = CC_MATH_ARRAY_F32(Load)(R);
+    }
+    
+    return Result;
+}
+
+/// Compute a partial vector of less than CC_MATH_ARRAY_LANES elements.
+static CC_FORCE_INLINE void CCMathArrayApplyPartial(const float *a, const float *b, float *Out, size_t Count, CCMathArrayKernel Kernel, CCMathArrayValidFunction Valid, CCMathArrayScalarFunction Scalar)
+{
+    // Padded with a value that is valid for all of the kernels
+    float A[CC_MATH_ARRAY_LANES], B[CC_MATH_ARRAY_LANES], Result[CC_MATH_ARRAY_LANES];
+    
+    for (size_t Loop = 0; Loop < CC_MATH_ARRAY_LANES; Loop++)
+    {
+        A[Loop] = Loop < Count ? a[Loop] : 1.0f;
+        B[Loop] = (b && (Loop < Count)) ? b[Loop] : 1.0f;
+    }
+    
+    CC_MATH_ARRAY_F32(Store)(Result, CCMathArrayApplyVector(CC_MATH_ARRAY_F32(Load)(A), CC_MATH_ARRAY_F32(Load)(B), Kernel, Valid, Scalar));
+    
+    memcpy(Out, Result, sizeof(float) * Count);
+}
+
+static CC_FORCE_INLINE void CCMathArrayApplyKernel(const float *a, const float *b, float *Out, size_t Count, CCMathArrayKernel Kernel, CCMathArrayValidFunction Valid, CCMathArrayScalarFunction Scalar)
+{
+    // Peel off a head so the stores of the main loop are aligned to the vector size
+    size_t Loop = CCMin((((uintptr_t)-(uintptr_t)Out) / sizeof(float)) % CC_MATH_ARRAY_LANES, Count);
+    
+    if (Loop) CCMathArrayApplyPartial(a, b, Out, Loop, Kernel, Valid, Scalar);
+    
+    for ( ; (Loop + CC_MATH_ARRAY_LANES) <= Count; Loop += CC_MATH_ARRAY_LANES)
+    {
+        const CCMathArraySimd A = CC_MATH_ARRAY_F32(Load)(a + Loop);
+        
+        CC_MATH_ARRAY_F32(Store)(Out + Loop, CCMathArrayApplyVector(A, b ? CC_MATH_ARRAY_F32(Load)(b + Loop) : A, Kernel, Valid, Scalar));
+    }
+    
+    if (Loop < Count) CCMathArrayApplyPartial(a + Loop, b ? b + Loop : NULL, Out + Loop, Count - Loop, Kernel, Valid, Scalar);
+}
+
+#define CC_MATH_ARRAY_APPLY_KERNEL(name, kernel, valid, scalar) \
+static void CCMathArrayApply##name(const float *a, const float *b, float *Out, size_t Count) \
+{ \
+    CCMathArrayApplyKernel(a, b, Out, Count, kernel, valid, scalar); \
+}
+
+CC_MATH_ARRAY_APPLY_KERNEL(SinFast, CCMathArraySinFast, NULL, CCMathArraySinScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(CosFast, CCMathArrayCosFast, NULL, CCMathArrayCosScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(ExpFast, CCMathArrayExpFast, NULL, CCMathArrayExpScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(LogFast, CCMathArrayLogFast, NULL, CCMathArrayLogScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(PowFast, CCMathArrayPowFast, NULL, CCMathArrayPowScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(SinBounded, CCMathArraySinBounded, CCMathArraySinCosValid, CCMathArraySinScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(CosBounded, CCMathArrayCosBounded, CCMathArraySinCosValid, CCMathArrayCosScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(ExpBounded, CCMathArrayExpBounded, CCMathArrayExpValid, CCMathArrayExpScalar)
+CC_MATH_ARRAY_APPLY_KERNEL(LogBounded, CCMathArrayLogBounded, CCMathArrayLogValid, CCMathArrayLogScalar)
+
+static void CCMathArrayApplyPowBounded(const float *a, const float *b, float *Out, size_t Count)
+{
+    for (size_t Loop = 0; Loop < Count; Loop++) Out[Loop] = powf(a[Loop], b[Loop]);
+}
+#endif
+
+static void CCMathArrayApply(const float *a, const float *b, float *Out, size_t Count, CCMathAccuracy Accuracy, CCMathArrayFunction Function)
+{
+    CCAssertLog(!Count || (a && Out), "Arrays must not be null");
+    CCAssertLog(!Count || (Function != CCMathArrayFunctionPow) || b, "Exponents must not be null");
+    CCAssertLog(Accuracy <= CCMathAccuracyBounded, "Accuracy must be a valid tier");
+    
+#if CC_MATH_ARRAY_LANES
+    static const CCMathArrayApplyFunction Apply[2][5] = {
+        [CCMathAccuracyFast] = {
+            [CCMathArrayFunctionSin] = CCMathArrayApplySinFast,
+            [CCMathArrayFunctionCos] = CCMathArrayApplyCosFast,
+            [CCMathArrayFunctionExp] = CCMathArrayApplyExpFast,
+            [CCMathArrayFunctionLog] = CCMathArrayApplyLogFast,
+            [CCMathArrayFunctionPow] = CCMathArrayApplyPowFast
+        },
+        [CCMathAccuracyBounded] = {
+            [CCMathArrayFunctionSin] = CCMathArrayApplySinBounded,
+            [CCMathArrayFunctionCos] = CCMathArrayApplyCosBounded,
+            [CCMathArrayFunctionExp] = CCMathArrayApplyExpBounded,
+            [CCMathArrayFunctionLog] = CCMathArrayApplyLogBounded,
+            [CCMathArrayFunctionPow] = CCMathArrayApplyPowBounded
+        }
+    };
+    
+    Apply[Accuracy][Function](a, b, Out, Count);
+#else
+    static const CCMathArrayScalarFunction Scalars[] = {
+        [CCMathArrayFunctionSin] = CCMathArraySinScalar,
+        [CCMathArrayFunctionCos] = CCMathArrayCosScalar,
+        [CCMathArrayFunctionExp] = CCMathArrayExpScalar,
+        [CCMathArrayFunctionLog] = CCMathArrayLogScalar,
+        [CCMathArrayFunctionPow] = CCMathArrayPowScalar
+    };
+    
+    const CCMathArrayScalarFunction Scalar = Scalars[Function];
+    
+    for (size_t Loop = 0; Loop < Count; Loop++) Out[Loop] = Scalar(a[Loop], b ? b[Loop] : 0.0f);
+#endif
+}
+
+#pragma mark - Trigonometry
+
+void CCMathSinArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy)
+{
+    CCMathArrayApply(In, NULL, Out, Count, Accuracy, CCMathArrayFunctionSin);
+}
+
+void CCMathCosArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy)
+{
+    CCMathArrayApply(In, NULL, Out, Count, Accuracy, CCMathArrayFunctionCos);
+}
+
+#pragma mark - Exponent
+
+void CCMathExpArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy)
+{
+    CCMathArrayApply(In, NULL, Out, Count, Accuracy, CCMathArrayFunctionExp);
+}
+
+void CCMathLogArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy)
+{
+    CCMathArrayApply(In, NULL, Out, Count, Accuracy, CCMathArrayFunctionLog);
+}
+
+void CCMathPowArray(const float *Base, const float *Exponent, float *Out, size_t Count, CCMathAccuracy Accuracy)
+{
+    CCMathArrayApply(Base, Exponent, Out, Count, Accuracy, CCMathArrayFunctionPow);
+}
+
+#pragma mark - Parallel
+
+typedef struct {
+    CCMathArrayFunction function;
+    CCMathAccuracy accuracy;
+    const float *in;
+    const float *in2;
+    float *out;
+    size_t count;
+} CCMathArrayParallelTask;
+
+static void CCMathArrayParallelExecute(const CCMathArrayParallelTask *Task, void *Out)
+{
+    CCMathArrayApply(Task->in, Task->in2, Task->out, Task->count, Task->accuracy, Task->function);
+}
+
+void CCMathArrayParallel(CCMathArrayFunction Function, const float *In, const float *In2, float *Out, size_t Count, CCMathAccuracy Accuracy, size_t ChunkElements, CCTaskQueue Queue)
+{
+    CCAssertLog(ChunkElements, "Chunk elements must not be 0");
+    
+    if (Count <= ChunkElements)
+    {
+        CCMathArrayApply(In, In2, Out, Count, Accuracy, Function);
+        return;
+    }
+    
+    if (!Queue) Queue = CCTaskQueueDefault();
+    
+    const size_t ChunkCount = (Count + ChunkElements - 1) / ChunkElements;
+    CCTask *Tasks = CCMalloc(CC_STD_ALLOCATOR, sizeof(CCTask) * ChunkCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    if (!Tasks)
+    {
+        CC_LOG_ERROR("Failed to allocate tasks for parallel array math, computing on the calling thread");
+        CCMathArrayApply(In, In2, Out, Count, Accuracy, Function);
+        return;
+    }
+    
+    for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+    {
+        const size_t Start = Loop * ChunkElements;
+        const CCMathArrayParallelTask Input = {
+            .function = Function,
+            .accuracy = Accuracy,
+            .in = In + Start,
+            .in2 = In2 ? In2 + Start : NULL,
+            .out = Out + Start,
+            .count = CCMin(ChunkElements, Count - Start)
+        };
+        
+        Tasks[Loop] = CCTaskCreate(CC_STD_ALLOCATOR, (CCTaskFunction)CCMathArrayParallelExecute, 0, NULL, sizeof(CCMathArrayParallelTask), &Input, NULL);
+        
+        if (Tasks[Loop]) CCTaskQueuePush(Queue, CCRetain(Tasks[Loop]));
+        else CCMathArrayParallelExecute(&Input, NULL);
+    }
+    
+    for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+    {
+        if (!Tasks[Loop]) continue;
+        
+        while (!CCTaskIsFinished(Tasks[Loop]))
+        {
+            CCTask Task = CCTaskQueuePop(Queue);
+            
+            if (Task)
+            {
+                CCTaskRun(Task);
+                CCTaskDestroy(Task);
+            }
+            
+            else CC_SPIN_WAIT();
+        }
+        
+        CCTaskDestroy(Tasks[Loop]);
+    }
+    
+    CCFree(Tasks);
+}
@@ -0,0 +1,144 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_MathArray_h
+#define CommonC_MathArray_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Extensions.h>
+#include <CommonC/TaskQueue.h>
+
+/*!
+ * @brief The accuracy of the array math functions.
+ */
+typedef CC_ENUM(CCMathAccuracy, uint8_t) {
+    /// Use the fast approximations of the @b CCSimd math functions.
+    CCMathAccuracyFast,
+    /// Bound the error to a few ULP of the correctly rounded result.
+    CCMathAccuracyBounded
+};
+
+/*!
+ * @brief The array math function.
+ */
+typedef CC_ENUM(CCMathArrayFunction, uint8_t) {
+    CCMathArrayFunctionSin,
+    CCMathArrayFunctionCos,
+    CCMathArrayFunctionExp,
+    CCMathArrayFunctionLog,
+    CCMathArrayFunctionPow
+};
+
+/*!
+ * @brief The default number of elements per chunk for @b CCMathArrayParallel.
+ */
+#define CC_MATH_ARRAY_PARALLEL_DEFAULT_ELEMENTS 65536
+
+/*
+ Each function applies the operation to @b Count elements of the input arrays, writing the results to @b Out. The
+ arrays do not need to be aligned, and @b Out may be the same as one of the inputs but must not otherwise overlap them.
+ 
+ The result of an element only depends on its inputs, so is the same regardless of its position in the array, how
+ many elements are processed at once, or how the work is split up by @b CCMathArrayParallel.
+ 
+ With @b CCMathAccuracyBounded the elements the vector kernels can't handle precisely (huge angles, results that
+ overflow or are subnormal, non-finite values) are computed by the standard library instead.
+ */
+
+#pragma mark - Trigonometry
+
+/*!
+ * @brief Compute the sine of each radian element in the array.
+ * @param In The radians.
+ * @param Out The array to store the results.
+ * @param Count The number of elements.
+ * @param Accuracy The accuracy of the results.
+ */
+void CCMathSinArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy);
+
+/*!
+ * @brief Compute the cosine of each radian element in the array.
+ * @param In The radians.
+ * @param Out The array to store the results.
+ * @param Count The number of elements.
+ * @param Accuracy The accuracy of the results.
+ */
+void CCMathCosArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy);
+
+#pragma mark - Exponent
+
+/*!
+ * @brief Computes e^n (Euler's number 2.7182818..) for each element in the array.
+ * @param In The exponents.
+ * @param Out The array to store the results.
+ * @param Count The number of elements.
+ * @param Accuracy The accuracy of the results.
+ */
+void CCMathExpArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy);
+
+/*!
+ * @brief Computes the base e logarithm of each element in the array.
+ * @param In The values.
+ * @param Out The array to store the results.
+ * @param Count The number of elements.
+ * @param Accuracy The accuracy of the results.
+ */
+void CCMathLogArray(const float *In, float *Out, size_t Count, CCMathAccuracy Accuracy);
+
+/*!
+ * @brief Compute each element of @b Base raised by the corresponding element of @b Exponent.
+ * @description @b CCMathAccuracyBounded is computed per element by the standard library, as deriving it from the
+ *              single precision log and exp kernels would lose too much precision for large results.
+ *
+ * @param Base The values to be raised.
+ * @param Exponent The exponents.
+ * @param Out The array to store the results.
+ * @param Count The number of elements.
+ * @param Accuracy The accuracy of the results.
+ */
+void CCMathPowArray(const float *Base, const float *Exponent, float *Out, size_t Count, CCMathAccuracy Accuracy);
+
+#pragma mark - Parallel
+
+/*!
+ * @brief Apply an array math function over independent chunks of the arrays.
+ * @description Each chunk is computed as a separate task on the task queue. The calling thread will also compute
+ *              chunks until they have all completed, so will make progress regardless of whether there are any other
+ *              threads servicing the queue. Arrays that fit in a single chunk are computed on the calling thread.
+ *
+ * @param Function The function to apply.
+ * @param In The input array.
+ * @param In2 The second input array for functions that take two (the exponents of @b CCMathArrayFunctionPow),
+ *        otherwise NULL.
+ *
+ * @param Out The array to store the results.
+ * @param Count The number of elements.
+ * @param Accuracy The accuracy of the results.
+ * @param ChunkElements The number of elements per chunk. Use @b CC_MATH_ARRAY_PARALLEL_DEFAULT_ELEMENTS for the default.
+ * @param Queue The task queue to use, or NULL to use the default task queue.
+ */
+void CCMathArrayParallel(CCMathArrayFunction Function, const float *In, const float *In2, float *Out, size_t Count, CCMathAccuracy Accuracy, size_t ChunkElements, CCTaskQueue Queue);
+
+#endif
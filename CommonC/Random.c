@@ -24,8 +24,17 @@
  */
 
 #include "Random.h"
+#include "Assertion.h"
+#include "HardwareInfo.h"
+#include <string.h>
+#include <stdatomic.h>
 
-CCRandomState_xorshift CCRandomGlobalState_xorshift = 1;
+#if (CC_HARDWARE_ARCH_X86 || CC_HARDWARE_ARCH_X86_64) && __has_attribute(target)
+#include <immintrin.h>
+#define CC_RANDOM_X86_DISPATCH 1
+#endif
+
+_Thread_local CCRandomState_xorshift CCRandomGlobalState_xorshift = 0;
 
 uint32_t CCRandom_xorshift(CCRandomState_xorshift *State)
 {
@@ -46,7 +55,7 @@ void CCRandomSeed_xorshift(CCRandomState_xorshift *State, uint32_t Seed)
     *State = Seed ? Seed : 1;
 }
 
-CCRandomState_xorwow CCRandomGlobalState_xorwow = { 270369, 67634689, 2647435461, 307599695, 2398689233 };
+_Thread_local CCRandomState_xorwow CCRandomGlobalState_xorwow = { 0, 0, 0, 0, 0 };
 
 uint32_t CCRandom_xorwow(CCRandomState_xorwow *State)
 {
@@ -84,3 +93,671 @@ void CCRandomSeed_xorwow(CCRandomState_xorwow *State, uint32_t Seed)
         .counter = CCRandom_xorshift(&Xorshift)
     };
 }
+
+#pragma mark Thread Seeding
+
+static _Atomic(uint32_t) CCRandomThreadIndex = 0;
+
+/*
+ Each thread takes the next index, which is mapped to its seed with a bijective mix (lowbias32 by Chris Wellons),
+ so no two threads receive the same seed, and neighbouring threads don't receive similar seeds. The mix maps 0 to
+ 0, so the seeds are offset to give the first thread the seed 1 (the same state as seeding with 0).
+ */
+static uint32_t CCRandomThreadSeed(void)
+{
+    uint32_t Seed;
+    do {
+        uint32_t x = atomic_fetch_add_explicit(&CCRandomThreadIndex, 1, memory_order_relaxed);
+        x ^= x >> 16;
+        x *= 0x7feb352d;
+        x ^= x >> 15;
+        x *= 0x846ca68b;
+        x ^= x >> 16;
+        
+        Seed = x ^ 1;
+    } while (!Seed); // 0 would collide with the first thread
+    
+    return Seed;
+}
+
+void CCRandomSeedThread_xorshift(CCRandomState_xorshift *State)
+{
+    CCRandomSeed_xorshift(State, CCRandomThreadSeed());
+}
+
+void CCRandomSeedThread_xorwow(CCRandomState_xorwow *State)
+{
+    CCRandomSeed_xorwow(State, CCRandomThreadSeed());
+}
+
+#pragma mark -
+
+/// Converts the upper 24 bits of a random value to a float between 0.0f - 1.0f (exclusive).
+static CC_FORCE_INLINE float CCRandomToFloat(uint32_t Value)
+{
+    return (float)(Value >> 8) * 0x1.0p-24f;
+}
+
+#define CC_RANDOM_FILL_FLOAT_CHUNK 256
+
+#define CC_RANDOM_FILL_FLOAT(fill, state, values, count) \
+{ \
+    uint32_t Chunk_[CC_RANDOM_FILL_FLOAT_CHUNK]; \
+    for (size_t Index_ = 0; Index_ < count; Index_ += CC_RANDOM_FILL_FLOAT_CHUNK) \
+    { \
+        const size_t Size_ = CCMin(count - Index_, CC_RANDOM_FILL_FLOAT_CHUNK); \
+        fill(state, Chunk_, Size_); \
+        for (size_t Loop_ = 0; Loop_ < Size_; Loop_++) values[Index_ + Loop_] = CCRandomToFloat(Chunk_[Loop_]); \
+    } \
+}
+
+static CC_FORCE_INLINE uint64_t CCRandomRotateLeft64(uint64_t x, int n)
+{
+    return (x << n) | (x >> (64 - n));
+}
+
+static uint64_t CCRandomSplitMix64(uint64_t *State)
+{
+    uint64_t z = (*State += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    
+    return z ^ (z >> 31);
+}
+
+#pragma mark xoshiro256**
+
+uint64_t CCRandom_xoshiro256(CCRandomState_xoshiro256 *State)
+{
+    uint64_t *s = State->s;
+    const uint64_t Result = CCRandomRotateLeft64(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+    
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = CCRandomRotateLeft64(s[3], 45);
+    
+    return Result;
+}
+
+uint64_t CCRandomMax_xoshiro256(void)
+{
+    return UINT64_MAX;
+}
+
+void CCRandomSeed_xoshiro256(CCRandomState_xoshiro256 *State, uint64_t Seed)
+{
+    for (size_t Loop = 0; Loop < 4; Loop++) State->s[Loop] = CCRandomSplitMix64(&Seed);
+}
+
+static void CCRandomJumpPolynomial_xoshiro256(CCRandomState_xoshiro256 *State, const uint64_t Polynomial[4])
+{
+    uint64_t s[4] = { 0, 0, 0, 0 };
+    
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        for (int Bit = 0; Bit < 64; Bit++)
+        {
+            if (Polynomial[Loop] & ((uint64_t)1 << Bit))
+            {
+                s[0] ^= State->s[0];
+                s[1] ^= State->s[1];
+                s[2] ^= State->s[2];
+                s[3] ^= State->s[3];
+            }
+            
+            CCRandom_xoshiro256(State);
+        }
+    }
+    
+    memcpy(State->s, s, sizeof(s));
+}
+
+void CCRandomJump_xoshiro256(CCRandomState_xoshiro256 *State)
+{
+    CCRandomJumpPolynomial_xoshiro256(State, (const uint64_t[4]){ 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c });
+}
+
+void CCRandomLongJump_xoshiro256(CCRandomState_xoshiro256 *State)
+{
+    CCRandomJumpPolynomial_xoshiro256(State, (const uint64_t[4]){ 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 });
+}
+
+void CCRandomFill_xoshiro256(CCRandomState_xoshiro256 *State, uint32_t *Values, size_t Count)
+{
+    CCAssertLog(State, "State must not be null");
+    CCAssertLog(Values || !Count, "Values must not be null");
+    
+    // Work on a local copy so the state can stay in registers
+    CCRandomState_xoshiro256 Local = *State;
+    
+    size_t Loop = 0;
+    for (const size_t Pairs = Count & ~(size_t)1; Loop < Pairs; Loop += 2)
+    {
+        const uint64_t Value = CCRandom_xoshiro256(&Local);
+        Values[Loop] = (uint32_t)Value;
+        Values[Loop + 1] = (uint32_t)(Value >> 32);
+    }
+    
+    if (Loop < Count) Values[Loop] = (uint32_t)CCRandom_xoshiro256(&Local);
+    
+    *State = Local;
+}
+
+void CCRandomFillf_xoshiro256(CCRandomState_xoshiro256 *State, float *Values, size_t Count)
+{
+    CCAssertLog(Values || !Count, "Values must not be null");
+    
+    CC_RANDOM_FILL_FLOAT(CCRandomFill_xoshiro256, State, Values, Count);
+}
+
+#pragma mark pcg64
+
+#define CC_RANDOM_PCG64_MULTIPLIER (((unsigned _BitInt(128))0x2360ed051fc65da4 << 64) | 0x4385df649fccf645)
+
+uint64_t CCRandom_pcg64(CCRandomState_pcg64 *State)
+{
+    State->state = (State->state * CC_RANDOM_PCG64_MULTIPLIER) + State->increment;
+    
+    const uint64_t Value = (uint64_t)(State->state >> 64) ^ (uint64_t)State->state;
+    const unsigned int Rotation = (unsigned int)(State->state >> 122);
+    
+    return (Value >> Rotation) | (Value << ((64 - Rotation) & 63));
+}
+
+uint64_t CCRandomMax_pcg64(void)
+{
+    return UINT64_MAX;
+}
+
+void CCRandomSeed_pcg64(CCRandomState_pcg64 *State, uint64_t Seed)
+{
+    CCRandomSeedStream_pcg64(State, Seed, 0);
+}
+
+void CCRandomSeedStream_pcg64(CCRandomState_pcg64 *State, uint64_t Seed, uint64_t Stream)
+{
+    State->state = 0;
+    State->increment = ((unsigned _BitInt(128))Stream << 1) | 1;
+    CCRandom_pcg64(State);
+    State->state += Seed;
+    CCRandom_pcg64(State);
+}
+
+/*
+ Jumps ahead in the LCG by computing the combined multiplier and increment of Delta steps, using the method from
+ "Random Number Generation with Arbitrary Strides" by F. Brown.
+ */
+static void CCRandomAdvance128_pcg64(CCRandomState_pcg64 *State, unsigned _BitInt(128) Delta)
+{
+    unsigned _BitInt(128) Multiplier = CC_RANDOM_PCG64_MULTIPLIER, Increment = State->increment;
+    unsigned _BitInt(128) AccumulatedMultiplier = 1, AccumulatedIncrement = 0;
+    
+    for ( ; Delta; Delta >>= 1)
+    {
+        if (Delta & 1)
+        {
+            AccumulatedMultiplier *= Multiplier;
+            AccumulatedIncrement = (AccumulatedIncrement * Multiplier) + Increment;
+        }
+        
+        Increment *= Multiplier + 1;
+        Multiplier *= Multiplier;
+    }
+    
+    State->state = (AccumulatedMultiplier * State->state) + AccumulatedIncrement;
+}
+
+void CCRandomAdvance_pcg64(CCRandomState_pcg64 *State, uint64_t Delta)
+{
+    CCRandomAdvance128_pcg64(State, Delta);
+}
+
+void CCRandomJump_pcg64(CCRandomState_pcg64 *State)
+{
+    CCRandomAdvance128_pcg64(State, (unsigned _BitInt(128))1 << 64);
+}
+
+void CCRandomLongJump_pcg64(CCRandomState_pcg64 *State)
+{
+    CCRandomAdvance128_pcg64(State, (unsigned _BitInt(128))1 << 96);
+}
+
+void CCRandomFill_pcg64(CCRandomState_pcg64 *State, uint32_t *Values, size_t Count)
+{
+    CCAssertLog(State, "State must not be null");
+    CCAssertLog(Values || !Count, "Values must not be null");
+    
+    CCRandomState_pcg64 Local = *State;
+    
+    size_t Loop = 0;
+    for (const size_t Pairs = Count & ~(size_t)1; Loop < Pairs; Loop += 2)
+    {
+        const uint64_t Value = CCRandom_pcg64(&Local);
+        Values[Loop] = (uint32_t)Value;
+        Values[Loop + 1] = (uint32_t)(Value >> 32);
+    }
+    
+    if (Loop < Count) Values[Loop] = (uint32_t)CCRandom_pcg64(&Local);
+    
+    *State = Local;
+}
+
+void CCRandomFillf_pcg64(CCRandomState_pcg64 *State, float *Values, size_t Count)
+{
+    CCAssertLog(Values || !Count, "Values must not be null");
+    
+    CC_RANDOM_FILL_FLOAT(CCRandomFill_pcg64, State, Values, Count);
+}
+
+#pragma mark philox
+
+#define CC_RANDOM_PHILOX_M0 UINT32_C(0xD2511F53)
+#define CC_RANDOM_PHILOX_M1 UINT32_C(0xCD9E8D57)
+#define CC_RANDOM_PHILOX_W0 UINT32_C(0x9E3779B9)
+#define CC_RANDOM_PHILOX_W1 UINT32_C(0xBB67AE85)
+#define CC_RANDOM_PHILOX_ROUNDS 10
+
+void CCRandomBlock_philox(const uint32_t Counter[4], const uint32_t Key[2], uint32_t Result[4])
+{
+    CCAssertLog(Counter, "Counter must not be null");
+    CCAssertLog(Key, "Key must not be null");
+    CCAssertLog(Result, "Result must not be null");
+    
+    uint32_t c0 = Counter[0], c1 = Counter[1], c2 = Counter[2], c3 = Counter[3];
+    uint32_t k0 = Key[0], k1 = Key[1];
+    
+    for (int Round = 0; Round < CC_RANDOM_PHILOX_ROUNDS; Round++)
+    {
+        const uint64_t p0 = (uint64_t)CC_RANDOM_PHILOX_M0 * c0;
+        const uint64_t p1 = (uint64_t)CC_RANDOM_PHILOX_M1 * c2;
+        
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        
+        k0 += CC_RANDOM_PHILOX_W0;
+        k1 += CC_RANDOM_PHILOX_W1;
+    }
+    
+    Result[0] = c0;
+    Result[1] = c1;
+    Result[2] = c2;
+    Result[3] = c3;
+}
+
+static CC_FORCE_INLINE void CCRandomIncrementCounter_philox(uint32_t Counter[4], size_t Word)
+{
+    for ( ; (Word < 4) && (++Counter[Word] == 0); Word++);
+}
+
+uint32_t CCRandom_philox(CCRandomState_philox *State)
+{
+    if (State->index >= 4)
+    {
+        CCRandomBlock_philox(State->counter, State->key, State->output);
+        CCRandomIncrementCounter_philox(State->counter, 0);
+        State->index = 0;
+    }
+    
+    return State->output[State->index++];
+}
+
+uint32_t CCRandomMax_philox(void)
+{
+    return UINT32_MAX;
+}
+
+void CCRandomSeed_philox(CCRandomState_philox *State, uint64_t Seed)
+{
+    *State = (CCRandomState_philox){
+        .key = { (uint32_t)Seed, (uint32_t)(Seed >> 32) },
+        .index = 4
+    };
+}
+
+void CCRandomJump_philox(CCRandomState_philox *State)
+{
+    CCRandomIncrementCounter_philox(State->counter, 2);
+    State->index = 4;
+}
+
+void CCRandomLongJump_philox(CCRandomState_philox *State)
+{
+    CCRandomIncrementCounter_philox(State->counter, 3);
+    State->index = 4;
+}
+
+/// Generates the remaining blocks one at a time.
+static CC_FORCE_INLINE void CCRandomBlocksTail_philox(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks)
+{
+    for (size_t Loop = 0; Loop < Blocks; Loop++, Values += 4)
+    {
+        CCRandomBlock_philox(Counter, Key, Values);
+        CCRandomIncrementCounter_philox(Counter, 0);
+    }
+}
+
+#if !(CC_RANDOM_X86_DISPATCH && CC_HARDWARE_VECTOR_SUPPORT_SSE2)
+/*
+ Number of blocks the portable kernel generates together. The rounds are written over arrays of lanes so the
+ multiplies of different blocks are independent of each other, hiding their latency.
+ */
+#define CC_RANDOM_PHILOX_LANES 8
+
+static void CCRandomBlocksGeneric_philox(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks)
+{
+    for ( ; Blocks >= CC_RANDOM_PHILOX_LANES; Blocks -= CC_RANDOM_PHILOX_LANES)
+    {
+        uint32_t c0[CC_RANDOM_PHILOX_LANES], c1[CC_RANDOM_PHILOX_LANES], c2[CC_RANDOM_PHILOX_LANES], c3[CC_RANDOM_PHILOX_LANES];
+        
+        for (size_t Lane = 0; Lane < CC_RANDOM_PHILOX_LANES; Lane++)
+        {
+            c0[Lane] = Counter[0];
+            c1[Lane] = Counter[1];
+            c2[Lane] = Counter[2];
+            c3[Lane] = Counter[3];
+            
+            CCRandomIncrementCounter_philox(Counter, 0);
+        }
+        
+        uint32_t k0 = Key[0], k1 = Key[1];
+        
+        for (int Round = 0; Round < CC_RANDOM_PHILOX_ROUNDS; Round++)
+        {
+            for (size_t Lane = 0; Lane < CC_RANDOM_PHILOX_LANES; Lane++)
+            {
+                const uint64_t p0 = (uint64_t)CC_RANDOM_PHILOX_M0 * c0[Lane];
+                const uint64_t p1 = (uint64_t)CC_RANDOM_PHILOX_M1 * c2[Lane];
+                
+                c0[Lane] = (uint32_t)(p1 >> 32) ^ c1[Lane] ^ k0;
+                c2[Lane] = (uint32_t)(p0 >> 32) ^ c3[Lane] ^ k1;
+                c1[Lane] = (uint32_t)p1;
+                c3[Lane] = (uint32_t)p0;
+            }
+            
+            k0 += CC_RANDOM_PHILOX_W0;
+            k1 += CC_RANDOM_PHILOX_W1;
+        }
+        
+        for (size_t Lane = 0; Lane < CC_RANDOM_PHILOX_LANES; Lane++, Values += 4)
+        {
+            Values[0] = c0[Lane];
+            Values[1] = c1[Lane];
+            Values[2] = c2[Lane];
+            Values[3] = c3[Lane];
+        }
+    }
+    
+    CCRandomBlocksTail_philox(Counter, Key, Values, Blocks);
+}
+#endif
+
+#if CC_RANDOM_X86_DISPATCH
+/*
+ The SIMD kernels hold one word of 4 (or 8) different blocks per vector. The 32x32 -> 64-bit multiplies are done
+ separately for the even and odd lanes, and then recombined into vectors of the low and high halves.
+ */
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE2
+static CC_FORCE_INLINE void CCRandomMultiplySSE2_philox(__m128i a, __m128i Multiplier, __m128i *Low, __m128i *High)
+{
+    const __m128i Mask = _mm_set1_epi64x(UINT32_MAX);
+    const __m128i Even = _mm_mul_epu32(a, Multiplier), Odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), Multiplier);
+    
+    *Low = _mm_or_si128(_mm_and_si128(Even, Mask), _mm_slli_epi64(Odd, 32));
+    *High = _mm_or_si128(_mm_srli_epi64(Even, 32), _mm_andnot_si128(Mask, Odd));
+}
+
+static void CCRandomBlocksSSE2_philox(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks)
+{
+    const __m128i M0 = _mm_set1_epi32((int32_t)CC_RANDOM_PHILOX_M0), M1 = _mm_set1_epi32((int32_t)CC_RANDOM_PHILOX_M1);
+    
+    for ( ; Blocks >= 4; Blocks -= 4, Values += 16)
+    {
+        __m128i c0, c1, c2, c3;
+        if (Counter[0] <= (UINT32_MAX - 3))
+        {
+            c0 = _mm_add_epi32(_mm_set1_epi32((int32_t)Counter[0]), _mm_setr_epi32(0, 1, 2, 3));
+            c1 = _mm_set1_epi32((int32_t)Counter[1]);
+            c2 = _mm_set1_epi32((int32_t)Counter[2]);
+            c3 = _mm_set1_epi32((int32_t)Counter[3]);
+            
+            if ((Counter[0] += 4) == 0) CCRandomIncrementCounter_philox(Counter, 1);
+        }
+        
+        else
+        {
+            uint32_t Words[4][4];
+            for (size_t Lane = 0; Lane < 4; Lane++)
+            {
+                for (size_t Word = 0; Word < 4; Word++) Words[Word][Lane] = Counter[Word];
+                
+                CCRandomIncrementCounter_philox(Counter, 0);
+            }
+            
+            c0 = _mm_loadu_si128((const __m128i*)Words[0]);
+            c1 = _mm_loadu_si128((const __m128i*)Words[1]);
+            c2 = _mm_loadu_si128((const __m128i*)Words[2]);
+            c3 = _mm_loadu_si128((const __m128i*)Words[3]);
+        }
+        
+        uint32_t k0 = Key[0], k1 = Key[1];
+        
+        for (int Round = 0; Round < CC_RANDOM_PHILOX_ROUNDS; Round++)
+        {
+            __m128i Low0, High0, Low1, High1;
+            CCRandomMultiplySSE2_philox(c0, M0, &Low0, &High0);
+            CCRandomMultiplySSE2_philox(c2, M1, &Low1, &High1);
+            
+            c0 = _mm_xor_si128(_mm_xor_si128(High1, c1), _mm_set1_epi32((int32_t)k0));
+            c2 = _mm_xor_si128(_mm_xor_si128(High0, c3), _mm_set1_epi32((int32_t)k1));
+            c1 = Low1;
+            c3 = Low0;
+            
+            k0 += CC_RANDOM_PHILOX_W0;
+            k1 += CC_RANDOM_PHILOX_W1;
+        }
+        
+        const __m128i t0 = _mm_unpacklo_epi32(c0, c1), t1 = _mm_unpacklo_epi32(c2, c3);
+        const __m128i t2 = _mm_unpackhi_epi32(c0, c1), t3 = _mm_unpackhi_epi32(c2, c3);
+        
+        _mm_storeu_si128((__m128i*)Values, _mm_unpacklo_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(Values + 4), _mm_unpackhi_epi64(t0, t1));
+        _mm_storeu_si128((__m128i*)(Values + 8), _mm_unpacklo_epi64(t2, t3));
+        _mm_storeu_si128((__m128i*)(Values + 12), _mm_unpackhi_epi64(t2, t3));
+    }
+    
+    CCRandomBlocksTail_philox(Counter, Key, Values, Blocks);
+}
+#endif
+
+static CC_TARGET("avx2") void CCRandomBlocksAVX2_philox(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks)
+{
+    const __m256i Mask = _mm256_set1_epi64x(UINT32_MAX);
+    const __m256i M0 = _mm256_set1_epi32((int32_t)CC_RANDOM_PHILOX_M0), M1 = _mm256_set1_epi32((int32_t)CC_RANDOM_PHILOX_M1);
+    
+    for ( ; Blocks >= 8; Blocks -= 8, Values += 32)
+    {
+        __m256i c0, c1, c2, c3;
+        if (Counter[0] <= (UINT32_MAX - 7))
+        {
+            c0 = _mm256_add_epi32(_mm256_set1_epi32((int32_t)Counter[0]), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            c1 = _mm256_set1_epi32((int32_t)Counter[1]);
+            c2 = _mm256_set1_epi32((int32_t)Counter[2]);
+            c3 = _mm256_set1_epi32((int32_t)Counter[3]);
+            
+            if ((Counter[0] += 8) == 0) CCRandomIncrementCounter_philox(Counter, 1);
+        }
+        
+        else
+        {
+            uint32_t Words[4][8];
+            for (size_t Lane = 0; Lane < 8; Lane++)
+            {
+                for (size_t Word = 0; Word < 4; Word++) Words[Word][Lane] = Counter[Word];
+                
+                CCRandomIncrementCounter_philox(Counter, 0);
+            }
+            
+            c0 = _mm256_loadu_si256((const __m256i*)Words[0]);
+            c1 = _mm256_loadu_si256((const __m256i*)Words[1]);
+            c2 = _mm256_loadu_si256((const __m256i*)Words[2]);
+            c3 = _mm256_loadu_si256((const __m256i*)Words[3]);
+        }
+        
+        uint32_t k0 = Key[0], k1 = Key[1];
+        
+        for (int Round = 0; Round < CC_RANDOM_PHILOX_ROUNDS; Round++)
+        {
+            const __m256i Even0 = _mm256_mul_epu32(c0, M0), Odd0 = _mm256_mul_epu32(_mm256_srli_epi64(c0, 32), M0);
+            const __m256i Even1 = _mm256_mul_epu32(c2, M1), Odd1 = _mm256_mul_epu32(_mm256_srli_epi64(c2, 32), M1);
+            
+            const __m256i High0 = _mm256_or_si256(_mm256_srli_epi64(Even0, 32), _mm256_andnot_si256(Mask, Odd0));
+            const __m256i High1 = _mm256_or_si256(_mm256_srli_epi64(Even1, 32), _mm256_andnot_si256(Mask, Odd1));
+            
+            c0 = _mm256_xor_si256(_mm256_xor_si256(High1, c1), _mm256_set1_epi32((int32_t)k0));
+            c2 = _mm256_xor_si256(_mm256_xor_si256(High0, c3), _mm256_set1_epi32((int32_t)k1));
+            c1 = _mm256_or_si256(_mm256_and_si256(Even1, Mask), _mm256_slli_epi64(Odd1, 32));
+            c3 = _mm256_or_si256(_mm256_and_si256(Even0, Mask), _mm256_slli_epi64(Odd0, 32));
+            
+            k0 += CC_RANDOM_PHILOX_W0;
+            k1 += CC_RANDOM_PHILOX_W1;
+        }
+        
+        // Each 128-bit half is transposed separately, giving blocks (0, 4), (1, 5), (2, 6), (3, 7)
+        const __m256i t0 = _mm256_unpacklo_epi32(c0, c1), t1 = _mm256_unpacklo_epi32(c2, c3);
+        const __m256i t2 = _mm256_unpackhi_epi32(c0, c1), t3 = _mm256_unpackhi_epi32(c2, c3);
+        const __m256i b0 = _mm256_unpacklo_epi64(t0, t1), b1 = _mm256_unpackhi_epi64(t0, t1);
+        const __m256i b2 = _mm256_unpacklo_epi64(t2, t3), b3 = _mm256_unpackhi_epi64(t2, t3);
+        
+        _mm256_storeu_si256((__m256i*)Values, _mm256_permute2x128_si256(b0, b1, 0x20));
+        _mm256_storeu_si256((__m256i*)(Values + 8), _mm256_permute2x128_si256(b2, b3, 0x20));
+        _mm256_storeu_si256((__m256i*)(Values + 16), _mm256_permute2x128_si256(b0, b1, 0x31));
+        _mm256_storeu_si256((__m256i*)(Values + 24), _mm256_permute2x128_si256(b2, b3, 0x31));
+    }
+    
+    CCRandomBlocksTail_philox(Counter, Key, Values, Blocks);
+}
+#endif
+
+static void CCRandomBlocksResolve_philox(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks);
+
+/// Generates consecutive blocks, advancing the counter. Resolved to the best implementation for the CPU on startup (or on first use).
+static _Atomic(void (*)(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks)) CCRandomBlocks_philox = CCRandomBlocksResolve_philox;
+
+CC_CONSTRUCTOR static void CCRandomDispatch_philox(void)
+{
+#if CC_RANDOM_X86_DISPATCH && CC_HARDWARE_VECTOR_SUPPORT_SSE2
+    void (*Blocks)(uint32_t [4], const uint32_t [2], uint32_t *, size_t) = CCRandomBlocksSSE2_philox;
+#else
+    void (*Blocks)(uint32_t [4], const uint32_t [2], uint32_t *, size_t) = CCRandomBlocksGeneric_philox;
+#endif
+    
+#if CC_RANDOM_X86_DISPATCH
+    if (CCHardwareGetFeatures() & CCHardwareFeatureAVX2) Blocks = CCRandomBlocksAVX2_philox;
+#endif
+    
+    atomic_store_explicit(&CCRandomBlocks_philox, Blocks, memory_order_relaxed);
+}
+
+static void CCRandomBlocksResolve_philox(uint32_t Counter[4], const uint32_t Key[2], uint32_t *Values, size_t Blocks)
+{
+    CCRandomDispatch_philox();
+    
+    atomic_load_explicit(&CCRandomBlocks_philox, memory_order_relaxed)(Counter, Key, Values, Blocks);
+}
+
+void CCRandomFill_philox(CCRandomState_philox *State, uint32_t *Values, size_t Count)
+{
+    CCAssertLog(State, "State must not be null");
+    CCAssertLog(Values || !Count, "Values must not be null");
+    
+    size_t Index = 0;
+    
+    // Finish the current block
+    for ( ; (Index < Count) && (State->index < 4); Index++) Values[Index] = State->output[State->index++];
+    
+    const size_t Blocks = (Count - Index) / 4;
+    if (Blocks)
+    {
+        atomic_load_explicit(&CCRandomBlocks_philox, memory_order_relaxed)(State->counter, State->key, Values + Index, Blocks);
+        Index += Blocks * 4;
+    }
+    
+    for ( ; Index < Count; Index++) Values[Index] = CCRandom_philox(State);
+}
+
+void CCRandomFillf_philox(CCRandomState_philox *State, float *Values, size_t Count)
+{
+    CCAssertLog(Values || !Count, "Values must not be null");
+    
+    CC_RANDOM_FILL_FLOAT(CCRandomFill_philox, State, Values, Count);
+}
+
+#pragma mark - Generator
+
+typedef struct CCRandomGeneratorInfo {
+    CCRandomState_xoshiro256 state;
+} CCRandomGeneratorInfo;
+
+CCRandomGenerator CCRandomGeneratorCreate(CCAllocatorType Allocator, uint64_t Seed)
+{
+    CCRandomGenerator Generator = CCMalloc(Allocator, sizeof(CCRandomGeneratorInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Generator) CCRandomSeed_xoshiro256(&Generator->state, Seed);
+    
+    return Generator;
+}
+
+CCRandomGenerator CCRandomGeneratorCreateStream(CCAllocatorType Allocator, CCRandomGenerator Parent)
+{
+    CCAssertLog(Parent, "Parent must not be null");
+    
+    CCRandomGenerator Generator = CCMalloc(Allocator, sizeof(CCRandomGeneratorInfo), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Generator)
+    {
+        *Generator = *Parent;
+        CCRandomJump_xoshiro256(&Parent->state);
+    }
+    
+    return Generator;
+}
+
+void CCRandomGeneratorDestroy(CCRandomGenerator Generator)
+{
+    CCAssertLog(Generator, "Generator must not be null");
+    
+    CCFree(Generator);
+}
+
+void CCRandomGeneratorSeed(CCRandomGenerator Generator, uint64_t Seed)
+{
+    CCAssertLog(Generator, "Generator must not be null");
+    
+    CCRandomSeed_xoshiro256(&Generator->state, Seed);
+}
+
+uint32_t CCRandomGeneratorNext(CCRandomGenerator Generator)
+{
+    CCAssertLog(Generator, "Generator must not be null");
+    
+    return (uint32_t)(CCRandom_xoshiro256(&Generator->state) >> 32);
+}
+
+void CCRandomGeneratorFill(CCRandomGenerator Generator, uint32_t *Values, size_t Count)
+{
+    CCAssertLog(Generator, "Generator must not be null");
+    
+    CCRandomFill_xoshiro256(&Generator->state, Values, Count);
+}
+
+void CCRandomGeneratorFillf(CCRandomGenerator Generator, float *Values, size_t Count)
+{
+    CCAssertLog(Generator, "Generator must not be null");
+    
+    CCRandomFillf_xoshiro256(&Generator->state, Values, Count);
+}
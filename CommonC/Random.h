@@ -33,13 +33,14 @@
 #include <CommonC/DataBuffer.h>
 #include <CommonC/MemoryAllocation.h>
 #include <CommonC/Logging.h>
+#include <string.h>
 
 #if !defined(CC_RANDOM_ARC4) && !defined(CC_RANDOM_STD) && !defined(CC_RANDOM_XORSHIFT) && !defined(CC_RANDOM_XORWOW)
 
 #if CC_PLATFORM_OS_X || CC_PLATFORM_IOS //or BSD
 #define CC_RANDOM_ARC4 1
 #else
-#define CC_RANDOM_STD 1
+#define CC_RANDOM_XORWOW 1
 #endif
 
 #endif
@@ -97,19 +98,253 @@ uint32_t CCRandomMax_xorwow(void);
  */
 void CCRandomSeed_xorwow(CCRandomState_xorwow *State, uint32_t Seed);
 
+#pragma mark xoshiro256**
+
+typedef struct {
+    uint64_t s[4];
+} CCRandomState_xoshiro256;
+
+/*!
+ * @brief Get the next random value using a xoshiro256** PRNG.
+ * @param State The current xoshiro256** state.
+ * @return A random number.
+ */
+uint64_t CCRandom_xoshiro256(CCRandomState_xoshiro256 *State);
+
+/*!
+ * @brief Get the maximum value the xoshiro256** PRNG can generate.
+ * @return The largest possible number.
+ */
+uint64_t CCRandomMax_xoshiro256(void);
+
+/*!
+ * @brief Seed the xoshiro256** PRNG.
+ * @description The state is expanded from the seed using splitmix64.
+ * @param State The xoshiro256** state.
+ * @param Seed The seed value.
+ */
+void CCRandomSeed_xoshiro256(CCRandomState_xoshiro256 *State, uint64_t Seed);
+
+/*!
+ * @brief Advance the xoshiro256** PRNG by 2^128 values.
+ * @description This can be used to create 2^128 non-overlapping streams, e.g. one per thread, by repeatedly
+ *              jumping a copy of the state.
+ *
+ * @param State The xoshiro256** state.
+ */
+void CCRandomJump_xoshiro256(CCRandomState_xoshiro256 *State);
+
+/*!
+ * @brief Advance the xoshiro256** PRNG by 2^192 values.
+ * @description This can be used to create 2^64 starting points, each of which can then be split into further
+ *              streams using @b CCRandomJump_xoshiro256.
+ *
+ * @param State The xoshiro256** state.
+ */
+void CCRandomLongJump_xoshiro256(CCRandomState_xoshiro256 *State);
+
+/*!
+ * @brief Fill an array with random values using a xoshiro256** PRNG.
+ * @description Each 64-bit value produces two 32-bit values (the low half first).
+ * @param State The current xoshiro256** state.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomFill_xoshiro256(CCRandomState_xoshiro256 *State, uint32_t *Values, size_t Count);
+
+/*!
+ * @brief Fill an array with random floats between 0.0f - 1.0f (exclusive) using a xoshiro256** PRNG.
+ * @param State The current xoshiro256** state.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomFillf_xoshiro256(CCRandomState_xoshiro256 *State, float *Values, size_t Count);
+
+#pragma mark pcg64
+
+typedef struct {
+    unsigned _BitInt(128) state;
+    unsigned _BitInt(128) increment;
+} CCRandomState_pcg64;
+
+/*!
+ * @brief Get the next random value using a PCG64 (XSL RR 128/64) PRNG.
+ * @param State The current pcg64 state.
+ * @return A random number.
+ */
+uint64_t CCRandom_pcg64(CCRandomState_pcg64 *State);
+
+/*!
+ * @brief Get the maximum value the pcg64 PRNG can generate.
+ * @return The largest possible number.
+ */
+uint64_t CCRandomMax_pcg64(void);
+
+/*!
+ * @brief Seed the pcg64 PRNG.
+ * @description Uses the first stream, this is equivalent to calling @b CCRandomSeedStream_pcg64 with a stream of 0.
+ * @param State The pcg64 state.
+ * @param Seed The seed value.
+ */
+void CCRandomSeed_pcg64(CCRandomState_pcg64 *State, uint64_t Seed);
+
+/*!
+ * @brief Seed the pcg64 PRNG and select its stream.
+ * @description Different streams produce distinct sequences for the same seed.
+ * @param State The pcg64 state.
+ * @param Seed The seed value.
+ * @param Stream The stream to use.
+ */
+void CCRandomSeedStream_pcg64(CCRandomState_pcg64 *State, uint64_t Seed, uint64_t Stream);
+
+/*!
+ * @brief Advance the pcg64 PRNG by the given number of values.
+ * @description This takes O(log n) time.
+ * @param State The pcg64 state.
+ * @param Delta The number of values to skip.
+ */
+void CCRandomAdvance_pcg64(CCRandomState_pcg64 *State, uint64_t Delta);
+
+/*!
+ * @brief Advance the pcg64 PRNG by 2^64 values.
+ * @param State The pcg64 state.
+ */
+void CCRandomJump_pcg64(CCRandomState_pcg64 *State);
+
+/*!
+ * @brief Advance the pcg64 PRNG by 2^96 values.
+ * @param State The pcg64 state.
+ */
+void CCRandomLongJump_pcg64(CCRandomState_pcg64 *State);
+
+/*!
+ * @brief Fill an array with random values using a pcg64 PRNG.
+ * @description Each 64-bit value produces two 32-bit values (the low half first).
+ * @param State The current pcg64 state.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomFill_pcg64(CCRandomState_pcg64 *State, uint32_t *Values, size_t Count);
+
+/*!
+ * @brief Fill an array with random floats between 0.0f - 1.0f (exclusive) using a pcg64 PRNG.
+ * @param State The current pcg64 state.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomFillf_pcg64(CCRandomState_pcg64 *State, float *Values, size_t Count);
+
+#pragma mark philox
+
+typedef struct {
+    uint32_t counter[4];
+    uint32_t key[2];
+    uint32_t output[4];
+    uint32_t index;
+} CCRandomState_philox;
+
+/*!
+ * @brief Generate the block of random values for a counter using Philox4x32-10.
+ * @description As the generator is counter-based, any block of the sequence can be generated directly.
+ * @param Counter The 128-bit counter.
+ * @param Key The 64-bit key.
+ * @param Result The 4 random values.
+ */
+void CCRandomBlock_philox(const uint32_t Counter[4], const uint32_t Key[2], uint32_t Result[4]);
+
+/*!
+ * @brief Get the next random value using a Philox4x32-10 PRNG.
+ * @param State The current philox state.
+ * @return A random number.
+ */
+uint32_t CCRandom_philox(CCRandomState_philox *State);
+
+/*!
+ * @brief Get the maximum value the philox PRNG can generate.
+ * @return The largest possible number.
+ */
+uint32_t CCRandomMax_philox(void);
+
+/*!
+ * @brief Seed the philox PRNG.
+ * @description The seed is used as the key, and the counter is reset.
+ * @param State The philox state.
+ * @param Seed The seed value.
+ */
+void CCRandomSeed_philox(CCRandomState_philox *State, uint64_t Seed);
+
+/*!
+ * @brief Advance the philox PRNG by 2^64 blocks (2^66 values).
+ * @description Any values remaining from the current block are discarded.
+ * @param State The philox state.
+ */
+void CCRandomJump_philox(CCRandomState_philox *State);
+
+/*!
+ * @brief Advance the philox PRNG by 2^96 blocks (2^98 values).
+ * @description Any values remaining from the current block are discarded.
+ * @param State The philox state.
+ */
+void CCRandomLongJump_philox(CCRandomState_philox *State);
+
+/*!
+ * @brief Fill an array with random values using a philox PRNG.
+ * @description Produces the same values as repeatedly calling @b CCRandom_philox, but generates multiple blocks
+ *              at a time.
+ *
+ * @param State The current philox state.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomFill_philox(CCRandomState_philox *State, uint32_t *Values, size_t Count);
+
+/*!
+ * @brief Fill an array with random floats between 0.0f - 1.0f (exclusive) using a philox PRNG.
+ * @param State The current philox state.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomFillf_philox(CCRandomState_philox *State, float *Values, size_t Count);
+
 #pragma mark - Global PRNG
 
-extern CCRandomState_xorshift CCRandomGlobalState_xorshift;
-extern CCRandomState_xorwow CCRandomGlobalState_xorwow;
+/*
+ The global states are thread local, so threads never contend on them or produce correlated values. They start
+ out zeroed (unseeded), and are seeded with a value unique to the thread on first use.
+ */
+extern _Thread_local CCRandomState_xorshift CCRandomGlobalState_xorshift;
+extern _Thread_local CCRandomState_xorwow CCRandomGlobalState_xorwow;
+
+/*!
+ * @brief Seed a xorshift state with a seed unique to the calling thread.
+ * @description The first thread to be seeded receives the same state as @b CCRandomSeed_xorshift with a seed of 0,
+ *              so single threaded programs remain reproducible.
+ *
+ * @param State The xorshift state.
+ */
+void CCRandomSeedThread_xorshift(CCRandomState_xorshift *State);
+
+/*!
+ * @brief Seed a xorwow state with a seed unique to the calling thread.
+ * @description The first thread to be seeded receives the same state as @b CCRandomSeed_xorwow with a seed of 0,
+ *              so single threaded programs remain reproducible.
+ *
+ * @param State The xorwow state.
+ */
+void CCRandomSeedThread_xorwow(CCRandomState_xorwow *State);
 
 #if CC_RANDOM_XORSHIFT
 #define CCRandomState CCRandomGlobalState_xorshift
 #define CC_RANDOM_SEED CCRandomSeed_xorshift
+#define CC_RANDOM_SEED_THREAD CCRandomSeedThread_xorshift
+#define CC_RANDOM_UNSEEDED(state) (!(state))
 #define CC_RANDOM_MAX CCRandomMax_xorshift
 #define CC_RANDOM CCRandom_xorshift
 #elif CC_RANDOM_XORWOW
 #define CCRandomState CCRandomGlobalState_xorwow
 #define CC_RANDOM_SEED CCRandomSeed_xorwow
+#define CC_RANDOM_SEED_THREAD CCRandomSeedThread_xorwow
+#define CC_RANDOM_UNSEEDED(state) (!((state).a | (state).b | (state).c | (state).d))
 #define CC_RANDOM_MAX CCRandomMax_xorwow
 #define CC_RANDOM CCRandom_xorwow
 #endif
@@ -126,6 +361,9 @@ extern CCRandomState_xorwow CCRandomGlobalState_xorwow;
  *
  *              - @b CC_RANDOM_XORWOW
  *
+ * @note The xorshift and xorwow states are per thread, while @b CC_RANDOM_STD shares the process-wide
+ *       @b rand state.
+ *
  * @return A random number.
  */
 static inline uint32_t CCRandom(void);
@@ -270,6 +508,161 @@ static inline CCVector2D CCRandomPointInEllipse(CCVector2D center, CCVector2D ra
  */
 static inline CCVector2D CCRandomPointInCircle(CCVector2D center, float radius);
 
+/*!
+ * @brief Fill an array with random values between 0 - CCRandomMax().
+ * @note This uses the global PRNG.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+static inline void CCRandomFill(uint32_t *Values, size_t Count);
+
+/*!
+ * @brief Fill an array with random floats between 0.0f - 1.0f.
+ * @note This uses the global PRNG.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+static inline void CCRandomFillf(float *Values, size_t Count);
+
+#pragma mark - Generator
+
+/*!
+ * @brief A PRNG with its own state.
+ * @description Generators use xoshiro256**. Unlike the global PRNG a generator is not tied to a thread, so it
+ *              must either only be used by one thread at a time, or access to it must be synchronised.
+ */
+typedef struct CCRandomGeneratorInfo *CCRandomGenerator;
+
+/*!
+ * @brief Create a generator.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Seed The seed value.
+ * @return The generator, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCRandomGenerator CCRandomGeneratorCreate(CCAllocatorType Allocator, uint64_t Seed);
+
+/*!
+ * @brief Create a generator for a stream split off from another generator.
+ * @description The new generator continues from the current position of the parent, and the parent is jumped
+ *              ahead 2^128 values. So repeatedly splitting a generator produces non-overlapping streams, e.g. one
+ *              for each worker thread.
+ *
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Parent The generator to split the stream from.
+ * @return The generator, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCRandomGenerator CCRandomGeneratorCreateStream(CCAllocatorType Allocator, CCRandomGenerator Parent);
+
+/*!
+ * @brief Destroy a generator.
+ * @param Generator The generator to be destroyed.
+ */
+void CCRandomGeneratorDestroy(CCRandomGenerator CC_DESTROY(Generator));
+
+/*!
+ * @brief Seed the generator.
+ * @param Generator The generator.
+ * @param Seed The seed value.
+ */
+void CCRandomGeneratorSeed(CCRandomGenerator Generator, uint64_t Seed);
+
+/*!
+ * @brief Get the next random value from the generator.
+ * @param Generator The generator.
+ * @return A random number between 0 - UINT32_MAX.
+ */
+uint32_t CCRandomGeneratorNext(CCRandomGenerator Generator);
+
+/*!
+ * @brief Fill an array with random values from the generator.
+ * @param Generator The generator.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomGeneratorFill(CCRandomGenerator Generator, uint32_t *Values, size_t Count);
+
+/*!
+ * @brief Fill an array with random floats between 0.0f - 1.0f (exclusive) from the generator.
+ * @param Generator The generator.
+ * @param Values The array to fill.
+ * @param Count The number of values to fill.
+ */
+void CCRandomGeneratorFillf(CCRandomGenerator Generator, float *Values, size_t Count);
+
+/*!
+ * @brief Get the next random value from the generator as a double between 0.0 - 1.0.
+ * @param Generator The generator.
+ * @return A random number between 0.0 - 1.0.
+ */
+static inline double CCRandomGeneratord(CCRandomGenerator Generator);
+
+/*!
+ * @brief Get the next random value from the generator as a float between 0.0f - 1.0f.
+ * @param Generator The generator.
+ * @return A random number between 0.0f - 1.0f.
+ */
+static inline float CCRandomGeneratorf(CCRandomGenerator Generator);
+
+/*!
+ * @brief Get the next random value from the generator as an integer between 0 - RAND_MAX.
+ * @param Generator The generator.
+ * @return A random number between 0 - RAND_MAX.
+ */
+static inline int CCRandomGeneratori(CCRandomGenerator Generator);
+
+/*!
+ * @brief Get the next random value from the generator as a double between the specified range.
+ * @param Generator The generator.
+ * @param min The minimum value that can be returned.
+ * @param max The maximum value that can be returned.
+ * @return A random number between defined range.
+ */
+static inline double CCRandomGeneratorRanged(CCRandomGenerator Generator, double min, double max);
+
+/*!
+ * @brief Get the next random value from the generator as a float between the specified range.
+ * @param Generator The generator.
+ * @param min The minimum value that can be returned.
+ * @param max The maximum value that can be returned.
+ * @return A random number between defined range.
+ */
+static inline float CCRandomGeneratorRangef(CCRandomGenerator Generator, float min, float max);
+
+/*!
+ * @brief Get the next random value from the generator as an integer between the specified range.
+ * @param Generator The generator.
+ * @param min The minimum value that can be returned.
+ * @param max The maximum value that can be returned.
+ * @return A random number between defined range.
+ */
+static inline int32_t CCRandomGeneratorRangei(CCRandomGenerator Generator, int32_t min, int32_t max);
+
+/*!
+ * @brief Get the next random value from the generator as a point in the given rect.
+ * @param Generator The generator.
+ * @param rect The rect to select a random point from.
+ * @return A random point.
+ */
+static inline CCVector2D CCRandomGeneratorPointInRect(CCRandomGenerator Generator, CCRect rect);
+
+/*!
+ * @brief Get the next random value from the generator as a point in the given ellipse.
+ * @param Generator The generator.
+ * @param center The center of the ellipse.
+ * @param radius The radius of the ellipse.
+ * @return A random point.
+ */
+static inline CCVector2D CCRandomGeneratorPointInEllipse(CCRandomGenerator Generator, CCVector2D center, CCVector2D radius);
+
+/*!
+ * @brief Get the next random value from the generator as a point in the given circle.
+ * @param Generator The generator.
+ * @param center The center of the circle.
+ * @param radius The radius of the circle.
+ * @return A random point.
+ */
+static inline CCVector2D CCRandomGeneratorPointInCircle(CCRandomGenerator Generator, CCVector2D center, float radius);
+
 #pragma mark -
 
 static inline uint32_t CCRandom(void) //0 - CCRandomMax()
@@ -277,6 +670,8 @@ static inline uint32_t CCRandom(void) //0 - CCRandomMax()
 #if CC_RANDOM_ARC4
     return arc4random(); //arc4random range: (2**32)-1
 #elif defined(CCRandomState)
+    if (CC_UNLIKELY(CC_RANDOM_UNSEEDED(CCRandomState))) CC_RANDOM_SEED_THREAD(&CCRandomState);
+    
     return CC_RANDOM(&CCRandomState);
 #else //CC_RANDOM_STD
     return rand();
@@ -305,15 +700,13 @@ static inline void CCRandomSeed(uint32_t seed)
 #endif
 }
 
-#undef CC_RANDOM_SEED
-#undef CC_RANDOM_MAX
-#undef CC_RANDOM
-
 static inline CC_NEW CCData CCRandomGetState(void)
 {
     size_t Size = 0;
     
 #if defined(CCRandomState)
+    if (CC_RANDOM_UNSEEDED(CCRandomState)) CC_RANDOM_SEED_THREAD(&CCRandomState);
+    
     Size = sizeof(CCRandomState);
 #endif
     
@@ -337,6 +730,12 @@ static inline void CCRandomSetState(CCData State)
 #endif
 }
 
+#undef CC_RANDOM_SEED
+#undef CC_RANDOM_SEED_THREAD
+#undef CC_RANDOM_UNSEEDED
+#undef CC_RANDOM_MAX
+#undef CC_RANDOM
+
 static inline double CCRandomd(void) //returns a random number between 0.0 - 1.0
 {
     return (double)CCRandom() / (double)CCRandomMax();
@@ -384,4 +783,65 @@ static inline CCVector2D CCRandomPointInCircle(CCVector2D center, float radius)
     return CCRandomPointInEllipse(center, (CCVector2D){ radius, radius });
 }
 
+static inline void CCRandomFill(uint32_t *Values, size_t Count)
+{
+#if CC_RANDOM_ARC4
+    arc4random_buf(Values, Count * sizeof(uint32_t));
+#else
+    for (size_t Loop = 0; Loop < Count; Loop++) Values[Loop] = CCRandom();
+#endif
+}
+
+static inline void CCRandomFillf(float *Values, size_t Count)
+{
+    for (size_t Loop = 0; Loop < Count; Loop++) Values[Loop] = CCRandomf();
+}
+
+static inline double CCRandomGeneratord(CCRandomGenerator Generator)
+{
+    return (double)CCRandomGeneratorNext(Generator) / (double)UINT32_MAX;
+}
+
+static inline float CCRandomGeneratorf(CCRandomGenerator Generator)
+{
+    return (float)CCRandomGeneratorNext(Generator) / (float)UINT32_MAX;
+}
+
+static inline int CCRandomGeneratori(CCRandomGenerator Generator)
+{
+    return CCRandomGeneratorNext(Generator) % ((unsigned int)RAND_MAX + 1);
+}
+
+static inline double CCRandomGeneratorRanged(CCRandomGenerator Generator, double min, double max)
+{
+    return CCClamp(CCRandomGeneratord(Generator) * (max - min) + min, min, max);
+}
+
+static inline float CCRandomGeneratorRangef(CCRandomGenerator Generator, float min, float max)
+{
+    return CCClamp(CCRandomGeneratorf(Generator) * (max - min) + min, min, max);
+}
+
+static inline int32_t CCRandomGeneratorRangei(CCRandomGenerator Generator, int32_t min, int32_t max)
+{
+    const int32_t r = CCRandomGeneratorNext(Generator);
+    return (r % (max - min + 1)) + (r < 0 ? max : min);
+}
+
+static inline CCVector2D CCRandomGeneratorPointInRect(CCRandomGenerator Generator, CCRect rect)
+{
+    return (CCVector2D){ rect.position.x + (CCRandomGeneratorf(Generator) * rect.size.x), rect.position.y + (CCRandomGeneratorf(Generator) * rect.size.y) };
+}
+
+static inline CCVector2D CCRandomGeneratorPointInEllipse(CCRandomGenerator Generator, CCVector2D center, CCVector2D radius)
+{
+    const float r = sqrtf(CCRandomGeneratorf(Generator)), angle = (CC_PI * 2.0f) * CCRandomGeneratorf(Generator);
+    return (CCVector2D){ (cosf(angle) * r * radius.x) + center.x, (sinf(angle) * r * radius.y) + center.y };
+}
+
+static inline CCVector2D CCRandomGeneratorPointInCircle(CCRandomGenerator Generator, CCVector2D center, float radius)
+{
+    return CCRandomGeneratorPointInEllipse(Generator, center, (CCVector2D){ radius, radius });
+}
+
 #endif
@@ -28,6 +28,7 @@
 #include "Dictionary.h"
 #include "Array.h"
 #include "ReflectedTypes.h"
+#include "ReflectStream.h"
 
 size_t CCReflectTypeSize(CCReflectType Type)
 {
@@ -2278,3 +2279,972 @@ void CCReflectDeserializeBinary(CCReflectType Type, void *Data, CCReflectEndian
         }
     }
 }
+
+#pragma mark - Compiled Binary Serialization
+
+#define CC_REFLECT_SERIALIZER_BUFFER_SIZE 512
+#define CC_REFLECT_SERIALIZER_UNROLL_MAX 16
+
+typedef enum {
+    CCReflectSerializerOpCopy,
+    CCReflectSerializerOpSwap,
+    CCReflectSerializerOpVariableLength,
+    CCReflectSerializerOpRepeat,
+    CCReflectSerializerOpType
+} CCReflectSerializerOpKind;
+
+typedef struct {
+    CCReflectSerializerOpKind kind;
+    size_t offset;
+    union {
+        struct {
+            size_t size;
+            /// The total size of the fixed ops that can be read together starting from this op, or 0 if it continues a previous run.
+            size_t run;
+        } fixed;
+        struct {
+            size_t size;
+            CCReflectEndian endian;
+            _Bool sign;
+        } integer;
+        struct {
+            size_t count;
+            size_t stride;
+            /// The number of ops that make up the body (including any nested bodies).
+            size_t length;
+        } repeat;
+        CCReflectType type;
+    };
+} CCReflectSerializerOp;
+
+typedef struct CCReflectSerializerInfo {
+    CCReflectEndian endian;
+    size_t preferVariableLength;
+    size_t count;
+    CCReflectSerializerOp ops[];
+} CCReflectSerializerInfo;
+
+typedef struct {
+    CCArray ops;
+    size_t barrier;
+} CCReflectSerializerCompiler;
+
+static inline CCReflectEndian CCReflectEndianResolve(CCReflectEndian Endianness)
+{
+    if (Endianness != CCReflectEndianNative) return Endianness;
+    
+#if CC_HARDWARE_ENDIAN_LITTLE
+    return CCReflectEndianLittle;
+#elif CC_HARDWARE_ENDIAN_BIG
+    return CCReflectEndianBig;
+#else
+#error Unknown native endianness
+#endif
+}
+
+static void CCReflectSerializerCompilerAppend(CCReflectSerializerCompiler *Compiler, CCReflectSerializerOp Op)
+{
+    const size_t Count = CCArrayGetCount(Compiler->ops);
+    
+    if ((Op.kind == CCReflectSerializerOpCopy) && (Count > Compiler->barrier))
+    {
+        CCReflectSerializerOp *Prev = CCArrayGetElementAtIndex(Compiler->ops, Count - 1);
+        
+        if ((Prev->kind == CCReflectSerializerOpCopy) && ((Prev->offset + Prev->fixed.size) == Op.offset))
+        {
+            Prev->fixed.size += Op.fixed.size;
+            return;
+        }
+    }
+    
+    CCArrayAppendElement(Compiler->ops, &Op);
+}
+
+static void CCReflectSerializerCompilerAppendEndianValue(CCReflectSerializerCompiler *Compiler, CCReflectEndian SourceEndianness, size_t Offset, size_t Size, CCReflectEndian DestinationEndianness)
+{
+    CCAssertLog(Size <= 64, "Exceeds max supported size");
+    
+    CCReflectSerializerCompilerAppend(Compiler, (CCReflectSerializerOp){
+        .kind = ((Size == 1) || (CCReflectEndianResolve(SourceEndianness) == CCReflectEndianResolve(DestinationEndianness))) ? CCReflectSerializerOpCopy : CCReflectSerializerOpSwap,
+        .offset = Offset,
+        .fixed = { .size = Size }
+    });
+}
+
+static void CCReflectSerializerCompileType(CCReflectSerializerCompiler *Compiler, CCReflectType Type, size_t Offset, CCReflectEndian SerializedEndianness, size_t PreferVariableLength)
+{
+    switch (*(const CCReflectTypeID*)Type)
+    {
+        case CCReflectTypeInteger:
+        {
+            const CCReflectInteger *Integer = Type;
+            
+            if ((Integer->size >= PreferVariableLength) || (!Integer->fixed))
+            {
+                CCAssertLog(Integer->size <= 64, "Exceeds max supported size");
+                
+                CCReflectSerializerCompilerAppend(Compiler, (CCReflectSerializerOp){
+                    .kind = CCReflectSerializerOpVariableLength,
+                    .offset = Offset,
+                    .integer = { .size = Integer->size, .endian = Integer->endian, .sign = Integer->sign }
+                });
+            }
+            
+            else CCReflectSerializerCompilerAppendEndianValue(Compiler, Integer->endian, Offset, Integer->size, SerializedEndianness);
+            
+            break;
+        }
+            
+        case CCReflectTypeFloat:
+            CCReflectSerializerCompilerAppendEndianValue(Compiler, ((const CCReflectFloat*)Type)->endian, Offset, ((const CCReflectFloat*)Type)->size, SerializedEndianness);
+            break;
+            
+        case CCReflectTypeStruct:
+            for (size_t Loop = 0, Count = ((const CCReflectStruct*)Type)->count; Loop < Count; Loop++)
+            {
+                CCReflectSerializerCompileType(Compiler, ((const CCReflectStruct*)Type)->fields[Loop].type, Offset + ((const CCReflectStruct*)Type)->fields[Loop].offset, SerializedEndianness, PreferVariableLength);
+            }
+            break;
+            
+        case CCReflectTypeArray:
+        {
+            const size_t Count = ((const CCReflectArray*)Type)->count;
+            
+            if (!Count) break;
+            
+            CCReflectType ElementType = ((const CCReflectArray*)Type)->type;
+            const size_t ElementSize = CCReflectTypeSize(ElementType);
+            
+            CCReflectSerializerCompiler Body = { .ops = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(CCReflectSerializerOp), 16), .barrier = 0 };
+            CCReflectSerializerCompileType(&Body, ElementType, 0, SerializedEndianness, PreferVariableLength);
+            
+            const size_t BodyCount = CCArrayGetCount(Body.ops);
+            const CCReflectSerializerOp *BodyOps = CCArrayGetData(Body.ops);
+            
+            if ((BodyCount == 1) && (BodyOps[0].kind == CCReflectSerializerOpCopy) && (BodyOps[0].offset == 0) && (BodyOps[0].fixed.size == ElementSize))
+            {
+                CCReflectSerializerCompilerAppend(Compiler, (CCReflectSerializerOp){
+                    .kind = CCReflectSerializerOpCopy,
+                    .offset = Offset,
+                    .fixed = { .size = ElementSize * Count }
+                });
+            }
+            
+            else if ((BodyCount * Count) <= CC_REFLECT_SERIALIZER_UNROLL_MAX)
+            {
+                for (size_t Loop = 0; Loop < Count; Loop++)
+                {
+                    CCReflectSerializerCompileType(Compiler, ElementType, Offset + (ElementSize * Loop), SerializedEndianness, PreferVariableLength);
+                }
+            }
+            
+            else
+            {
+                CCArrayAppendElement(Compiler->ops, &(CCReflectSerializerOp){
+                    .kind = CCReflectSerializerOpRepeat,
+                    .offset = Offset,
+                    .repeat = { .count = Count, .stride = ElementSize, .length = BodyCount }
+                });
+                
+                CCArrayAppendElements(Compiler->ops, BodyOps, BodyCount);
+                
+                Compiler->barrier = CCArrayGetCount(Compiler->ops);
+            }
+            
+            CCArrayDestroy(Body.ops);
+            
+            break;
+        }
+            
+        case CCReflectTypePointer:
+        case CCReflectTypeOpaque:
+        case CCReflectTypeValidator:
+        case CCReflectTypeEnumerable:
+            CCArrayAppendElement(Compiler->ops, &(CCReflectSerializerOp){
+                .kind = CCReflectSerializerOpType,
+                .offset = Offset,
+                .type = Type
+            });
+            break;
+    }
+}
+
+static size_t CCReflectSerializerComputeRuns(CCReflectSerializerOp *Ops, size_t Count)
+{
+    CCReflectSerializerOp *Run = NULL;
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        CCReflectSerializerOp *Op = &Ops[Loop];
+        
+        switch (Op->kind)
+        {
+            case CCReflectSerializerOpCopy:
+            case CCReflectSerializerOpSwap:
+                Op->fixed.run = 0;
+                
+                if ((Run) && ((Run->fixed.run + Op->fixed.size) <= CC_REFLECT_SERIALIZER_BUFFER_SIZE)) Run->fixed.run += Op->fixed.size;
+                else
+                {
+                    Run = Op;
+                    Run->fixed.run = Op->fixed.size;
+                }
+                break;
+                
+            case CCReflectSerializerOpRepeat:
+                Loop += CCReflectSerializerComputeRuns(Op + 1, Op->repeat.length);
+                Run = NULL;
+                break;
+                
+            default:
+                Run = NULL;
+                break;
+        }
+    }
+    
+    return Count;
+}
+
+CCReflectSerializer CCReflectCompileSerializer(CCAllocatorType Allocator, CCReflectType Type, CCReflectEndian SerializedEndianness, size_t PreferVariableLength)
+{
+    CCAssertLog(Type, "Type must not be null");
+    
+    CCReflectSerializerCompiler Compiler = { .ops = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(CCReflectSerializerOp), 16), .barrier = 0 };
+    CCReflectSerializerCompileType(&Compiler, Type, 0, SerializedEndianness, PreferVariableLength);
+    
+    const size_t Count = CCArrayGetCount(Compiler.ops);
+    
+    CCReflectSerializer Serializer = CCMalloc(Allocator, sizeof(CCReflectSerializerInfo) + (sizeof(CCReflectSerializerOp) * Count), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Serializer)
+    {
+        Serializer->endian = SerializedEndianness;
+        Serializer->preferVariableLength = PreferVariableLength;
+        Serializer->count = Count;
+        
+        if (Count) memcpy(Serializer->ops, CCArrayGetData(Compiler.ops), sizeof(CCReflectSerializerOp) * Count);
+        
+        CCReflectSerializerComputeRuns(Serializer->ops, Count);
+    }
+    
+    CCArrayDestroy(Compiler.ops);
+    
+    return Serializer;
+}
+
+void CCReflectSerializerDestroy(CCReflectSerializer Serializer)
+{
+    CCAssertLog(Serializer, "Serializer must not be null");
+    
+    CCFree(Serializer);
+}
+
+typedef struct {
+    void *stream;
+    CCReflectStreamWriter write;
+    size_t count;
+    uint8_t buffer[CC_REFLECT_SERIALIZER_BUFFER_SIZE];
+} CCReflectSerializerWriteBuffer;
+
+static inline void CCReflectSerializerWriteBufferFlush(CCReflectSerializerWriteBuffer *Buffer)
+{
+    if (Buffer->count)
+    {
+        Buffer->write(Buffer->stream, Buffer->buffer, Buffer->count);
+        Buffer->count = 0;
+    }
+}
+
+static void CCReflectSerializerWriteBufferWrite(CCReflectSerializerWriteBuffer *Buffer, const void *Data, size_t Size)
+{
+    if ((Buffer->count + Size) > CC_REFLECT_SERIALIZER_BUFFER_SIZE)
+    {
+        CCReflectSerializerWriteBufferFlush(Buffer);
+        
+        if (Size > CC_REFLECT_SERIALIZER_BUFFER_SIZE)
+        {
+            Buffer->write(Buffer->stream, Data, Size);
+            return;
+        }
+    }
+    
+    memcpy(Buffer->buffer + Buffer->count, Data, Size);
+    Buffer->count += Size;
+}
+
+static void CCReflectSerializerExecuteSerialize(CCReflectSerializer Serializer, const CCReflectSerializerOp *Ops, size_t Count, const void *Data, CCReflectSerializerWriteBuffer *Buffer, CCMemoryZone Zone)
+{
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const CCReflectSerializerOp *Op = &Ops[Loop];
+        
+        switch (Op->kind)
+        {
+            case CCReflectSerializerOpCopy:
+                CCReflectSerializerWriteBufferWrite(Buffer, Data + Op->offset, Op->fixed.size);
+                break;
+                
+            case CCReflectSerializerOpSwap:
+            {
+                const size_t Size = Op->fixed.size;
+                
+                if ((Buffer->count + Size) > CC_REFLECT_SERIALIZER_BUFFER_SIZE) CCReflectSerializerWriteBufferFlush(Buffer);
+                
+                for (size_t Index = 0; Index < Size; Index++)
+                {
+                    Buffer->buffer[Buffer->count + Index] = ((const uint8_t*)Data)[Op->offset + ((Size - Index) - 1)];
+                }
+                
+                Buffer->count += Size;
+                break;
+            }
+                
+            case CCReflectSerializerOpVariableLength:
+                CCReflectSerializeBinaryVariableLengthIntegerValue(Op->integer.endian, Data + Op->offset, Op->integer.size, Op->integer.sign, Buffer, (CCReflectStreamWriter)CCReflectSerializerWriteBufferWrite);
+                break;
+                
+            case CCReflectSerializerOpRepeat:
+                for (size_t Index = 0; Index < Op->repeat.count; Index++)
+                {
+                    CCReflectSerializerExecuteSerialize(Serializer, Op + 1, Op->repeat.length, Data + Op->offset + (Op->repeat.stride * Index), Buffer, Zone);
+                }
+                
+                Loop += Op->repeat.length;
+                break;
+                
+            case CCReflectSerializerOpType:
+                CCReflectSerializeBinary(Op->type, Data + Op->offset, Serializer->endian, Serializer->preferVariableLength, Buffer, (CCReflectStreamWriter)CCReflectSerializerWriteBufferWrite, Zone);
+                break;
+        }
+    }
+}
+
+void CCReflectSerializerSerialize(CCReflectSerializer Serializer, const void *Data, void *Stream, CCReflectStreamWriter Write, CCMemoryZone Zone)
+{
+    CCAssertLog(Serializer, "Serializer must not be null");
+    CCAssertLog(Data, "Data must not be null");
+    CCAssertLog(Write, "Write must not be null");
+    
+    CCReflectSerializerWriteBuffer Buffer;
+    Buffer.stream = Stream;
+    Buffer.write = Write;
+    Buffer.count = 0;
+    
+    CCReflectSerializerExecuteSerialize(Serializer, Serializer->ops, Serializer->count, Data, &Buffer, Zone);
+    
+    CCReflectSerializerWriteBufferFlush(&Buffer);
+}
+
+typedef struct {
+    void *stream;
+    CCReflectStreamReader read;
+    size_t offset;
+    _Bool staged;
+    uint8_t buffer[CC_REFLECT_SERIALIZER_BUFFER_SIZE];
+} CCReflectSerializerReadBuffer;
+
+static void CCReflectSerializerExecuteDeserialize(CCReflectSerializer Serializer, const CCReflectSerializerOp *Ops, size_t Count, void *Data, CCReflectSerializerReadBuffer *Buffer, CCMemoryZone Zone, CCAllocatorType Allocator)
+{
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const CCReflectSerializerOp *Op = &Ops[Loop];
+        
+        switch (Op->kind)
+        {
+            case CCReflectSerializerOpCopy:
+            case CCReflectSerializerOpSwap:
+            {
+                const size_t Size = Op->fixed.size;
+                
+                if (Op->fixed.run)
+                {
+                    if ((Buffer->staged = (Op->fixed.run <= CC_REFLECT_SERIALIZER_BUFFER_SIZE)))
+                    {
+                        Buffer->read(Buffer->stream, Buffer->buffer, Op->fixed.run);
+                        Buffer->offset = 0;
+                    }
+                }
+                
+                if (Op->kind == CCReflectSerializerOpCopy)
+                {
+                    if (Buffer->staged) memcpy(Data + Op->offset, Buffer->buffer + Buffer->offset, Size);
+                    else Buffer->read(Buffer->stream, Data + Op->offset, Size);
+                }
+                
+                else
+                {
+                    if (!Buffer->staged)
+                    {
+                        Buffer->read(Buffer->stream, Buffer->buffer, Size);
+                        Buffer->offset = 0;
+                    }
+                    
+                    for (size_t Index = 0; Index < Size; Index++)
+                    {
+                        ((uint8_t*)Data)[Op->offset + Index] = Buffer->buffer[Buffer->offset + ((Size - Index) - 1)];
+                    }
+                }
+                
+                if (Buffer->staged) Buffer->offset += Size;
+                
+                break;
+            }
+                
+            case CCReflectSerializerOpVariableLength:
+                CCReflectDeserializeBinaryVariableLengthIntegerValue(Op->integer.endian, Data + Op->offset, Op->integer.size, Op->integer.sign, Buffer->stream, Buffer->read);
+                break;
+                
+            case CCReflectSerializerOpRepeat:
+                for (size_t Index = 0; Index < Op->repeat.count; Index++)
+                {
+                    CCReflectSerializerExecuteDeserialize(Serializer, Op + 1, Op->repeat.length, Data + Op->offset + (Op->repeat.stride * Index), Buffer, Zone, Allocator);
+                }
+                
+                Loop += Op->repeat.length;
+                break;
+                
+            case CCReflectSerializerOpType:
+                CCReflectDeserializeBinary(Op->type, Data + Op->offset, Serializer->endian, Serializer->preferVariableLength, Buffer->stream, Buffer->read, Zone, Allocator);
+                break;
+        }
+    }
+}
+
+void CCReflectSerializerDeserialize(CCReflectSerializer Serializer, void *Data, void *Stream, CCReflectStreamReader Read, CCMemoryZone Zone, CCAllocatorType Allocator)
+{
+    CCAssertLog(Serializer, "Serializer must not be null");
+    CCAssertLog(Data, "Data must not be null");
+    CCAssertLog(Read, "Read must not be null");
+    
+    CCReflectSerializerReadBuffer Buffer;
+    Buffer.stream = Stream;
+    Buffer.read = Read;
+    Buffer.offset = 0;
+    Buffer.staged = FALSE;
+    
+    CCReflectSerializerExecuteDeserialize(Serializer, Serializer->ops, Serializer->count, Data, &Buffer, Zone, Allocator);
+}
+
+#pragma mark - Binary View
+
+typedef struct CCReflectViewInfo {
+    CCReflectType type;
+    CCReflectEndian endian;
+    size_t preferVariableLength;
+    const uint8_t *data;
+    size_t size;
+    size_t root;
+    size_t count;
+    size_t tables[];
+} CCReflectViewInfo;
+
+static inline CCReflectType CCReflectViewResolveType(CCReflectType Type)
+{
+    while (*(const CCReflectTypeID*)Type == CCReflectTypeValidator) Type = ((const CCReflectValidator*)Type)->type;
+    
+    return Type;
+}
+
+static inline _Bool CCReflectViewIsVariableLengthInteger(const CCReflectInteger *Type, size_t PreferVariableLength)
+{
+    return (Type->size >= PreferVariableLength) || (!Type->fixed);
+}
+
+/*!
+ * @brief Get the serialized size of a type if it is not dependent on the data.
+ * @return The size, or SIZE_MAX if the size can only be determined from the data.
+ */
+static size_t CCReflectViewFixedSize(CCReflectType Type, size_t PreferVariableLength)
+{
+    Type = CCReflectViewResolveType(Type);
+    
+    switch (*(const CCReflectTypeID*)Type)
+    {
+        case CCReflectTypeInteger:
+            return CCReflectViewIsVariableLengthInteger(Type, PreferVariableLength) ? SIZE_MAX : ((const CCReflectInteger*)Type)->size;
+            
+        case CCReflectTypeFloat:
+            return ((const CCReflectFloat*)Type)->size;
+            
+        case CCReflectTypeStruct:
+        {
+            size_t Size = 0;
+            
+            for (size_t Loop = 0, Count = ((const CCReflectStruct*)Type)->count; Loop < Count; Loop++)
+            {
+                const size_t FieldSize = CCReflectViewFixedSize(((const CCReflectStruct*)Type)->fields[Loop].type, PreferVariableLength);
+                
+                if (FieldSize == SIZE_MAX) return SIZE_MAX;
+                
+                Size += FieldSize;
+            }
+            
+            return Size;
+        }
+            
+        case CCReflectTypeArray:
+        {
+            const size_t Count = ((const CCReflectArray*)Type)->count;
+            
+            if (!Count) return 0;
+            
+            const size_t ElementSize = CCReflectViewFixedSize(((const CCReflectArray*)Type)->type, PreferVariableLength);
+            
+            return ((ElementSize == SIZE_MAX) || (ElementSize > (SIZE_MAX / Count))) ? SIZE_MAX : ElementSize * Count;
+        }
+            
+        default:
+            return SIZE_MAX;
+    }
+}
+
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t preferVariableLength;
+    CCArray tables;
+} CCReflectViewBuilder;
+
+static _Bool CCReflectViewBuildType(CCReflectViewBuilder *Builder, CCReflectType Type, size_t *Offset, size_t *Table);
+
+static inline _Bool CCReflectViewBuildVariableLengthInteger(CCReflectViewBuilder *Builder, size_t *Offset)
+{
+    for (size_t Index = *Offset; Index < Builder->size; Index++)
+    {
+        if (!(Builder->data[Index] & 0x80))
+        {
+            *Offset = Index + 1;
+            
+            return TRUE;
+        }
+    }
+    
+    return FALSE;
+}
+
+static inline size_t CCReflectViewBuildReserve(CCReflectViewBuilder *Builder, size_t Count)
+{
+    const size_t Table = CCArrayGetCount(Builder->tables);
+    
+    for (size_t Loop = 0; Loop < Count; Loop++) CCArrayAppendElement(Builder->tables, &(size_t){ 0 });
+    
+    return Table;
+}
+
+static inline void CCReflectViewBuildSet(CCReflectViewBuilder *Builder, size_t Index, size_t Value)
+{
+    *(size_t*)CCArrayGetElementAtIndex(Builder->tables, Index) = Value;
+}
+
+static _Bool CCReflectViewBuildChildren(CCReflectViewBuilder *Builder, size_t Table, size_t Count, CCReflectType (*ChildType)(CCReflectType, size_t), CCReflectType Type, size_t *Offset)
+{
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const size_t ChildOffset = *Offset;
+        size_t ChildTable;
+        
+        if (!CCReflectViewBuildType(Builder, ChildType(Type, Loop), Offset, &ChildTable)) return FALSE;
+        
+        CCReflectViewBuildSet(Builder, Table + 1 + (Loop * 2), ChildOffset);
+        CCReflectViewBuildSet(Builder, Table + 2 + (Loop * 2), ChildTable);
+    }
+    
+    return TRUE;
+}
+
+static CCReflectType CCReflectViewStructFieldType(CCReflectType Type, size_t Index)
+{
+    return ((const CCReflectStruct*)Type)->fields[Index].type;
+}
+
+static CCReflectType CCReflectViewElementType(CCReflectType Type, size_t Index)
+{
+    return ((const CCReflectArray*)Type)->type;
+}
+
+static CCReflectType CCReflectViewPointeeType(CCReflectType Type, size_t Index)
+{
+    return ((const CCReflectPointer*)Type)->type;
+}
+
+static CCReflectType CCReflectViewEnumerableElementType(CCReflectType Type, size_t Index)
+{
+    return ((const CCReflectEnumerable*)Type)->type;
+}
+
+static _Bool CCReflectViewBuildType(CCReflectViewBuilder *Builder, CCReflectType Type, size_t *Offset, size_t *Table)
+{
+    Type = CCReflectViewResolveType(Type);
+    
+    *Table = SIZE_MAX;
+    
+    const size_t FixedSize = CCReflectViewFixedSize(Type, Builder->preferVariableLength);
+    
+    if (FixedSize != SIZE_MAX)
+    {
+        if (FixedSize > (Builder->size - *Offset)) return FALSE;
+        
+        *Offset += FixedSize;
+        
+        return TRUE;
+    }
+    
+    switch (*(const CCReflectTypeID*)Type)
+    {
+        case CCReflectTypeInteger:
+            return CCReflectViewBuildVariableLengthInteger(Builder, Offset);
+            
+        case CCReflectTypeStruct:
+        {
+            // [count][offset:0][table:0]..[offset:n][table:n]
+            const size_t Count = ((const CCReflectStruct*)Type)->count;
+            
+            *Table = CCReflectViewBuildReserve(Builder, 1 + (Count * 2));
+            CCReflectViewBuildSet(Builder, *Table, Count);
+            
+            return CCReflectViewBuildChildren(Builder, *Table, Count, CCReflectViewStructFieldType, Type, Offset);
+        }
+            
+        case CCReflectTypeArray:
+        {
+            // [count][offset:0][table:0]..[offset:n][table:n]
+            const size_t Count = ((const CCReflectArray*)Type)->count;
+            
+            if (Count > (Builder->size - *Offset)) return FALSE;
+            
+            *Table = CCReflectViewBuildReserve(Builder, 1 + (Count * 2));
+            CCReflectViewBuildSet(Builder, *Table, Count);
+            
+            return CCReflectViewBuildChildren(Builder, *Table, Count, CCReflectViewElementType, Type, Offset);
+        }
+            
+        case CCReflectTypePointer:
+        {
+            // [exists][offset][table]
+            if (((const CCReflectPointer*)Type)->storage != CCReflectStorageDynamic) return FALSE;
+            if (*Offset >= Builder->size) return FALSE;
+            
+            const size_t Exists = Builder->data[(*Offset)++] ? 1 : 0;
+            
+            *Table = CCReflectViewBuildReserve(Builder, 1 + (Exists * 2));
+            CCReflectViewBuildSet(Builder, *Table, Exists);
+            
+            return CCReflectViewBuildChildren(Builder, *Table, Exists, CCReflectViewPointeeType, Type, Offset);
+        }
+            
+        case CCReflectTypeEnumerable:
+        {
+            // [count][stride][offset] or [count][SIZE_MAX][offset:0][table:0]..[offset:n][table:n]
+            size_t Count;
+            
+            const size_t CountOffset = *Offset;
+            if (!CCReflectViewBuildVariableLengthInteger(Builder, Offset)) return FALSE;
+            
+            CCReflectDeserializeBinaryVariableLengthIntegerValue(CCReflectEndianNative, &Count, sizeof(Count), TRUE, &CC_REFLECT_STREAM_MEMORY(Builder->data + CountOffset, *Offset - CountOffset), (CCReflectStreamReader)CCReflectStreamMemoryRead);
+            
+            CCReflectType ElementType = ((const CCReflectEnumerable*)Type)->type;
+            const size_t ElementSize = CCReflectViewFixedSize(ElementType, Builder->preferVariableLength);
+            
+            if (ElementSize != SIZE_MAX)
+            {
+                *Table = CCReflectViewBuildReserve(Builder, 3);
+                
+                if (Count == SIZE_MAX)
+                {
+                    CCReflectViewBuildSet(Builder, *Table + 1, ElementSize + 1);
+                    CCReflectViewBuildSet(Builder, *Table + 2, *Offset + 1);
+                    
+                    for (Count = 0; ; Count++)
+                    {
+                        if (*Offset >= Builder->size) return FALSE;
+                        if (!Builder->data[(*Offset)++]) break;
+                        if (ElementSize > (Builder->size - *Offset)) return FALSE;
+                        
+                        *Offset += ElementSize;
+                    }
+                }
+                
+                else
+                {
+                    if ((ElementSize) && (Count > ((Builder->size - *Offset) / ElementSize))) return FALSE;
+                    
+                    CCReflectViewBuildSet(Builder, *Table + 1, ElementSize);
+                    CCReflectViewBuildSet(Builder, *Table + 2, *Offset);
+                    
+                    *Offset += ElementSize * Count;
+                }
+                
+                CCReflectViewBuildSet(Builder, *Table, Count);
+                
+                return TRUE;
+            }
+            
+            else if (Count == SIZE_MAX)
+            {
+                CCArray Entries = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(size_t), 16);
+                
+                _Bool Valid = TRUE;
+                for (Count = 0; ; Count++)
+                {
+                    if (*Offset >= Builder->size)
+                    {
+                        Valid = FALSE;
+                        break;
+                    }
+                    
+                    if (!Builder->data[(*Offset)++]) break;
+                    
+                    size_t ElementOffset = *Offset, ElementTable;
+                    if (!CCReflectViewBuildType(Builder, ElementType, Offset, &ElementTable))
+                    {
+                        Valid = FALSE;
+                        break;
+                    }
+                    
+                    CCArrayAppendElement(Entries, &ElementOffset);
+                    CCArrayAppendElement(Entries, &ElementTable);
+                }
+                
+                if (Valid)
+                {
+                    *Table = CCReflectViewBuildReserve(Builder, 2);
+                    CCReflectViewBuildSet(Builder, *Table, Count);
+                    CCReflectViewBuildSet(Builder, *Table + 1, SIZE_MAX);
+                    
+                    if (Count) CCArrayAppendElements(Builder->tables, CCArrayGetData(Entries), Count * 2);
+                }
+                
+                CCArrayDestroy(Entries);
+                
+                return Valid;
+            }
+            
+            else
+            {
+                if (Count > (Builder->size - *Offset)) return FALSE;
+                
+                *Table = CCReflectViewBuildReserve(Builder, 2 + (Count * 2));
+                CCReflectViewBuildSet(Builder, *Table, Count);
+                CCReflectViewBuildSet(Builder, *Table + 1, SIZE_MAX);
+                
+                return CCReflectViewBuildChildren(Builder, *Table + 1, Count, CCReflectViewEnumerableElementType, Type, Offset);
+            }
+        }
+            
+        default:
+            return FALSE;
+    }
+}
+
+CCReflectView CCReflectViewCreate(CCAllocatorType Allocator, CCReflectType Type, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, const void *Data, size_t Size)
+{
+    CCAssertLog(Type, "Type must not be null");
+    CCAssertLog(Data || !Size, "Data must not be null");
+    
+    CCReflectViewBuilder Builder = {
+        .data = Data,
+        .size = Size,
+        .preferVariableLength = PreferVariableLength,
+        .tables = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(size_t), 64)
+    };
+    
+    size_t Offset = 0, Root;
+    CCReflectView View = NULL;
+    
+    if (CCReflectViewBuildType(&Builder, Type, &Offset, &Root))
+    {
+        const size_t Count = CCArrayGetCount(Builder.tables);
+        
+        View = CCMalloc(Allocator, sizeof(CCReflectViewInfo) + (sizeof(size_t) * Count), NULL, CC_DEFAULT_ERROR_CALLBACK);
+        if (View)
+        {
+            View->type = Type;
+            View->endian = SerializedEndianness;
+            View->preferVariableLength = PreferVariableLength;
+            View->data = Data;
+            View->size = Offset;
+            View->root = Root;
+            View->count = Count;
+            
+            if (Count) memcpy(View->tables, CCArrayGetData(Builder.tables), sizeof(size_t) * Count);
+        }
+    }
+    
+    CCArrayDestroy(Builder.tables);
+    
+    return View;
+}
+
+void CCReflectViewDestroy(CCReflectView View)
+{
+    CCAssertLog(View, "View must not be null");
+    
+    CCFree(View);
+}
+
+size_t CCReflectViewGetSize(CCReflectView View)
+{
+    CCAssertLog(View, "View must not be null");
+    
+    return View->size;
+}
+
+CCReflectViewValue CCReflectViewGetRoot(CCReflectView View)
+{
+    CCAssertLog(View, "View must not be null");
+    
+    return (CCReflectViewValue){
+        .view = View,
+        .type = CCReflectViewResolveType(View->type),
+        .offset = 0,
+        .table = View->root
+    };
+}
+
+size_t CCReflectViewGetCount(CCReflectViewValue Value)
+{
+    CCAssertLog(Value.view, "Value must be from a view");
+    
+    switch (*(const CCReflectTypeID*)Value.type)
+    {
+        case CCReflectTypeStruct:
+            return ((const CCReflectStruct*)Value.type)->count;
+            
+        case CCReflectTypeArray:
+            return ((const CCReflectArray*)Value.type)->count;
+            
+        case CCReflectTypePointer:
+        case CCReflectTypeEnumerable:
+            return Value.view->tables[Value.table];
+            
+        default:
+            return 0;
+    }
+}
+
+CCReflectViewValue CCReflectViewGetChild(CCReflectViewValue Value, size_t Index)
+{
+    CCAssertLog(Index < CCReflectViewGetCount(Value), "Index must not exceed bounds");
+    
+    CCReflectType ChildType;
+    size_t Offset, Table = SIZE_MAX;
+    
+    switch (*(const CCReflectTypeID*)Value.type)
+    {
+        case CCReflectTypeStruct:
+            ChildType = ((const CCReflectStruct*)Value.type)->fields[Index].type;
+            
+            if (Value.table == SIZE_MAX)
+            {
+                Offset = Value.offset;
+                
+                for (size_t Loop = 0; Loop < Index; Loop++) Offset += CCReflectViewFixedSize(((const CCReflectStruct*)Value.type)->fields[Loop].type, Value.view->preferVariableLength);
+            }
+            
+            else
+            {
+                Offset = Value.view->tables[Value.table + 1 + (Index * 2)];
+                Table = Value.view->tables[Value.table + 2 + (Index * 2)];
+            }
+            break;
+            
+        case CCReflectTypeArray:
+            ChildType = ((const CCReflectArray*)Value.type)->type;
+            
+            if (Value.table == SIZE_MAX) Offset = Value.offset + (CCReflectViewFixedSize(ChildType, Value.view->preferVariableLength) * Index);
+            else
+            {
+                Offset = Value.view->tables[Value.table + 1 + (Index * 2)];
+                Table = Value.view->tables[Value.table + 2 + (Index * 2)];
+            }
+            break;
+            
+        case CCReflectTypePointer:
+            ChildType = ((const CCReflectPointer*)Value.type)->type;
+            Offset = Value.view->tables[Value.table + 1];
+            Table = Value.view->tables[Value.table + 2];
+            break;
+            
+        case CCReflectTypeEnumerable:
+        {
+            ChildType = ((const CCReflectEnumerable*)Value.type)->type;
+            
+            const size_t Stride = Value.view->tables[Value.table + 1];
+            
+            if (Stride != SIZE_MAX) Offset = Value.view->tables[Value.table + 2] + (Stride * Index);
+            else
+            {
+                Offset = Value.view->tables[Value.table + 2 + (Index * 2)];
+                Table = Value.view->tables[Value.table + 3 + (Index * 2)];
+            }
+            break;
+        }
+            
+        default:
+            CCAssertLog(0, "Value has no children");
+            return Value;
+    }
+    
+    return (CCReflectViewValue){
+        .view = Value.view,
+        .type = CCReflectViewResolveType(ChildType),
+        .offset = Offset,
+        .table = Table
+    };
+}
+
+_Bool CCReflectViewGetField(CCReflectViewValue Value, CCString Name, CCReflectViewValue *Field)
+{
+    CCAssertLog(*(const CCReflectTypeID*)Value.type == CCReflectTypeStruct, "Value must be a struct");
+    CCAssertLog(Field, "Field must not be null");
+    
+    for (size_t Loop = 0, Count = ((const CCReflectStruct*)Value.type)->count; Loop < Count; Loop++)
+    {
+        if (CCStringEqual(((const CCReflectStruct*)Value.type)->fields[Loop].name, Name))
+        {
+            *Field = CCReflectViewGetChild(Value, Loop);
+            
+            return TRUE;
+        }
+    }
+    
+    return FALSE;
+}
+
+const void *CCReflectViewGetData(CCReflectViewValue Value)
+{
+    CCAssertLog(Value.view, "Value must be from a view");
+    
+    return Value.view->data + Value.offset;
+}
+
+void CCReflectViewRead(CCReflectViewValue Value, void *Data, CCMemoryZone Zone, CCAllocatorType Allocator)
+{
+    CCAssertLog(Value.view, "Value must be from a view");
+    CCAssertLog(Data, "Data must not be null");
+    
+    const CCReflectEndian Endian = CCReflectEndianResolve(Value.view->endian);
+    
+    switch (*(const CCReflectTypeID*)Value.type)
+    {
+        case CCReflectTypeInteger:
+            if ((!CCReflectViewIsVariableLengthInteger(Value.type, Value.view->preferVariableLength)) && (CCReflectEndianResolve(((const CCReflectInteger*)Value.type)->endian) == Endian))
+            {
+                memcpy(Data, Value.view->data + Value.offset, ((const CCReflectInteger*)Value.type)->size);
+                return;
+            }
+            break;
+            
+        case CCReflectTypeFloat:
+            if (CCReflectEndianResolve(((const CCReflectFloat*)Value.type)->endian) == Endian)
+            {
+                memcpy(Data, Value.view->data + Value.offset, ((const CCReflectFloat*)Value.type)->size);
+                return;
+            }
+            break;
+            
+        default:
+            break;
+    }
+    
+    CCReflectDeserializeBinary(Value.type, Data, Value.view->endian, Value.view->preferVariableLength, &CC_REFLECT_STREAM_MEMORY(Value.view->data + Value.offset, Value.view->size - Value.offset), (CCReflectStreamReader)CCReflectStreamMemoryRead, Zone, Allocator);
+}
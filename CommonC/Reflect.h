@@ -538,6 +538,156 @@ void CCReflectSerializeBinary(CCReflectType Type, const void *Data, CCReflectEnd
  */
 void CCReflectDeserializeBinary(CCReflectType Type, void *Data, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, void *Stream, CCReflectStreamReader Read, CCMemoryZone Zone, CCAllocatorType Allocator);
 
+/*!
+ * @brief A compiled binary serializer.
+ * @description Allows @b CCRetain.
+ */
+typedef struct CCReflectSerializerInfo *CCReflectSerializer;
+
+/*!
+ * @brief Compile a binary serializer for a given type.
+ * @description Flattens the type into a linear plan so the type does not need to be walked for every value. Contiguous
+ *              fields that require no conversion are coalesced into single copies, and writes are batched before being
+ *              passed to the stream. Types that cannot be flattened (pointers, opaque types, validators, enumerables)
+ *              fall back to @b CCReflectSerializeBinary/CCReflectDeserializeBinary.
+ *
+ *              The binary data produced is identical to that of @b CCReflectSerializeBinary.
+ *
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Type The reflected type of the data to be serialized. The type must outlive the serializer.
+ * @param SerializedEndianness The endianness of the serialized binary data.
+ * @param PreferVariableLength The minimum size of any fixed sized integers that should be stored using the variable length integer format instead.
+ * @return The serializer, or NULL on failure. Must be destroyed to free the memory.
+ */
+CC_NEW CCReflectSerializer CCReflectCompileSerializer(CCAllocatorType Allocator, CCReflectType Type, CCReflectEndian SerializedEndianness, size_t PreferVariableLength);
+
+/*!
+ * @brief Destroy a compiled serializer.
+ * @param Serializer The serializer to be destroyed.
+ */
+void CCReflectSerializerDestroy(CCReflectSerializer CC_DESTROY(Serializer));
+
+/*!
+ * @brief Serialize the data as binary data using a compiled serializer.
+ * @param Serializer The compiled serializer for the type of the data.
+ * @param Data The data to be serialized.
+ * @param Stream The stream to be used for writing the binary data to.
+ * @param Write The writer function.
+ * @param Zone The memory zone to be used for internal allocations.
+ */
+void CCReflectSerializerSerialize(CCReflectSerializer Serializer, const void *Data, void *Stream, CCReflectStreamWriter Write, CCMemoryZone Zone);
+
+/*!
+ * @brief Deserialize the data from binary data using a compiled serializer.
+ * @param Serializer The compiled serializer for the type of the data.
+ * @param Data A pointer to where to store the deserialized data.
+ * @param Stream The stream to be used for reading the binary data from.
+ * @param Read The reader function.
+ * @param Zone The memory zone to be used for internal allocations.
+ * @param Allocator The allocator to be used as the default allocator.
+ */
+void CCReflectSerializerDeserialize(CCReflectSerializer Serializer, void *Data, void *Stream, CCReflectStreamReader Read, CCMemoryZone Zone, CCAllocatorType Allocator);
+
+/*!
+ * @brief A view over binary serialized data.
+ */
+typedef struct CCReflectViewInfo *CCReflectView;
+
+typedef struct {
+    CCReflectView view;
+    CCReflectType type;
+    /// The offset of the value in the serialized data.
+    size_t offset;
+    /// The index of the value's offset table, or SIZE_MAX if the value has a fixed layout.
+    size_t table;
+} CCReflectViewValue;
+
+/*!
+ * @brief Create a view over binary serialized data.
+ * @description Validates the data once and builds offset tables for any variable length members (variable length integers,
+ *              dynamic pointers, enumerables), after which any value can be accessed in place without deserializing the
+ *              rest of the data. Values with a fixed layout are located purely from the type, and do not take up any
+ *              space in the offset tables.
+ *
+ *              Opaque types and static pointers are not supported, as their layout is defined by the serialized data.
+ *              Validator types are viewed as their underlying type (the validation is not applied).
+ *
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Type The reflected type of the serialized data. The type must outlive the view.
+ * @param SerializedEndianness The endianness of the binary data.
+ * @param PreferVariableLength The minimum size of any fixed sized integers that are stored using the variable length integer format.
+ * @param Data The binary data. This is not copied, so must outlive the view.
+ * @param Size The size of the binary data.
+ * @return The view, or NULL if the data is not valid for the type or the type is not supported. Must be destroyed to
+ *         free the memory.
+ */
+CC_NEW CCReflectView CCReflectViewCreate(CCAllocatorType Allocator, CCReflectType Type, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, const void *Data, size_t Size);
+
+/*!
+ * @brief Destroy a view.
+ * @param View The view to be destroyed.
+ */
+void CCReflectViewDestroy(CCReflectView CC_DESTROY(View));
+
+/*!
+ * @brief Get the size of the serialized data covered by the view.
+ * @param View The view.
+ * @return The size of the serialized data.
+ */
+size_t CCReflectViewGetSize(CCReflectView View);
+
+/*!
+ * @brief Get the root value of the view.
+ * @param View The view.
+ * @return The root value.
+ */
+CCReflectViewValue CCReflectViewGetRoot(CCReflectView View);
+
+/*!
+ * @brief Get the number of children a value has.
+ * @param Value The value.
+ * @return The number of fields of a struct, the number of elements of an array or enumerable, 1 if a pointer is not
+ *         null otherwise 0, or 0 for any other types.
+ */
+size_t CCReflectViewGetCount(CCReflectViewValue Value);
+
+/*!
+ * @brief Get a child of a value.
+ * @param Value The value.
+ * @param Index The index of the field, element, or 0 for the pointee. Must be less than @b CCReflectViewGetCount.
+ * @return The child value.
+ */
+CCReflectViewValue CCReflectViewGetChild(CCReflectViewValue Value, size_t Index);
+
+/*!
+ * @brief Get the field of a struct value.
+ * @param Value The struct value.
+ * @param Name The name of the field.
+ * @param Field A pointer to where the field value should be stored.
+ * @return Whether the field exists.
+ */
+_Bool CCReflectViewGetField(CCReflectViewValue Value, CCString Name, CCReflectViewValue *Field);
+
+/*!
+ * @brief Get the serialized data of a value.
+ * @description Can be used to read values in place when their serialized representation matches their native one
+ *              (e.g. fixed width integers and floats when the serialized endianness matches).
+ *
+ * @param Value The value.
+ * @return A pointer to the serialized data of the value.
+ */
+const void *CCReflectViewGetData(CCReflectViewValue Value);
+
+/*!
+ * @brief Read the value.
+ * @description Deserializes only the given value.
+ * @param Value The value.
+ * @param Data A pointer to where to store the deserialized data.
+ * @param Zone The memory zone to be used for internal allocations. May be NULL if the value has no pointers or enumerables.
+ * @param Allocator The allocator to be used as the default allocator.
+ */
+void CCReflectViewRead(CCReflectViewValue Value, void *Data, CCMemoryZone Zone, CCAllocatorType Allocator);
+
 #pragma mark - Handlers
 
 typedef struct {
@@ -0,0 +1,476 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ReflectChunked.h"
+#include "ReflectStream.h"
+#include "Assertion.h"
+#include "MemoryAllocation.h"
+#include "Array.h"
+#include "Maths.h"
+#include <string.h>
+
+static const CCReflectInteger CCReflectChunkedSize = CC_REFLECT_INTEGER(size_t, CCReflectEndianNative);
+
+typedef struct {
+    CCReflectSerializer serializer;
+    CCReflectType type;
+    /// The elements are either located at base + (stride * index), or if pointers is not null then at pointers[index].
+    void *base;
+    size_t stride;
+    void * const *pointers;
+    size_t start;
+    size_t count;
+    union {
+        CCArray output;
+        struct {
+            const void *data;
+            size_t size;
+            CCMemoryZone zone;
+            CCAllocatorType allocator;
+            _Bool *failed;
+        } input;
+    };
+} CCReflectChunkedTask;
+
+static _Bool CCReflectChunkedRequiresZone(CCReflectType Type, size_t Depth)
+{
+    if (Depth > 16) return TRUE;
+    
+    switch (*(const CCReflectTypeID*)Type)
+    {
+        case CCReflectTypeInteger:
+        case CCReflectTypeFloat:
+            return FALSE;
+            
+        case CCReflectTypeStruct:
+            for (size_t Loop = 0, Count = ((const CCReflectStruct*)Type)->count; Loop < Count; Loop++)
+            {
+                if (CCReflectChunkedRequiresZone(((const CCReflectStruct*)Type)->fields[Loop].type, Depth + 1)) return TRUE;
+            }
+            
+            return FALSE;
+            
+        case CCReflectTypeArray:
+            return CCReflectChunkedRequiresZone(((const CCReflectArray*)Type)->type, Depth + 1);
+            
+        case CCReflectTypeValidator:
+            return CCReflectChunkedRequiresZone(((const CCReflectValidator*)Type)->type, Depth + 1);
+            
+        case CCReflectTypePointer:
+            if (((const CCReflectPointer*)Type)->storage == CCReflectStorageDynamic) return CCReflectChunkedRequiresZone(((const CCReflectPointer*)Type)->type, Depth + 1);
+            
+            return TRUE;
+            
+        default:
+            return TRUE;
+    }
+}
+
+static inline void *CCReflectChunkedTaskElement(const CCReflectChunkedTask *Task, size_t Index)
+{
+    return Task->pointers ? Task->pointers[Index] : Task->base + (Task->stride * Index);
+}
+
+static void CCReflectChunkedExecute(CCTaskQueue Queue, CCTaskFunction Function, const CCReflectChunkedTask *Inputs, size_t Count)
+{
+    if (!Queue) Queue = CCTaskQueueDefault();
+    
+    CCTask *Tasks = CCMalloc(CC_STD_ALLOCATOR, sizeof(CCTask) * Count, NULL, CC_DEFAULT_ERROR_CALLBACK);
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        Tasks[Loop] = CCTaskCreate(CC_STD_ALLOCATOR, Function, 0, NULL, sizeof(CCReflectChunkedTask), &Inputs[Loop], NULL);
+        CCTaskQueuePush(Queue, CCRetain(Tasks[Loop]));
+    }
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        while (!CCTaskIsFinished(Tasks[Loop]))
+        {
+            CCTask Task = CCTaskQueuePop(Queue);
+            
+            if (Task)
+            {
+                CCTaskRun(Task);
+                CCTaskDestroy(Task);
+            }
+            
+            else CC_SPIN_WAIT();
+        }
+        
+        CCTaskDestroy(Tasks[Loop]);
+    }
+    
+    CCFree(Tasks);
+}
+
+static size_t CCReflectChunkedGetElements(CCReflectType Type, const void *Data, CCReflectType *ElementType, void **Base, size_t *Stride, CCArray *Pointers)
+{
+    switch (*(const CCReflectTypeID*)Type)
+    {
+        case CCReflectTypeArray:
+            *ElementType = ((const CCReflectArray*)Type)->type;
+            *Base = (void*)Data;
+            *Stride = CCReflectTypeSize(((const CCReflectArray*)Type)->type);
+            *Pointers = NULL;
+            
+            return ((const CCReflectArray*)Type)->count;
+            
+        case CCReflectTypeEnumerable:
+        {
+            CCEnumerable Enumerable = *(const CCEnumerable*)Data;
+            
+            *ElementType = ((const CCReflectEnumerable*)Type)->type;
+            *Base = NULL;
+            *Stride = 0;
+            *Pointers = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(void*), 1024);
+            
+            for (const void *Element = CCEnumerableGetCurrent(&Enumerable); Element; Element = CCEnumerableNext(&Enumerable))
+            {
+                CCArrayAppendElement(*Pointers, &Element);
+            }
+            
+            return CCArrayGetCount(*Pointers);
+        }
+            
+        default:
+            CCAssertLog(0, "Type must be an array or enumerable");
+            *ElementType = NULL;
+            *Base = NULL;
+            *Stride = 0;
+            *Pointers = NULL;
+            
+            return 0;
+    }
+}
+
+#pragma mark - Serialization
+
+static void CCReflectChunkedSerializeTask(const CCReflectChunkedTask *Task, void *Out)
+{
+    CCMemoryZone Zone = CCReflectChunkedRequiresZone(Task->type, 0) ? CCMemoryZoneCreate(CC_STD_ALLOCATOR, 1024) : NULL;
+    
+    for (size_t Loop = 0; Loop < Task->count; Loop++)
+    {
+        CCReflectSerializerSerialize(Task->serializer, CCReflectChunkedTaskElement(Task, Task->start + Loop), Task->output, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Zone);
+    }
+    
+    if (Zone) CCMemoryZoneDestroy(Zone);
+}
+
+void CCReflectSerializeBinaryChunked(CCReflectType Type, const void *Data, size_t ChunkElements, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, void *Stream, CCReflectStreamWriter Write, CCTaskQueue Queue)
+{
+    CCAssertLog(Type, "Type must not be null");
+    CCAssertLog(Data, "Data must not be null");
+    CCAssertLog(Write, "Write must not be null");
+    CCAssertLog(ChunkElements, "ChunkElements must not be 0");
+    
+    CCReflectType ElementType;
+    void *Base;
+    size_t Stride;
+    CCArray Pointers;
+    const size_t Count = CCReflectChunkedGetElements(Type, Data, &ElementType, &Base, &Stride, &Pointers);
+    const size_t ChunkCount = (Count + (ChunkElements - 1)) / ChunkElements;
+    
+    CCReflectSerializeBinary(&CCReflectChunkedSize, &Count, SerializedEndianness, PreferVariableLength, Stream, Write, NULL);
+    CCReflectSerializeBinary(&CCReflectChunkedSize, &ChunkElements, SerializedEndianness, PreferVariableLength, Stream, Write, NULL);
+    
+    if (ChunkCount)
+    {
+        CCReflectSerializer Serializer = CCReflectCompileSerializer(CC_STD_ALLOCATOR, ElementType, SerializedEndianness, PreferVariableLength);
+        
+        CCReflectChunkedTask *Tasks = CCMalloc(CC_STD_ALLOCATOR, sizeof(CCReflectChunkedTask) * ChunkCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        
+        for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+        {
+            const size_t Start = Loop * ChunkElements;
+            
+            Tasks[Loop] = (CCReflectChunkedTask){
+                .serializer = Serializer,
+                .type = ElementType,
+                .base = Base,
+                .stride = Stride,
+                .pointers = Pointers ? CCArrayGetData(Pointers) : NULL,
+                .start = Start,
+                .count = CCMin(ChunkElements, Count - Start),
+                .output = CCArrayCreate(CC_STD_ALLOCATOR, 1, CCReflectTypeSize(ElementType) * CCMin(ChunkElements, 1024))
+            };
+        }
+        
+        CCReflectChunkedExecute(Queue, (CCTaskFunction)CCReflectChunkedSerializeTask, Tasks, ChunkCount);
+        
+        for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+        {
+            const size_t Size = CCArrayGetCount(Tasks[Loop].output);
+            CCReflectSerializeBinary(&CCReflectChunkedSize, &Size, SerializedEndianness, PreferVariableLength, Stream, Write, NULL);
+        }
+        
+        for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+        {
+            if (CCArrayGetCount(Tasks[Loop].output)) Write(Stream, CCArrayGetData(Tasks[Loop].output), CCArrayGetCount(Tasks[Loop].output));
+            
+            CCArrayDestroy(Tasks[Loop].output);
+        }
+        
+        CCFree(Tasks);
+        CCReflectSerializerDestroy(Serializer);
+    }
+    
+    if (Pointers) CCArrayDestroy(Pointers);
+}
+
+#pragma mark - Deserialization
+
+static void CCReflectChunkedDeserializeTask(const CCReflectChunkedTask *Task, void *Out)
+{
+    CCReflectStreamMemory Stream = CC_REFLECT_STREAM_MEMORY(Task->input.data, Task->input.size);
+    
+    for (size_t Loop = 0; Loop < Task->count; Loop++)
+    {
+        CCReflectSerializerDeserialize(Task->serializer, CCReflectChunkedTaskElement(Task, Task->start + Loop), &Stream, (CCReflectStreamReader)CCReflectStreamMemoryRead, Task->input.zone, Task->input.allocator);
+    }
+    
+    *Task->input.failed = (Stream.failure.count) || (Stream.offset != Stream.size);
+}
+
+static _Bool CCReflectChunkedReadHeader(size_t *Count, size_t *ChunkElements, size_t *ChunkCount, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, void *Stream, CCReflectStreamReader Read)
+{
+    CCReflectDeserializeBinary(&CCReflectChunkedSize, Count, SerializedEndianness, PreferVariableLength, Stream, Read, NULL, CC_STD_ALLOCATOR);
+    CCReflectDeserializeBinary(&CCReflectChunkedSize, ChunkElements, SerializedEndianness, PreferVariableLength, Stream, Read, NULL, CC_STD_ALLOCATOR);
+    
+    if ((*Count) && (!*ChunkElements)) return FALSE;
+    
+    *ChunkCount = *Count ? ((*Count - 1) / *ChunkElements) + 1 : 0;
+    
+    return TRUE;
+}
+
+_Bool CCReflectDeserializeBinaryChunked(CCReflectType Type, void *Data, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, void *Stream, CCReflectStreamReader Read, CCTaskQueue Queue, CCMemoryZone Zone, CCAllocatorType Allocator)
+{
+    CCAssertLog(Type, "Type must not be null");
+    CCAssertLog(Data, "Data must not be null");
+    CCAssertLog(Read, "Read must not be null");
+    
+    size_t Count, ChunkElements, ChunkCount;
+    if (!CCReflectChunkedReadHeader(&Count, &ChunkElements, &ChunkCount, SerializedEndianness, PreferVariableLength, Stream, Read)) return FALSE;
+    
+    CCReflectType ElementType;
+    void *Base = NULL;
+    size_t Stride = 0;
+    CCArray Pointers = NULL;
+    
+    CCMemoryZoneBlock *Block = NULL;
+    ptrdiff_t Offset = 0;
+    
+    switch (*(const CCReflectTypeID*)Type)
+    {
+        case CCReflectTypeArray:
+            if (((const CCReflectArray*)Type)->count != Count) return FALSE;
+            
+            ElementType = ((const CCReflectArray*)Type)->type;
+            Base = Data;
+            Stride = CCReflectTypeSize(ElementType);
+            break;
+            
+        case CCReflectTypeEnumerable:
+        {
+            ElementType = ((const CCReflectEnumerable*)Type)->type;
+            
+            const size_t ElementSize = CCReflectTypeSize(ElementType);
+            
+            Block = CCMemoryZoneGetCurrentBlock(Zone);
+            Offset = CCMemoryZoneBlockGetCurrentOffset(Block);
+            
+            Pointers = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(void*), 1024);
+            
+            for (size_t Loop = 0; Loop < Count; Loop++)
+            {
+                void *Element = CCMemoryZoneAllocate(Zone, ElementSize);
+                CCArrayAppendElement(Pointers, &Element);
+            }
+            break;
+        }
+            
+        default:
+            CCAssertLog(0, "Type must be an array or enumerable");
+            return FALSE;
+    }
+    
+    _Bool Success = TRUE;
+    
+    if (ChunkCount)
+    {
+        size_t *Sizes = CCMalloc(CC_STD_ALLOCATOR, sizeof(size_t) * ChunkCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+        size_t Total = 0;
+        
+        for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+        {
+            CCReflectDeserializeBinary(&CCReflectChunkedSize, &Sizes[Loop], SerializedEndianness, PreferVariableLength, Stream, Read, NULL, CC_STD_ALLOCATOR);
+            
+            if (Sizes[Loop] > (SIZE_MAX - Total))
+            {
+                Success = FALSE;
+                break;
+            }
+            
+            Total += Sizes[Loop];
+        }
+        
+        uint8_t *Chunks = Success ? CCMalloc(CC_STD_ALLOCATOR, CCMax(Total, 1), NULL, CC_DEFAULT_ERROR_CALLBACK) : NULL;
+        
+        if (Chunks)
+        {
+            Read(Stream, Chunks, Total);
+            
+            CCReflectSerializer Serializer = CCReflectCompileSerializer(CC_STD_ALLOCATOR, ElementType, SerializedEndianness, PreferVariableLength);
+            
+            const _Bool Sequential = CCReflectChunkedRequiresZone(ElementType, 0);
+            
+            CCReflectChunkedTask *Tasks = CCMalloc(CC_STD_ALLOCATOR, sizeof(CCReflectChunkedTask) * ChunkCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+            _Bool *Failed = CCMalloc(CC_STD_ALLOCATOR, sizeof(_Bool) * ChunkCount, NULL, CC_DEFAULT_ERROR_CALLBACK);
+            
+            for (size_t Loop = 0, ChunkOffset = 0; Loop < ChunkCount; ChunkOffset += Sizes[Loop++])
+            {
+                const size_t Start = Loop * ChunkElements;
+                
+                Tasks[Loop] = (CCReflectChunkedTask){
+                    .serializer = Serializer,
+                    .type = ElementType,
+                    .base = Base,
+                    .stride = Stride,
+                    .pointers = Pointers ? CCArrayGetData(Pointers) : NULL,
+                    .start = Start,
+                    .count = CCMin(ChunkElements, Count - Start),
+                    .input = {
+                        .data = Chunks + ChunkOffset,
+                        .size = Sizes[Loop],
+                        .zone = Sequential ? Zone : NULL,
+                        .allocator = Allocator,
+                        .failed = &Failed[Loop]
+                    }
+                };
+            }
+            
+            if (Sequential)
+            {
+                for (size_t Loop = 0; Loop < ChunkCount; Loop++) CCReflectChunkedDeserializeTask(&Tasks[Loop], NULL);
+            }
+            
+            else CCReflectChunkedExecute(Queue, (CCTaskFunction)CCReflectChunkedDeserializeTask, Tasks, ChunkCount);
+            
+            for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+            {
+                if (Failed[Loop]) Success = FALSE;
+            }
+            
+            CCFree(Failed);
+            CCFree(Tasks);
+            CCReflectSerializerDestroy(Serializer);
+            CCFree(Chunks);
+        }
+        
+        else Success = FALSE;
+        
+        CCFree(Sizes);
+    }
+    
+    if (Pointers)
+    {
+        CCMemoryZoneBlockGetEnumerable(Block, Offset, CCReflectTypeSize(ElementType), Count, Data);
+        CCArrayDestroy(Pointers);
+    }
+    
+    return Success;
+}
+
+#pragma mark - Index
+
+CCReflectChunkedIndex *CCReflectChunkedIndexCreate(CCAllocatorType Allocator, const void *Data, size_t Size)
+{
+    CCAssertLog(Data || !Size, "Data must not be null");
+    
+    CCReflectStreamMemory Stream = CC_REFLECT_STREAM_MEMORY(Data, Size);
+    
+    size_t Count, ChunkElements, ChunkCount;
+    if ((!CCReflectChunkedReadHeader(&Count, &ChunkElements, &ChunkCount, CCReflectEndianNative, SIZE_MAX, &Stream, (CCReflectStreamReader)CCReflectStreamMemoryRead)) || (Stream.failure.count)) return NULL;
+    
+    if (ChunkCount > (Size - Stream.offset)) return NULL;
+    
+    CCReflectChunkedIndex *Index = CCMalloc(Allocator, sizeof(CCReflectChunkedIndex) + (sizeof(size_t) * (ChunkCount + 1)), NULL, CC_DEFAULT_ERROR_CALLBACK);
+    if (Index)
+    {
+        Index->count = Count;
+        Index->elements = ChunkElements;
+        Index->chunks = ChunkCount;
+        
+        for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+        {
+            CCReflectDeserializeBinary(&CCReflectChunkedSize, &Index->offsets[Loop + 1], CCReflectEndianNative, SIZE_MAX, &Stream, (CCReflectStreamReader)CCReflectStreamMemoryRead, NULL, CC_STD_ALLOCATOR);
+        }
+        
+        Index->offsets[0] = Stream.offset;
+        
+        for (size_t Loop = 0; Loop < ChunkCount; Loop++)
+        {
+            if ((Stream.failure.count) || (Index->offsets[Loop + 1] > (Size - Index->offsets[Loop])))
+            {
+                CCFree(Index);
+                
+                return NULL;
+            }
+            
+            Index->offsets[Loop + 1] += Index->offsets[Loop];
+        }
+    }
+    
+    return Index;
+}
+
+void CCReflectChunkedIndexDestroy(CCReflectChunkedIndex *Index)
+{
+    CCAssertLog(Index, "Index must not be null");
+    
+    CCFree(Index);
+}
+
+size_t CCReflectDeserializeBinaryChunk(const CCReflectChunkedIndex *Index, size_t Chunk, CCReflectType ElementType, void *Elements, const void *Data, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, CCMemoryZone Zone, CCAllocatorType Allocator)
+{
+    CCAssertLog(Index, "Index must not be null");
+    CCAssertLog(Chunk < Index->chunks, "Chunk must not exceed bounds");
+    CCAssertLog(ElementType, "ElementType must not be null");
+    CCAssertLog(Elements, "Elements must not be null");
+    
+    const size_t Start = Chunk * Index->elements, Count = CCMin(Index->elements, Index->count - Start);
+    const size_t ElementSize = CCReflectTypeSize(ElementType);
+    
+    CCReflectStreamMemory Stream = CC_REFLECT_STREAM_MEMORY(Data + Index->offsets[Chunk], Index->offsets[Chunk + 1] - Index->offsets[Chunk]);
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        CCReflectDeserializeBinary(ElementType, Elements + (ElementSize * Loop), SerializedEndianness, PreferVariableLength, &Stream, (CCReflectStreamReader)CCReflectStreamMemoryRead, Zone, Allocator);
+    }
+    
+    return Count;
+}
@@ -0,0 +1,140 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_ReflectChunked_h
+#define CommonC_ReflectChunked_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Reflect.h>
+#include <CommonC/TaskQueue.h>
+
+/*!
+ * @brief The default number of elements per chunk.
+ */
+#define CC_REFLECT_CHUNKED_DEFAULT_ELEMENTS 65536
+
+/*!
+ * @brief The chunk index of chunked binary data.
+ * @description The chunked binary format is as follows:
+ *
+ *              [count:n][elements:n][size:n]..[size:n][chunk]..[chunk]
+ *
+ *              Where count is the total number of elements, elements is the number of elements per chunk (the last
+ *              chunk may be smaller), and a size (variable length integer) is stored for each chunk. Each chunk is
+ *              the binary serialization of its elements, and can be deserialized independently of any other chunk.
+ */
+typedef struct {
+    /// The total number of elements.
+    size_t count;
+    /// The number of elements per chunk.
+    size_t elements;
+    /// The number of chunks.
+    size_t chunks;
+    /// The offsets of each chunk from the start of the data, with an additional entry for the end of the last chunk.
+    size_t offsets[];
+} CCReflectChunkedIndex;
+
+#pragma mark - Serialization
+
+/*!
+ * @brief Serialize the elements of an array or enumerable into independent chunks.
+ * @description Each chunk is serialized as a separate task on the task queue. The calling thread will also execute
+ *              chunks until they have all completed, so will make progress regardless of whether there are any other
+ *              threads servicing the queue.
+ *
+ * @param Type The reflected type of the array or enumerable.
+ * @param Data The data to be serialized.
+ * @param ChunkElements The number of elements per chunk. Use @b CC_REFLECT_CHUNKED_DEFAULT_ELEMENTS for the default.
+ * @param SerializedEndianness The endianness the binary data should be serialized to.
+ * @param PreferVariableLength The minimum size of any fixed sized integers that should be serialized using the variable
+ *        length integer format.
+ *
+ * @param Stream The stream to write the serialized data to.
+ * @param Write The writer to use to write the serialized data.
+ * @param Queue The task queue to use, or NULL to use the default task queue.
+ */
+void CCReflectSerializeBinaryChunked(CCReflectType Type, const void *Data, size_t ChunkElements, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, void *Stream, CCReflectStreamWriter Write, CCTaskQueue Queue);
+
+/*!
+ * @brief Deserialize chunked binary data into an array or enumerable.
+ * @description Each chunk is deserialized as a separate task on the task queue. The calling thread will also execute
+ *              chunks until they have all completed.
+ *
+ * @note If the element type needs to allocate from the memory zone (enumerables, opaque types, static pointers), the
+ *       chunks will be deserialized on the calling thread as the memory zone is not thread safe.
+ *
+ * @param Type The reflected type of the array or enumerable.
+ * @param Data A pointer to where to store the deserialized data.
+ * @param SerializedEndianness The endianness of the binary data.
+ * @param PreferVariableLength The minimum size of any fixed sized integers that are stored using the variable length
+ *        integer format.
+ *
+ * @param Stream The stream to read the serialized data from.
+ * @param Read The reader to use to read the serialized data.
+ * @param Queue The task queue to use, or NULL to use the default task queue.
+ * @param Zone The memory zone to be used for internal allocations.
+ * @param Allocator The allocator to be used as the default allocator.
+ * @return Whether the data could be deserialized. This will fail if the number of elements does not match the array.
+ */
+_Bool CCReflectDeserializeBinaryChunked(CCReflectType Type, void *Data, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, void *Stream, CCReflectStreamReader Read, CCTaskQueue Queue, CCMemoryZone Zone, CCAllocatorType Allocator);
+
+#pragma mark - Index
+
+/*!
+ * @brief Create the chunk index for chunked binary data.
+ * @param Allocator The allocator to be used for the allocation.
+ * @param Data The chunked binary data.
+ * @param Size The size of the binary data.
+ * @return The chunk index, or NULL if the data is malformed. Must be destroyed to free the memory.
+ */
+CC_NEW CCReflectChunkedIndex *CCReflectChunkedIndexCreate(CCAllocatorType Allocator, const void *Data, size_t Size);
+
+/*!
+ * @brief Destroy a chunk index.
+ * @param Index The chunk index to be destroyed.
+ */
+void CCReflectChunkedIndexDestroy(CCReflectChunkedIndex *CC_DESTROY(Index));
+
+/*!
+ * @brief Deserialize a single chunk.
+ * @description Allows chunks to be seeked to and read independently.
+ * @param Index The chunk index.
+ * @param Chunk The chunk to be deserialized.
+ * @param ElementType The reflected type of the elements.
+ * @param Elements A pointer to where to store the deserialized elements. Must be large enough to store the elements of
+ *        the chunk.
+ *
+ * @param Data The chunked binary data.
+ * @param SerializedEndianness The endianness of the binary data.
+ * @param PreferVariableLength The minimum size of any fixed sized integers that are stored using the variable length
+ *        integer format.
+ *
+ * @param Zone The memory zone to be used for internal allocations.
+ * @param Allocator The allocator to be used as the default allocator.
+ * @return The number of elements deserialized.
+ */
+size_t CCReflectDeserializeBinaryChunk(const CCReflectChunkedIndex *Index, size_t Chunk, CCReflectType ElementType, void *Elements, const void *Data, CCReflectEndian SerializedEndianness, size_t PreferVariableLength, CCMemoryZone Zone, CCAllocatorType Allocator);
+
+#endif
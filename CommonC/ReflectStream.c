@@ -26,6 +26,8 @@
 #include "ReflectStream.h"
 #include "Platform.h"
 #include "Swap.h"
+#include "Maths.h"
+#include <string.h>
 
 #pragma mark - File
 
@@ -49,6 +51,172 @@ void CCReflectStreamFileWrite(CCReflectStreamFile *Stream, const void *Data, siz
     }
 }
 
+#pragma mark - Memory
+
+void CCReflectStreamMemoryRead(CCReflectStreamMemory *Stream, void *Data, size_t Size)
+{
+    if ((Stream->size - Stream->offset) < Size)
+    {
+        memset(Data, 0, Size);
+        Stream->failure.count++;
+        
+        return;
+    }
+    
+    memcpy(Data, Stream->data + Stream->offset, Size);
+    Stream->offset += Size;
+}
+
+void CCReflectStreamMemoryWrite(CCReflectStreamMemory *Stream, const void *Data, size_t Size)
+{
+    if ((Stream->size - Stream->offset) < Size)
+    {
+        Stream->failure.count++;
+        
+        return;
+    }
+    
+    memcpy(Stream->data + Stream->offset, Data, Size);
+    Stream->offset += Size;
+}
+
+void CCReflectStreamArrayWrite(CCArray Array, const void *Data, size_t Size)
+{
+    CCAssertLog(CCArrayGetElementSize(Array) == 1, "Array must have an element size of 1");
+    
+    if (Size) CCArrayAppendElements(Array, Data, Size);
+}
+
+#pragma mark - Buffered
+
+void CCReflectStreamBufferedWriteFlush(CCReflectStreamBuffered *Stream)
+{
+    if (Stream->buffer.count)
+    {
+        Stream->into.write(Stream->into.stream, Stream->buffer.data, Stream->buffer.count);
+        Stream->buffer.count = 0;
+    }
+}
+
+void CCReflectStreamBufferedWrite(CCReflectStreamBuffered *Stream, const void *Data, size_t Size)
+{
+    if ((Stream->buffer.size - Stream->buffer.count) < Size)
+    {
+        CCReflectStreamBufferedWriteFlush(Stream);
+        
+        if (Stream->buffer.size < Size)
+        {
+            Stream->into.write(Stream->into.stream, Data, Size);
+            
+            return;
+        }
+    }
+    
+    memcpy(Stream->buffer.data + Stream->buffer.count, Data, Size);
+    Stream->buffer.count += Size;
+}
+
+#pragma mark - Vector
+
+void CCReflectStreamVectorWriteFlush(CCReflectStreamVector *Stream)
+{
+    if (Stream->vectors.count)
+    {
+        Stream->write(Stream->stream, Stream->vectors.buffers, Stream->vectors.count);
+        
+        Stream->vectors.count = 0;
+    }
+    
+    Stream->staging.count = 0;
+}
+
+void CCReflectStreamVectorWrite(CCReflectStreamVector *Stream, const void *Data, size_t Size)
+{
+    if (!Size) return;
+    
+    if (Size >= Stream->reference)
+    {
+        if (Stream->vectors.count == Stream->vectors.max) CCReflectStreamVectorWriteFlush(Stream);
+        
+        Stream->vectors.buffers[Stream->vectors.count++] = (CCReflectStreamVectorBuffer){ .data = Data, .size = Size };
+        
+        return;
+    }
+    
+    if ((Stream->staging.size - Stream->staging.count) < Size)
+    {
+        CCReflectStreamVectorWriteFlush(Stream);
+        
+        if (Stream->staging.size < Size)
+        {
+            Stream->write(Stream->stream, &(CCReflectStreamVectorBuffer){ .data = Data, .size = Size }, 1);
+            
+            return;
+        }
+    }
+    
+    uint8_t *Staged = Stream->staging.data + Stream->staging.count;
+    
+    memcpy(Staged, Data, Size);
+    Stream->staging.count += Size;
+    
+    if (Stream->vectors.count)
+    {
+        CCReflectStreamVectorBuffer *Last = &Stream->vectors.buffers[Stream->vectors.count - 1];
+        
+        if ((Last->data + Last->size) == Staged)
+        {
+            Last->size += Size;
+            
+            return;
+        }
+        
+        if (Stream->vectors.count == Stream->vectors.max)
+        {
+            Stream->write(Stream->stream, Stream->vectors.buffers, Stream->vectors.count);
+            
+            Stream->vectors.count = 0;
+        }
+    }
+    
+    Stream->vectors.buffers[Stream->vectors.count++] = (CCReflectStreamVectorBuffer){ .data = Staged, .size = Size };
+}
+
+void CCReflectStreamFileWriteVector(CCReflectStreamFile *Stream, const CCReflectStreamVectorBuffer *Buffers, size_t Count)
+{
+    //File handles have no vectored write, so gather the buffers to issue as few writes as possible
+    uint8_t Gathered[4096];
+    size_t Size = 0;
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        const CCReflectStreamVectorBuffer *Buffer = &Buffers[Loop];
+        
+        if (!Buffer->size) continue;
+        
+        if ((Size + Buffer->size) > sizeof(Gathered))
+        {
+            if (Size)
+            {
+                CCReflectStreamFileWrite(Stream, Gathered, Size);
+                Size = 0;
+            }
+            
+            if (Buffer->size > sizeof(Gathered))
+            {
+                CCReflectStreamFileWrite(Stream, Buffer->data, Buffer->size);
+                
+                continue;
+            }
+        }
+        
+        memcpy(Gathered + Size, Buffer->data, Buffer->size);
+        Size += Buffer->size;
+    }
+    
+    if (Size) CCReflectStreamFileWrite(Stream, Gathered, Size);
+}
+
 #pragma mark - RLE
 
 void CCReflectStreamRLEWriteFlush(CCReflectStreamRLE *Stream)
@@ -190,3 +358,281 @@ void CCReflectStreamRLEReadContinue(CCReflectStreamRLE *Stream, void *Data, size
     
     Stream->into.read(Stream->into.stream, Data, Size);
 }
+
+#pragma mark - LZ
+
+#define CC_REFLECT_STREAM_LZ_MIN_MATCH 4
+#define CC_REFLECT_STREAM_LZ_MAX_OFFSET 65535
+#define CC_REFLECT_STREAM_LZ_LAST_LITERALS 5
+#define CC_REFLECT_STREAM_LZ_MATCH_LIMIT 12
+#define CC_REFLECT_STREAM_LZ_STORED 0x80000000
+
+static inline uint32_t CCReflectStreamLZLoad32(const uint8_t *Data)
+{
+    uint32_t Value;
+    memcpy(&Value, Data, sizeof(Value));
+    
+    return Value;
+}
+
+static inline uint8_t *CCReflectStreamLZWriteLength(uint8_t *Output, size_t Length)
+{
+    for ( ; Length >= 255; Length -= 255) *Output++ = 255;
+    
+    *Output++ = (uint8_t)Length;
+    
+    return Output;
+}
+
+static inline uint8_t *CCReflectStreamLZWriteSequence(uint8_t *Output, const uint8_t *Literals, size_t LiteralLength, size_t Offset, size_t MatchLength)
+{
+    uint8_t *Token = Output++;
+    
+    *Token = (LiteralLength < 15 ? LiteralLength : 15) << 4;
+    
+    if (LiteralLength >= 15) Output = CCReflectStreamLZWriteLength(Output, LiteralLength - 15);
+    
+    memcpy(Output, Literals, LiteralLength);
+    Output += LiteralLength;
+    
+    if (MatchLength)
+    {
+        *Output++ = Offset & 0xff;
+        *Output++ = Offset >> 8;
+        
+        MatchLength -= CC_REFLECT_STREAM_LZ_MIN_MATCH;
+        *Token |= MatchLength < 15 ? MatchLength : 15;
+        
+        if (MatchLength >= 15) Output = CCReflectStreamLZWriteLength(Output, MatchLength - 15);
+    }
+    
+    return Output;
+}
+
+static size_t CCReflectStreamLZCompress(const uint8_t *Input, size_t Size, uint8_t *Output, uint32_t *Table)
+{
+    uint8_t *Start = Output;
+    size_t Anchor = 0;
+    
+    if (Size > CC_REFLECT_STREAM_LZ_MATCH_LIMIT)
+    {
+        memset(Table, 0, sizeof(uint32_t) * CC_REFLECT_STREAM_LZ_TABLE_COUNT);
+        
+        const size_t MatchLimit = Size - CC_REFLECT_STREAM_LZ_MATCH_LIMIT, LengthLimit = Size - CC_REFLECT_STREAM_LZ_LAST_LITERALS;
+        
+        for (size_t Index = 0; Index < MatchLimit; )
+        {
+            const uint32_t Sequence = CCReflectStreamLZLoad32(Input + Index);
+            const uint32_t Hash = (Sequence * UINT32_C(2654435761)) >> 20;
+            const size_t Candidate = Table[Hash];
+            
+            Table[Hash] = (uint32_t)(Index + 1);
+            
+            if ((Candidate) && ((Index - (Candidate - 1)) <= CC_REFLECT_STREAM_LZ_MAX_OFFSET) && (CCReflectStreamLZLoad32(Input + (Candidate - 1)) == Sequence))
+            {
+                size_t Match = Candidate - 1;
+                
+                while ((Index > Anchor) && (Match) && (Input[Index - 1] == Input[Match - 1]))
+                {
+                    Index--;
+                    Match--;
+                }
+                
+                size_t Length = CC_REFLECT_STREAM_LZ_MIN_MATCH;
+                while (((Index + Length) < LengthLimit) && (Input[Index + Length] == Input[Match + Length])) Length++;
+                
+                Output = CCReflectStreamLZWriteSequence(Output, Input + Anchor, Index - Anchor, Index - Match, Length);
+                
+                Index += Length;
+                Anchor = Index;
+            }
+            
+            else Index += 1 + ((Index - Anchor) >> 6);
+        }
+    }
+    
+    Output = CCReflectStreamLZWriteSequence(Output, Input + Anchor, Size - Anchor, 0, 0);
+    
+    return Output - Start;
+}
+
+static _Bool CCReflectStreamLZDecompress(const uint8_t *Input, size_t Size, uint8_t *Output, size_t OutputSize)
+{
+    const uint8_t *End = Input + Size;
+    uint8_t *Start = Output, *OutputEnd = Output + OutputSize;
+    
+    while (Input < End)
+    {
+        const uint8_t Token = *Input++;
+        
+        size_t Length = Token >> 4;
+        if (Length == 15)
+        {
+            uint8_t Byte;
+            do {
+                if (Input == End) return FALSE;
+                
+                Byte = *Input++;
+                Length += Byte;
+            } while (Byte == 255);
+        }
+        
+        if ((Length > (size_t)(End - Input)) || (Length > (size_t)(OutputEnd - Output))) return FALSE;
+        
+        memcpy(Output, Input, Length);
+        Input += Length;
+        Output += Length;
+        
+        if (Input == End) break;
+        
+        if ((End - Input) < 2) return FALSE;
+        
+        const size_t Offset = Input[0] | ((size_t)Input[1] << 8);
+        Input += 2;
+        
+        if ((!Offset) || (Offset > (size_t)(Output - Start))) return FALSE;
+        
+        Length = Token & 15;
+        if (Length == 15)
+        {
+            uint8_t Byte;
+            do {
+                if (Input == End) return FALSE;
+                
+                Byte = *Input++;
+                Length += Byte;
+            } while (Byte == 255);
+        }
+        
+        Length += CC_REFLECT_STREAM_LZ_MIN_MATCH;
+        
+        if (Length > (size_t)(OutputEnd - Output)) return FALSE;
+        
+        const uint8_t *Match = Output - Offset;
+        
+        if (Offset >= Length) memcpy(Output, Match, Length);
+        else for (size_t Loop = 0; Loop < Length; Loop++) Output[Loop] = Match[Loop];
+        
+        Output += Length;
+    }
+    
+    return Output == OutputEnd;
+}
+
+static inline void CCReflectStreamLZWriteHeaderValue(uint8_t *Header, uint32_t Value)
+{
+    Header[0] = Value & 0xff;
+    Header[1] = (Value >> 8) & 0xff;
+    Header[2] = (Value >> 16) & 0xff;
+    Header[3] = Value >> 24;
+}
+
+static inline uint32_t CCReflectStreamLZReadHeaderValue(const uint8_t *Header)
+{
+    return Header[0] | ((uint32_t)Header[1] << 8) | ((uint32_t)Header[2] << 16) | ((uint32_t)Header[3] << 24);
+}
+
+void CCReflectStreamLZWriteFlush(CCReflectStreamLZ *Stream)
+{
+    if (Stream->block.count)
+    {
+        const size_t Count = Stream->block.count;
+        size_t Size = CCReflectStreamLZCompress(Stream->block.data, Count, Stream->compressed, Stream->table);
+        
+        uint8_t Header[8];
+        CCReflectStreamLZWriteHeaderValue(Header + 4, (uint32_t)Count);
+        
+        if (Size < Count)
+        {
+            CCReflectStreamLZWriteHeaderValue(Header, (uint32_t)Size);
+            
+            Stream->into.write(Stream->into.stream, Header, sizeof(Header));
+            Stream->into.write(Stream->into.stream, Stream->compressed, Size);
+        }
+        
+        else
+        {
+            CCReflectStreamLZWriteHeaderValue(Header, (uint32_t)Count | CC_REFLECT_STREAM_LZ_STORED);
+            
+            Stream->into.write(Stream->into.stream, Header, sizeof(Header));
+            Stream->into.write(Stream->into.stream, Stream->block.data, Count);
+        }
+        
+        Stream->block.count = 0;
+    }
+}
+
+void CCReflectStreamLZWrite(CCReflectStreamLZ *Stream, const void *Data, size_t Size)
+{
+    while (Size)
+    {
+        const size_t Count = CCMin(Size, Stream->block.size - Stream->block.count);
+        
+        memcpy(Stream->block.data + Stream->block.count, Data, Count);
+        Stream->block.count += Count;
+        
+        Data += Count;
+        Size -= Count;
+        
+        if (Stream->block.count == Stream->block.size) CCReflectStreamLZWriteFlush(Stream);
+    }
+}
+
+static _Bool CCReflectStreamLZReadBlock(CCReflectStreamLZ *Stream)
+{
+    uint8_t Header[8];
+    Stream->into.read(Stream->into.stream, Header, sizeof(Header));
+    
+    const uint32_t Size = CCReflectStreamLZReadHeaderValue(Header);
+    const size_t Count = CCReflectStreamLZReadHeaderValue(Header + 4);
+    
+    Stream->block.count = 0;
+    Stream->block.offset = 0;
+    
+    if ((!Count) || (Count > Stream->block.size)) return FALSE;
+    
+    if (Size & CC_REFLECT_STREAM_LZ_STORED)
+    {
+        if ((Size & ~CC_REFLECT_STREAM_LZ_STORED) != Count) return FALSE;
+        
+        Stream->into.read(Stream->into.stream, Stream->block.data, Count);
+    }
+    
+    else
+    {
+        if (Size > CC_REFLECT_STREAM_LZ_BOUND(Stream->block.size)) return FALSE;
+        
+        Stream->into.read(Stream->into.stream, Stream->compressed, Size);
+        
+        if (!CCReflectStreamLZDecompress(Stream->compressed, Size, Stream->block.data, Count)) return FALSE;
+    }
+    
+    Stream->block.count = Count;
+    
+    return TRUE;
+}
+
+void CCReflectStreamLZRead(CCReflectStreamLZ *Stream, void *Data, size_t Size)
+{
+    while (Size)
+    {
+        if (Stream->block.offset == Stream->block.count)
+        {
+            if (!CCReflectStreamLZReadBlock(Stream))
+            {
+                memset(Data, 0, Size);
+                Stream->failure.count++;
+                
+                return;
+            }
+        }
+        
+        const size_t Count = CCMin(Size, Stream->block.count - Stream->block.offset);
+        
+        memcpy(Data, Stream->block.data + Stream->block.offset, Count);
+        Stream->block.offset += Count;
+        
+        Data += Count;
+        Size -= Count;
+    }
+}
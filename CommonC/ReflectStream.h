@@ -30,6 +30,7 @@
 #include <CommonC/BitSets.h>
 #include <CommonC/Reflect.h>
 #include <CommonC/FileHandle.h>
+#include <CommonC/Array.h>
 
 typedef struct {
     void *stream;
@@ -76,6 +77,157 @@ void CCReflectStreamFileRead(CCReflectStreamFile *Stream, void *Data, size_t Siz
  */
 void CCReflectStreamFileWrite(CCReflectStreamFile *Stream, const void *Data, size_t Size);
 
+#pragma mark - Memory
+
+typedef struct {
+    void *data;
+    size_t size;
+    size_t offset;
+    struct {
+        size_t count;
+    } failure;
+} CCReflectStreamMemory;
+
+#define CC_REFLECT_STREAM_MEMORY(data_, size_) (CCReflectStreamMemory){ .data = (void*)(data_), .size = size_, .offset = 0, .failure = { .count = 0 } }
+
+/*!
+ * @brief Read from a memory stream.
+ * @description Reads directly from the memory, so can be used to deserialize from a mapped or preloaded buffer. If the read
+ *              exceeds the bounds of the memory, the output is zeroed and @b failure.count is incremented.
+ *
+ * @note Compatible as a @b CCReflectStreamReader.
+ * @param Stream The memory stream.
+ * @param Data The output data.
+ * @param Size The size of the data to read.
+ */
+void CCReflectStreamMemoryRead(CCReflectStreamMemory *Stream, void *Data, size_t Size);
+
+/*!
+ * @brief Write to a memory stream.
+ * @description If the write exceeds the bounds of the memory, nothing is written and @b failure.count is incremented.
+ * @note Compatible as a @b CCReflectStreamWriter.
+ * @param Stream The memory stream.
+ * @param Data The input data.
+ * @param Size The size of the data.
+ */
+void CCReflectStreamMemoryWrite(CCReflectStreamMemory *Stream, const void *Data, size_t Size);
+
+/*!
+ * @brief Write to a growable array.
+ * @note Compatible as a @b CCReflectStreamWriter.
+ * @param Array The array to append the data to. Must have an element size of 1.
+ * @param Data The input data.
+ * @param Size The size of the data.
+ */
+void CCReflectStreamArrayWrite(CCArray Array, const void *Data, size_t Size);
+
+#pragma mark - Buffered
+
+typedef struct {
+    CCReflectStream into;
+    struct {
+        uint8_t *data;
+        size_t size;
+        size_t count;
+    } buffer;
+} CCReflectStreamBuffered;
+
+#define CC_REFLECT_STREAM_WRITE_BUFFERED(stream, writer, data_, size_) (CCReflectStreamBuffered){ .into = { stream, .write = writer }, .buffer = { .data = data_, .size = size_, .count = 0 } }
+
+/*!
+ * @brief Write to a buffered stream.
+ * @description Accumulates the writes in the buffer and only passes them to the underlying stream once the buffer is full,
+ *              so many small writes become a few large ones.
+ *
+ * @warning If the write is the last call it should be followed by a @b CCReflectStreamBufferedWriteFlush to write any
+ *          remaining buffered data.
+ *
+ * @note Compatible as a @b CCReflectStreamWriter.
+ * @param Stream The buffered stream.
+ * @param Data The input data.
+ * @param Size The size of the data.
+ */
+void CCReflectStreamBufferedWrite(CCReflectStreamBuffered *Stream, const void *Data, size_t Size);
+
+/*!
+ * @brief Flush the buffered data to the underlying stream.
+ * @param Stream The buffered stream.
+ */
+void CCReflectStreamBufferedWriteFlush(CCReflectStreamBuffered *Stream);
+
+#pragma mark - Vector
+
+typedef struct {
+    const void *data;
+    size_t size;
+} CCReflectStreamVectorBuffer;
+
+/*!
+ * @brief A vectored writer, similar to writev.
+ * @param Stream The stream.
+ * @param Buffers The buffers to be written in order.
+ * @param Count The number of buffers.
+ */
+typedef void (*CCReflectStreamVectorWriter)(void *Stream, const CCReflectStreamVectorBuffer *Buffers, size_t Count);
+
+typedef struct {
+    void *stream;
+    CCReflectStreamVectorWriter write;
+    struct {
+        CCReflectStreamVectorBuffer *buffers;
+        size_t max;
+        size_t count;
+    } vectors;
+    struct {
+        uint8_t *data;
+        size_t size;
+        size_t count;
+    } staging;
+    /// The minimum size of a write that should be referenced rather than copied into the staging buffer.
+    size_t reference;
+} CCReflectStreamVector;
+
+#define CC_REFLECT_STREAM_WRITE_VECTOR(stream_, writer, buffers_, max_, data_, size_, reference_) (CCReflectStreamVector){ .stream = stream_, .write = writer, .vectors = { .buffers = buffers_, .max = max_, .count = 0 }, .staging = { .data = data_, .size = size_, .count = 0 }, .reference = reference_ }
+
+/*!
+ * @brief Write to a vectored stream.
+ * @description Small writes are copied into the staging buffer, while writes of at least @b reference size are referenced
+ *              directly. The collected buffers are passed to the writer in a single call once either the staging buffer
+ *              or the vectors are full.
+ *
+ * @warning Referenced data must remain valid until the stream has been flushed. Set @b reference to SIZE_MAX if the
+ *          data passed to the writes is not guaranteed to outlive the call (such as when serializing).
+ *
+ *          If the write is the last call it should be followed by a @b CCReflectStreamVectorWriteFlush to write any
+ *          remaining data.
+ *
+ * @note Compatible as a @b CCReflectStreamWriter.
+ * @param Stream The vectored stream.
+ * @param Data The input data.
+ * @param Size The size of the data.
+ */
+void CCReflectStreamVectorWrite(CCReflectStreamVector *Stream, const void *Data, size_t Size);
+
+/*!
+ * @brief Flush the collected buffers to the writer.
+ * @param Stream The vectored stream.
+ */
+void CCReflectStreamVectorWriteFlush(CCReflectStreamVector *Stream);
+
+/*!
+ * @brief Write the buffers to a file stream.
+ * @description The result and failure fields of the stream are handled the same as @b CCReflectStreamFileWrite.
+ *
+ * @performance File handles have no vectored write, so the buffers are gathered into a small buffer and
+ *              written together. Buffers larger than it are written directly.
+ *
+ * @note Compatible as a @b CCReflectStreamVectorWriter.
+ * @param Stream The file handle.
+ * @param Buffers The buffers to be written in order.
+ * @param Count The number of buffers.
+ */
+void CCReflectStreamFileWriteVector(CCReflectStreamFile *Stream, const CCReflectStreamVectorBuffer *Buffers, size_t Count);
+
 #pragma mark - RLE
 
 typedef struct {
@@ -146,4 +298,101 @@ void CCReflectStreamRLEWriteContinue(CCReflectStreamRLE *Stream, const void *Dat
  */
 void CCReflectStreamRLEWriteFlush(CCReflectStreamRLE *Stream);
 
+
+#pragma mark - LZ
+
+/*!
+ * @brief The maximum size of a compressed block.
+ * @param size The size of the uncompressed block.
+ */
+#define CC_REFLECT_STREAM_LZ_BOUND(size) ((size) + ((size) / 255) + 16)
+
+/*!
+ * @brief The number of entries in the match table used when compressing.
+ */
+#define CC_REFLECT_STREAM_LZ_TABLE_COUNT 4096
+
+/*!
+ * @brief The size of the buffer needed to read an LZ stream.
+ * @param blockSize The block size of the stream.
+ */
+#define CC_REFLECT_STREAM_READ_LZ_BUFFER_SIZE(blockSize) ((blockSize) + CC_REFLECT_STREAM_LZ_BOUND(blockSize))
+
+/*!
+ * @brief The size of the buffer needed to write an LZ stream.
+ * @param blockSize The block size of the stream.
+ */
+#define CC_REFLECT_STREAM_WRITE_LZ_BUFFER_SIZE(blockSize) ((sizeof(uint32_t) * CC_REFLECT_STREAM_LZ_TABLE_COUNT) + CC_REFLECT_STREAM_READ_LZ_BUFFER_SIZE(blockSize))
+
+typedef struct {
+    CCReflectStream into;
+    struct {
+        uint8_t *data;
+        size_t size;
+        size_t count;
+        size_t offset;
+    } block;
+    uint8_t *compressed;
+    uint32_t *table;
+    struct {
+        size_t count;
+    } failure;
+} CCReflectStreamLZ;
+
+/*!
+ * @brief Create an LZ read stream.
+ * @param stream The underlying stream.
+ * @param reader The underlying reader.
+ * @param buffer The working buffer. Must be at least @b CC_REFLECT_STREAM_READ_LZ_BUFFER_SIZE in size.
+ * @param blockSize The maximum size of the uncompressed blocks. Must match the block size the stream was written with.
+ */
+#define CC_REFLECT_STREAM_READ_LZ(stream, reader, buffer, blockSize) (CCReflectStreamLZ){ .into = { stream, .read = reader }, .block = { .data = (uint8_t*)(buffer), .size = blockSize, .count = 0, .offset = 0 }, .compressed = (uint8_t*)(buffer) + (blockSize), .table = NULL, .failure = { .count = 0 } }
+
+/*!
+ * @brief Create an LZ write stream.
+ * @param stream The underlying stream.
+ * @param writer The underlying writer.
+ * @param buffer The working buffer. Must be at least @b CC_REFLECT_STREAM_WRITE_LZ_BUFFER_SIZE in size, and aligned to 4 bytes.
+ * @param blockSize The size of the uncompressed blocks. Must not exceed 2GB. A block size of 64KB or larger is
+ *        recommended, as matches are only found within a block.
+ */
+#define CC_REFLECT_STREAM_WRITE_LZ(stream, writer, buffer, blockSize) (CCReflectStreamLZ){ .into = { stream, .write = writer }, .block = { .data = (uint8_t*)(buffer) + (sizeof(uint32_t) * CC_REFLECT_STREAM_LZ_TABLE_COUNT), .size = blockSize, .count = 0, .offset = 0 }, .compressed = (uint8_t*)(buffer) + (sizeof(uint32_t) * CC_REFLECT_STREAM_LZ_TABLE_COUNT) + (blockSize), .table = (uint32_t*)(buffer), .failure = { .count = 0 } }
+
+/*!
+ * @brief Read from an LZ stream.
+ * @description Blocks are read from the underlying stream and decompressed as they're needed. If a block is malformed,
+ *              the output is zeroed and @b failure.count is incremented.
+ *
+ * @note Compatible as a @b CCReflectStreamReader.
+ * @param Stream The LZ stream.
+ * @param Data The output data.
+ * @param Size The size of the data to read.
+ */
+void CCReflectStreamLZRead(CCReflectStreamLZ *Stream, void *Data, size_t Size);
+
+/*!
+ * @brief Write to an LZ stream.
+ * @description Writes are accumulated into a block, and each block is compressed independently using an LZ77 (LZ4 block
+ *              format) compressor once it is full. Each block is framed as follows:
+ *
+ *              [compressed size:31][stored:1][uncompressed size:32][data:n]
+ *
+ *              Where the sizes are little endian, and if the block could not be compressed it is stored as is.
+ *
+ * @warning If the write is the last call it should be followed by a @b CCReflectStreamLZWriteFlush to write the final
+ *          block.
+ *
+ * @note Compatible as a @b CCReflectStreamWriter.
+ * @param Stream The LZ stream.
+ * @param Data The input data.
+ * @param Size The size of the data.
+ */
+void CCReflectStreamLZWrite(CCReflectStreamLZ *Stream, const void *Data, size_t Size);
+
+/*!
+ * @brief Compress and write the current block.
+ * @param Stream The LZ stream.
+ */
+void CCReflectStreamLZWriteFlush(CCReflectStreamLZ *Stream);
+
 #endif
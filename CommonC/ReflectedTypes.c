@@ -156,6 +156,7 @@ const char *CCReflectTypeNameDefaults(CCReflectType Type)
             else if (Type == &CC_REFLECT(CCString)) return "CCString";
             else if (Type == &CC_REFLECT(CCBigInt)) return "CCBigInt";
             else if (Type == &CC_REFLECT(CCBigIntFast)) return "CCBigIntFast";
+            else if (Type == &CC_REFLECT(CCCompressedBitmap)) return "CCCompressedBitmap";
             else if (Type == &CC_REFLECT(ARRAY(char, v8))) return "char[8]";
             else if (Type == &CC_REFLECT(ARRAY(char, v16))) return "char[16]";
             else if (Type == &CC_REFLECT(ARRAY(char, v32))) return "char[32]";
@@ -578,17 +579,16 @@ void CCBigIntMapper(CCReflectType Type, const void *Data, void *Args, CCReflectT
     
     else if (Intent == CCReflectMapIntentSerialize)
     {
-        const size_t Count = CCListGetCount(Integer->value);
+        const size_t Count = CCBigIntGetComponentCount(Integer);
         uint64_t *Components = CCMemoryZoneAllocate(Zone, sizeof(uint64_t) * (Count + 1));
         
-        CCEnumerable Enumerable;
-        CCListGetEnumerable(Integer->value, &Enumerable);
-        
-        size_t Loop = 0, Remainder = Integer->sign;
-        for (const uint64_t *Component = CCEnumerableGetCurrent(&Enumerable); Component; Component = CCEnumerableNext(&Enumerable))
+        size_t Loop = 0, Remainder = CCBigIntGetSign(Integer);
+        for ( ; Loop < Count; Loop++)
         {
-            Components[Loop++] = (*Component << 1) | Remainder;
-            Remainder = *Component >> 63;
+            const uint64_t Component = CCBigIntGetComponent(Integer, Loop);
+            
+            Components[Loop] = (Component << 1) | Remainder;
+            Remainder = Component >> 63;
         }
         
         if (Remainder)
@@ -629,25 +629,8 @@ void CCBigIntUnmapper(CCReflectType Type, CCReflectType MappedType, const void *
     {
         CCBigInt Integer = CCBigIntCreate(Allocator);
         
-        CCListRemoveAllElements(Integer->value);
-        
-        Integer->sign = ((const uint64_t*)Data)[0] & 1;
-        
-        uint64_t Component = ((const uint64_t*)Data)[0] >> 1;
-        
-        for (size_t Loop = 1, Count = ((const CCReflectArray*)MappedType)->count; Loop < Count; Loop++)
-        {
-            Component |= (((const uint64_t*)Data)[Loop] & 1) << 63;
-            
-            CCListAppendElement(Integer->value, &Component);
-            
-            Component = ((const uint64_t*)Data)[Loop] >> 1;
-        }
-        
-        if (Component)
-        {
-            CCListAppendElement(Integer->value, &Component);
-        }
+        CCBigIntSetComponents(Integer, Data, ((const CCReflectArray*)MappedType)->count, ((const uint64_t*)Data)[0] & 1);
+        CCBigIntShiftRight(Integer, 1);
         
         Handler(&CC_REFLECT(PTYPE(void, retain, dynamic)), &Integer, Args);
         
@@ -692,17 +675,16 @@ static void CCBigIntFastMapper(CCReflectType Type, const void *Data, void *Args,
         
         else
         {
-            const size_t Count = CCListGetCount(((CCBigInt)Integer)->value);
+            const size_t Count = CCBigIntGetComponentCount((CCBigInt)Integer);
             uint64_t *Components = CCMemoryZoneAllocate(Zone, sizeof(uint64_t) * (Count + 1));
             
-            CCEnumerable Enumerable;
-            CCListGetEnumerable(((CCBigInt)Integer)->value, &Enumerable);
-            
-            size_t Loop = 0, Remainder = ((CCBigInt)Integer)->sign;
-            for (const uint64_t *Component = CCEnumerableGetCurrent(&Enumerable); Component; Component = CCEnumerableNext(&Enumerable))
+            size_t Loop = 0, Remainder = CCBigIntGetSign((CCBigInt)Integer);
+            for ( ; Loop < Count; Loop++)
             {
-                Components[Loop++] = (*Component << 1) | Remainder;
-                Remainder = *Component >> 63;
+                const uint64_t Component = CCBigIntGetComponent((CCBigInt)Integer, Loop);
+                
+                Components[Loop] = (Component << 1) | Remainder;
+                Remainder = Component >> 63;
             }
             
             if (Remainder)
@@ -744,29 +726,56 @@ void CCBigIntFastUnmapper(CCReflectType Type, CCReflectType MappedType, const vo
     {
         CCBigInt Integer = CCBigIntCreate(Allocator);
         
-        CCListRemoveAllElements(Integer->value);
+        CCBigIntSetComponents(Integer, Data, ((const CCReflectArray*)MappedType)->count, ((const uint64_t*)Data)[0] & 1);
+        CCBigIntShiftRight(Integer, 1);
         
-        Integer->sign = ((const uint64_t*)Data)[0] & 1;
+        Handler(&CC_REFLECT(PTYPE(void, retain, dynamic)), &Integer, Args);
         
-        uint64_t Component = ((const uint64_t*)Data)[0] >> 1;
+        CCBigIntDestroy(Integer);
+    }
+    
+    else
+    {
+        Handler(MappedType, Data, Args);
+    }
+}
+
+#pragma mark - Compressed Bitmaps
+
+static void CCCompressedBitmapMapper(CCReflectType Type, const void *Data, void *Args, CCReflectTypeHandler Handler, CCMemoryZone Zone, CCAllocatorType Allocator, CCReflectMapIntent Intent);
+static void CCCompressedBitmapUnmapper(CCReflectType Type, CCReflectType MappedType, const void *Data, void *Args, CCReflectTypeHandler Handler, CCMemoryZone Zone, CCAllocatorType Allocator);
+
+const CCReflectOpaque CC_REFLECT(CCCompressedBitmap) = CC_REFLECT_OPAQUE(sizeof(CCCompressedBitmap), sizeof(CCReflectOpaque), CCCompressedBitmapMapper, CCCompressedBitmapUnmapper);
+
+void CCCompressedBitmapMapper(CCReflectType Type, const void *Data, void *Args, CCReflectTypeHandler Handler, CCMemoryZone Zone, CCAllocatorType Allocator, CCReflectMapIntent Intent)
+{
+    CCCompressedBitmap Bitmap;
+    
+    if ((Intent == CCReflectMapIntentTransfer) || (Intent == CCReflectMapIntentShare) || (!(Bitmap = *(CCCompressedBitmap*)Data)))
+    {
+        Handler(&CC_REFLECT(PTYPE(void, retain, dynamic)), Data, Args);
+    }
+    
+    else
+    {
+        const size_t Count = CCCompressedBitmapSerialize(Bitmap, NULL);
+        uint16_t *Words = Count ? CCMemoryZoneAllocate(Zone, sizeof(uint16_t) * Count) : NULL;
         
-        for (size_t Loop = 1, Count = ((const CCReflectArray*)MappedType)->count; Loop < Count; Loop++)
-        {
-            Component |= (((const uint64_t*)Data)[Loop] & 1) << 63;
-            
-            CCListAppendElement(Integer->value, &Component);
-            
-            Component = ((const uint64_t*)Data)[Loop] >> 1;
-        }
+        if (Words) CCCompressedBitmapSerialize(Bitmap, Words);
         
-        if (Component)
-        {
-            CCListAppendElement(Integer->value, &Component);
-        }
+        Handler(&CC_REFLECT_ARRAY(&CC_REFLECT(uint16_t), Count), Words, Args);
+    }
+}
+
+void CCCompressedBitmapUnmapper(CCReflectType Type, CCReflectType MappedType, const void *Data, void *Args, CCReflectTypeHandler Handler, CCMemoryZone Zone, CCAllocatorType Allocator)
+{
+    if (*(const CCReflectTypeID*)MappedType == CCReflectTypeArray)
+    {
+        CCCompressedBitmap Bitmap = CCCompressedBitmapCreateWithSerialized(Allocator, Data, ((const CCReflectArray*)MappedType)->count);
         
-        Handler(&CC_REFLECT(PTYPE(void, retain, dynamic)), &Integer, Args);
+        Handler(&CC_REFLECT(PTYPE(void, retain, dynamic)), &Bitmap, Args);
         
-        CCBigIntDestroy(Integer);
+        if (Bitmap) CCCompressedBitmapDestroy(Bitmap);
     }
     
     else
@@ -1009,6 +1018,8 @@ REFLECT_DYNAMIC_POINTERS(ARRAY(char, v65536));
 REFLECT_DYNAMIC_POINTERS(CCBigInt, .destructor = (CCMemoryDestructorCallback)CCBigIntDestroy);
 REFLECT_DYNAMIC_POINTERS(CCBigIntFast, .destructor = (CCMemoryDestructorCallback)CCBigIntFastDestroy);
 
+REFLECT_DYNAMIC_POINTERS(CCCompressedBitmap, .destructor = (CCMemoryDestructorCallback)CCCompressedBitmapDestroy);
+
 REFLECT_DYNAMIC_POINTERS(CCString, .destructor = (CCMemoryDestructorCallback)CCStringDestroy);
 
 REFLECT_DYNAMIC_POINTERS(CCAllocatorType);
@@ -264,6 +264,17 @@ extern const CCReflectDynamicPointer CC_REFLECT(PTYPE(CCBigIntFast, transfer, dy
 extern const CCReflectDynamicPointer CC_REFLECT(PTYPE(CCBigIntFast, retain, dynamic));
 
 
+#pragma mark - Compressed Bitmaps
+
+#include <CommonC/CompressedBitmap.h>
+
+extern const CCReflectOpaque CC_REFLECT(CCCompressedBitmap);
+
+extern const CCReflectDynamicPointer CC_REFLECT(PTYPE(CCCompressedBitmap, weak, dynamic));
+extern const CCReflectDynamicPointer CC_REFLECT(PTYPE(CCCompressedBitmap, transfer, dynamic));
+extern const CCReflectDynamicPointer CC_REFLECT(PTYPE(CCCompressedBitmap, retain, dynamic));
+
+
 #pragma mark - Strings
 
 extern const CCReflectInteger CC_REFLECT(CCChar);
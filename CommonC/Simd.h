@@ -390,6 +390,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_x_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_x_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_x_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_x_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_s8x8 INCLUDE((s8, 8))
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_s16x4 IGNORE
@@ -408,6 +418,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x8_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_s16x4 INCLUDE((s16, 4))
@@ -426,6 +446,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x4_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_s16x4 IGNORE
@@ -444,6 +474,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x2_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_s16x4 IGNORE
@@ -462,6 +502,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x8_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_s16x4 IGNORE
@@ -480,6 +530,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x4_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_s16x4 IGNORE
@@ -498,6 +558,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x2_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_s16x4 IGNORE
@@ -516,6 +586,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x2_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_s16x4 IGNORE
@@ -534,6 +614,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x16_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_s16x4 IGNORE
@@ -552,6 +642,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x8_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_s16x4 IGNORE
@@ -570,6 +670,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x4_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_s16x4 IGNORE
@@ -588,6 +698,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x2_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_s16x4 IGNORE
@@ -606,6 +726,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x16_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_s16x4 IGNORE
@@ -624,6 +754,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x8_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_s16x4 IGNORE
@@ -642,6 +782,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x4_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_s16x4 IGNORE
@@ -660,6 +810,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_u64x2 INCLUDE((u64, 2))
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x2_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_s16x4 IGNORE
@@ -678,6 +838,16 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_f32x4 INCLUDE((f32, 4))
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x4_f64x4 IGNORE
 
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_s8x8 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_s16x4 IGNORE
@@ -696,6 +866,296 @@
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_u64x2 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_f32x4 IGNORE
 #define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_f64x2 INCLUDE((f64, 2))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x2_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s8x32 INCLUDE((s8, 32))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s8x32_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s16x16 INCLUDE((s16, 16))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s16x16_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s32x8 INCLUDE((s32, 8))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s32x8_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_s64x4 INCLUDE((s64, 4))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_s64x4_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u8x32 INCLUDE((u8, 32))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u8x32_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u16x16 INCLUDE((u16, 16))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u16x16_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u32x8 INCLUDE((u32, 8))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u32x8_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_u64x4 INCLUDE((u64, 4))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_u64x4_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_f32x8 INCLUDE((f32, 8))
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f32x8_f64x4 IGNORE
+
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u8x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u16x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_f32x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u8x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u16x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_f32x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_f64x2 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_s64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u8x32 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u16x16 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_u64x4 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_f32x8 IGNORE
+#define CC_SIMD_TYPE_FILTER_INCLUDE_f64x4_f64x4 INCLUDE((f64, 4))
 
 /*!
  * @define CC_SIMD_MATH_ACCURACY
@@ -749,4 +1209,12 @@
 #include <CommonC/Simd64.h>
 #include <CommonC/Simd128.h>
 
+/*
+ Without AVX the 256-bit types are emulated and returning them changes the ABI, so only expose them by default
+ when AVX is enabled. Code that wants the emulated variants can include Simd256.h explicitly.
+ */
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX
+#include <CommonC/Simd256.h>
+#endif
+
 #endif
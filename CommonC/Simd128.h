@@ -34,6 +34,8 @@
 
 #if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
 #include <CommonC/Simd128Types_arm.h>
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <CommonC/Simd128Types_x86.h>
 #endif
 
 
@@ -8448,6 +8450,8 @@ CC_SIMD_128_2_ELEMENT_FLOAT_TYPES
 
 #if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
 #include <CommonC/Simd128_arm.h>
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <CommonC/Simd128_x86.h>
 #endif
 
 #pragma mark - Fallback Implementations
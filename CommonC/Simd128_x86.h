@@ -0,0 +1,659 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_Simd128_x86_h
+#define CommonC_Simd128_x86_h
+
+#include <CommonC/Extensions.h>
+#include <CommonC/Platform.h>
+#include <CommonC/Assertion.h>
+
+#include <CommonC/Simd_x86.h>
+
+#define CC_SIMD_INTERNAL_X86_TYPE(base) CC_SIMD_INTERNAL_X86_TYPE_##base
+
+#define CC_SIMD_INTERNAL_X86_TYPE_s8 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_s16 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_s32 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_s64 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_u8 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_u16 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_u32 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_u64 __m128i
+#define CC_SIMD_INTERNAL_X86_TYPE_f32 __m128
+#define CC_SIMD_INTERNAL_X86_TYPE_f64 __m128d
+
+#define CC_SIMD_INTERNAL_X86_SUFFIX(base) CC_SIMD_INTERNAL_X86_SUFFIX_##base
+
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s8 epi8
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s16 epi16
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s32 epi32
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s64 epi64
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u8 epu8
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u16 epu16
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u32 epu32
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u64 epu64
+#define CC_SIMD_INTERNAL_X86_SUFFIX_f32 ps
+#define CC_SIMD_INTERNAL_X86_SUFFIX_f64 pd
+
+#define CC_SIMD_INTERNAL_X86_CALL(op, base, count, ...) ((CC_SIMD_TYPE(base, count))CC_CAT(_mm_, op, _, CC_SIMD_INTERNAL_X86_SUFFIX(base))(__VA_ARGS__))
+#define CC_SIMD_INTERNAL_X86_ARG(base, x) ((CC_SIMD_INTERNAL_X86_TYPE(base))(x))
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE4_1
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES CC_SIMD_128_INTEGER_8_TYPES, CC_SIMD_128_INTEGER_16_TYPES, CC_SIMD_128_INTEGER_32_TYPES, CC_SIMD_128_FLOAT_TYPES
+#else
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES (u8, 16), (s16, 8), CC_SIMD_128_FLOAT_TYPES
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s8x16)a; }
+CC_SIMD_DECL(CCSimd_s8x16_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s8x16), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s16x8)a; }
+CC_SIMD_DECL(CCSimd_s16x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s16x8), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s32x4)a; }
+CC_SIMD_DECL(CCSimd_s32x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s32x4), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s64x2)a; }
+CC_SIMD_DECL(CCSimd_s64x2_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s64x2), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u8x16)a; }
+CC_SIMD_DECL(CCSimd_u8x16_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u8x16), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u16x8)a; }
+CC_SIMD_DECL(CCSimd_u16x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u16x8), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u32x4)a; }
+CC_SIMD_DECL(CCSimd_u32x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u32x4), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u64x2)a; }
+CC_SIMD_DECL(CCSimd_u64x2_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u64x2), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_f32x4)a; }
+CC_SIMD_DECL(CCSimd_f32x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_f32x4), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_f64x2)a; }
+CC_SIMD_DECL(CCSimd_f64x2_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_f64x2), CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s8x16); }
+CC_SIMD_DECL(CCSimd_s8x16_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s8x16), CC_SIMD_128_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s16x8); }
+CC_SIMD_DECL(CCSimd_s16x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s16x8), CC_SIMD_128_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s32x4); }
+CC_SIMD_DECL(CCSimd_s32x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s32x4), CC_SIMD_128_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s64x2); }
+CC_SIMD_DECL(CCSimd_s64x2_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s64x2), CC_SIMD_128_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u8x16); }
+CC_SIMD_DECL(CCSimd_u8x16_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u8x16), CC_SIMD_128_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u16x8); }
+CC_SIMD_DECL(CCSimd_u16x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u16x8), CC_SIMD_128_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u32x4); }
+CC_SIMD_DECL(CCSimd_u32x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u32x4), CC_SIMD_128_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u64x2); }
+CC_SIMD_DECL(CCSimd_u64x2_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u64x2), CC_SIMD_128_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_f32x4); }
+CC_SIMD_DECL(CCSimd_f32x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_f32x4), CC_SIMD_128_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_f64x2); }
+CC_SIMD_DECL(CCSimd_f64x2_Cast, CC_SIMD_RETURN_TYPE(CCSimd_f64x2), CC_SIMD_128_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_CALL(min, base, count, CC_SIMD_INTERNAL_X86_ARG(base, a), CC_SIMD_INTERNAL_X86_ARG(base, b)); }
+CC_SIMD_DECL(CCSimdMin, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMin
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE4_1
+#define CC_SIMD_MISSING_CCSimdMin CC_SIMD_128_INTEGER_64_TYPES
+#else
+#define CC_SIMD_MISSING_CCSimdMin (s8, 16), (u16, 8), CC_SIMD_128_INTEGER_32_TYPES, CC_SIMD_128_INTEGER_64_TYPES
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_CALL(max, base, count, CC_SIMD_INTERNAL_X86_ARG(base, a), CC_SIMD_INTERNAL_X86_ARG(base, b)); }
+CC_SIMD_DECL(CCSimdMax, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMax
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE4_1
+#define CC_SIMD_MISSING_CCSimdMax CC_SIMD_128_INTEGER_64_TYPES
+#else
+#define CC_SIMD_MISSING_CCSimdMax (s8, 16), (u16, 8), CC_SIMD_128_INTEGER_32_TYPES, CC_SIMD_128_INTEGER_64_TYPES
+#endif
+
+#if CC_HARDWARE_VECTOR_SUPPORT_FMA
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fmadd, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fnmadd, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdNegMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fmsub, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fnmsub, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdNegMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#else
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return (a * b) + c; }
+CC_SIMD_DECL(CCSimdMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return c - (a * b); }
+CC_SIMD_DECL(CCSimdNegMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return (a * b) - c; }
+CC_SIMD_DECL(CCSimdMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return -(a * b) - c; }
+CC_SIMD_DECL(CCSimdNegMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#undef CC_SIMD_MISSING_CCSimdMadd
+#define CC_SIMD_MISSING_CCSimdMadd CC_SIMD_128_INTEGER_TYPES
+
+#undef CC_SIMD_MISSING_CCSimdNegMadd
+#define CC_SIMD_MISSING_CCSimdNegMadd CC_SIMD_128_INTEGER_TYPES
+
+#undef CC_SIMD_MISSING_CCSimdMsub
+#define CC_SIMD_MISSING_CCSimdMsub CC_SIMD_128_INTEGER_TYPES
+
+#undef CC_SIMD_MISSING_CCSimdNegMsub
+#define CC_SIMD_MISSING_CCSimdNegMsub CC_SIMD_128_INTEGER_TYPES
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE4_1
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdRoundNearestEven, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdRoundZero, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdFloor, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdCeil, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#else
+#define CC_SIMD_INTERNAL_X86_ROUND_MAGIC_f32 8388608.0f
+#define CC_SIMD_INTERNAL_X86_ROUND_MAGIC_f64 4503599627370496.0
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    typedef CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits; \
+    \
+    const Bits Sign = (Bits)a & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(-0.0); \
+    const CC_SIMD_TYPE(base, count) Magnitude = (CC_SIMD_TYPE(base, count))((Bits)a ^ Sign); \
+    const CC_SIMD_TYPE(base, count) Rounded = (CC_SIMD_TYPE(base, count))((Bits)((Magnitude + CC_CAT(CC_SIMD_INTERNAL_X86_ROUND_MAGIC_, base)) - CC_CAT(CC_SIMD_INTERNAL_X86_ROUND_MAGIC_, base)) | Sign); \
+    const Bits Exact = (Bits)(Magnitude >= CC_CAT(CC_SIMD_INTERNAL_X86_ROUND_MAGIC_, base)); \
+    \
+    return (CC_SIMD_TYPE(base, count))(((Bits)Rounded & ~Exact) | ((Bits)a & Exact)); \
+}
+CC_SIMD_DECL(CCSimdRoundNearestEven, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_INTERNAL_X86_ROUND_MAGIC_f32
+#undef CC_SIMD_INTERNAL_X86_ROUND_MAGIC_f64
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    typedef CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits; \
+    \
+    const CC_SIMD_TYPE(base, count) Rounded = CC_SIMD_NAME(CCSimdRoundNearestEven, base, count)(a); \
+    \
+    return Rounded - (CC_SIMD_TYPE(base, count))((Bits)(Rounded > a) & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(1.0)); \
+}
+CC_SIMD_DECL(CCSimdFloor, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    typedef CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits; \
+    \
+    const Bits Sign = (Bits)a & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(-0.0); \
+    const CC_SIMD_TYPE(base, count) Rounded = CC_SIMD_NAME(CCSimdRoundNearestEven, base, count)(a); \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits)(Rounded + (CC_SIMD_TYPE(base, count))((Bits)(Rounded < a) & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(1.0))) | Sign); \
+}
+CC_SIMD_DECL(CCSimdCeil, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    typedef CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits; \
+    \
+    const Bits Sign = (Bits)a & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(-0.0); \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits)CC_SIMD_NAME(CCSimdFloor, base, count)((CC_SIMD_TYPE(base, count))((Bits)a ^ Sign)) | Sign); \
+}
+CC_SIMD_DECL(CCSimdRoundZero, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    typedef CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits; \
+    \
+    const Bits Sign = (Bits)a & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(-0.0); \
+    const CC_SIMD_TYPE(base, count) Truncated = CC_SIMD_NAME(CCSimdRoundZero, base, count)(a); \
+    const Bits One = Sign | (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(1.0); \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits)(Truncated + (CC_SIMD_TYPE(base, count))((Bits)(CC_SIMD_NAME(CCSimdAbs, base, count)(a - Truncated) >= 0.5) & One)) | Sign); \
+}
+CC_SIMD_DECL(CCSimdRoundNearestAway, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    CC_SIMD_TYPE(base, count) Result = a; \
+    \
+    if (count > 8) Result += (CC_SIMD_TYPE(base, count))_mm_srli_si128((__m128i)Result, 8 * (16 / count)); \
+    if (count > 4) Result += (CC_SIMD_TYPE(base, count))_mm_srli_si128((__m128i)Result, 4 * (16 / count)); \
+    if (count > 2) Result += (CC_SIMD_TYPE(base, count))_mm_srli_si128((__m128i)Result, 2 * (16 / count)); \
+    if (count > 1) Result += (CC_SIMD_TYPE(base, count))_mm_srli_si128((__m128i)Result, 16 / count); \
+    \
+    return Result[0]; \
+}
+CC_SIMD_DECL(CCSimdSum, CC_SIMD_RETURN_TYPE_BASE, CC_SIMD_128_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(sqrt, base, count, a); }
+CC_SIMD_DECL(CCSimdSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return _mm_rsqrt_ps(a); }
+CC_SIMD_DECL(CCSimdInvSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_4_ELEMENT_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_NAME(CCSimdFill, base, count)(1.0) / _mm_sqrt_pd(a); }
+CC_SIMD_DECL(CCSimdInvSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_2_ELEMENT_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2), "Indexes must not exceed lane count"); \
+    \
+    switch ((v1 << 1) | v0) \
+    { \
+        case 0: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, _MM_SHUFFLE(1, 0, 1, 0)); \
+        case 1: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, _MM_SHUFFLE(1, 0, 3, 2)); \
+        case 2: return a; \
+        case 3: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, _MM_SHUFFLE(3, 2, 3, 2)); \
+    } \
+    \
+    CC_UNREACHABLE(); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
+{ \
+    CCAssertLog((v0 < 4) && (v1 < 4) && (v2 < 4) && (v3 < 4), "Indexes must not exceed lane count"); \
+    \
+    switch (_MM_SHUFFLE(v3, v2, v1, v0)) \
+    { \
+        case 0: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 0); \
+        case 1: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 1); \
+        case 2: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 2); \
+        case 3: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 3); \
+        case 4: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 4); \
+        case 5: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 5); \
+        case 6: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 6); \
+        case 7: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 7); \
+        case 8: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 8); \
+        case 9: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 9); \
+        case 10: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 10); \
+        case 11: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 11); \
+        case 12: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 12); \
+        case 13: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 13); \
+        case 14: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 14); \
+        case 15: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 15); \
+        case 16: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 16); \
+        case 17: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 17); \
+        case 18: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 18); \
+        case 19: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 19); \
+        case 20: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 20); \
+        case 21: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 21); \
+        case 22: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 22); \
+        case 23: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 23); \
+        case 24: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 24); \
+        case 25: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 25); \
+        case 26: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 26); \
+        case 27: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 27); \
+        case 28: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 28); \
+        case 29: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 29); \
+        case 30: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 30); \
+        case 31: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 31); \
+        case 32: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 32); \
+        case 33: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 33); \
+        case 34: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 34); \
+        case 35: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 35); \
+        case 36: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 36); \
+        case 37: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 37); \
+        case 38: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 38); \
+        case 39: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 39); \
+        case 40: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 40); \
+        case 41: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 41); \
+        case 42: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 42); \
+        case 43: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 43); \
+        case 44: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 44); \
+        case 45: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 45); \
+        case 46: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 46); \
+        case 47: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 47); \
+        case 48: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 48); \
+        case 49: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 49); \
+        case 50: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 50); \
+        case 51: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 51); \
+        case 52: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 52); \
+        case 53: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 53); \
+        case 54: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 54); \
+        case 55: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 55); \
+        case 56: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 56); \
+        case 57: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 57); \
+        case 58: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 58); \
+        case 59: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 59); \
+        case 60: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 60); \
+        case 61: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 61); \
+        case 62: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 62); \
+        case 63: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 63); \
+        case 64: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 64); \
+        case 65: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 65); \
+        case 66: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 66); \
+        case 67: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 67); \
+        case 68: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 68); \
+        case 69: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 69); \
+        case 70: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 70); \
+        case 71: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 71); \
+        case 72: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 72); \
+        case 73: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 73); \
+        case 74: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 74); \
+        case 75: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 75); \
+        case 76: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 76); \
+        case 77: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 77); \
+        case 78: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 78); \
+        case 79: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 79); \
+        case 80: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 80); \
+        case 81: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 81); \
+        case 82: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 82); \
+        case 83: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 83); \
+        case 84: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 84); \
+        case 85: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 85); \
+        case 86: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 86); \
+        case 87: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 87); \
+        case 88: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 88); \
+        case 89: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 89); \
+        case 90: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 90); \
+        case 91: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 91); \
+        case 92: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 92); \
+        case 93: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 93); \
+        case 94: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 94); \
+        case 95: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 95); \
+        case 96: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 96); \
+        case 97: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 97); \
+        case 98: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 98); \
+        case 99: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 99); \
+        case 100: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 100); \
+        case 101: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 101); \
+        case 102: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 102); \
+        case 103: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 103); \
+        case 104: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 104); \
+        case 105: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 105); \
+        case 106: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 106); \
+        case 107: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 107); \
+        case 108: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 108); \
+        case 109: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 109); \
+        case 110: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 110); \
+        case 111: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 111); \
+        case 112: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 112); \
+        case 113: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 113); \
+        case 114: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 114); \
+        case 115: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 115); \
+        case 116: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 116); \
+        case 117: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 117); \
+        case 118: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 118); \
+        case 119: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 119); \
+        case 120: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 120); \
+        case 121: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 121); \
+        case 122: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 122); \
+        case 123: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 123); \
+        case 124: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 124); \
+        case 125: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 125); \
+        case 126: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 126); \
+        case 127: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 127); \
+        case 128: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 128); \
+        case 129: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 129); \
+        case 130: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 130); \
+        case 131: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 131); \
+        case 132: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 132); \
+        case 133: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 133); \
+        case 134: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 134); \
+        case 135: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 135); \
+        case 136: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 136); \
+        case 137: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 137); \
+        case 138: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 138); \
+        case 139: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 139); \
+        case 140: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 140); \
+        case 141: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 141); \
+        case 142: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 142); \
+        case 143: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 143); \
+        case 144: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 144); \
+        case 145: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 145); \
+        case 146: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 146); \
+        case 147: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 147); \
+        case 148: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 148); \
+        case 149: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 149); \
+        case 150: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 150); \
+        case 151: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 151); \
+        case 152: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 152); \
+        case 153: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 153); \
+        case 154: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 154); \
+        case 155: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 155); \
+        case 156: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 156); \
+        case 157: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 157); \
+        case 158: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 158); \
+        case 159: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 159); \
+        case 160: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 160); \
+        case 161: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 161); \
+        case 162: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 162); \
+        case 163: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 163); \
+        case 164: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 164); \
+        case 165: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 165); \
+        case 166: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 166); \
+        case 167: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 167); \
+        case 168: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 168); \
+        case 169: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 169); \
+        case 170: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 170); \
+        case 171: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 171); \
+        case 172: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 172); \
+        case 173: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 173); \
+        case 174: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 174); \
+        case 175: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 175); \
+        case 176: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 176); \
+        case 177: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 177); \
+        case 178: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 178); \
+        case 179: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 179); \
+        case 180: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 180); \
+        case 181: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 181); \
+        case 182: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 182); \
+        case 183: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 183); \
+        case 184: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 184); \
+        case 185: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 185); \
+        case 186: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 186); \
+        case 187: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 187); \
+        case 188: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 188); \
+        case 189: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 189); \
+        case 190: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 190); \
+        case 191: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 191); \
+        case 192: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 192); \
+        case 193: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 193); \
+        case 194: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 194); \
+        case 195: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 195); \
+        case 196: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 196); \
+        case 197: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 197); \
+        case 198: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 198); \
+        case 199: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 199); \
+        case 200: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 200); \
+        case 201: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 201); \
+        case 202: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 202); \
+        case 203: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 203); \
+        case 204: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 204); \
+        case 205: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 205); \
+        case 206: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 206); \
+        case 207: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 207); \
+        case 208: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 208); \
+        case 209: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 209); \
+        case 210: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 210); \
+        case 211: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 211); \
+        case 212: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 212); \
+        case 213: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 213); \
+        case 214: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 214); \
+        case 215: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 215); \
+        case 216: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 216); \
+        case 217: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 217); \
+        case 218: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 218); \
+        case 219: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 219); \
+        case 220: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 220); \
+        case 221: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 221); \
+        case 222: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 222); \
+        case 223: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 223); \
+        case 224: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 224); \
+        case 225: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 225); \
+        case 226: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 226); \
+        case 227: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 227); \
+        case 228: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 228); \
+        case 229: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 229); \
+        case 230: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 230); \
+        case 231: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 231); \
+        case 232: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 232); \
+        case 233: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 233); \
+        case 234: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 234); \
+        case 235: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 235); \
+        case 236: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 236); \
+        case 237: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 237); \
+        case 238: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 238); \
+        case 239: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 239); \
+        case 240: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 240); \
+        case 241: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 241); \
+        case 242: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 242); \
+        case 243: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 243); \
+        case 244: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 244); \
+        case 245: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 245); \
+        case 246: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 246); \
+        case 247: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 247); \
+        case 248: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 248); \
+        case 249: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 249); \
+        case 250: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 250); \
+        case 251: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 251); \
+        case 252: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 252); \
+        case 253: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 253); \
+        case 254: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 254); \
+        case 255: return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi32((__m128i)a, 255); \
+    } \
+    \
+    CC_UNREACHABLE(); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSSE3
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog((v0 < 8) && (v1 < 8) && (v2 < 8) && (v3 < 8) && (v4 < 8) && (v5 < 8) && (v6 < 8) && (v7 < 8), "Indexes must not exceed lane count"); \
+    \
+    return (CC_SIMD_TYPE(base, count))CCSimdSwizzle_u8x16(CC_SIMD_NAME(CCSimd_u8x16_Reinterpret, base, count)(a), v0 * 2, (v0 * 2) + 1, v1 * 2, (v1 * 2) + 1, v2 * 2, (v2 * 2) + 1, v3 * 2, (v3 * 2) + 1, v4 * 2, (v4 * 2) + 1, v5 * 2, (v5 * 2) + 1, v6 * 2, (v6 * 2) + 1, v7 * 2, (v7 * 2) + 1); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) \
+{ \
+    CCAssertLog((v0 < 16) && (v1 < 16) && (v2 < 16) && (v3 < 16) && (v4 < 16) && (v5 < 16) && (v6 < 16) && (v7 < 16) && (v8 < 16) && (v9 < 16) && (v10 < 16) && (v11 < 16) && (v12 < 16) && (v13 < 16) && (v14 < 16) && (v15 < 16), "Indexes must not exceed lane count"); \
+    \
+    return (CC_SIMD_TYPE(base, count))_mm_shuffle_epi8((__m128i)a, _mm_setr_epi8(v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15)); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#else
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog((v0 < 8) && (v1 < 8) && (v2 < 8) && (v3 < 8) && (v4 < 8) && (v5 < 8) && (v6 < 8) && (v7 < 8), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_NAME(CCSimdLoad, base, count)((CC_SIMD_BASE_TYPE(base)[8]){ a[v0], a[v1], a[v2], a[v3], a[v4], a[v5], a[v6], a[v7] }); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) \
+{ \
+    CCAssertLog((v0 < 16) && (v1 < 16) && (v2 < 16) && (v3 < 16) && (v4 < 16) && (v5 < 16) && (v6 < 16) && (v7 < 16) && (v8 < 16) && (v9 < 16) && (v10 < 16) && (v11 < 16) && (v12 < 16) && (v13 < 16) && (v14 < 16) && (v15 < 16), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_NAME(CCSimdLoad, base, count)((CC_SIMD_BASE_TYPE(base)[16]){ a[v0], a[v1], a[v2], a[v3], a[v4], a[v5], a[v6], a[v7], a[v8], a[v9], a[v10], a[v11], a[v12], a[v13], a[v14], a[v15] }); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_128_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#undef CC_SIMD_INTERNAL_X86_TYPE
+#undef CC_SIMD_INTERNAL_X86_SUFFIX
+#undef CC_SIMD_INTERNAL_X86_CALL
+#undef CC_SIMD_INTERNAL_X86_ARG
+#undef CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES
+
+#endif
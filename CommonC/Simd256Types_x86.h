@@ -0,0 +1,45 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_Simd256Types_x86_h
+#define CommonC_Simd256Types_x86_h
+
+#include <stdint.h>
+#include <immintrin.h>
+
+typedef int8_t CCSimd_s8x32 __attribute__((vector_size(32)));
+typedef int16_t CCSimd_s16x16 __attribute__((vector_size(32)));
+typedef int32_t CCSimd_s32x8 __attribute__((vector_size(32)));
+typedef int64_t CCSimd_s64x4 __attribute__((vector_size(32)));
+
+typedef uint8_t CCSimd_u8x32 __attribute__((vector_size(32)));
+typedef uint16_t CCSimd_u16x16 __attribute__((vector_size(32)));
+typedef uint32_t CCSimd_u32x8 __attribute__((vector_size(32)));
+typedef uint64_t CCSimd_u64x4 __attribute__((vector_size(32)));
+
+typedef float CCSimd_f32x8 __attribute__((vector_size(32)));
+typedef double CCSimd_f64x4 __attribute__((vector_size(32)));
+
+#endif
@@ -0,0 +1,422 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_Simd256_x86_h
+#define CommonC_Simd256_x86_h
+
+#include <CommonC/Extensions.h>
+#include <CommonC/Platform.h>
+#include <CommonC/Assertion.h>
+
+#include <CommonC/Simd_x86.h>
+
+/*
+ * Operations that have an AVX (floats) or AVX2 (integers) instruction use it directly, otherwise the vector
+ * is split into its 128-bit halves and the equivalent 128-bit operation is applied to each half.
+ */
+
+#define CC_SIMD_INTERNAL_X86_TYPE(base) CC_SIMD_INTERNAL_X86_TYPE_##base
+
+#undef CC_SIMD_INTERNAL_X86_TYPE_s8
+#undef CC_SIMD_INTERNAL_X86_TYPE_s16
+#undef CC_SIMD_INTERNAL_X86_TYPE_s32
+#undef CC_SIMD_INTERNAL_X86_TYPE_s64
+#undef CC_SIMD_INTERNAL_X86_TYPE_u8
+#undef CC_SIMD_INTERNAL_X86_TYPE_u16
+#undef CC_SIMD_INTERNAL_X86_TYPE_u32
+#undef CC_SIMD_INTERNAL_X86_TYPE_u64
+#undef CC_SIMD_INTERNAL_X86_TYPE_f32
+#undef CC_SIMD_INTERNAL_X86_TYPE_f64
+
+#define CC_SIMD_INTERNAL_X86_TYPE_s8 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_s16 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_s32 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_s64 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_u8 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_u16 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_u32 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_u64 __m256i
+#define CC_SIMD_INTERNAL_X86_TYPE_f32 __m256
+#define CC_SIMD_INTERNAL_X86_TYPE_f64 __m256d
+
+#define CC_SIMD_INTERNAL_X86_SUFFIX(base) CC_SIMD_INTERNAL_X86_SUFFIX_##base
+
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s8 epi8
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s16 epi16
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s32 epi32
+#define CC_SIMD_INTERNAL_X86_SUFFIX_s64 epi64
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u8 epu8
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u16 epu16
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u32 epu32
+#define CC_SIMD_INTERNAL_X86_SUFFIX_u64 epu64
+#define CC_SIMD_INTERNAL_X86_SUFFIX_f32 ps
+#define CC_SIMD_INTERNAL_X86_SUFFIX_f64 pd
+
+#define CC_SIMD_INTERNAL_X86_CALL(op, base, count, ...) ((CC_SIMD_TYPE(base, count))CC_CAT(_mm256_, op, _, CC_SIMD_INTERNAL_X86_SUFFIX(base))(__VA_ARGS__))
+#define CC_SIMD_INTERNAL_X86_ARG(base, x) ((CC_SIMD_INTERNAL_X86_TYPE(base))(x))
+
+#define CC_SIMD_INTERNAL_X86_HALF_COUNT(count) CC_SIMD_INTERNAL_X86_HALF_COUNT_##count
+
+#define CC_SIMD_INTERNAL_X86_HALF_COUNT_4 2
+#define CC_SIMD_INTERNAL_X86_HALF_COUNT_8 4
+#define CC_SIMD_INTERNAL_X86_HALF_COUNT_16 8
+#define CC_SIMD_INTERNAL_X86_HALF_COUNT_32 16
+
+#define CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count) CC_SIMD_NAME(name, base, CC_SIMD_INTERNAL_X86_HALF_COUNT(count))
+#define CC_SIMD_INTERNAL_X86_LOW(base, count, x) ((CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_HALF_COUNT(count)))__builtin_shufflevector((CCSimd_s64x4)(x), (CCSimd_s64x4)(x), 0, 1))
+#define CC_SIMD_INTERNAL_X86_HIGH(base, count, x) ((CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_HALF_COUNT(count)))__builtin_shufflevector((CCSimd_s64x4)(x), (CCSimd_s64x4)(x), 2, 3))
+#define CC_SIMD_INTERNAL_X86_JOIN(base, count, low, high) ((CC_SIMD_TYPE(base, count))__builtin_shufflevector((CCSimd_s64x2)(low), (CCSimd_s64x2)(high), 0, 1, 2, 3))
+
+#define CC_SIMD_INTERNAL_X86_SPLIT_1(name, base, count, a) CC_SIMD_INTERNAL_X86_JOIN(base, count, CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count)(CC_SIMD_INTERNAL_X86_LOW(base, count, a)), CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count)(CC_SIMD_INTERNAL_X86_HIGH(base, count, a)))
+#define CC_SIMD_INTERNAL_X86_SPLIT_2(name, base, count, a, b) CC_SIMD_INTERNAL_X86_JOIN(base, count, CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count)(CC_SIMD_INTERNAL_X86_LOW(base, count, a), CC_SIMD_INTERNAL_X86_LOW(base, count, b)), CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count)(CC_SIMD_INTERNAL_X86_HIGH(base, count, a), CC_SIMD_INTERNAL_X86_HIGH(base, count, b)))
+#define CC_SIMD_INTERNAL_X86_SPLIT_3(name, base, count, a, b, c) CC_SIMD_INTERNAL_X86_JOIN(base, count, CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count)(CC_SIMD_INTERNAL_X86_LOW(base, count, a), CC_SIMD_INTERNAL_X86_LOW(base, count, b), CC_SIMD_INTERNAL_X86_LOW(base, count, c)), CC_SIMD_INTERNAL_X86_HALF_NAME(name, base, count)(CC_SIMD_INTERNAL_X86_HIGH(base, count, a), CC_SIMD_INTERNAL_X86_HIGH(base, count, b), CC_SIMD_INTERNAL_X86_HIGH(base, count, c)))
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES CC_SIMD_256_INTEGER_8_TYPES, CC_SIMD_256_INTEGER_16_TYPES, CC_SIMD_256_INTEGER_32_TYPES, CC_SIMD_256_FLOAT_TYPES
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_SPLIT_TYPES CC_SIMD_256_INTEGER_64_TYPES
+#elif CC_HARDWARE_VECTOR_SUPPORT_AVX
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES CC_SIMD_256_FLOAT_TYPES
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_SPLIT_TYPES CC_SIMD_256_INTEGER_TYPES
+#else
+#define CC_SIMD_INTERNAL_X86_MIN_MAX_SPLIT_TYPES CC_SIMD_256_TYPES
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s8x32)a; }
+CC_SIMD_DECL(CCSimd_s8x32_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s8x32), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s16x16)a; }
+CC_SIMD_DECL(CCSimd_s16x16_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s16x16), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s32x8)a; }
+CC_SIMD_DECL(CCSimd_s32x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s32x8), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s64x4)a; }
+CC_SIMD_DECL(CCSimd_s64x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s64x4), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u8x32)a; }
+CC_SIMD_DECL(CCSimd_u8x32_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u8x32), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u16x16)a; }
+CC_SIMD_DECL(CCSimd_u16x16_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u16x16), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u32x8)a; }
+CC_SIMD_DECL(CCSimd_u32x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u32x8), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u64x4)a; }
+CC_SIMD_DECL(CCSimd_u64x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u64x4), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_f32x8)a; }
+CC_SIMD_DECL(CCSimd_f32x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_f32x8), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_f64x4)a; }
+CC_SIMD_DECL(CCSimd_f64x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_f64x4), CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s8x32); }
+CC_SIMD_DECL(CCSimd_s8x32_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s8x32), CC_SIMD_256_32_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s16x16); }
+CC_SIMD_DECL(CCSimd_s16x16_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s16x16), CC_SIMD_256_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s32x8); }
+CC_SIMD_DECL(CCSimd_s32x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s32x8), CC_SIMD_256_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s64x4); }
+CC_SIMD_DECL(CCSimd_s64x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s64x4), CC_SIMD_256_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u8x32); }
+CC_SIMD_DECL(CCSimd_u8x32_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u8x32), CC_SIMD_256_32_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u16x16); }
+CC_SIMD_DECL(CCSimd_u16x16_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u16x16), CC_SIMD_256_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u32x8); }
+CC_SIMD_DECL(CCSimd_u32x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u32x8), CC_SIMD_256_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u64x4); }
+CC_SIMD_DECL(CCSimd_u64x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u64x4), CC_SIMD_256_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_f32x8); }
+CC_SIMD_DECL(CCSimd_f32x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_f32x8), CC_SIMD_256_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_f64x4); }
+CC_SIMD_DECL(CCSimd_f64x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_f64x4), CC_SIMD_256_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#ifdef CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_CALL(min, base, count, CC_SIMD_INTERNAL_X86_ARG(base, a), CC_SIMD_INTERNAL_X86_ARG(base, b)); }
+CC_SIMD_DECL(CCSimdMin, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_CALL(max, base, count, CC_SIMD_INTERNAL_X86_ARG(base, a), CC_SIMD_INTERNAL_X86_ARG(base, b)); }
+CC_SIMD_DECL(CCSimdMax, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_SPLIT_2(CCSimdMin, base, count, a, b); }
+CC_SIMD_DECL(CCSimdMin, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_MIN_MAX_SPLIT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_SPLIT_2(CCSimdMax, base, count, a, b); }
+CC_SIMD_DECL(CCSimdMax, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_MIN_MAX_SPLIT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMin
+#undef CC_SIMD_MISSING_CCSimdMax
+
+#if CC_HARDWARE_VECTOR_SUPPORT_FMA
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fmadd, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fnmadd, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdNegMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fmsub, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_CALL(fnmsub, base, count, a, b, c); }
+CC_SIMD_DECL(CCSimdNegMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#else
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return (a * b) + c; }
+CC_SIMD_DECL(CCSimdMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return c - (a * b); }
+CC_SIMD_DECL(CCSimdNegMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return (a * b) - c; }
+CC_SIMD_DECL(CCSimdMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return -(a * b) - c; }
+CC_SIMD_DECL(CCSimdNegMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#undef CC_SIMD_MISSING_CCSimdMadd
+#define CC_SIMD_MISSING_CCSimdMadd CC_SIMD_256_INTEGER_TYPES
+
+#undef CC_SIMD_MISSING_CCSimdNegMadd
+#define CC_SIMD_MISSING_CCSimdNegMadd CC_SIMD_256_INTEGER_TYPES
+
+#undef CC_SIMD_MISSING_CCSimdMsub
+#define CC_SIMD_MISSING_CCSimdMsub CC_SIMD_256_INTEGER_TYPES
+
+#undef CC_SIMD_MISSING_CCSimdNegMsub
+#define CC_SIMD_MISSING_CCSimdNegMsub CC_SIMD_256_INTEGER_TYPES
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdRoundNearestEven, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdRoundZero, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdFloor, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(round, base, count, a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); }
+CC_SIMD_DECL(CCSimdCeil, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_CALL(sqrt, base, count, a); }
+CC_SIMD_DECL(CCSimdSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return _mm256_rsqrt_ps(a); }
+CC_SIMD_DECL(CCSimdInvSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_8_ELEMENT_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_NAME(CCSimdFill, base, count)(1.0) / _mm256_sqrt_pd(a); }
+CC_SIMD_DECL(CCSimdInvSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_4_ELEMENT_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#else
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_SPLIT_1(CCSimdRoundNearestEven, base, count, a); }
+CC_SIMD_DECL(CCSimdRoundNearestEven, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_SPLIT_1(CCSimdRoundZero, base, count, a); }
+CC_SIMD_DECL(CCSimdRoundZero, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_SPLIT_1(CCSimdFloor, base, count, a); }
+CC_SIMD_DECL(CCSimdFloor, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_SPLIT_1(CCSimdCeil, base, count, a); }
+CC_SIMD_DECL(CCSimdCeil, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_SPLIT_1(CCSimdSqrt, base, count, a); }
+CC_SIMD_DECL(CCSimdSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_SPLIT_1(CCSimdInvSqrt, base, count, a); }
+CC_SIMD_DECL(CCSimdInvSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    typedef CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits; \
+    \
+    const Bits Sign = (Bits)a & (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(-0.0); \
+    const CC_SIMD_TYPE(base, count) Truncated = CC_SIMD_NAME(CCSimdRoundZero, base, count)(a); \
+    const Bits One = Sign | (Bits)CC_SIMD_NAME(CCSimdFill, base, count)(1.0); \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits)(Truncated + (CC_SIMD_TYPE(base, count))((Bits)(CC_SIMD_NAME(CCSimdAbs, base, count)(a - Truncated) >= 0.5) & One)) | Sign); \
+}
+CC_SIMD_DECL(CCSimdRoundNearestAway, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_HALF_NAME(CCSimdSum, base, count)(CC_SIMD_INTERNAL_X86_LOW(base, count, a) + CC_SIMD_INTERNAL_X86_HIGH(base, count, a)); }
+CC_SIMD_DECL(CCSimdSum, CC_SIMD_RETURN_TYPE_BASE, CC_SIMD_256_TYPES)
+#undef CC_SIMD_IMPL
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX2
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
+{ \
+    CCAssertLog((v0 < 4) && (v1 < 4) && (v2 < 4) && (v3 < 4), "Indexes must not exceed lane count"); \
+    \
+    return (CC_SIMD_TYPE(base, count))CCSimdSwizzle_u32x8(CC_SIMD_NAME(CCSimd_u32x8_Reinterpret, base, count)(a), v0 * 2, (v0 * 2) + 1, v1 * 2, (v1 * 2) + 1, v2 * 2, (v2 * 2) + 1, v3 * 2, (v3 * 2) + 1); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog((v0 < 8) && (v1 < 8) && (v2 < 8) && (v3 < 8) && (v4 < 8) && (v5 < 8) && (v6 < 8) && (v7 < 8), "Indexes must not exceed lane count"); \
+    \
+    return (CC_SIMD_TYPE(base, count))_mm256_permutevar8x32_epi32((__m256i)a, _mm256_setr_epi32(v0, v1, v2, v3, v4, v5, v6, v7)); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) \
+{ \
+    CCAssertLog((v0 < 16) && (v1 < 16) && (v2 < 16) && (v3 < 16) && (v4 < 16) && (v5 < 16) && (v6 < 16) && (v7 < 16) && (v8 < 16) && (v9 < 16) && (v10 < 16) && (v11 < 16) && (v12 < 16) && (v13 < 16) && (v14 < 16) && (v15 < 16), "Indexes must not exceed lane count"); \
+    \
+    return (CC_SIMD_TYPE(base, count))CCSimdSwizzle_u8x32(CC_SIMD_NAME(CCSimd_u8x32_Reinterpret, base, count)(a), v0 * 2, (v0 * 2) + 1, v1 * 2, (v1 * 2) + 1, v2 * 2, (v2 * 2) + 1, v3 * 2, (v3 * 2) + 1, v4 * 2, (v4 * 2) + 1, v5 * 2, (v5 * 2) + 1, v6 * 2, (v6 * 2) + 1, v7 * 2, (v7 * 2) + 1, v8 * 2, (v8 * 2) + 1, v9 * 2, (v9 * 2) + 1, v10 * 2, (v10 * 2) + 1, v11 * 2, (v11 * 2) + 1, v12 * 2, (v12 * 2) + 1, v13 * 2, (v13 * 2) + 1, v14 * 2, (v14 * 2) + 1, v15 * 2, (v15 * 2) + 1); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+/*
+ * vpshufb only shuffles within each 128-bit lane, so shuffle both a and its lane swapped copy and then select
+ * the swapped result wherever an index refers to the other lane (bit 4 moved up to the blend bit).
+ */
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31) \
+{ \
+    CCAssertLog((v0 < 32) && (v1 < 32) && (v2 < 32) && (v3 < 32) && (v4 < 32) && (v5 < 32) && (v6 < 32) && (v7 < 32) && (v8 < 32) && (v9 < 32) && (v10 < 32) && (v11 < 32) && (v12 < 32) && (v13 < 32) && (v14 < 32) && (v15 < 32) && (v16 < 32) && (v17 < 32) && (v18 < 32) && (v19 < 32) && (v20 < 32) && (v21 < 32) && (v22 < 32) && (v23 < 32) && (v24 < 32) && (v25 < 32) && (v26 < 32) && (v27 < 32) && (v28 < 32) && (v29 < 32) && (v30 < 32) && (v31 < 32), "Indexes must not exceed lane count"); \
+    \
+    const __m256i Indexes = _mm256_setr_epi8(v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15, v16, v17, v18, v19, v20, v21, v22, v23, v24, v25, v26, v27, v28, v29, v30, v31); \
+    const __m256i Same = _mm256_shuffle_epi8((__m256i)a, Indexes); \
+    const __m256i Swapped = _mm256_shuffle_epi8(_mm256_permute2x128_si256((__m256i)a, (__m256i)a, 0x01), Indexes); \
+    const __m256i Crossing = _mm256_slli_epi16(_mm256_xor_si256(_mm256_and_si256(Indexes, _mm256_set1_epi8(16)), _mm256_setr_epi64x(0, 0, 0x1010101010101010, 0x1010101010101010)), 3); \
+    \
+    return (CC_SIMD_TYPE(base, count))_mm256_blendv_epi8(Same, Swapped, Crossing); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_32_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#else
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
+{ \
+    CCAssertLog((v0 < 4) && (v1 < 4) && (v2 < 4) && (v3 < 4), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_NAME(CCSimdLoad, base, count)((CC_SIMD_BASE_TYPE(base)[4]){ a[v0], a[v1], a[v2], a[v3] }); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog((v0 < 8) && (v1 < 8) && (v2 < 8) && (v3 < 8) && (v4 < 8) && (v5 < 8) && (v6 < 8) && (v7 < 8), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_NAME(CCSimdLoad, base, count)((CC_SIMD_BASE_TYPE(base)[8]){ a[v0], a[v1], a[v2], a[v3], a[v4], a[v5], a[v6], a[v7] }); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) \
+{ \
+    CCAssertLog((v0 < 16) && (v1 < 16) && (v2 < 16) && (v3 < 16) && (v4 < 16) && (v5 < 16) && (v6 < 16) && (v7 < 16) && (v8 < 16) && (v9 < 16) && (v10 < 16) && (v11 < 16) && (v12 < 16) && (v13 < 16) && (v14 < 16) && (v15 < 16), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_NAME(CCSimdLoad, base, count)((CC_SIMD_BASE_TYPE(base)[16]){ a[v0], a[v1], a[v2], a[v3], a[v4], a[v5], a[v6], a[v7], a[v8], a[v9], a[v10], a[v11], a[v12], a[v13], a[v14], a[v15] }); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31) \
+{ \
+    CCAssertLog((v0 < 32) && (v1 < 32) && (v2 < 32) && (v3 < 32) && (v4 < 32) && (v5 < 32) && (v6 < 32) && (v7 < 32) && (v8 < 32) && (v9 < 32) && (v10 < 32) && (v11 < 32) && (v12 < 32) && (v13 < 32) && (v14 < 32) && (v15 < 32) && (v16 < 32) && (v17 < 32) && (v18 < 32) && (v19 < 32) && (v20 < 32) && (v21 < 32) && (v22 < 32) && (v23 < 32) && (v24 < 32) && (v25 < 32) && (v26 < 32) && (v27 < 32) && (v28 < 32) && (v29 < 32) && (v30 < 32) && (v31 < 32), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_NAME(CCSimdLoad, base, count)((CC_SIMD_BASE_TYPE(base)[32]){ a[v0], a[v1], a[v2], a[v3], a[v4], a[v5], a[v6], a[v7], a[v8], a[v9], a[v10], a[v11], a[v12], a[v13], a[v14], a[v15], a[v16], a[v17], a[v18], a[v19], a[v20], a[v21], a[v22], a[v23], a[v24], a[v25], a[v26], a[v27], a[v28], a[v29], a[v30], a[v31] }); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_256_32_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#undef CC_SIMD_INTERNAL_X86_TYPE
+#undef CC_SIMD_INTERNAL_X86_SUFFIX
+#undef CC_SIMD_INTERNAL_X86_CALL
+#undef CC_SIMD_INTERNAL_X86_ARG
+#undef CC_SIMD_INTERNAL_X86_HALF_COUNT
+#undef CC_SIMD_INTERNAL_X86_HALF_NAME
+#undef CC_SIMD_INTERNAL_X86_LOW
+#undef CC_SIMD_INTERNAL_X86_HIGH
+#undef CC_SIMD_INTERNAL_X86_JOIN
+#undef CC_SIMD_INTERNAL_X86_SPLIT_1
+#undef CC_SIMD_INTERNAL_X86_SPLIT_2
+#undef CC_SIMD_INTERNAL_X86_SPLIT_3
+#undef CC_SIMD_INTERNAL_X86_MIN_MAX_TYPES
+#undef CC_SIMD_INTERNAL_X86_MIN_MAX_SPLIT_TYPES
+
+#endif
@@ -34,6 +34,9 @@
 
 #if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
 #include <CommonC/Simd64Types_arm.h>
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <CommonC/Simd128.h>
+#include <CommonC/Simd64Types_x86.h>
 #endif
 
 
@@ -5640,6 +5643,8 @@ CC_SIMD_64_2_ELEMENT_FLOAT_TYPES
 
 #if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
 #include <CommonC/Simd64_arm.h>
+#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include <CommonC/Simd64_x86.h>
 #endif
 
 #pragma mark - Fallback Implementations
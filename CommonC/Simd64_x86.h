@@ -0,0 +1,219 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_Simd64_x86_h
+#define CommonC_Simd64_x86_h
+
+#include <CommonC/Extensions.h>
+#include <CommonC/Platform.h>
+#include <CommonC/Assertion.h>
+
+#include <CommonC/Simd_x86.h>
+
+/*
+ * SSE has no 64-bit registers, so operations that need specific instructions are performed in the low half of
+ * the equivalent 128-bit vector and the result narrowed back.
+ */
+
+#define CC_SIMD_INTERNAL_X86_WIDE_COUNT(count) CC_SIMD_INTERNAL_X86_WIDE_COUNT_##count
+
+#define CC_SIMD_INTERNAL_X86_WIDE_COUNT_2 4
+#define CC_SIMD_INTERNAL_X86_WIDE_COUNT_4 8
+#define CC_SIMD_INTERNAL_X86_WIDE_COUNT_8 16
+
+#define CC_SIMD_INTERNAL_X86_WIDE_NAME(name, base, count) CC_SIMD_NAME(name, base, CC_SIMD_INTERNAL_X86_WIDE_COUNT(count))
+#define CC_SIMD_INTERNAL_X86_WIDEN(base, count, x) ((CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_WIDE_COUNT(count)))(CCSimd_s64x2){ (int64_t)(x), 0 })
+#define CC_SIMD_INTERNAL_X86_NARROW(base, count, x) ((CC_SIMD_TYPE(base, count))((CCSimd_s64x2)(x))[0])
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s8x8)a; }
+CC_SIMD_DECL(CCSimd_s8x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s8x8), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s16x4)a; }
+CC_SIMD_DECL(CCSimd_s16x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s16x4), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_s32x2)a; }
+CC_SIMD_DECL(CCSimd_s32x2_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_s32x2), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u8x8)a; }
+CC_SIMD_DECL(CCSimd_u8x8_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u8x8), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u16x4)a; }
+CC_SIMD_DECL(CCSimd_u16x4_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u16x4), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_u32x2)a; }
+CC_SIMD_DECL(CCSimd_u32x2_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_u32x2), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CCSimd_f32x2)a; }
+CC_SIMD_DECL(CCSimd_f32x2_Reinterpret, CC_SIMD_RETURN_TYPE(CCSimd_f32x2), CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s8x8); }
+CC_SIMD_DECL(CCSimd_s8x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s8x8), CC_SIMD_64_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s16x4); }
+CC_SIMD_DECL(CCSimd_s16x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s16x4), CC_SIMD_64_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_s32x2); }
+CC_SIMD_DECL(CCSimd_s32x2_Cast, CC_SIMD_RETURN_TYPE(CCSimd_s32x2), CC_SIMD_64_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u8x8); }
+CC_SIMD_DECL(CCSimd_u8x8_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u8x8), CC_SIMD_64_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u16x4); }
+CC_SIMD_DECL(CCSimd_u16x4_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u16x4), CC_SIMD_64_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_u32x2); }
+CC_SIMD_DECL(CCSimd_u32x2_Cast, CC_SIMD_RETURN_TYPE(CCSimd_u32x2), CC_SIMD_64_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return __builtin_convertvector(a, CCSimd_f32x2); }
+CC_SIMD_DECL(CCSimd_f32x2_Cast, CC_SIMD_RETURN_TYPE(CCSimd_f32x2), CC_SIMD_64_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdMin, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), CC_SIMD_INTERNAL_X86_WIDEN(base, count, b))); }
+CC_SIMD_DECL(CCSimdMin, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMin
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdMax, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), CC_SIMD_INTERNAL_X86_WIDEN(base, count, b))); }
+CC_SIMD_DECL(CCSimdMax, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMax
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdMadd, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), CC_SIMD_INTERNAL_X86_WIDEN(base, count, b), CC_SIMD_INTERNAL_X86_WIDEN(base, count, c))); }
+CC_SIMD_DECL(CCSimdMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMadd
+#define CC_SIMD_MISSING_CCSimdMadd CC_SIMD_64_INTEGER_TYPES
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdNegMadd, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), CC_SIMD_INTERNAL_X86_WIDEN(base, count, b), CC_SIMD_INTERNAL_X86_WIDEN(base, count, c))); }
+CC_SIMD_DECL(CCSimdNegMadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdNegMadd
+#define CC_SIMD_MISSING_CCSimdNegMadd CC_SIMD_64_INTEGER_TYPES
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdMsub, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), CC_SIMD_INTERNAL_X86_WIDEN(base, count, b), CC_SIMD_INTERNAL_X86_WIDEN(base, count, c))); }
+CC_SIMD_DECL(CCSimdMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMsub
+#define CC_SIMD_MISSING_CCSimdMsub CC_SIMD_64_INTEGER_TYPES
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, const CC_SIMD_TYPE(base, count) c){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdNegMsub, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), CC_SIMD_INTERNAL_X86_WIDEN(base, count, b), CC_SIMD_INTERNAL_X86_WIDEN(base, count, c))); }
+CC_SIMD_DECL(CCSimdNegMsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdNegMsub
+#define CC_SIMD_MISSING_CCSimdNegMsub CC_SIMD_64_INTEGER_TYPES
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdRoundNearestAway, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdRoundNearestAway, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdRoundNearestEven, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdRoundNearestEven, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdRoundZero, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdRoundZero, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdFloor, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdFloor, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdCeil, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdCeil, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_WIDE_COUNT(count)) Result = CC_SIMD_INTERNAL_X86_WIDEN(base, count, a); \
+    \
+    if (count > 4) Result += (CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_WIDE_COUNT(count)))_mm_srli_si128((__m128i)Result, 4 * (8 / count)); \
+    if (count > 2) Result += (CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_WIDE_COUNT(count)))_mm_srli_si128((__m128i)Result, 2 * (8 / count)); \
+    if (count > 1) Result += (CC_SIMD_TYPE(base, CC_SIMD_INTERNAL_X86_WIDE_COUNT(count)))_mm_srli_si128((__m128i)Result, 8 / count); \
+    \
+    return Result[0]; \
+}
+CC_SIMD_DECL(CCSimdSum, CC_SIMD_RETURN_TYPE_BASE, CC_SIMD_64_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdSqrt, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdInvSqrt, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a))); }
+CC_SIMD_DECL(CCSimdInvSqrt, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdSwizzle, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), v0, v1, v0, v1)); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
+{ \
+    CCAssertLog((v0 < 4) && (v1 < 4) && (v2 < 4) && (v3 < 4), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdSwizzle, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), v0, v1, v2, v3, v0, v1, v2, v3)); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog((v0 < 8) && (v1 < 8) && (v2 < 8) && (v3 < 8) && (v4 < 8) && (v5 < 8) && (v6 < 8) && (v7 < 8), "Indexes must not exceed lane count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_NARROW(base, count, CC_SIMD_INTERNAL_X86_WIDE_NAME(CCSimdSwizzle, base, count)(CC_SIMD_INTERNAL_X86_WIDEN(base, count, a), v0, v1, v2, v3, v4, v5, v6, v7, v0, v1, v2, v3, v4, v5, v6, v7)); \
+}
+CC_SIMD_DECL(CCSimdSwizzle, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_64_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_INTERNAL_X86_WIDE_COUNT
+#undef CC_SIMD_INTERNAL_X86_WIDE_NAME
+#undef CC_SIMD_INTERNAL_X86_WIDEN
+#undef CC_SIMD_INTERNAL_X86_NARROW
+
+#endif
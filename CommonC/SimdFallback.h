@@ -34,7 +34,7 @@ CC_SIMD_DECL(CCSimdZero, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_MISSING_CCSimdZero)
 #endif
 
 #ifdef CC_SIMD_MISSING_CCSimdSetSequence
-#if CC_SIMD_LANES_MAX >= 2
+#if (CC_SIMD_LANES_MIN <= 2) && (CC_SIMD_LANES_MAX >= 2)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, CC_SIMD_BASE_TYPE(base) v, _Bool v0, _Bool v1) \
 { \
     switch ((v1 << 1) | v0) \
@@ -51,7 +51,7 @@ CC_SIMD_DECL(CCSimdSetSequence, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((C
 #undef CC_SIMD_IMPL
 #endif
 
-#if CC_SIMD_LANES_MAX >= 4
+#if (CC_SIMD_LANES_MIN <= 4) && (CC_SIMD_LANES_MAX >= 4)
 // FIXME: some interleaves are causing gpr use
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, CC_SIMD_BASE_TYPE(base) v, _Bool v0, _Bool v1, _Bool v2, _Bool v3) \
 { \
@@ -465,13 +465,13 @@ CC_SIMD_DECL(CCSimdCompareEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((
 #undef CC_SIMD_IMPL
 
 #ifdef CC_SIMD_N_FLOAT_32_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareEqual, base, count)(a, b), 25), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareEqual, base, count)(a, b), 25), 2)); }
 CC_SIMD_DECL(CCSimdCompareEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_32_TYPES), CC_SIMD_MISSING_CCSimdCompareEqual))
 #undef CC_SIMD_IMPL
 #endif
 
 #ifdef CC_SIMD_N_FLOAT_64_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareEqual, base, count)(a, b), 54), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareEqual, base, count)(a, b), 54), 2)); }
 CC_SIMD_DECL(CCSimdCompareEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_64_TYPES), CC_SIMD_MISSING_CCSimdCompareEqual))
 #undef CC_SIMD_IMPL
 #endif
@@ -483,13 +483,13 @@ CC_SIMD_DECL(CCSimdCompareNotEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTE
 #undef CC_SIMD_IMPL
 
 #ifdef CC_SIMD_N_FLOAT_32_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareNotEqual, base, count)(a, b), 25), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareNotEqual, base, count)(a, b), 25), 2)); }
 CC_SIMD_DECL(CCSimdCompareNotEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_32_TYPES), CC_SIMD_MISSING_CCSimdCompareNotEqual))
 #undef CC_SIMD_IMPL
 #endif
 
 #ifdef CC_SIMD_N_FLOAT_64_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareNotEqual, base, count)(a, b), 54), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareNotEqual, base, count)(a, b), 54), 2)); }
 CC_SIMD_DECL(CCSimdCompareNotEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_64_TYPES), CC_SIMD_MISSING_CCSimdCompareNotEqual))
 #undef CC_SIMD_IMPL
 #endif
@@ -501,13 +501,13 @@ CC_SIMD_DECL(CCSimdCompareLessThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTE
 #undef CC_SIMD_IMPL
 
 #ifdef CC_SIMD_N_FLOAT_32_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThan, base, count)(a, b), 25), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThan, base, count)(a, b), 25), 2)); }
 CC_SIMD_DECL(CCSimdCompareLessThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_32_TYPES), CC_SIMD_MISSING_CCSimdCompareLessThan))
 #undef CC_SIMD_IMPL
 #endif
 
 #ifdef CC_SIMD_N_FLOAT_64_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThan, base, count)(a, b), 54), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThan, base, count)(a, b), 54), 2)); }
 CC_SIMD_DECL(CCSimdCompareLessThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_64_TYPES), CC_SIMD_MISSING_CCSimdCompareLessThan))
 #undef CC_SIMD_IMPL
 #endif
@@ -519,13 +519,13 @@ CC_SIMD_DECL(CCSimdCompareLessThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_
 #undef CC_SIMD_IMPL
 
 #ifdef CC_SIMD_N_FLOAT_32_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThanEqual, base, count)(a, b), 25), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThanEqual, base, count)(a, b), 25), 2)); }
 CC_SIMD_DECL(CCSimdCompareLessThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_32_TYPES), CC_SIMD_MISSING_CCSimdCompareLessThanEqual))
 #undef CC_SIMD_IMPL
 #endif
 
 #ifdef CC_SIMD_N_FLOAT_64_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThanEqual, base, count)(a, b), 54), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareLessThanEqual, base, count)(a, b), 54), 2)); }
 CC_SIMD_DECL(CCSimdCompareLessThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_64_TYPES), CC_SIMD_MISSING_CCSimdCompareLessThanEqual))
 #undef CC_SIMD_IMPL
 #endif
@@ -537,13 +537,13 @@ CC_SIMD_DECL(CCSimdCompareGreaterThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FI
 #undef CC_SIMD_IMPL
 
 #ifdef CC_SIMD_N_FLOAT_32_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThan, base, count)(a, b), 25), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThan, base, count)(a, b), 25), 2)); }
 CC_SIMD_DECL(CCSimdCompareGreaterThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_32_TYPES), CC_SIMD_MISSING_CCSimdCompareGreaterThan))
 #undef CC_SIMD_IMPL
 #endif
 
 #ifdef CC_SIMD_N_FLOAT_64_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThan, base, count)(a, b), 54), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThan, base, count)(a, b), 54), 2)); }
 CC_SIMD_DECL(CCSimdCompareGreaterThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_64_TYPES), CC_SIMD_MISSING_CCSimdCompareGreaterThan))
 #undef CC_SIMD_IMPL
 #endif
@@ -555,13 +555,13 @@ CC_SIMD_DECL(CCSimdCompareGreaterThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TY
 #undef CC_SIMD_IMPL
 
 #ifdef CC_SIMD_N_FLOAT_32_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThanEqual, base, count)(a, b), 25), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThanEqual, base, count)(a, b), 25), 2)); }
 CC_SIMD_DECL(CCSimdCompareGreaterThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_32_TYPES), CC_SIMD_MISSING_CCSimdCompareGreaterThanEqual))
 #undef CC_SIMD_IMPL
 #endif
 
 #ifdef CC_SIMD_N_FLOAT_64_TYPES
-#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThanEqual, base, count)(a, b), 54), 2); }
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_CAT(CC_SIMD_NAME(CCSimd, base, count), CC_SIMD_NAME(_Reinterpret, CC_SIMD_TO(base, u), count))(CC_SIMD_NAME(CCSimdShiftRightN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdShiftLeftN, CC_SIMD_TO(base, u), count)(CC_SIMD_NAME(CCSimdMaskCompareGreaterThanEqual, base, count)(a, b), 54), 2)); }
 CC_SIMD_DECL(CCSimdCompareGreaterThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N_FLOAT_64_TYPES), CC_SIMD_MISSING_CCSimdCompareGreaterThanEqual))
 #undef CC_SIMD_IMPL
 #endif
@@ -652,7 +652,7 @@ CC_SIMD_DECL(CCSimdMod, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N
 #endif
 
 #ifdef CC_SIMD_MISSING_CCSimdHadd
-#if CC_SIMD_LANES_MAX >= 2
+#if (CC_SIMD_LANES_MIN <= 2) && (CC_SIMD_LANES_MAX >= 2)
 #define CC_SIMD_HADD_MASK(x0, x1) ((x1) << 2) | (x0)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1) \
 { \
@@ -688,7 +688,7 @@ CC_SIMD_DECL(CCSimdHadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_
 #undef CC_SIMD_HADD_MASK
 #endif
 
-#if CC_SIMD_LANES_MAX >= 4
+#if (CC_SIMD_LANES_MIN <= 4) && (CC_SIMD_LANES_MAX >= 4)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
 { \
     CCAssertLog((v0 <= 15) && (v1 <= 15) && (v2 <= 15) && (v3 <= 15), "Index masks must not exceed lane count"); \
@@ -763,7 +763,7 @@ CC_SIMD_DECL(CCSimdHadd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_
 #endif
 
 #ifdef CC_SIMD_MISSING_CCSimdHsub
-#if CC_SIMD_LANES_MAX >= 2
+#if (CC_SIMD_LANES_MIN <= 2) && (CC_SIMD_LANES_MAX >= 2)
 #define CC_SIMD_HSUB_MASK(x0, x1) ((x1) << 2) | (x0)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1) \
 { \
@@ -799,7 +799,7 @@ CC_SIMD_DECL(CCSimdHsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_
 #undef CC_SIMD_HSUB_MASK
 #endif
 
-#if CC_SIMD_LANES_MAX >= 4
+#if (CC_SIMD_LANES_MIN <= 4) && (CC_SIMD_LANES_MAX >= 4)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
 { \
     CCAssertLog((v0 <= 15) && (v1 <= 15) && (v2 <= 15) && (v3 <= 15), "Index masks must not exceed lane count"); \
@@ -870,7 +870,7 @@ CC_SIMD_DECL(CCSimdHsub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_
 #endif
 
 #ifdef CC_SIMD_MISSING_CCSimdDot
-#if CC_SIMD_LANES_MAX >= 2
+#if (CC_SIMD_LANES_MIN <= 2) && (CC_SIMD_LANES_MAX >= 2)
 #define CC_SIMD_DOT_MASK(x0, x1) ((x1) << 2) | (x0)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1) \
 { \
@@ -905,7 +905,7 @@ CC_SIMD_DECL(CCSimdDot, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_TYPE_FILTER((CC_SIMD_N
 #undef CC_SIMD_DOT_MASK
 #endif
 
-#if CC_SIMD_LANES_MAX >= 4
+#if (CC_SIMD_LANES_MIN <= 4) && (CC_SIMD_LANES_MAX >= 4)
 #define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
 { \
     CCAssertLog((v0 <= 15) && (v1 <= 15) && (v2 <= 15) && (v3 <= 15), "Index masks must not exceed lane count"); \
@@ -942,6 +942,7 @@ CC_SIMD_DECL(CCSimdClamp, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_MISSING_CCSimdClamp)
 #include <CommonC/SimdFallbackTrig.h>
 
 #undef CC_SIMD_LANES_MAX
+#undef CC_SIMD_LANES_MIN
 
 #undef CC_SIMD_N_2_ELEMENT_TYPES
 #undef CC_SIMD_N_4_ELEMENT_TYPES
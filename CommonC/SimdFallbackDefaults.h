@@ -28,6 +28,7 @@
 #endif
 
 #define CC_SIMD_LANES_MAX (CC_SIMD_WIDTH / 8)
+#define CC_SIMD_LANES_MIN (CC_SIMD_WIDTH > 128 ? CC_SIMD_WIDTH / 64 : 2)
 
 #define CC_SIMD_N_2_ELEMENT_TYPES CC_CAT(CC_SIMD_, CC_SIMD_WIDTH, _2_ELEMENT_TYPES)
 #define CC_SIMD_N_4_ELEMENT_TYPES CC_CAT(CC_SIMD_, CC_SIMD_WIDTH, _4_ELEMENT_TYPES)
@@ -654,7 +654,7 @@ static CC_FORCE_INLINE CC_SIMD_T CCSimdExp2(const CC_SIMD_T a)
     
     const CC_SIMD_T Offset = CCSimdCompareLessThan(a, Zero);
     
-    const CC_SIMD_T Mask = CCSimdMaskCompareLessThan_T(a, Min);
+    const CC_SIMD_U Mask = CCSimdMaskCompareLessThan_T(a, Min);
     const CC_SIMD_T Clip = CCSimd_T_Reinterpret_U(CCSimdOr(CCSimdAndNot(Mask, CCSimd_U_Reinterpret_T(a)), CCSimdAnd(Mask, CCSimd_U_Reinterpret_T(Min))));
     
     const CC_SIMD_T Z = CCSimdSub(CCSimdAdd_T(Clip, Offset), CCSimdRoundZero(Clip));
@@ -0,0 +1,432 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CC_SIMD_WIDTH
+#error "CC_SIMD_WIDTH is not defined"
+#endif
+
+/*
+ * Width independent x86 implementations shared by Simd64_x86.h, Simd128_x86.h and Simd256_x86.h. The vector types
+ * are compiler vector extensions so the element-wise operators map directly to SSE instructions, while
+ * anything needing specific intrinsics is left to the width specific headers.
+ */
+
+#define CC_SIMD_INTERNAL_X86_N_SIGNED_INTEGER_TYPES CC_SIMD_TYPE_FILTER((CC_SIMD_N_INTEGER_TYPES), CC_CAT(CC_SIMD_, CC_SIMD_WIDTH, _SIGNED_TYPES))
+#define CC_SIMD_INTERNAL_X86_N_UNSIGNED_TYPES CC_CAT(CC_SIMD_, CC_SIMD_WIDTH, _UNSIGNED_TYPES)
+
+#define CC_SIMD_INTERNAL_X86_MASK(base, count, x) ((CC_SIMD_TYPE(CC_SIMD_TO(base, u), count))(x))
+
+#if (CC_SIMD_WIDTH == 128) && CC_HARDWARE_VECTOR_SUPPORT_SSE4_1
+#define CC_SIMD_INTERNAL_X86_SELECT(base, count, mask, a, b) ((CC_SIMD_TYPE(base, count))_mm_blendv_epi8((__m128i)(a), (__m128i)(b), (__m128i)(mask)))
+#elif (CC_SIMD_WIDTH == 256) && CC_HARDWARE_VECTOR_SUPPORT_AVX2
+#define CC_SIMD_INTERNAL_X86_SELECT(base, count, mask, a, b) ((CC_SIMD_TYPE(base, count))_mm256_blendv_epi8((__m256i)(a), (__m256i)(b), (__m256i)(mask)))
+#else
+#define CC_SIMD_INTERNAL_X86_SELECT(base, count, mask, a, b) ((CC_SIMD_TYPE(base, count))((CC_SIMD_INTERNAL_X86_MASK(base, count, a) & ~CC_SIMD_INTERNAL_X86_MASK(base, count, mask)) | (CC_SIMD_INTERNAL_X86_MASK(base, count, b) & CC_SIMD_INTERNAL_X86_MASK(base, count, mask))))
+#endif
+
+/* Subtracting a zero vector broadcasts the scalar while keeping -0.0 intact. */
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_BASE_TYPE(base) v){ return v - (CC_SIMD_TYPE(base, count)){ 0 }; }
+CC_SIMD_DECL(CCSimdFill, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_BASE_TYPE(base) src[count]) \
+{ \
+    CC_SIMD_TYPE(base, count) Result; \
+    __builtin_memcpy(&Result, src, sizeof(Result)); \
+    \
+    return Result; \
+}
+CC_SIMD_DECL(CCSimdLoad, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (CC_SIMD_BASE_TYPE(base) dst[count], const CC_SIMD_TYPE(base, count) src){ __builtin_memcpy(dst, &src, sizeof(src)); }
+CC_SIMD_DECL(CCSimdStore, CC_SIMD_RETURN_TYPE(void), CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, n, kind) (const CC_SIMD_BASE_TYPE(base) src[count * n]) \
+{ \
+    CC_SIMD_POLY_TYPE(base, count, n) Result; \
+    \
+    for (size_t Loop = 0; Loop < count; Loop++) \
+    { \
+        for (size_t Index = 0; Index < n; Index++) Result.v[Index][Loop] = src[(Loop * n) + Index]; \
+    } \
+    \
+    return Result; \
+}
+CC_SIMD_POLY_DECL(CCSimdInterleaveLoad, 2, CC_SIMD_RETURN_TYPE_SIMD_POLY, CC_SIMD_N_TYPES)
+CC_SIMD_POLY_DECL(CCSimdInterleaveLoad, 3, CC_SIMD_RETURN_TYPE_SIMD_POLY, CC_SIMD_N_TYPES)
+CC_SIMD_POLY_DECL(CCSimdInterleaveLoad, 4, CC_SIMD_RETURN_TYPE_SIMD_POLY, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, n, kind) (CC_SIMD_BASE_TYPE(base) dst[count * n], const CC_SIMD_POLY_TYPE(base, count, n) src) \
+{ \
+    for (size_t Loop = 0; Loop < count; Loop++) \
+    { \
+        for (size_t Index = 0; Index < n; Index++) dst[(Loop * n) + Index] = src.v[Index][Loop]; \
+    } \
+}
+CC_SIMD_POLY_DECL(CCSimdInterleaveStore, 2, CC_SIMD_RETURN_TYPE(void), CC_SIMD_N_TYPES)
+CC_SIMD_POLY_DECL(CCSimdInterleaveStore, 3, CC_SIMD_RETURN_TYPE(void), CC_SIMD_N_TYPES)
+CC_SIMD_POLY_DECL(CCSimdInterleaveStore, 4, CC_SIMD_RETURN_TYPE(void), CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t index) \
+{ \
+    CCAssertLog(index < count, "Index must not exceed lane count"); \
+    \
+    return a[index]; \
+}
+CC_SIMD_DECL(CCSimdGet, CC_SIMD_RETURN_TYPE_BASE, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, uint8_t index, CC_SIMD_BASE_TYPE(base) v) \
+{ \
+    CCAssertLog(index < count, "Index must not exceed lane count"); \
+    \
+    CC_SIMD_TYPE(base, count) Result = a; \
+    Result[index] = v; \
+    \
+    return Result; \
+}
+CC_SIMD_DECL(CCSimdSet, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return ~a; }
+CC_SIMD_DECL(CCSimdNot, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a & b; }
+CC_SIMD_DECL(CCSimdAnd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return ~a & b; }
+CC_SIMD_DECL(CCSimdAndNot, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdAndNot
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a | b; }
+CC_SIMD_DECL(CCSimdOr, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return ~a | b; }
+CC_SIMD_DECL(CCSimdOrNot, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a ^ b; }
+CC_SIMD_DECL(CCSimdXor, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b) \
+{ \
+    const CC_SIMD_TYPE(CC_SIMD_TO(base, s), count) Shift = (CC_SIMD_TYPE(CC_SIMD_TO(base, s), count))b; \
+    const CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Count = (CC_SIMD_TYPE(CC_SIMD_TO(base, u), count))CC_SIMD_INTERNAL_X86_SELECT(CC_SIMD_TO(base, s), count, Shift < 0, Shift, -Shift); \
+    const CC_SIMD_TYPE(base, count) InRange = (CC_SIMD_TYPE(base, count))(Count < CC_SIMD_BITS(base)); \
+    const CC_SIMD_TYPE(base, count) Clamped = CC_SIMD_INTERNAL_X86_SELECT(base, count, InRange, (CC_SIMD_TYPE(base, count)){ 0 } + (CC_SIMD_BITS(base) - 1), (CC_SIMD_TYPE(base, count))Count); \
+    const CC_SIMD_TYPE(base, count) Left = (a << Clamped) & InRange; \
+    const CC_SIMD_TYPE(base, count) Right = (a >> Clamped) & (InRange | (CC_SIMD_TYPE(base, count))(a < 0)); \
+    \
+    return CC_SIMD_INTERNAL_X86_SELECT(base, count, Shift < 0, Left, Right); \
+}
+CC_SIMD_DECL(CCSimdShiftLeft, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const uint8_t n) \
+{ return a << n; }
+CC_SIMD_DECL(CCSimdShiftLeftN, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_NAME(CCSimdShiftLeft, base, count)(a, -b); }
+CC_SIMD_DECL(CCSimdShiftRight, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const uint8_t n) \
+{ return a >> n; }
+CC_SIMD_DECL(CCSimdShiftRightN, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits = (CC_SIMD_TYPE(CC_SIMD_TO(base, u), count))a; \
+    \
+    Bits |= Bits >> 1; \
+    Bits |= Bits >> 2; \
+    Bits = ~(Bits | (Bits >> 4)); \
+    Bits -= (Bits >> 1) & 0x55; \
+    Bits = (Bits & 0x33) + ((Bits >> 2) & 0x33); \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits + (Bits >> 4)) & 0x0f); \
+}
+CC_SIMD_DECL(CCSimdCountHighestUnset, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_8_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits = (CC_SIMD_TYPE(CC_SIMD_TO(base, u), count))a; \
+    \
+    Bits |= Bits >> 1; \
+    Bits |= Bits >> 2; \
+    Bits |= Bits >> 4; \
+    Bits = ~(Bits | (Bits >> 8)); \
+    Bits -= (Bits >> 1) & 0x5555; \
+    Bits = (Bits & 0x3333) + ((Bits >> 2) & 0x3333); \
+    Bits = (Bits + (Bits >> 4)) & 0x0f0f; \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits + (Bits >> 8)) & 0x1f); \
+}
+CC_SIMD_DECL(CCSimdCountHighestUnset, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_16_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits = (CC_SIMD_TYPE(CC_SIMD_TO(base, u), count))a; \
+    \
+    Bits |= Bits >> 1; \
+    Bits |= Bits >> 2; \
+    Bits |= Bits >> 4; \
+    Bits |= Bits >> 8; \
+    Bits = ~(Bits | (Bits >> 16)); \
+    Bits -= (Bits >> 1) & 0x55555555; \
+    Bits = (Bits & 0x33333333) + ((Bits >> 2) & 0x33333333); \
+    Bits = (Bits + (Bits >> 4)) & 0x0f0f0f0f; \
+    Bits += Bits >> 8; \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits + (Bits >> 16)) & 0x3f); \
+}
+CC_SIMD_DECL(CCSimdCountHighestUnset, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_32_TYPES)
+#undef CC_SIMD_IMPL
+
+#ifdef CC_SIMD_N_INTEGER_64_TYPES
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    CC_SIMD_TYPE(CC_SIMD_TO(base, u), count) Bits = (CC_SIMD_TYPE(CC_SIMD_TO(base, u), count))a; \
+    \
+    Bits |= Bits >> 1; \
+    Bits |= Bits >> 2; \
+    Bits |= Bits >> 4; \
+    Bits |= Bits >> 8; \
+    Bits |= Bits >> 16; \
+    Bits = ~(Bits | (Bits >> 32)); \
+    Bits -= (Bits >> 1) & 0x5555555555555555ULL; \
+    Bits = (Bits & 0x3333333333333333ULL) + ((Bits >> 2) & 0x3333333333333333ULL); \
+    Bits = (Bits + (Bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL; \
+    Bits += Bits >> 8; \
+    Bits += Bits >> 16; \
+    \
+    return (CC_SIMD_TYPE(base, count))((Bits + (Bits >> 32)) & 0x7f); \
+}
+CC_SIMD_DECL(CCSimdCountHighestUnset, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_64_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return (CC_SIMD_TYPE(base, count))(a == b); }
+CC_SIMD_DECL(CCSimdMaskCompareEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_MASK(base, count, a == b); }
+CC_SIMD_DECL(CCSimdMaskCompareEqual, CC_SIMD_RETURN_TYPE_SIMD_TO(u), CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return (CC_SIMD_TYPE(base, count))(a != b); }
+CC_SIMD_DECL(CCSimdMaskCompareNotEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_MASK(base, count, a != b); }
+CC_SIMD_DECL(CCSimdMaskCompareNotEqual, CC_SIMD_RETURN_TYPE_SIMD_TO(u), CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdMaskCompareNotEqual
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return (CC_SIMD_TYPE(base, count))(a < b); }
+CC_SIMD_DECL(CCSimdMaskCompareLessThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_MASK(base, count, a < b); }
+CC_SIMD_DECL(CCSimdMaskCompareLessThan, CC_SIMD_RETURN_TYPE_SIMD_TO(u), CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return (CC_SIMD_TYPE(base, count))(a <= b); }
+CC_SIMD_DECL(CCSimdMaskCompareLessThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_MASK(base, count, a <= b); }
+CC_SIMD_DECL(CCSimdMaskCompareLessThanEqual, CC_SIMD_RETURN_TYPE_SIMD_TO(u), CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return (CC_SIMD_TYPE(base, count))(a > b); }
+CC_SIMD_DECL(CCSimdMaskCompareGreaterThan, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_MASK(base, count, a > b); }
+CC_SIMD_DECL(CCSimdMaskCompareGreaterThan, CC_SIMD_RETURN_TYPE_SIMD_TO(u), CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return (CC_SIMD_TYPE(base, count))(a >= b); }
+CC_SIMD_DECL(CCSimdMaskCompareGreaterThanEqual, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return CC_SIMD_INTERNAL_X86_MASK(base, count, a >= b); }
+CC_SIMD_DECL(CCSimdMaskCompareGreaterThanEqual, CC_SIMD_RETURN_TYPE_SIMD_TO(u), CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a + b; }
+CC_SIMD_DECL(CCSimdAdd, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a - b; }
+CC_SIMD_DECL(CCSimdSub, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a * b; }
+CC_SIMD_DECL(CCSimdMul, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b){ return a / b; }
+CC_SIMD_DECL(CCSimdDiv, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#undef CC_SIMD_MISSING_CCSimdDiv
+#define CC_SIMD_MISSING_CCSimdDiv CC_SIMD_N_INTEGER_TYPES
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return -a; }
+CC_SIMD_DECL(CCSimdNeg, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a) \
+{ \
+    const CC_SIMD_TYPE(base, count) Sign = a >> (CC_SIMD_BITS(base) - 1); \
+    \
+    return (a ^ Sign) - Sign; \
+}
+CC_SIMD_DECL(CCSimdAbs, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_N_SIGNED_INTEGER_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return a; }
+CC_SIMD_DECL(CCSimdAbs, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_INTERNAL_X86_N_UNSIGNED_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a){ return (CC_SIMD_TYPE(base, count))(CC_SIMD_INTERNAL_X86_MASK(base, count, a) & ~CC_SIMD_INTERNAL_X86_MASK(base, count, CC_SIMD_NAME(CCSimdFill, base, count)(-0.0))); }
+CC_SIMD_DECL(CCSimdAbs, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_FLOAT_TYPES)
+#undef CC_SIMD_IMPL
+
+#if CC_SIMD_LANES_MIN <= 2
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2), "Indexes must not exceed arg count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_SELECT(base, count, ((CC_SIMD_TYPE(CC_SIMD_TO(base, s), count)){ -v0, -v1 }), a, b); \
+}
+CC_SIMD_DECL(CCSimdInterleave, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2) && (v2 < 2) && (v3 < 2), "Indexes must not exceed arg count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_SELECT(base, count, ((CC_SIMD_TYPE(CC_SIMD_TO(base, s), count)){ -v0, -v1, -v2, -v3 }), a, b); \
+}
+CC_SIMD_DECL(CCSimdInterleave, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2) && (v2 < 2) && (v3 < 2) && (v4 < 2) && (v5 < 2) && (v6 < 2) && (v7 < 2), "Indexes must not exceed arg count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_SELECT(base, count, ((CC_SIMD_TYPE(CC_SIMD_TO(base, s), count)){ -v0, -v1, -v2, -v3, -v4, -v5, -v6, -v7 }), a, b); \
+}
+CC_SIMD_DECL(CCSimdInterleave, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#if CC_SIMD_LANES_MAX >= 16
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2) && (v2 < 2) && (v3 < 2) && (v4 < 2) && (v5 < 2) && (v6 < 2) && (v7 < 2) && (v8 < 2) && (v9 < 2) && (v10 < 2) && (v11 < 2) && (v12 < 2) && (v13 < 2) && (v14 < 2) && (v15 < 2), "Indexes must not exceed arg count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_SELECT(base, count, ((CC_SIMD_TYPE(CC_SIMD_TO(base, s), count)){ -v0, -v1, -v2, -v3, -v4, -v5, -v6, -v7, -v8, -v9, -v10, -v11, -v12, -v13, -v14, -v15 }), a, b); \
+}
+CC_SIMD_DECL(CCSimdInterleave, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#if CC_SIMD_LANES_MAX >= 32
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15, uint8_t v16, uint8_t v17, uint8_t v18, uint8_t v19, uint8_t v20, uint8_t v21, uint8_t v22, uint8_t v23, uint8_t v24, uint8_t v25, uint8_t v26, uint8_t v27, uint8_t v28, uint8_t v29, uint8_t v30, uint8_t v31) \
+{ \
+    CCAssertLog((v0 < 2) && (v1 < 2) && (v2 < 2) && (v3 < 2) && (v4 < 2) && (v5 < 2) && (v6 < 2) && (v7 < 2) && (v8 < 2) && (v9 < 2) && (v10 < 2) && (v11 < 2) && (v12 < 2) && (v13 < 2) && (v14 < 2) && (v15 < 2) && (v16 < 2) && (v17 < 2) && (v18 < 2) && (v19 < 2) && (v20 < 2) && (v21 < 2) && (v22 < 2) && (v23 < 2) && (v24 < 2) && (v25 < 2) && (v26 < 2) && (v27 < 2) && (v28 < 2) && (v29 < 2) && (v30 < 2) && (v31 < 2), "Indexes must not exceed arg count"); \
+    \
+    return CC_SIMD_INTERNAL_X86_SELECT(base, count, ((CC_SIMD_TYPE(CC_SIMD_TO(base, s), count)){ -v0, -v1, -v2, -v3, -v4, -v5, -v6, -v7, -v8, -v9, -v10, -v11, -v12, -v13, -v14, -v15, -v16, -v17, -v18, -v19, -v20, -v21, -v22, -v23, -v24, -v25, -v26, -v27, -v28, -v29, -v30, -v31 }), a, b); \
+}
+CC_SIMD_DECL(CCSimdInterleave, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_32_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#if CC_SIMD_LANES_MIN <= 2
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1) \
+{ \
+    CCAssertLog(((v0 & 0xf) < 2) && ((v1 & 0xf) < 2), "Indexes must not exceed lane count"); \
+    CCAssertLog(!((v0 | v1) & ~0x11), "Indexes must only reference either a or b"); \
+    \
+    return CC_SIMD_NAME(CCSimdInterleave, base, count)(CC_SIMD_NAME(CCSimdSwizzle, base, count)(a, v0 & 1, v1 & 1), CC_SIMD_NAME(CCSimdSwizzle, base, count)(b, v0 & 1, v1 & 1), v0 >> 4, v1 >> 4); \
+}
+CC_SIMD_DECL(CCSimdMerge, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_2_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3) \
+{ \
+    CCAssertLog(((v0 & 0xf) < 4) && ((v1 & 0xf) < 4) && ((v2 & 0xf) < 4) && ((v3 & 0xf) < 4), "Indexes must not exceed lane count"); \
+    CCAssertLog(!((v0 | v1 | v2 | v3) & ~0x13), "Indexes must only reference either a or b"); \
+    \
+    return CC_SIMD_NAME(CCSimdInterleave, base, count)(CC_SIMD_NAME(CCSimdSwizzle, base, count)(a, v0 & 3, v1 & 3, v2 & 3, v3 & 3), CC_SIMD_NAME(CCSimdSwizzle, base, count)(b, v0 & 3, v1 & 3, v2 & 3, v3 & 3), v0 >> 4, v1 >> 4, v2 >> 4, v3 >> 4); \
+}
+CC_SIMD_DECL(CCSimdMerge, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_4_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7) \
+{ \
+    CCAssertLog(((v0 & 0xf) < 8) && ((v1 & 0xf) < 8) && ((v2 & 0xf) < 8) && ((v3 & 0xf) < 8) && ((v4 & 0xf) < 8) && ((v5 & 0xf) < 8) && ((v6 & 0xf) < 8) && ((v7 & 0xf) < 8), "Indexes must not exceed lane count"); \
+    CCAssertLog(!((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7) & ~0x17), "Indexes must only reference either a or b"); \
+    \
+    return CC_SIMD_NAME(CCSimdInterleave, base, count)(CC_SIMD_NAME(CCSimdSwizzle, base, count)(a, v0 & 7, v1 & 7, v2 & 7, v3 & 7, v4 & 7, v5 & 7, v6 & 7, v7 & 7), CC_SIMD_NAME(CCSimdSwizzle, base, count)(b, v0 & 7, v1 & 7, v2 & 7, v3 & 7, v4 & 7, v5 & 7, v6 & 7, v7 & 7), v0 >> 4, v1 >> 4, v2 >> 4, v3 >> 4, v4 >> 4, v5 >> 4, v6 >> 4, v7 >> 4); \
+}
+CC_SIMD_DECL(CCSimdMerge, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_8_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+
+#if CC_SIMD_LANES_MAX >= 16
+#define CC_SIMD_IMPL(base, count, kind) (const CC_SIMD_TYPE(base, count) a, const CC_SIMD_TYPE(base, count) b, uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4, uint8_t v5, uint8_t v6, uint8_t v7, uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15) \
+{ \
+    CCAssertLog(!((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7 | v8 | v9 | v10 | v11 | v12 | v13 | v14 | v15) & ~0x1f), "Indexes must only reference either a or b"); \
+    \
+    return CC_SIMD_NAME(CCSimdInterleave, base, count)(CC_SIMD_NAME(CCSimdSwizzle, base, count)(a, v0 & 15, v1 & 15, v2 & 15, v3 & 15, v4 & 15, v5 & 15, v6 & 15, v7 & 15, v8 & 15, v9 & 15, v10 & 15, v11 & 15, v12 & 15, v13 & 15, v14 & 15, v15 & 15), CC_SIMD_NAME(CCSimdSwizzle, base, count)(b, v0 & 15, v1 & 15, v2 & 15, v3 & 15, v4 & 15, v5 & 15, v6 & 15, v7 & 15, v8 & 15, v9 & 15, v10 & 15, v11 & 15, v12 & 15, v13 & 15, v14 & 15, v15 & 15), v0 >> 4, v1 >> 4, v2 >> 4, v3 >> 4, v4 >> 4, v5 >> 4, v6 >> 4, v7 >> 4, v8 >> 4, v9 >> 4, v10 >> 4, v11 >> 4, v12 >> 4, v13 >> 4, v14 >> 4, v15 >> 4); \
+}
+CC_SIMD_DECL(CCSimdMerge, CC_SIMD_RETURN_TYPE_SIMD, CC_SIMD_N_16_ELEMENT_TYPES)
+#undef CC_SIMD_IMPL
+#endif
+
+#undef CC_SIMD_INTERNAL_X86_N_SIGNED_INTEGER_TYPES
+#undef CC_SIMD_INTERNAL_X86_N_UNSIGNED_TYPES
+#undef CC_SIMD_INTERNAL_X86_MASK
+#undef CC_SIMD_INTERNAL_X86_SELECT
@@ -142,13 +142,10 @@ uintmax_t CCStringHasher(CCString *Key)
 
 uintmax_t CCBigIntHasher(CCBigInt *Key)
 {
-    CCEnumerable Enumerable;
-    CCListGetEnumerable((*Key)->value, &Enumerable);
-    
     uintmax_t Hash = 0;
-    for (uint64_t *Component = CCEnumerableGetCurrent(&Enumerable); Component; Component = CCEnumerableNext(&Enumerable))
+    for (size_t Loop = 0, Count = CCBigIntGetComponentCount(*Key); Loop < Count; Loop++)
     {
-        Hash ^= *Component;
+        Hash ^= CCBigIntGetComponent(*Key, Loop);
     }
     
     return Hash | ((uint64_t)CCBigIntGetSign(*Key) << 63);
@@ -0,0 +1,510 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "VectorBatch.h"
+#include "Vector.h"
+#include "Matrix4.h"
+#include "Assertion.h"
+
+#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON || CC_HARDWARE_VECTOR_SUPPORT_SSE2
+#include "Simd.h"
+
+#if CC_HARDWARE_VECTOR_SUPPORT_AVX
+#define CC_VECTOR_BATCH_LANES 8
+#define CC_VECTOR_BATCH_SIMD(op) CCSimd##op##_f32x8
+typedef CCSimd_f32x8 CCVectorBatchSimd;
+#else
+#define CC_VECTOR_BATCH_LANES 4
+#define CC_VECTOR_BATCH_SIMD(op) CCSimd##op##_f32x4
+typedef CCSimd_f32x4 CCVectorBatchSimd;
+#endif
+
+#define CC_VECTOR_BATCH_LOAD(array, index) CC_VECTOR_BATCH_SIMD(Load)((array) + (index))
+#define CC_VECTOR_BATCH_STORE(array, index, v) CC_VECTOR_BATCH_SIMD(Store)((array) + (index), v)
+
+/*
+ The SIMD bodies follow the same order of operations as the single vector functions (separate multiplies and adds,
+ true division and square roots), so the results are the same regardless of which path handles a given vector.
+ */
+
+static CC_FORCE_INLINE CCVectorBatchSimd CCVectorBatchDot2(const CCVectorBatchSimd ax, const CCVectorBatchSimd ay, const CCVectorBatchSimd bx, const CCVectorBatchSimd by)
+{
+    return CC_VECTOR_BATCH_SIMD(Add)(CC_VECTOR_BATCH_SIMD(Mul)(ax, bx), CC_VECTOR_BATCH_SIMD(Mul)(ay, by));
+}
+
+static CC_FORCE_INLINE CCVectorBatchSimd CCVectorBatchDot3(const CCVectorBatchSimd ax, const CCVectorBatchSimd ay, const CCVectorBatchSimd az, const CCVectorBatchSimd bx, const CCVectorBatchSimd by, const CCVectorBatchSimd bz)
+{
+    return CC_VECTOR_BATCH_SIMD(Add)(CCVectorBatchDot2(ax, ay, bx, by), CC_VECTOR_BATCH_SIMD(Mul)(az, bz));
+}
+
+static CC_FORCE_INLINE CCVectorBatchSimd CCVectorBatchDot4(const CCVectorBatchSimd ax, const CCVectorBatchSimd ay, const CCVectorBatchSimd az, const CCVectorBatchSimd aw, const CCVectorBatchSimd bx, const CCVectorBatchSimd by, const CCVectorBatchSimd bz, const CCVectorBatchSimd bw)
+{
+    return CC_VECTOR_BATCH_SIMD(Add)(CCVectorBatchDot3(ax, ay, az, bx, by, bz), CC_VECTOR_BATCH_SIMD(Mul)(aw, bw));
+}
+#endif
+
+#define CC_VECTOR_BATCH_GET2(v, index) CCVector2DMake((v).x[index], (v).y[index])
+#define CC_VECTOR_BATCH_GET3(v, index) CCVector3DMake((v).x[index], (v).y[index], (v).z[index])
+#define CC_VECTOR_BATCH_GET4(v, index) CCVector4DMake((v).x[index], (v).y[index], (v).z[index], (v).w[index])
+
+#define CC_VECTOR_BATCH_SET2(v, index, r) do { const CCVector2D Value_ = (r); (v).x[index] = Value_.x; (v).y[index] = Value_.y; } while (0)
+#define CC_VECTOR_BATCH_SET3(v, index, r) do { const CCVector3D Value_ = (r); (v).x[index] = Value_.x; (v).y[index] = Value_.y; (v).z[index] = Value_.z; } while (0)
+#define CC_VECTOR_BATCH_SET4(v, index, r) do { const CCVector4D Value_ = (r); (v).x[index] = Value_.x; (v).y[index] = Value_.y; (v).z[index] = Value_.z; (v).w[index] = Value_.w; } while (0)
+
+#pragma mark - Vector2D
+
+void CCVector2BatchDot(const CCVector2DBatch a, const CCVector2DBatch b, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && b.x && b.y && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result, Loop, CCVectorBatchDot2(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector2Dot(CC_VECTOR_BATCH_GET2(a, Loop), CC_VECTOR_BATCH_GET2(b, Loop));
+}
+
+void CCVector2BatchLength(const CCVector2DBatch a, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(a.x, Loop), y = CC_VECTOR_BATCH_LOAD(a.y, Loop);
+        
+        CC_VECTOR_BATCH_STORE(Result, Loop, CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot2(x, y, x, y)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector2Length(CC_VECTOR_BATCH_GET2(a, Loop));
+}
+
+void CCVector2BatchDistance(const CCVector2DBatch a, const CCVector2DBatch b, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && b.x && b.y && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop));
+        const CCVectorBatchSimd y = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop));
+        
+        CC_VECTOR_BATCH_STORE(Result, Loop, CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot2(x, y, x, y)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector2Distance(CC_VECTOR_BATCH_GET2(a, Loop), CC_VECTOR_BATCH_GET2(b, Loop));
+}
+
+void CCVector2BatchNormalize(const CCVector2DBatch a, const CCVector2DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && Result.x && Result.y), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(a.x, Loop), y = CC_VECTOR_BATCH_LOAD(a.y, Loop);
+        const CCVectorBatchSimd Length = CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot2(x, y, x, y));
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Div)(x, Length));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Div)(y, Length));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET2(Result, Loop, CCVector2Normalize(CC_VECTOR_BATCH_GET2(a, Loop)));
+}
+
+void CCVector2BatchMin(const CCVector2DBatch a, const CCVector2DBatch b, const CCVector2DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && b.x && b.y && Result.x && Result.y), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET2(Result, Loop, CCVector2Min(CC_VECTOR_BATCH_GET2(a, Loop), CC_VECTOR_BATCH_GET2(b, Loop)));
+}
+
+void CCVector2BatchMax(const CCVector2DBatch a, const CCVector2DBatch b, const CCVector2DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && b.x && b.y && Result.x && Result.y), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET2(Result, Loop, CCVector2Max(CC_VECTOR_BATCH_GET2(a, Loop), CC_VECTOR_BATCH_GET2(b, Loop)));
+}
+
+#pragma mark - Vector3D
+
+void CCVector3BatchDot(const CCVector3DBatch a, const CCVector3DBatch b, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && b.x && b.y && b.z && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result, Loop, CCVectorBatchDot3(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector3Dot(CC_VECTOR_BATCH_GET3(a, Loop), CC_VECTOR_BATCH_GET3(b, Loop));
+}
+
+void CCVector3BatchLength(const CCVector3DBatch a, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(a.x, Loop), y = CC_VECTOR_BATCH_LOAD(a.y, Loop), z = CC_VECTOR_BATCH_LOAD(a.z, Loop);
+        
+        CC_VECTOR_BATCH_STORE(Result, Loop, CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot3(x, y, z, x, y, z)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector3Length(CC_VECTOR_BATCH_GET3(a, Loop));
+}
+
+void CCVector3BatchDistance(const CCVector3DBatch a, const CCVector3DBatch b, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && b.x && b.y && b.z && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop));
+        const CCVectorBatchSimd y = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop));
+        const CCVectorBatchSimd z = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop));
+        
+        CC_VECTOR_BATCH_STORE(Result, Loop, CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot3(x, y, z, x, y, z)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector3Distance(CC_VECTOR_BATCH_GET3(a, Loop), CC_VECTOR_BATCH_GET3(b, Loop));
+}
+
+void CCVector3BatchNormalize(const CCVector3DBatch a, const CCVector3DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && Result.x && Result.y && Result.z), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(a.x, Loop), y = CC_VECTOR_BATCH_LOAD(a.y, Loop), z = CC_VECTOR_BATCH_LOAD(a.z, Loop);
+        const CCVectorBatchSimd Length = CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot3(x, y, z, x, y, z));
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Div)(x, Length));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Div)(y, Length));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Div)(z, Length));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET3(Result, Loop, CCVector3Normalize(CC_VECTOR_BATCH_GET3(a, Loop)));
+}
+
+void CCVector3BatchMin(const CCVector3DBatch a, const CCVector3DBatch b, const CCVector3DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && b.x && b.y && b.z && Result.x && Result.y && Result.z), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET3(Result, Loop, CCVector3Min(CC_VECTOR_BATCH_GET3(a, Loop), CC_VECTOR_BATCH_GET3(b, Loop)));
+}
+
+void CCVector3BatchMax(const CCVector3DBatch a, const CCVector3DBatch b, const CCVector3DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && b.x && b.y && b.z && Result.x && Result.y && Result.z), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET3(Result, Loop, CCVector3Max(CC_VECTOR_BATCH_GET3(a, Loop), CC_VECTOR_BATCH_GET3(b, Loop)));
+}
+
+#pragma mark - Vector4D
+
+void CCVector4BatchDot(const CCVector4DBatch a, const CCVector4DBatch b, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && a.w && b.x && b.y && b.z && b.w && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result, Loop, CCVectorBatchDot4(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(a.w, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop), CC_VECTOR_BATCH_LOAD(b.w, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector4Dot(CC_VECTOR_BATCH_GET4(a, Loop), CC_VECTOR_BATCH_GET4(b, Loop));
+}
+
+void CCVector4BatchLength(const CCVector4DBatch a, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && a.w && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(a.x, Loop), y = CC_VECTOR_BATCH_LOAD(a.y, Loop), z = CC_VECTOR_BATCH_LOAD(a.z, Loop), w = CC_VECTOR_BATCH_LOAD(a.w, Loop);
+        
+        CC_VECTOR_BATCH_STORE(Result, Loop, CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot4(x, y, z, w, x, y, z, w)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector4Length(CC_VECTOR_BATCH_GET4(a, Loop));
+}
+
+void CCVector4BatchDistance(const CCVector4DBatch a, const CCVector4DBatch b, float *Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && a.w && b.x && b.y && b.z && b.w && Result), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop));
+        const CCVectorBatchSimd y = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop));
+        const CCVectorBatchSimd z = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop));
+        const CCVectorBatchSimd w = CC_VECTOR_BATCH_SIMD(Sub)(CC_VECTOR_BATCH_LOAD(a.w, Loop), CC_VECTOR_BATCH_LOAD(b.w, Loop));
+        
+        CC_VECTOR_BATCH_STORE(Result, Loop, CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot4(x, y, z, w, x, y, z, w)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) Result[Loop] = CCVector4Distance(CC_VECTOR_BATCH_GET4(a, Loop), CC_VECTOR_BATCH_GET4(b, Loop));
+}
+
+void CCVector4BatchNormalize(const CCVector4DBatch a, const CCVector4DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && a.w && Result.x && Result.y && Result.z && Result.w), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(a.x, Loop), y = CC_VECTOR_BATCH_LOAD(a.y, Loop), z = CC_VECTOR_BATCH_LOAD(a.z, Loop), w = CC_VECTOR_BATCH_LOAD(a.w, Loop);
+        const CCVectorBatchSimd Length = CC_VECTOR_BATCH_SIMD(Sqrt)(CCVectorBatchDot4(x, y, z, w, x, y, z, w));
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Div)(x, Length));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Div)(y, Length));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Div)(z, Length));
+        CC_VECTOR_BATCH_STORE(Result.w, Loop, CC_VECTOR_BATCH_SIMD(Div)(w, Length));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET4(Result, Loop, CCVector4Normalize(CC_VECTOR_BATCH_GET4(a, Loop)));
+}
+
+void CCVector4BatchMin(const CCVector4DBatch a, const CCVector4DBatch b, const CCVector4DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && a.w && b.x && b.y && b.z && b.w && Result.x && Result.y && Result.z && Result.w), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.w, Loop, CC_VECTOR_BATCH_SIMD(Min)(CC_VECTOR_BATCH_LOAD(a.w, Loop), CC_VECTOR_BATCH_LOAD(b.w, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET4(Result, Loop, CCVector4Min(CC_VECTOR_BATCH_GET4(a, Loop), CC_VECTOR_BATCH_GET4(b, Loop)));
+}
+
+void CCVector4BatchMax(const CCVector4DBatch a, const CCVector4DBatch b, const CCVector4DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (a.x && a.y && a.z && a.w && b.x && b.y && b.z && b.w && Result.x && Result.y && Result.z && Result.w), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.x, Loop), CC_VECTOR_BATCH_LOAD(b.x, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.y, Loop), CC_VECTOR_BATCH_LOAD(b.y, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.z, Loop), CC_VECTOR_BATCH_LOAD(b.z, Loop)));
+        CC_VECTOR_BATCH_STORE(Result.w, Loop, CC_VECTOR_BATCH_SIMD(Max)(CC_VECTOR_BATCH_LOAD(a.w, Loop), CC_VECTOR_BATCH_LOAD(b.w, Loop)));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET4(Result, Loop, CCVector4Max(CC_VECTOR_BATCH_GET4(a, Loop), CC_VECTOR_BATCH_GET4(b, Loop)));
+}
+
+#pragma mark - Matrix4
+
+#if CC_VECTOR_BATCH_LANES
+/*
+ Row of CCMatrix4MulVector4D: (m.x[Row] * x) + (m.y[Row] * y) + (m.z[Row] * z) + (m.w[Row] * w)
+ */
+static CC_FORCE_INLINE CCVectorBatchSimd CCMatrix4BatchRow(const CCMatrix4 m, size_t Row, const CCVectorBatchSimd x, const CCVectorBatchSimd y, const CCVectorBatchSimd z, const CCVectorBatchSimd w)
+{
+    return CCVectorBatchDot4(CC_VECTOR_BATCH_SIMD(Fill)(m.x.v[Row]), CC_VECTOR_BATCH_SIMD(Fill)(m.y.v[Row]), CC_VECTOR_BATCH_SIMD(Fill)(m.z.v[Row]), CC_VECTOR_BATCH_SIMD(Fill)(m.w.v[Row]), x, y, z, w);
+}
+#endif
+
+void CCMatrix4BatchMulPositionVector3D(const CCMatrix4 m, const CCVector3DBatch v, const CCVector3DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (v.x && v.y && v.z && Result.x && Result.y && Result.z), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    const CCVectorBatchSimd w = CC_VECTOR_BATCH_SIMD(Fill)(1.0f);
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(v.x, Loop), y = CC_VECTOR_BATCH_LOAD(v.y, Loop), z = CC_VECTOR_BATCH_LOAD(v.z, Loop);
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CCMatrix4BatchRow(m, 0, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CCMatrix4BatchRow(m, 1, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CCMatrix4BatchRow(m, 2, x, y, z, w));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET3(Result, Loop, CCMatrix4MulPositionVector3D(m, CC_VECTOR_BATCH_GET3(v, Loop)));
+}
+
+void CCMatrix4BatchMulDirectionVector3D(const CCMatrix4 m, const CCVector3DBatch v, const CCVector3DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (v.x && v.y && v.z && Result.x && Result.y && Result.z), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    const CCVectorBatchSimd w = CC_VECTOR_BATCH_SIMD(Fill)(0.0f);
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(v.x, Loop), y = CC_VECTOR_BATCH_LOAD(v.y, Loop), z = CC_VECTOR_BATCH_LOAD(v.z, Loop);
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CCMatrix4BatchRow(m, 0, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CCMatrix4BatchRow(m, 1, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CCMatrix4BatchRow(m, 2, x, y, z, w));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET3(Result, Loop, CCMatrix4MulDirectionVector3D(m, CC_VECTOR_BATCH_GET3(v, Loop)));
+}
+
+void CCMatrix4BatchMulProjectVector3D(const CCMatrix4 m, const CCVector3DBatch v, const CCVector3DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (v.x && v.y && v.z && Result.x && Result.y && Result.z), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    const CCVectorBatchSimd w = CC_VECTOR_BATCH_SIMD(Fill)(1.0f);
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(v.x, Loop), y = CC_VECTOR_BATCH_LOAD(v.y, Loop), z = CC_VECTOR_BATCH_LOAD(v.z, Loop);
+        const CCVectorBatchSimd InvW = CC_VECTOR_BATCH_SIMD(Div)(w, CCMatrix4BatchRow(m, 3, x, y, z, w));
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CC_VECTOR_BATCH_SIMD(Mul)(CCMatrix4BatchRow(m, 0, x, y, z, w), InvW));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CC_VECTOR_BATCH_SIMD(Mul)(CCMatrix4BatchRow(m, 1, x, y, z, w), InvW));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CC_VECTOR_BATCH_SIMD(Mul)(CCMatrix4BatchRow(m, 2, x, y, z, w), InvW));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET3(Result, Loop, CCMatrix4MulProjectVector3D(m, CC_VECTOR_BATCH_GET3(v, Loop)));
+}
+
+void CCMatrix4BatchMulVector4D(const CCMatrix4 m, const CCVector4DBatch v, const CCVector4DBatch Result, size_t Count)
+{
+    CCAssertLog(!Count || (v.x && v.y && v.z && v.w && Result.x && Result.y && Result.z && Result.w), "Arrays must not be null");
+    
+    size_t Loop = 0;
+    
+#if CC_VECTOR_BATCH_LANES
+    for ( ; (Loop + CC_VECTOR_BATCH_LANES) <= Count; Loop += CC_VECTOR_BATCH_LANES)
+    {
+        const CCVectorBatchSimd x = CC_VECTOR_BATCH_LOAD(v.x, Loop), y = CC_VECTOR_BATCH_LOAD(v.y, Loop), z = CC_VECTOR_BATCH_LOAD(v.z, Loop), w = CC_VECTOR_BATCH_LOAD(v.w, Loop);
+        
+        CC_VECTOR_BATCH_STORE(Result.x, Loop, CCMatrix4BatchRow(m, 0, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.y, Loop, CCMatrix4BatchRow(m, 1, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.z, Loop, CCMatrix4BatchRow(m, 2, x, y, z, w));
+        CC_VECTOR_BATCH_STORE(Result.w, Loop, CCMatrix4BatchRow(m, 3, x, y, z, w));
+    }
+#endif
+    
+    for ( ; Loop < Count; Loop++) CC_VECTOR_BATCH_SET4(Result, Loop, CCMatrix4MulVector4D(m, CC_VECTOR_BATCH_GET4(v, Loop)));
+}
@@ -0,0 +1,277 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CommonC_VectorBatch_h
+#define CommonC_VectorBatch_h
+
+#include <CommonC/Base.h>
+#include <CommonC/Types.h>
+
+/*!
+ * @brief A structure-of-arrays view of 2D vectors.
+ * @description Each component is stored in its own array, the vector at index i is (x[i], y[i]).
+ */
+typedef struct {
+    float *x;
+    float *y;
+} CCVector2DBatch;
+
+/*!
+ * @brief A structure-of-arrays view of 3D vectors.
+ * @description Each component is stored in its own array, the vector at index i is (x[i], y[i], z[i]).
+ */
+typedef struct {
+    float *x;
+    float *y;
+    float *z;
+} CCVector3DBatch;
+
+/*!
+ * @brief A structure-of-arrays view of 4D vectors.
+ * @description Each component is stored in its own array, the vector at index i is (x[i], y[i], z[i], w[i]).
+ */
+typedef struct {
+    float *x;
+    float *y;
+    float *z;
+    float *w;
+} CCVector4DBatch;
+
+#define CCVector2DBatchMake(x, y) ((CCVector2DBatch){ (x), (y) })
+#define CCVector3DBatchMake(x, y, z) ((CCVector3DBatch){ (x), (y), (z) })
+#define CCVector4DBatchMake(x, y, z, w) ((CCVector4DBatch){ (x), (y), (z), (w) })
+
+/*
+ Batch variants of the single vector operations. Each produces the same result as applying the single vector operation
+ (e.g. CCVector3Dot) to every vector in turn, but processes multiple vectors per SIMD operation.
+ 
+ Outputs may be the same arrays as the inputs (in-place), but must not otherwise overlap them.
+ */
+
+#pragma mark - Vector2D
+
+/*!
+ * @brief Calculate the dot product of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The array to store the dot products.
+ * @param Count The number of vectors.
+ */
+void CCVector2BatchDot(const CCVector2DBatch a, const CCVector2DBatch b, float *Result, size_t Count);
+
+/*!
+ * @brief Calculate the length of each vector.
+ * @param a The vectors.
+ * @param Result The array to store the lengths.
+ * @param Count The number of vectors.
+ */
+void CCVector2BatchLength(const CCVector2DBatch a, float *Result, size_t Count);
+
+/*!
+ * @brief Calculate the distance between each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The array to store the distances.
+ * @param Count The number of vectors.
+ */
+void CCVector2BatchDistance(const CCVector2DBatch a, const CCVector2DBatch b, float *Result, size_t Count);
+
+/*!
+ * @brief Normalize each vector.
+ * @param a The vectors. None of these may be zero length.
+ * @param Result The vectors to store the normalized vectors.
+ * @param Count The number of vectors.
+ */
+void CCVector2BatchNormalize(const CCVector2DBatch a, const CCVector2DBatch Result, size_t Count);
+
+/*!
+ * @brief Get the component-wise minimum of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The vectors to store the minimums.
+ * @param Count The number of vectors.
+ */
+void CCVector2BatchMin(const CCVector2DBatch a, const CCVector2DBatch b, const CCVector2DBatch Result, size_t Count);
+
+/*!
+ * @brief Get the component-wise maximum of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The vectors to store the maximums.
+ * @param Count The number of vectors.
+ */
+void CCVector2BatchMax(const CCVector2DBatch a, const CCVector2DBatch b, const CCVector2DBatch Result, size_t Count);
+
+#pragma mark - Vector3D
+
+/*!
+ * @brief Calculate the dot product of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The array to store the dot products.
+ * @param Count The number of vectors.
+ */
+void CCVector3BatchDot(const CCVector3DBatch a, const CCVector3DBatch b, float *Result, size_t Count);
+
+/*!
+ * @brief Calculate the length of each vector.
+ * @param a The vectors.
+ * @param Result The array to store the lengths.
+ * @param Count The number of vectors.
+ */
+void CCVector3BatchLength(const CCVector3DBatch a, float *Result, size_t Count);
+
+/*!
+ * @brief Calculate the distance between each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The array to store the distances.
+ * @param Count The number of vectors.
+ */
+void CCVector3BatchDistance(const CCVector3DBatch a, const CCVector3DBatch b, float *Result, size_t Count);
+
+/*!
+ * @brief Normalize each vector.
+ * @param a The vectors. None of these may be zero length.
+ * @param Result The vectors to store the normalized vectors.
+ * @param Count The number of vectors.
+ */
+void CCVector3BatchNormalize(const CCVector3DBatch a, const CCVector3DBatch Result, size_t Count);
+
+/*!
+ * @brief Get the component-wise minimum of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The vectors to store the minimums.
+ * @param Count The number of vectors.
+ */
+void CCVector3BatchMin(const CCVector3DBatch a, const CCVector3DBatch b, const CCVector3DBatch Result, size_t Count);
+
+/*!
+ * @brief Get the component-wise maximum of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The vectors to store the maximums.
+ * @param Count The number of vectors.
+ */
+void CCVector3BatchMax(const CCVector3DBatch a, const CCVector3DBatch b, const CCVector3DBatch Result, size_t Count);
+
+#pragma mark - Vector4D
+
+/*!
+ * @brief Calculate the dot product of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The array to store the dot products.
+ * @param Count The number of vectors.
+ */
+void CCVector4BatchDot(const CCVector4DBatch a, const CCVector4DBatch b, float *Result, size_t Count);
+
+/*!
+ * @brief Calculate the length of each vector.
+ * @param a The vectors.
+ * @param Result The array to store the lengths.
+ * @param Count The number of vectors.
+ */
+void CCVector4BatchLength(const CCVector4DBatch a, float *Result, size_t Count);
+
+/*!
+ * @brief Calculate the distance between each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The array to store the distances.
+ * @param Count The number of vectors.
+ */
+void CCVector4BatchDistance(const CCVector4DBatch a, const CCVector4DBatch b, float *Result, size_t Count);
+
+/*!
+ * @brief Normalize each vector.
+ * @param a The vectors. None of these may be zero length.
+ * @param Result The vectors to store the normalized vectors.
+ * @param Count The number of vectors.
+ */
+void CCVector4BatchNormalize(const CCVector4DBatch a, const CCVector4DBatch Result, size_t Count);
+
+/*!
+ * @brief Get the component-wise minimum of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The vectors to store the minimums.
+ * @param Count The number of vectors.
+ */
+void CCVector4BatchMin(const CCVector4DBatch a, const CCVector4DBatch b, const CCVector4DBatch Result, size_t Count);
+
+/*!
+ * @brief Get the component-wise maximum of each pair of vectors.
+ * @param a The first vectors.
+ * @param b The second vectors.
+ * @param Result The vectors to store the maximums.
+ * @param Count The number of vectors.
+ */
+void CCVector4BatchMax(const CCVector4DBatch a, const CCVector4DBatch b, const CCVector4DBatch Result, size_t Count);
+
+#pragma mark - Matrix4
+
+/*!
+ * @brief Transform each position (w = 1) by the matrix.
+ * @description Batch variant of @b CCMatrix4MulPositionVector3D.
+ * @param m The matrix.
+ * @param v The positions.
+ * @param Result The vectors to store the transformed positions.
+ * @param Count The number of vectors.
+ */
+void CCMatrix4BatchMulPositionVector3D(const CCMatrix4 m, const CCVector3DBatch v, const CCVector3DBatch Result, size_t Count);
+
+/*!
+ * @brief Transform each direction (w = 0) by the matrix.
+ * @description Batch variant of @b CCMatrix4MulDirectionVector3D.
+ * @param m The matrix.
+ * @param v The directions.
+ * @param Result The vectors to store the transformed directions.
+ * @param Count The number of vectors.
+ */
+void CCMatrix4BatchMulDirectionVector3D(const CCMatrix4 m, const CCVector3DBatch v, const CCVector3DBatch Result, size_t Count);
+
+/*!
+ * @brief Transform each position (w = 1) by the matrix and apply the perspective divide.
+ * @description Batch variant of @b CCMatrix4MulProjectVector3D.
+ * @param m The matrix.
+ * @param v The positions.
+ * @param Result The vectors to store the projected positions.
+ * @param Count The number of vectors.
+ */
+void CCMatrix4BatchMulProjectVector3D(const CCMatrix4 m, const CCVector3DBatch v, const CCVector3DBatch Result, size_t Count);
+
+/*!
+ * @brief Transform each vector by the matrix.
+ * @description Batch variant of @b CCMatrix4MulVector4D.
+ * @param m The matrix.
+ * @param v The vectors.
+ * @param Result The vectors to store the transformed vectors.
+ * @param Count The number of vectors.
+ */
+void CCMatrix4BatchMulVector4D(const CCMatrix4 m, const CCVector4DBatch v, const CCVector4DBatch Result, size_t Count);
+
+#endif
@@ -33,6 +33,16 @@
 
 @end
 
+static void SetRandomComponents(CCBigInt Integer, size_t Count, _Bool Sign)
+{
+    uint64_t Components[1024];
+    for (size_t Loop = 0; Loop < Count; Loop++) Components[Loop] = ((uint64_t)rand() << 62) ^ ((uint64_t)rand() << 31) ^ (uint64_t)rand();
+    
+    Components[Count - 1] |= 1;
+    
+    CCBigIntSetComponents(Integer, Components, Count, Sign);
+}
+
 @implementation BigIntTests
 
 -(void) setUp
@@ -596,9 +606,12 @@
     CCBigIntAdd(Integer, 2);
     
     Value = CCBigIntGetString(Integer);
-    XCTAssertTrue(CCStringEqual(Value, CC_STRING("-0x0000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0x0000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
     CCStringDestroy(Value);
     
+    XCTAssertFalse(CCBigIntGetSign(Integer), @"Zero should be positive");
+    XCTAssertEqual(CCBigIntCompareInt(Integer, 0), CCComparisonResultEqual, @"Should be equal to zero");
+    
     
     CCBigIntSet(Integer, 3);
     CCBigIntAdd(Integer, -2);
@@ -1196,6 +1209,396 @@
     CCBigIntFastDestroy(Integer);
 }
 
+-(void) testMultiplication
+{
+    CCBigInt Integer = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    CCBigIntSet(Integer, 0x10f);
+    CCBigIntMul(Integer, -3);
+    
+    CCString Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("-0x000000000000032d")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    
+    CCBigIntSet(Integer, -5);
+    CCBigIntMul(Integer, 0);
+    
+    Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0x0000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    
+    CCBigIntSet(Integer, CC_STRING("0xffffffffffffffff"));
+    CCBigIntMul(Integer, Integer);
+    
+    Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0xfffffffffffffffe0000000000000001")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    
+    CCBigIntSet(Integer, CC_STRING("-0x100000000000000000000000000000001"));
+    CCBigIntMul(Integer, CC_STRING("0x100000000000000000000000000000001"));
+    
+    Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("-0x00000000000000010000000000000000000000000000000200000000000000000000000000000001")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    
+    CCBigInt Expected = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    const size_t Sizes[] = { 1, 2, 23, 24, 25, 64, 127, 128, 129, 300, 700 };
+    for (size_t Loop = 0; Loop < sizeof(Sizes) / sizeof(*Sizes); Loop++)
+    {
+        //(2^n - 1)^2 = 2^2n - 2^(n + 1) + 1
+        const size_t Bits = Sizes[Loop] * 64;
+        
+        CCBigIntSet(Integer, 1);
+        CCBigIntShiftLeft(Integer, Bits);
+        CCBigIntSub(Integer, 1);
+        CCBigIntMul(Integer, Integer);
+        
+        CCBigIntSet(Expected, 1);
+        CCBigIntShiftLeft(Expected, Bits - 1);
+        CCBigIntSub(Expected, 1);
+        CCBigIntShiftLeft(Expected, Bits + 1);
+        CCBigIntAdd(Expected, 1);
+        
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, Expected), @"Should square %zu components correctly", Sizes[Loop]);
+    }
+    
+    CCBigInt a = CCBigIntCreate(CC_STD_ALLOCATOR), b = CCBigIntCreate(CC_STD_ALLOCATOR), c = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    srand(1);
+    
+    for (size_t Loop = 0; Loop < sizeof(Sizes) / sizeof(*Sizes); Loop++)
+    {
+        for (size_t Loop2 = 0; Loop2 <= Loop; Loop2++)
+        {
+            //a(b + c) = ab + ac
+            SetRandomComponents(a, Sizes[Loop], rand() & 1);
+            SetRandomComponents(b, Sizes[Loop2], rand() & 1);
+            SetRandomComponents(c, Sizes[(Loop + Loop2) / 2], rand() & 1);
+            
+            CCBigIntSet(Integer, b);
+            CCBigIntAdd(Integer, c);
+            CCBigIntMul(Integer, a);
+            
+            CCBigIntSet(Expected, a);
+            CCBigIntMul(Expected, c);
+            CCBigIntMul(b, a);
+            CCBigIntAdd(Expected, b);
+            
+            XCTAssertTrue(CCBigIntCompareEqual(Integer, Expected), @"Should multiply %zu by %zu components correctly", Sizes[Loop], Sizes[Loop2]);
+        }
+    }
+    
+    CCBigIntDestroy(a);
+    CCBigIntDestroy(b);
+    CCBigIntDestroy(c);
+    CCBigIntDestroy(Expected);
+    CCBigIntDestroy(Integer);
+}
+
+-(void) testDivision
+{
+    CCBigInt Integer = CCBigIntCreate(CC_STD_ALLOCATOR), Remainder = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    CCBigIntSet(Integer, CC_STRING("0x10000000000000000"));
+    CCBigIntSet(Remainder, Integer);
+    CCBigIntDiv(Integer, 3);
+    CCBigIntMod(Remainder, 3);
+    
+    CCString Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0x5555555555555555")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    XCTAssertTrue(CCBigIntCompareEqual(Remainder, 1), @"Should have the correct remainder");
+    
+    
+    const struct {
+        int64_t a, b;
+    } Cases[] = {
+        { 7, 2 }, { -7, 2 }, { 7, -2 }, { -7, -2 }, { 1, 5 }, { -1, 5 }, { 0, -3 }, { 6, 3 }, { -6, 3 }
+    };
+    
+    for (size_t Loop = 0; Loop < sizeof(Cases) / sizeof(*Cases); Loop++)
+    {
+        CCBigIntSet(Integer, Cases[Loop].a);
+        CCBigIntDiv(Integer, Cases[Loop].b);
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, Cases[Loop].a / Cases[Loop].b), @"Should truncate the quotient towards zero");
+        
+        CCBigIntSet(Integer, Cases[Loop].a);
+        CCBigIntMod(Integer, Cases[Loop].b);
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, Cases[Loop].a % Cases[Loop].b), @"Should give the remainder the sign of the dividend");
+    }
+    
+    
+    CCBigInt a = CCBigIntCreate(CC_STD_ALLOCATOR), b = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    srand(2);
+    
+    const size_t Sizes[] = { 1, 2, 3, 10, 50, 200 };
+    for (size_t Loop = 0; Loop < sizeof(Sizes) / sizeof(*Sizes); Loop++)
+    {
+        for (size_t Loop2 = 0; Loop2 <= Loop; Loop2++)
+        {
+            //a = qb + r, |r| < |b|
+            SetRandomComponents(a, Sizes[Loop] + Sizes[Loop2], rand() & 1);
+            SetRandomComponents(b, Sizes[Loop2], rand() & 1);
+            
+            CCBigIntSet(Integer, a);
+            CCBigIntDivMod(Integer, b, Remainder);
+            
+            XCTAssertTrue((CCBigIntGetSign(Remainder) == CCBigIntGetSign(a)) || (CCBigIntCompareEqual(Remainder, 0)), @"Should give the remainder the sign of the dividend");
+            
+            CCBigIntMul(Integer, b);
+            CCBigIntAdd(Integer, Remainder);
+            XCTAssertTrue(CCBigIntCompareEqual(Integer, a), @"Should divide %zu by %zu components correctly", Sizes[Loop] + Sizes[Loop2], Sizes[Loop2]);
+            
+            if (CCBigIntGetSign(Remainder)) CCBigIntMul(Remainder, -1);
+            if (CCBigIntGetSign(b)) CCBigIntMul(b, -1);
+            XCTAssertTrue(CCBigIntCompareLessThan(Remainder, b), @"Remainder should be less than the divisor");
+            
+            //ab / b = a
+            CCBigIntSet(Integer, a);
+            CCBigIntMul(Integer, b);
+            CCBigIntSet(Remainder, Integer);
+            CCBigIntDiv(Integer, b);
+            CCBigIntMod(Remainder, b);
+            
+            XCTAssertTrue(CCBigIntCompareEqual(Integer, a), @"Should divide exactly");
+            XCTAssertTrue(CCBigIntCompareEqual(Remainder, 0), @"Should have no remainder");
+        }
+    }
+    
+    CCBigIntDestroy(a);
+    CCBigIntDestroy(b);
+    CCBigIntDestroy(Remainder);
+    CCBigIntDestroy(Integer);
+}
+
+-(void) testShifting
+{
+    CCBigInt Integer = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    CCBigIntSet(Integer, -1);
+    CCBigIntShiftLeft(Integer, 68);
+    
+    CCString Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("-0x00000000000000100000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    CCBigIntShiftRight(Integer, 4);
+    
+    Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("-0x00000000000000010000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    CCBigIntShiftRight(Integer, 63);
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, -2), @"Should shift the magnitude");
+    
+    CCBigIntShiftRight(Integer, 200);
+    
+    Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0x0000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    CCBigIntSet(Integer, -1);
+    CCBigIntShiftRight(Integer, 1);
+    XCTAssertFalse(CCBigIntGetSign(Integer), @"Zero should be positive");
+    XCTAssertEqual(CCBigIntCompareInt(Integer, 0), CCComparisonResultEqual, @"Should be equal to zero");
+    
+    CCBigIntSetComponents(Integer, (uint64_t[2]){ 0, 0 }, 2, TRUE);
+    XCTAssertFalse(CCBigIntGetSign(Integer), @"Zero should be positive");
+    XCTAssertEqual(CCBigIntCompareInt(Integer, 0), CCComparisonResultEqual, @"Should be equal to zero");
+    
+    
+    CCBigIntSet(Integer, CC_STRING("0x123456789abcdef0fedcba9876543210"));
+    CCBigIntShiftLeft(Integer, 1000);
+    CCBigIntShiftRight(Integer, 1000);
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, CC_STRING("0x123456789abcdef0fedcba9876543210")), @"Should restore the value");
+    
+    CCBigIntShiftRight(Integer, 4);
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, CC_STRING("0x123456789abcdef0fedcba987654321")), @"Should shift across components");
+    
+    CCBigIntDestroy(Integer);
+}
+
+-(void) testPowMod
+{
+    CCBigInt Integer = CCBigIntCreate(CC_STD_ALLOCATOR), Exponent = CCBigIntCreate(CC_STD_ALLOCATOR), Modulus = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    //Fermat's little theorem with the Mersenne primes 2^127 - 1 and 2^521 - 1
+    const size_t Primes[] = { 127, 521 };
+    for (size_t Loop = 0; Loop < sizeof(Primes) / sizeof(*Primes); Loop++)
+    {
+        CCBigIntSet(Modulus, 1);
+        CCBigIntShiftLeft(Modulus, Primes[Loop]);
+        CCBigIntSub(Modulus, 1);
+        
+        CCBigIntSet(Exponent, Modulus);
+        CCBigIntSub(Exponent, 1);
+        
+        CCBigIntSet(Integer, 3);
+        CCBigIntPowMod(Integer, Exponent, Modulus);
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, 1), @"Should be congruent to 1");
+        
+        CCBigIntSet(Integer, -3);
+        CCBigIntPowMod(Integer, Exponent, Modulus);
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, 1), @"Should be congruent to 1");
+    }
+    
+    //Even modulus
+    CCBigIntSet(Modulus, CC_STRING("0x10000000000000000"));
+    CCBigIntSet(Exponent, 100);
+    CCBigIntSet(Integer, 3);
+    CCBigIntPowMod(Integer, Exponent, Modulus);
+    
+    CCBigInt Expected = CCBigIntCreate(CC_STD_ALLOCATOR);
+    CCBigIntSet(Expected, 1);
+    for (size_t Loop = 0; Loop < 100; Loop++) CCBigIntMul(Expected, 3);
+    CCBigIntMod(Expected, Modulus);
+    
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, Expected), @"Should have the correct value");
+    
+    CCBigIntSet(Modulus, 5);
+    CCBigIntSet(Exponent, 3);
+    CCBigIntSet(Integer, -2);
+    CCBigIntPowMod(Integer, Exponent, Modulus);
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, 2), @"Should be in the range of the modulus");
+    
+    CCBigIntSet(Exponent, 0);
+    CCBigIntSet(Integer, 7);
+    CCBigIntPowMod(Integer, Exponent, Modulus);
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, 1), @"Should be 1");
+    
+    CCBigIntSet(Modulus, -1);
+    CCBigIntSet(Exponent, 5);
+    CCBigIntSet(Integer, 7);
+    CCBigIntPowMod(Integer, Exponent, Modulus);
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, 0), @"Should be 0");
+    
+    CCBigIntDestroy(Expected);
+    CCBigIntDestroy(Modulus);
+    CCBigIntDestroy(Exponent);
+    CCBigIntDestroy(Integer);
+}
+
+-(void) testFastIntegerMultiplication
+{
+    CCBigIntFast Integer = CC_BIG_INT_FAST_0;
+    
+    CCBigIntFastSet(&Integer, -12);
+    CCBigIntFastMul(&Integer, 5);
+    
+    XCTAssertTrue(CCBigIntFastIsTaggedValue(Integer), @"Should remain tagged");
+    XCTAssertTrue(CCBigIntFastCompareEqual(Integer, -60), @"Should have the correct value");
+    
+    CCBigIntFastDiv(&Integer, 7);
+    XCTAssertTrue(CCBigIntFastCompareEqual(Integer, -8), @"Should have the correct value");
+    
+    CCBigIntFastMod(&Integer, 3);
+    XCTAssertTrue(CCBigIntFastCompareEqual(Integer, -2), @"Should have the correct value");
+    
+    
+    CCBigIntFastSet(&Integer, (int64_t)1 << 40);
+    CCBigIntFastMul(&Integer, CC_BIG_INT_FAST_CONSTANT((int64_t)1 << 40));
+    
+    XCTAssertFalse(CCBigIntFastIsTaggedValue(Integer), @"Should be promoted");
+    
+    CCString Value = CCBigIntFastGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0x00000000000100000000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    CCBigIntFastDiv(&Integer, (int64_t)1 << 40);
+    XCTAssertTrue(CCBigIntFastCompareEqual(Integer, (int64_t)1 << 40), @"Should have the correct value");
+    
+    
+    CCBigIntFastSet(&Integer, 1000);
+    CCBigIntFastDiv(&Integer, CC_STRING("0x100000000000000000000"));
+    XCTAssertTrue(CCBigIntFastCompareEqual(Integer, 0), @"Should have the correct value");
+    
+    CCBigIntFastSet(&Integer, -1000);
+    CCBigIntFastMod(&Integer, CC_STRING("0x100000000000000000000"));
+    XCTAssertTrue(CCBigIntFastCompareEqual(Integer, -1000), @"Should have the correct value");
+    
+    CCBigIntFastDestroy(Integer);
+}
+
+-(void) testDecimalStrings
+{
+    CCBigInt Integer = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    CCBigIntSet(Integer, CC_STRING("18446744073709551616"));
+    
+    CCString Value = CCBigIntGetString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0x00000000000000010000000000000000")), @"Should have the correct value instead got: %s", CCStringGetBuffer(Value));
+    CCStringDestroy(Value);
+    
+    Value = CCBigIntGetDecimalString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("18446744073709551616")), @"Should have the correct value");
+    CCStringDestroy(Value);
+    
+    CCBigIntSet(Integer, CC_STRING("-000123"));
+    XCTAssertTrue(CCBigIntCompareEqual(Integer, -123), @"Should have the correct value");
+    
+    Value = CCBigIntGetDecimalString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("-123")), @"Should have the correct value");
+    CCStringDestroy(Value);
+    
+    CCBigIntSet(Integer, CC_STRING("-0"));
+    
+    Value = CCBigIntGetDecimalString(Integer);
+    XCTAssertTrue(CCStringEqual(Value, CC_STRING("0")), @"Should have the correct value");
+    CCStringDestroy(Value);
+    
+    
+    CCBigInt Expected = CCBigIntCreate(CC_STD_ALLOCATOR);
+    
+    const size_t Digits[] = { 19, 20, 38, 600, 609, 1216, 5000, 20000 };
+    for (size_t Loop = 0; Loop < sizeof(Digits) / sizeof(*Digits); Loop++)
+    {
+        //10^n - 1
+        CCBigIntSet(Expected, 1);
+        for (size_t Loop2 = 0; Loop2 < Digits[Loop]; Loop2++) CCBigIntMul(Expected, 10);
+        CCBigIntSub(Expected, 1);
+        
+        char *String = malloc(Digits[Loop] + 1);
+        memset(String, '9', Digits[Loop]);
+        String[Digits[Loop]] = 0;
+        
+        CCString Nines = CCStringCreate(CC_STD_ALLOCATOR, CCStringEncodingASCII | CCStringHintCopy, String);
+        free(String);
+        
+        CCBigIntSet(Integer, Nines);
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, Expected), @"Should parse %zu digits", Digits[Loop]);
+        
+        Value = CCBigIntGetDecimalString(Expected);
+        XCTAssertTrue(CCStringEqual(Value, Nines), @"Should format %zu digits", Digits[Loop]);
+        CCStringDestroy(Value);
+        
+        CCStringDestroy(Nines);
+    }
+    
+    srand(3);
+    
+    const size_t Sizes[] = { 1, 2, 31, 32, 33, 65, 200, 1000 };
+    for (size_t Loop = 0; Loop < sizeof(Sizes) / sizeof(*Sizes); Loop++)
+    {
+        SetRandomComponents(Expected, Sizes[Loop], rand() & 1);
+        
+        Value = CCBigIntGetDecimalString(Expected);
+        CCBigIntSet(Integer, Value);
+        CCStringDestroy(Value);
+        
+        XCTAssertTrue(CCBigIntCompareEqual(Integer, Expected), @"Should round trip %zu components", Sizes[Loop]);
+    }
+    
+    CCBigIntDestroy(Expected);
+    CCBigIntDestroy(Integer);
+}
+
 -(void) testHashing
 {
     CCBigInt Integer = CCBigIntCreate(CC_STD_ALLOCATOR);
@@ -1272,6 +1675,13 @@
     XCTAssertEqual(CCBigIntHasherForDictionary(&Integer), CCBigIntFastHasherForDictionary(&IntegerFast), @"Hashes should be equal");
     XCTAssertEqual(CCBigIntLowHasherForDictionary(&Integer), CCBigIntFastLowHasherForDictionary(&IntegerFast), @"Hashes should be equal");
     
+    CCBigIntFastSet(&IntegerFast, (int64_t)0);
+    CCBigIntSet(Integer, -1);
+    CCBigIntShiftRight(Integer, 1);
+    
+    XCTAssertEqual(CCBigIntHasherForDictionary(&Integer), CCBigIntFastHasherForDictionary(&IntegerFast), @"Hashes should be equal");
+    XCTAssertEqual(CCBigIntLowHasherForDictionary(&Integer), CCBigIntFastLowHasherForDictionary(&IntegerFast), @"Hashes should be equal");
+    
     CCBigIntDestroy(Integer);
     CCBigIntFastDestroy(IntegerFast);
 }
@@ -25,6 +25,8 @@
 
 #import <XCTest/XCTest.h>
 #import "BitSets.h"
+#import "BitsEnumerable.h"
+#import "BitsRankSelect.h"
 
 @interface BitSetsTests : XCTestCase
 
@@ -1816,4 +1818,142 @@ static size_t TestCount32(CCBits(uint32_t, 0) Bits, size_t Index, size_t Count)
     XCTAssertEqual(CCBitsGet(a32, 1), TRUE, @"should get the correct indexes");
 }
 
+static _Bool TestGetBit(const uint8_t *Set, size_t Index)
+{
+    return Set[Index / 8] & (1 << (Index % 8));
+}
+
+static void TestFillBits(uint8_t *Set, size_t Size, int Density)
+{
+    for (size_t Loop = 0; Loop < Size; Loop++)
+    {
+        Set[Loop] = 0;
+        
+        for (int Bit = 0; Bit < 8; Bit++)
+        {
+            if ((rand() % Density) == 0) Set[Loop] |= 1 << Bit;
+        }
+    }
+}
+
+-(void) testFind
+{
+    CCBits(uint8_t, 1000) Set;
+    CCBits(uint32_t, 1000) Set32;
+    
+    srand(1);
+    
+    for (int Density = 1; Density <= 256; Density *= 4)
+    {
+        TestFillBits(Set, sizeof(Set), Density);
+        memcpy(Set32, Set, sizeof(Set32));
+        
+        for (size_t Index = 0; Index < 1000; Index += 1 + (rand() % 37))
+        {
+            for (size_t Count = 0; (Index + Count) <= 1000; Count += 1 + (rand() % 53))
+            {
+                size_t FirstSet = SIZE_MAX, FirstClear = SIZE_MAX, LastSet = SIZE_MAX, LastClear = SIZE_MAX;
+                for (size_t Loop = Index; Loop < (Index + Count); Loop++)
+                {
+                    if (TestGetBit(Set, Loop))
+                    {
+                        if (FirstSet == SIZE_MAX) FirstSet = Loop;
+                        LastSet = Loop;
+                    }
+                    
+                    else
+                    {
+                        if (FirstClear == SIZE_MAX) FirstClear = Loop;
+                        LastClear = Loop;
+                    }
+                }
+                
+                XCTAssertEqual(CCBitsFindFirstSet(Set, Index, Count), FirstSet, @"should find the first set bit");
+                XCTAssertEqual(CCBitsFindFirstClear(Set, Index, Count), FirstClear, @"should find the first clear bit");
+                XCTAssertEqual(CCBitsFindLastSet(Set, Index, Count), LastSet, @"should find the last set bit");
+                XCTAssertEqual(CCBitsFindLastClear(Set, Index, Count), LastClear, @"should find the last clear bit");
+                XCTAssertEqual(CCBitsFindFirstSet(Set32, Index, Count), FirstSet, @"should find the first set bit");
+                XCTAssertEqual(CCBitsFindLastClear(Set32, Index, Count), LastClear, @"should find the last clear bit");
+            }
+        }
+    }
+}
+
+-(void) testEnumerable
+{
+    CCBits(uint8_t, 1000) Set;
+    
+    CC_BITS_INIT_CLEAR(Set);
+    
+    CCEnumerable Enumerable = CCBitsEnumerableCreate(Set, 0, 1000);
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"should not have any set bits");
+    XCTAssertEqual(CCEnumerableGetTail(&Enumerable), NULL, @"should not have any set bits");
+    
+    srand(2);
+    TestFillBits(Set, sizeof(Set), 13);
+    
+    Enumerable = CCBitsEnumerableCreate(Set, 3, 990);
+    
+    size_t Count = 0;
+    for (size_t *Bit = CCEnumerableGetCurrent(&Enumerable); Bit; Bit = CCEnumerableNext(&Enumerable))
+    {
+        for ( ; !TestGetBit(Set, Count + 3); Count++);
+        
+        XCTAssertEqual(*Bit, Count + 3, @"should enumerate the next set bit");
+        
+        Count++;
+    }
+    
+    for ( ; (Count < 990) && (!TestGetBit(Set, Count + 3)); Count++);
+    
+    XCTAssertEqual(Count, 990, @"should enumerate all set bits");
+    
+    size_t Enumerated = 0, Previous = SIZE_MAX;
+    for (size_t *Bit = CCEnumerableGetTail(&Enumerable); Bit; Bit = CCEnumerablePrevious(&Enumerable))
+    {
+        XCTAssertTrue(TestGetBit(Set, *Bit), @"should only enumerate set bits");
+        XCTAssertTrue((*Bit >= 3) && (*Bit < 993), @"should only enumerate bits within the range");
+        XCTAssertLessThan(*Bit, Previous, @"should enumerate in reverse");
+        
+        Previous = *Bit;
+        Enumerated++;
+    }
+    
+    XCTAssertEqual(Enumerated, CCBitsCount(Set, 3, 990), @"should enumerate all set bits");
+}
+
+-(void) testRankSelect
+{
+    static uint8_t Set[200003];
+    
+    srand(3);
+    
+    for (int Density = 1; Density <= 4096; Density *= 8)
+    {
+        TestFillBits(Set, sizeof(Set), Density);
+        
+        const size_t Bits = (sizeof(Set) * 8) - 5;
+        CCBitsRankSelect Index = CCBitsRankSelectCreate(CC_STD_ALLOCATOR, Set, Bits);
+        
+        size_t Rank = 0;
+        for (size_t Loop = 0; Loop < Bits; Loop++)
+        {
+            if ((Loop % 97) == 0) XCTAssertEqual(CCBitsRank(Index, Loop), Rank, @"should get the rank");
+            
+            if (TestGetBit(Set, Loop))
+            {
+                XCTAssertEqual(CCBitsSelect(Index, Rank), Loop, @"should select the set bit");
+                
+                Rank++;
+            }
+        }
+        
+        XCTAssertEqual(CCBitsRank(Index, Bits), Rank, @"should get the rank");
+        XCTAssertEqual(CCBitsRankSelectGetCount(Index), Rank, @"should get the number of set bits");
+        XCTAssertEqual(CCBitsSelect(Index, Rank), SIZE_MAX, @"should not select a bit beyond the set bits");
+        
+        CCBitsRankSelectDestroy(Index);
+    }
+}
+
 @end
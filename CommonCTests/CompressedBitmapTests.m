@@ -0,0 +1,340 @@
+/*
+*  Copyright (c) 2023, Stefan Johnson
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification,
+*  are permitted provided that the following conditions are met:
+*
+*  1. Redistributions of source code must retain the above copyright notice, this list
+*     of conditions and the following disclaimer.
+*  2. Redistributions in binary form must reproduce the above copyright notice, this
+*     list of conditions and the following disclaimer in the documentation and/or other
+*     materials provided with the distribution.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+* OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#import <XCTest/XCTest.h>
+#import "CompressedBitmap.h"
+#import "ConsecutiveIDGenerator.h"
+#import "OrderedCollection.h"
+
+@interface CompressedBitmapTests : XCTestCase
+
+@end
+
+@implementation CompressedBitmapTests
+
+#define TEST_RANGE 300000
+
+static _Bool TestMatches(CCCompressedBitmap Bitmap, const _Bool *Reference, size_t Range)
+{
+    size_t Count = 0;
+    for (size_t Loop = 0; Loop < Range; Loop++)
+    {
+        if (CCCompressedBitmapContains(Bitmap, (uint32_t)Loop) != Reference[Loop]) return FALSE;
+        
+        Count += Reference[Loop];
+    }
+    
+    return CCCompressedBitmapGetCount(Bitmap) == Count;
+}
+
+-(void) testAddRemove
+{
+    static _Bool Reference[TEST_RANGE];
+    memset(Reference, 0, sizeof(Reference));
+    
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Bitmap), 0, @"should be empty");
+    XCTAssertFalse(CCCompressedBitmapContains(Bitmap, 0), @"should not contain the value");
+    
+    srand(1234);
+    for (size_t Loop = 0; Loop < 200000; Loop++)
+    {
+        //Dense around the first chunk to force bitmap containers, sparse elsewhere
+        const uint32_t Value = (Loop % 3) ? rand() % 8000 : rand() % TEST_RANGE;
+        
+        if ((Loop % 5) == 4)
+        {
+            XCTAssertEqual(CCCompressedBitmapRemove(Bitmap, Value), Reference[Value], @"should only remove present values");
+            Reference[Value] = FALSE;
+        }
+        
+        else
+        {
+            XCTAssertEqual(CCCompressedBitmapAdd(Bitmap, Value), !Reference[Value], @"should only add absent values");
+            Reference[Value] = TRUE;
+        }
+    }
+    
+    XCTAssertTrue(TestMatches(Bitmap, Reference, TEST_RANGE), @"should match the reference");
+    
+    for (size_t Loop = 0; Loop < 8000; Loop++)
+    {
+        CCCompressedBitmapRemove(Bitmap, (uint32_t)Loop);
+        Reference[Loop] = FALSE;
+    }
+    
+    XCTAssertTrue(TestMatches(Bitmap, Reference, TEST_RANGE), @"should convert back to arrays and match the reference");
+    
+    XCTAssertTrue(CCCompressedBitmapAdd(Bitmap, UINT32_MAX), @"should add the value");
+    XCTAssertTrue(CCCompressedBitmapContains(Bitmap, UINT32_MAX), @"should contain the value");
+    XCTAssertTrue(CCCompressedBitmapRemove(Bitmap, UINT32_MAX), @"should remove the value");
+    
+    CCCompressedBitmapRemoveAll(Bitmap);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Bitmap), 0, @"should be empty");
+    
+    CCCompressedBitmapDestroy(Bitmap);
+}
+
+-(void) testRanges
+{
+    static _Bool Reference[TEST_RANGE];
+    memset(Reference, 0, sizeof(Reference));
+    
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    CCCompressedBitmapAddRange(Bitmap, 10, 100);
+    CCCompressedBitmapAddRange(Bitmap, 60000, 150000);
+    CCCompressedBitmapAddRange(Bitmap, 250000, 1);
+    for (size_t Loop = 10; Loop < 110; Loop++) Reference[Loop] = TRUE;
+    for (size_t Loop = 60000; Loop < 210000; Loop++) Reference[Loop] = TRUE;
+    Reference[250000] = TRUE;
+    
+    XCTAssertTrue(TestMatches(Bitmap, Reference, TEST_RANGE), @"should match the reference");
+    XCTAssertEqual(CCCompressedBitmapSerialize(Bitmap, NULL), (3 + 4) + (3 + 2) + (3 + 2) + (3 + 4), @"should be stored as runs");
+    
+    //Punch holes into the runs and then fill them back in
+    for (size_t Loop = 60001; Loop < 210000; Loop += 1000)
+    {
+        XCTAssertTrue(CCCompressedBitmapRemove(Bitmap, (uint32_t)Loop), @"should remove the value");
+        Reference[Loop] = FALSE;
+    }
+    
+    XCTAssertFalse(CCCompressedBitmapRemove(Bitmap, 60001), @"should not remove an absent value");
+    XCTAssertTrue(TestMatches(Bitmap, Reference, TEST_RANGE), @"should match the reference");
+    
+    for (size_t Loop = 60001; Loop < 210000; Loop += 2000)
+    {
+        XCTAssertTrue(CCCompressedBitmapAdd(Bitmap, (uint32_t)Loop), @"should add the value");
+        Reference[Loop] = TRUE;
+    }
+    
+    XCTAssertTrue(CCCompressedBitmapAdd(Bitmap, 110), @"should extend the run");
+    XCTAssertTrue(CCCompressedBitmapAdd(Bitmap, 9), @"should extend the run");
+    XCTAssertTrue(CCCompressedBitmapAdd(Bitmap, 112), @"should add a run");
+    XCTAssertTrue(CCCompressedBitmapAdd(Bitmap, 111), @"should merge the runs");
+    Reference[9] = Reference[110] = Reference[111] = Reference[112] = TRUE;
+    
+    XCTAssertTrue(TestMatches(Bitmap, Reference, TEST_RANGE), @"should match the reference");
+    
+    CCCompressedBitmapDestroy(Bitmap);
+    
+    
+    Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    for (size_t Loop = 0; Loop < 5000; Loop++) CCCompressedBitmapAdd(Bitmap, (uint32_t)Loop);
+    
+    XCTAssertEqual(CCCompressedBitmapSerialize(Bitmap, NULL), 3 + 4096, @"should be stored as a bitmap");
+    
+    CCCompressedBitmapOptimize(Bitmap);
+    
+    XCTAssertEqual(CCCompressedBitmapSerialize(Bitmap, NULL), 3 + 2, @"should be stored as a run");
+    XCTAssertEqual(CCCompressedBitmapGetCount(Bitmap), 5000, @"should contain all values");
+    
+    CCCompressedBitmapDestroy(Bitmap);
+}
+
+-(void) testSetOperations
+{
+    static _Bool ReferenceA[TEST_RANGE], ReferenceB[TEST_RANGE], Reference[TEST_RANGE];
+    memset(ReferenceA, 0, sizeof(ReferenceA));
+    memset(ReferenceB, 0, sizeof(ReferenceB));
+    
+    CCCompressedBitmap A = CCCompressedBitmapCreate(CC_STD_ALLOCATOR), B = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    srand(99);
+    for (size_t Loop = 0; Loop < 20000; Loop++)
+    {
+        uint32_t Value = rand() % 70000;
+        CCCompressedBitmapAdd(A, Value);
+        ReferenceA[Value] = TRUE;
+        
+        Value = rand() % TEST_RANGE;
+        CCCompressedBitmapAdd(B, Value);
+        ReferenceB[Value] = TRUE;
+    }
+    
+    CCCompressedBitmapAddRange(A, 131072, 70000);
+    for (size_t Loop = 131072; Loop < 201072; Loop++) ReferenceA[Loop] = TRUE;
+    
+    CCCompressedBitmapAddRange(B, 65536, 500);
+    for (size_t Loop = 65536; Loop < 66036; Loop++) ReferenceB[Loop] = TRUE;
+    
+    CCCompressedBitmap Result = CCCompressedBitmapCreateUnion(CC_STD_ALLOCATOR, A, B);
+    for (size_t Loop = 0; Loop < TEST_RANGE; Loop++) Reference[Loop] = ReferenceA[Loop] || ReferenceB[Loop];
+    
+    XCTAssertTrue(TestMatches(Result, Reference, TEST_RANGE), @"should be the union");
+    CCCompressedBitmapDestroy(Result);
+    
+    Result = CCCompressedBitmapCreateIntersection(CC_STD_ALLOCATOR, A, B);
+    for (size_t Loop = 0; Loop < TEST_RANGE; Loop++) Reference[Loop] = ReferenceA[Loop] && ReferenceB[Loop];
+    
+    XCTAssertTrue(TestMatches(Result, Reference, TEST_RANGE), @"should be the intersection");
+    CCCompressedBitmapDestroy(Result);
+    
+    Result = CCCompressedBitmapCreateIntersection(CC_STD_ALLOCATOR, A, A);
+    
+    XCTAssertTrue(TestMatches(Result, ReferenceA, TEST_RANGE), @"should be the same set");
+    CCCompressedBitmapDestroy(Result);
+    
+    CCCompressedBitmapDestroy(A);
+    CCCompressedBitmapDestroy(B);
+}
+
+-(void) testEnumerable
+{
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    CCEnumerable Enumerable;
+    CCCompressedBitmapGetEnumerable(Bitmap, &Enumerable);
+    
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"should be empty");
+    
+    CCCompressedBitmapAdd(Bitmap, 5);
+    CCCompressedBitmapAdd(Bitmap, 3);
+    CCCompressedBitmapAddRange(Bitmap, 65530, 10);
+    for (size_t Loop = 0; Loop < 5000; Loop++) CCCompressedBitmapAdd(Bitmap, (uint32_t)(200000 + (Loop * 2)));
+    CCCompressedBitmapAdd(Bitmap, UINT32_MAX);
+    
+    CCCompressedBitmapGetEnumerable(Bitmap, &Enumerable);
+    
+    size_t Count = 0;
+    uint32_t Previous = 0;
+    for (const uint32_t *Value = CCEnumerableGetCurrent(&Enumerable); Value; Value = CCEnumerableNext(&Enumerable), Count++)
+    {
+        XCTAssertTrue(CCCompressedBitmapContains(Bitmap, *Value), @"should be a value in the set");
+        XCTAssertTrue(!Count || (*Value > Previous), @"should be in ascending order");
+        
+        Previous = *Value;
+    }
+    
+    XCTAssertEqual(Count, CCCompressedBitmapGetCount(Bitmap), @"should enumerate all values");
+    XCTAssertEqual(Previous, UINT32_MAX, @"should end on the last value");
+    
+    Count = 0;
+    for (const uint32_t *Value = CCEnumerableGetTail(&Enumerable); Value; Value = CCEnumerablePrevious(&Enumerable), Count++)
+    {
+        XCTAssertTrue(!Count || (*Value < Previous), @"should be in descending order");
+        
+        Previous = *Value;
+    }
+    
+    XCTAssertEqual(Count, CCCompressedBitmapGetCount(Bitmap), @"should enumerate all values");
+    XCTAssertEqual(Previous, 3, @"should end on the first value");
+    
+    CCCompressedBitmapDestroy(Bitmap);
+}
+
+-(void) testSerialization
+{
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    CCCompressedBitmapAdd(Bitmap, 1);
+    CCCompressedBitmapAddRange(Bitmap, 70000, 3000);
+    for (size_t Loop = 0; Loop < 6000; Loop++) CCCompressedBitmapAdd(Bitmap, (uint32_t)(300000 + (Loop * 3)));
+    
+    const size_t Count = CCCompressedBitmapSerialize(Bitmap, NULL);
+    uint16_t *Words = malloc(sizeof(uint16_t) * Count);
+    
+    XCTAssertEqual(CCCompressedBitmapSerialize(Bitmap, Words), Count, @"should write the same number of words");
+    
+    CCCompressedBitmap Copy = CCCompressedBitmapCreateWithSerialized(CC_STD_ALLOCATOR, Words, Count);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Copy), CCCompressedBitmapGetCount(Bitmap), @"should contain the same number of values");
+    
+    CCCompressedBitmap Intersection = CCCompressedBitmapCreateIntersection(CC_STD_ALLOCATOR, Bitmap, Copy);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Intersection), CCCompressedBitmapGetCount(Bitmap), @"should contain the same values");
+    
+    CCCompressedBitmapDestroy(Intersection);
+    CCCompressedBitmapDestroy(Copy);
+    
+    XCTAssertEqual(CCCompressedBitmapCreateWithSerialized(CC_STD_ALLOCATOR, Words, Count - 1), NULL, @"should reject truncated data");
+    
+    Words[3] = 2;
+    Words[4] = 1;
+    
+    XCTAssertEqual(CCCompressedBitmapCreateWithSerialized(CC_STD_ALLOCATOR, Words, 5), NULL, @"should reject unsorted values");
+    
+    Words[1] = 3;
+    
+    XCTAssertEqual(CCCompressedBitmapCreateWithSerialized(CC_STD_ALLOCATOR, Words, 4), NULL, @"should reject unknown containers");
+    
+    Copy = CCCompressedBitmapCreateWithSerialized(CC_STD_ALLOCATOR, NULL, 0);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Copy), 0, @"should be empty");
+    
+    CCCompressedBitmapDestroy(Copy);
+    
+    free(Words);
+    CCCompressedBitmapDestroy(Bitmap);
+}
+
+-(void) testInteroperability
+{
+    CCCollection(uint32_t) Collection = CCCollectionCreate(CC_STD_ALLOCATOR, CCCollectionHintHeavyEnumerating, sizeof(uint32_t), NULL);
+    
+    CCCollectionInsertElement(Collection, &(uint32_t){ 40 });
+    CCCollectionInsertElement(Collection, &(uint32_t){ 7 });
+    CCCollectionInsertElement(Collection, &(uint32_t){ 100000 });
+    CCCollectionInsertElement(Collection, &(uint32_t){ 7 });
+    
+    CCCompressedBitmap Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    CCCompressedBitmapAddCollection(Bitmap, Collection);
+    CCCollectionDestroy(Collection);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Bitmap), 3, @"should add the unique values");
+    
+    Collection = CCCompressedBitmapCreateCollection(CC_STD_ALLOCATOR, Bitmap, CCCollectionHintOrdered);
+    
+    XCTAssertEqual(CCCollectionGetCount(Collection), 3, @"should contain all values");
+    XCTAssertEqual(*(uint32_t*)CCOrderedCollectionGetElementAtIndex(Collection, 0), 7, @"should be in ascending order");
+    XCTAssertEqual(*(uint32_t*)CCOrderedCollectionGetElementAtIndex(Collection, 1), 40, @"should be in ascending order");
+    XCTAssertEqual(*(uint32_t*)CCOrderedCollectionGetElementAtIndex(Collection, 2), 100000, @"should be in ascending order");
+    
+    CCCollectionDestroy(Collection);
+    CCCompressedBitmapDestroy(Bitmap);
+    
+    
+    CCConcurrentIDGenerator Generator = CCConcurrentIDGeneratorCreate(CC_STD_ALLOCATOR, 100, CCConsecutiveIDGenerator);
+    Bitmap = CCCompressedBitmapCreate(CC_STD_ALLOCATOR);
+    
+    uintptr_t ID;
+    for (size_t Loop = 0; Loop < 100; Loop++) XCTAssertTrue(CCCompressedBitmapTryAssignID(Bitmap, Generator, &ID), @"should assign an ID");
+    
+    XCTAssertFalse(CCCompressedBitmapTryAssignID(Bitmap, Generator, &ID), @"should exhaust the IDs");
+    XCTAssertEqual(CCCompressedBitmapGetCount(Bitmap), 100, @"should track the assigned IDs");
+    
+    CCCompressedBitmapRecycleIDs(Bitmap, Generator);
+    
+    XCTAssertEqual(CCCompressedBitmapGetCount(Bitmap), 0, @"should be empty");
+    XCTAssertTrue(CCCompressedBitmapTryAssignID(Bitmap, Generator, &ID), @"should assign a recycled ID");
+    
+    CCCompressedBitmapDestroy(Bitmap);
+    CCConcurrentIDGeneratorDestroy(Generator);
+}
+
+@end
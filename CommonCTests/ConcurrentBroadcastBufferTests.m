@@ -0,0 +1,201 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import <pthread.h>
+
+#define Titem int
+#define Tmax 4
+#define Tconsumers 3
+#include "ConcurrentBroadcastBuffer.h"
+
+#define Titem int
+#define Tmax 64
+#define Tconsumers 4
+#include "ConcurrentBroadcastBuffer.h"
+
+@interface ConcurrentBroadcastBufferTests : XCTestCase
+@end
+
+@implementation ConcurrentBroadcastBufferTests
+
+-(void) testAddingItems
+{
+    CCConcurrentBroadcastBuffer(int, 4, 3) Buffer = CC_CONCURRENT_BROADCAST_BUFFER_INIT;
+    
+    CCEnumerable Enumerable;
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 0, &Enumerable);
+    
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"Enumerable should be empty");
+    
+    XCTAssertTrue(CCConcurrentBroadcastBufferAddItem(&Buffer, &(int){ 1 }), @"Should add the item");
+    XCTAssertTrue(CCConcurrentBroadcastBufferAddItem(&Buffer, &(int){ 2 }), @"Should add the item");
+    XCTAssertTrue(CCConcurrentBroadcastBufferAddItem(&Buffer, &(int){ 3 }), @"Should add the item");
+    XCTAssertTrue(CCConcurrentBroadcastBufferAddItem(&Buffer, &(int){ 4 }), @"Should add the item");
+    XCTAssertFalse(CCConcurrentBroadcastBufferAddItem(&Buffer, &(int){ 5 }), @"Should not add the item");
+    
+    for (size_t Loop = 0; Loop < 3; Loop++)
+    {
+        XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, Loop), 4, @"Every consumer should see every item");
+    }
+    
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 0, &Enumerable);
+    
+    XCTAssertEqual(*(int*)CCEnumerableGetCurrent(&Enumerable), 1, @"Enumerable should contain the correct value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 2, @"Enumerable should contain the correct value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 3, @"Enumerable should contain the correct value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 4, @"Enumerable should contain the correct value");
+    XCTAssertEqual(CCEnumerableNext(&Enumerable), NULL, @"Enumerable should not contain anymore values");
+    
+    CCConcurrentBroadcastBufferRelease(&Buffer, 0, &Enumerable);
+    
+    XCTAssertFalse(CCConcurrentBroadcastBufferAddItem(&Buffer, &(int){ 5 }), @"Should not add the item until the slowest consumer has released it");
+    
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 1, &Enumerable);
+    CCConcurrentBroadcastBufferRelease(&Buffer, 1, &Enumerable);
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 2, &Enumerable);
+    CCConcurrentBroadcastBufferRelease(&Buffer, 2, &Enumerable);
+    
+    int Items[5] = { 5, 6, 7, 8, 9 };
+    XCTAssertEqual(CCConcurrentBroadcastBufferAddItems(&Buffer, Items, 5), 4, @"Should add only some of the items");
+    
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 2, &Enumerable);
+    
+    XCTAssertEqual(*(int*)CCEnumerableGetCurrent(&Enumerable), 5, @"Enumerable should contain the correct value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 6, @"Enumerable should contain the correct value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 7, @"Enumerable should contain the correct value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 8, @"Enumerable should contain the correct value");
+    XCTAssertEqual(CCEnumerableNext(&Enumerable), NULL, @"Enumerable should not contain anymore values");
+}
+
+-(void) testClaimingItems
+{
+    CCConcurrentBroadcastBuffer(int, 4, 3) Buffer = CC_CONCURRENT_BROADCAST_BUFFER_INIT;
+    
+    XCTAssertEqual(CCConcurrentBroadcastBufferClaim(&Buffer, 3), 3, @"Should claim the requested items");
+    
+    *(int*)CCConcurrentBroadcastBufferGetClaimedItem(&Buffer, 0) = 10;
+    *(int*)CCConcurrentBroadcastBufferGetClaimedItem(&Buffer, 1) = 11;
+    
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 0), 0, @"Claimed items should not be visible until published");
+    
+    CCConcurrentBroadcastBufferPublish(&Buffer, 2);
+    
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 0), 2, @"Published items should be visible");
+    XCTAssertEqual(CCConcurrentBroadcastBufferClaim(&Buffer, 4), 2, @"Should only claim the free items");
+}
+
+-(void) testDependencies
+{
+    CCConcurrentBroadcastBuffer(int, 4, 3) Buffer = CC_CONCURRENT_BROADCAST_BUFFER_INIT;
+    
+    CCConcurrentBroadcastBufferSetDependencies(&Buffer, 1, 1 << 0);
+    CCConcurrentBroadcastBufferSetDependencies(&Buffer, 2, (1 << 0) | (1 << 1));
+    
+    int Items[3] = { 1, 2, 3 };
+    XCTAssertEqual(CCConcurrentBroadcastBufferAddItems(&Buffer, Items, 3), 3, @"Should add the items");
+    
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 0), 3, @"Should see all the items");
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 1), 0, @"Should not see items until the dependency has released them");
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 2), 0, @"Should not see items until the dependency has released them");
+    
+    CCEnumerable Enumerable;
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 0, &Enumerable);
+    CCConcurrentBroadcastBufferRelease(&Buffer, 0, &Enumerable);
+    
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 1), 3, @"Should see the released items");
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 2), 0, @"Should not see items until all dependencies have released them");
+    
+    CCConcurrentBroadcastBufferGetEnumerable(&Buffer, 1, &Enumerable);
+    
+    XCTAssertEqual(*(int*)CCEnumerableGetCurrent(&Enumerable), 1, @"Enumerable should contain the correct value");
+    
+    CCConcurrentBroadcastBufferRelease(&Buffer, 1, &Enumerable);
+    
+    XCTAssertEqual(CCConcurrentBroadcastBufferGetAvailableCount(&Buffer, 2), 3, @"Should see the released items");
+}
+
+#define CONSUMER_THREADS 4
+#define ITEM_COUNT 100000
+
+static CCConcurrentBroadcastBuffer(int, 64, 4) Buffer = CC_CONCURRENT_BROADCAST_BUFFER_INIT;
+
+static void *Consumer(void *Arg)
+{
+    const size_t Index = *(size_t*)Arg;
+    size_t Sum = 0;
+    int Expected = 0;
+    
+    while (Expected < ITEM_COUNT)
+    {
+        CCEnumerable Enumerable;
+        CCConcurrentBroadcastBufferGetEnumerable(&Buffer, Index, &Enumerable);
+        
+        for (int *Item = CCEnumerableGetCurrent(&Enumerable); Item; Item = CCEnumerableNext(&Enumerable))
+        {
+            if (*Item != Expected++) return (void*)SIZE_MAX;
+            
+            Sum += *Item;
+        }
+        
+        CCConcurrentBroadcastBufferRelease(&Buffer, Index, &Enumerable);
+    }
+    
+    return (void*)Sum;
+}
+
+-(void) testMultiThreading
+{
+    pthread_t Consumers[CONSUMER_THREADS];
+    size_t Args[CONSUMER_THREADS];
+    
+    //Consumer 3 should only see items after consumers 0 and 1 have
+    CCConcurrentBroadcastBufferSetDependencies(&Buffer, 3, (1 << 0) | (1 << 1));
+    
+    for (size_t Loop = 0; Loop < CONSUMER_THREADS; Loop++)
+    {
+        Args[Loop] = Loop;
+        pthread_create(Consumers + Loop, NULL, Consumer, Args + Loop);
+    }
+    
+    for (int Loop = 0; Loop < ITEM_COUNT; )
+    {
+        int Items[8];
+        const int Count = CCMin(8, ITEM_COUNT - Loop);
+        for (int Index = 0; Index < Count; Index++) Items[Index] = Loop + Index;
+        
+        Loop += (int)CCConcurrentBroadcastBufferAddItems(&Buffer, Items, Count);
+    }
+    
+    for (int Loop = 0; Loop < CONSUMER_THREADS; Loop++)
+    {
+        size_t Sum;
+        pthread_join(Consumers[Loop], (void**)&Sum);
+        
+        XCTAssertEqual(Sum, ((size_t)ITEM_COUNT * (ITEM_COUNT - 1)) / 2, @"Every consumer should receive every item in order");
+    }
+}
+
+@end
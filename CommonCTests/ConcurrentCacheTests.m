@@ -0,0 +1,250 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "ConcurrentCache.h"
+#import <stdatomic.h>
+#import <pthread.h>
+
+@interface ConcurrentCacheTests : XCTestCase
+
+@end
+
+@implementation ConcurrentCacheTests
+
+-(void) testInsertion
+{
+    CCConcurrentCache Cache = CCConcurrentCacheCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 3, 100, NULL, NULL, NULL);
+    
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 0, @"Should be empty");
+    XCTAssertEqual(CCConcurrentCacheGetCapacity(Cache), 100, @"Should have the capacity it was created with");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 1 }, NULL), @"Should not contain the key");
+    
+    for (int Loop = 0; Loop < 10; Loop++) XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &Loop, &(int){ Loop * 10 }, 1), @"Should set the entry");
+    
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 10, @"Should contain 10 entries");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 10, @"Should have the cost of all entries");
+    
+    for (int Loop = 0; Loop < 10; Loop++)
+    {
+        int Value;
+        XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &Loop, &Value), @"Should contain the key");
+        XCTAssertEqual(Value, Loop * 10, @"Should be the inserted value");
+    }
+    
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 2 }, &(int){ 200 }, 5), @"Should replace the entry");
+    
+    int Value;
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 2 }, &Value), @"Should contain the key");
+    XCTAssertEqual(Value, 200, @"Should be the replaced value");
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 10, @"Should not add an entry");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 14, @"Should use the cost of the replaced entry");
+    
+    XCTAssertTrue(CCConcurrentCacheRemoveValue(Cache, &(int){ 2 }), @"Should remove the entry");
+    XCTAssertFalse(CCConcurrentCacheRemoveValue(Cache, &(int){ 2 }), @"Should not remove a missing entry");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 2 }, NULL), @"Should not contain the key");
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 9, @"Should contain 9 entries");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 9, @"Should have the cost of the remaining entries");
+    
+    CCConcurrentCacheRemoveAllValues(Cache);
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 0, @"Should be empty");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 0, @"Should have no cost");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 1 }, NULL), @"Should not contain the key");
+    
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 1 }, &(int){ 1 }, 1), @"Should set the entry");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 1 }, NULL), @"Should contain the key");
+    
+    CCConcurrentCacheDestroy(Cache);
+}
+
+-(void) testEviction
+{
+    CCConcurrentCache Cache = CCConcurrentCacheCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 1, 4, NULL, NULL, NULL);
+    
+    for (int Loop = 0; Loop < 4; Loop++) CCConcurrentCacheSetValue(Cache, &Loop, &Loop, 1);
+    
+    CCConcurrentCacheGetValue(Cache, &(int){ 0 }, NULL);
+    CCConcurrentCacheGetValue(Cache, &(int){ 1 }, NULL);
+    
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 4 }, &(int){ 4 }, 1), @"Should set the entry");
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 4, @"Should have evicted an entry");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 0 }, NULL), @"Should keep referenced entries");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 1 }, NULL), @"Should keep referenced entries");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 2 }, NULL), @"Should evict the first unreferenced entry");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 3 }, NULL), @"Should keep the remaining entries");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 4 }, NULL), @"Should keep the new entry");
+    
+    //All entries are now referenced, so a full sweep is needed before the entry after the hand is evicted
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 5 }, &(int){ 5 }, 1), @"Should set the entry");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 3 }, NULL), @"Should evict the entry after the hand");
+    
+    CCConcurrentCacheStatistics Statistics = CCConcurrentCacheGetStatistics(Cache);
+    XCTAssertEqual(Statistics.evictions, 2, @"Should count the evictions");
+    
+    CCConcurrentCacheDestroy(Cache);
+}
+
+-(void) testCost
+{
+    CCConcurrentCache Cache = CCConcurrentCacheCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 1, 10, NULL, NULL, NULL);
+    
+    XCTAssertFalse(CCConcurrentCacheSetValue(Cache, &(int){ 0 }, &(int){ 0 }, 11), @"Should not set an entry larger than the capacity");
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), 0, @"Should be empty");
+    
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 1 }, &(int){ 1 }, 6), @"Should set the entry");
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 2 }, &(int){ 2 }, 4), @"Should set the entry");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 10, @"Should be at capacity");
+    
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 3 }, &(int){ 3 }, 5), @"Should set the entry");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 1 }, NULL), @"Should evict entries to fit the cost");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 2 }, NULL), @"Should only evict what is needed");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 9, @"Should have the cost of the remaining entries");
+    
+    XCTAssertTrue(CCConcurrentCacheSetValue(Cache, &(int){ 3 }, &(int){ 3 }, 10), @"Should replace the entry");
+    XCTAssertFalse(CCConcurrentCacheGetValue(Cache, &(int){ 2 }, NULL), @"Should evict other entries to fit the replaced entry");
+    XCTAssertTrue(CCConcurrentCacheGetValue(Cache, &(int){ 3 }, NULL), @"Should not evict the replaced entry");
+    XCTAssertEqual(CCConcurrentCacheGetCost(Cache), 10, @"Should have the cost of the replaced entry");
+    
+    CCConcurrentCacheDestroy(Cache);
+}
+
+static int DestroyedSum = 0, DestroyedCount = 0;
+static void Destructor(CCConcurrentCache Cache, const int *Key, int *Value)
+{
+    DestroyedSum += *Value;
+    DestroyedCount++;
+}
+
+-(void) testDestructor
+{
+    DestroyedSum = 0;
+    DestroyedCount = 0;
+    
+    CCConcurrentCache Cache = CCConcurrentCacheCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 1, 3, NULL, NULL, (CCConcurrentCacheEntryDestructor)Destructor);
+    
+    CCConcurrentCacheSetValue(Cache, &(int){ 1 }, &(int){ 1 }, 1);
+    CCConcurrentCacheSetValue(Cache, &(int){ 1 }, &(int){ 10 }, 1);
+    XCTAssertEqual(DestroyedCount, 1, @"Should destroy the replaced entry");
+    XCTAssertEqual(DestroyedSum, 1, @"Should destroy the replaced entry");
+    
+    CCConcurrentCacheSetValue(Cache, &(int){ 2 }, &(int){ 100 }, 2);
+    CCConcurrentCacheSetValue(Cache, &(int){ 3 }, &(int){ 1000 }, 1);
+    XCTAssertEqual(DestroyedCount, 2, @"Should destroy the evicted entry");
+    XCTAssertEqual(DestroyedSum, 101, @"Should destroy the evicted entry");
+    
+    XCTAssertFalse(CCConcurrentCacheSetValue(Cache, &(int){ 4 }, &(int){ 10000 }, 4), @"Should not set an entry larger than the capacity");
+    XCTAssertEqual(DestroyedCount, 2, @"Should not destroy an entry that was not set");
+    
+    CCConcurrentCacheRemoveValue(Cache, &(int){ 1 });
+    XCTAssertEqual(DestroyedCount, 3, @"Should destroy the removed entry");
+    XCTAssertEqual(DestroyedSum, 111, @"Should destroy the removed entry");
+    
+    CCConcurrentCacheDestroy(Cache);
+    XCTAssertEqual(DestroyedCount, 4, @"Should destroy the remaining entries");
+    XCTAssertEqual(DestroyedSum, 1111, @"Should destroy the remaining entries");
+}
+
+-(void) testStatistics
+{
+    CCConcurrentCache Cache = CCConcurrentCacheCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 4, 8, NULL, NULL, NULL);
+    
+    for (int Loop = 0; Loop < 4; Loop++) CCConcurrentCacheSetValue(Cache, &Loop, &Loop, 0);
+    for (int Loop = 0; Loop < 8; Loop++) CCConcurrentCacheGetValue(Cache, &Loop, NULL);
+    
+    CCConcurrentCacheStatistics Statistics = CCConcurrentCacheGetStatistics(Cache);
+    XCTAssertEqual(Statistics.hits, 4, @"Should count the hits");
+    XCTAssertEqual(Statistics.misses, 4, @"Should count the misses");
+    XCTAssertEqual(Statistics.evictions, 0, @"Should not evict entries without a cost");
+    
+    CCConcurrentCacheDestroy(Cache);
+}
+
+#define THREAD_COUNT 4
+#define KEY_COUNT 20000
+#define CAPACITY 1000
+
+static CCConcurrentCache Cache;
+
+static void *Accessor(void *Arg)
+{
+    const int Offset = (int)(uintptr_t)Arg;
+    _Bool Correct = TRUE;
+    
+    for (int Loop = 0; Loop < KEY_COUNT; Loop++)
+    {
+        const int Key = (Loop * 7 + Offset) % (CAPACITY * 4);
+        
+        int Value;
+        if (CCConcurrentCacheGetValue(Cache, &Key, &Value)) Correct &= Value == -Key;
+        else CCConcurrentCacheSetValue(Cache, &Key, &(int){ -Key }, 1);
+        
+        if (!(Loop % 64)) CCConcurrentCacheRemoveValue(Cache, &(int){ Key + 1 });
+    }
+    
+    return (void*)(uintptr_t)Correct;
+}
+
+-(void) testMultiThreading
+{
+    Cache = CCConcurrentCacheCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), 8, CAPACITY, NULL, NULL, NULL);
+    
+    pthread_t Accessors[THREAD_COUNT];
+    for (int Loop = 0; Loop < THREAD_COUNT; Loop++) pthread_create(Accessors + Loop, NULL, Accessor, (void*)(uintptr_t)Loop);
+    
+    _Bool Correct = TRUE;
+    for (int Loop = 0; Loop < THREAD_COUNT; Loop++)
+    {
+        uintptr_t Result;
+        pthread_join(Accessors[Loop], (void**)&Result);
+        
+        Correct &= Result;
+    }
+    
+    XCTAssertTrue(Correct, @"Should only ever get the value set for the key");
+    XCTAssertLessThanOrEqual(CCConcurrentCacheGetCost(Cache), CAPACITY, @"Should not exceed the capacity");
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), CCConcurrentCacheGetCost(Cache), @"Should have the correct count");
+    
+    CCConcurrentCacheStatistics Statistics = CCConcurrentCacheGetStatistics(Cache);
+    XCTAssertEqual(Statistics.hits + Statistics.misses, THREAD_COUNT * KEY_COUNT, @"Should count every lookup");
+    XCTAssertGreaterThan(Statistics.evictions, 0, @"Should have evicted entries");
+    
+    size_t Count = 0;
+    for (int Loop = 0; Loop < CAPACITY * 4; Loop++)
+    {
+        int Value;
+        if (CCConcurrentCacheGetValue(Cache, &Loop, &Value))
+        {
+            Correct &= Value == -Loop;
+            Count++;
+        }
+    }
+    
+    XCTAssertTrue(Correct, @"Should only contain the values set for the keys");
+    XCTAssertEqual(CCConcurrentCacheGetCount(Cache), Count, @"Should contain the counted entries");
+    
+    CCConcurrentCacheDestroy(Cache);
+}
+
+@end
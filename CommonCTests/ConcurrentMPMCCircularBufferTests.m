@@ -0,0 +1,184 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import <stdatomic.h>
+#import <pthread.h>
+
+#define Titem int
+#define Tmax 4
+#include "ConcurrentMPMCCircularBuffer.h"
+
+#define Titem int
+#define Tmax 64
+#include "ConcurrentMPMCCircularBuffer.h"
+
+@interface ConcurrentMPMCCircularBufferTests : XCTestCase
+@end
+
+@implementation ConcurrentMPMCCircularBufferTests
+
+-(void) testAddingItems
+{
+    CCConcurrentMPMCCircularBuffer(int, 4) Buffer = CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_INIT;
+    
+    int Value;
+    XCTAssertFalse(CCConcurrentMPMCCircularBufferRemoveItem(&Buffer, &Value), @"Should be empty");
+    
+    XCTAssertTrue(CCConcurrentMPMCCircularBufferAddItem(&Buffer, &(int){ 1 }), @"Should add the item");
+    XCTAssertTrue(CCConcurrentMPMCCircularBufferAddItem(&Buffer, &(int){ 2 }), @"Should add the item");
+    XCTAssertTrue(CCConcurrentMPMCCircularBufferAddItem(&Buffer, &(int){ 3 }), @"Should add the item");
+    XCTAssertTrue(CCConcurrentMPMCCircularBufferAddItem(&Buffer, &(int){ 4 }), @"Should add the item");
+    XCTAssertFalse(CCConcurrentMPMCCircularBufferAddItem(&Buffer, &(int){ 5 }), @"Should not add the item");
+    
+    XCTAssertTrue(CCConcurrentMPMCCircularBufferRemoveItem(&Buffer, &Value), @"Should remove the item");
+    XCTAssertEqual(Value, 1, @"Should remove the items in order");
+    
+    XCTAssertTrue(CCConcurrentMPMCCircularBufferAddItem(&Buffer, &(int){ 5 }), @"Should add the item");
+    
+    int Values[6] = { 0 }, More[5] = { 6, 7, 8, 9, 10 };
+    XCTAssertEqual(CCConcurrentMPMCCircularBufferRemoveItems(&Buffer, Values, 3), 3, @"Should remove the requested items");
+    XCTAssertEqual(Values[0], 2, @"Should remove the items in order");
+    XCTAssertEqual(Values[1], 3, @"Should remove the items in order");
+    XCTAssertEqual(Values[2], 4, @"Should remove the items in order");
+    
+    XCTAssertEqual(CCConcurrentMPMCCircularBufferAddItems(&Buffer, More, 5), 3, @"Should add only some of the items");
+    XCTAssertEqual(CCConcurrentMPMCCircularBufferRemoveItems(&Buffer, Values, 6), 4, @"Should remove all of the items");
+    XCTAssertEqual(Values[0], 5, @"Should remove the items in order");
+    XCTAssertEqual(Values[1], 6, @"Should remove the items in order");
+    XCTAssertEqual(Values[2], 7, @"Should remove the items in order");
+    XCTAssertEqual(Values[3], 8, @"Should remove the items in order");
+    
+    XCTAssertEqual(CCConcurrentMPMCCircularBufferRemoveItems(&Buffer, Values, 6), 0, @"Should be empty");
+    
+    CCConcurrentMPMCCircularBufferWaitAddItem(&Buffer, &(int){ 11 });
+    CCConcurrentMPMCCircularBufferWaitAddItem(&Buffer, &(int){ 12 });
+    
+    XCTAssertEqual(CCConcurrentMPMCCircularBufferWaitRemoveItems(&Buffer, Values, 6), 2, @"Should remove all of the items");
+    XCTAssertEqual(Values[0], 11, @"Should remove the items in order");
+    XCTAssertEqual(Values[1], 12, @"Should remove the items in order");
+    
+    CCConcurrentMPMCCircularBufferWaitAddItem(&Buffer, &(int){ 13 });
+    CCConcurrentMPMCCircularBufferWaitRemoveItem(&Buffer, &Value);
+    XCTAssertEqual(Value, 13, @"Should remove the item");
+}
+
+#define PRODUCER_THREADS 4
+#define CONSUMER_THREADS 4
+#define ITEM_COUNT 100000
+
+static CCConcurrentMPMCCircularBuffer(int, 64) Buffer = CC_CONCURRENT_MPMC_CIRCULAR_BUFFER_INIT;
+static _Atomic(int) Received[ITEM_COUNT * PRODUCER_THREADS];
+
+static void *Producer(void *Arg)
+{
+    const int Start = *(int*)Arg * ITEM_COUNT;
+    
+    for (int Loop = 0; Loop < ITEM_COUNT; )
+    {
+        if (Loop % 3)
+        {
+            CCConcurrentMPMCCircularBufferWaitAddItem(&Buffer, &(int){ Start + Loop });
+            Loop++;
+        }
+        
+        else
+        {
+            int Items[8];
+            const int Count = CCMin(8, ITEM_COUNT - Loop);
+            for (int Index = 0; Index < Count; Index++) Items[Index] = Start + Loop + Index;
+            
+            Loop += (int)CCConcurrentMPMCCircularBufferAddItems(&Buffer, Items, Count);
+        }
+    }
+    
+    return NULL;
+}
+
+static void *Consumer(void *Arg)
+{
+    size_t Count = 0;
+    
+    for (;;)
+    {
+        int Items[16];
+        const size_t Removed = CCConcurrentMPMCCircularBufferWaitRemoveItems(&Buffer, Items, 16);
+        
+        size_t Terminators = 0;
+        for (size_t Loop = 0; Loop < Removed; Loop++)
+        {
+            if (Items[Loop] == -1) Terminators++;
+            else
+            {
+                atomic_fetch_add_explicit(&Received[Items[Loop]], 1, memory_order_relaxed);
+                Count++;
+            }
+        }
+        
+        if (Terminators)
+        {
+            //Hand back any terminators meant for the other consumers
+            while (--Terminators) CCConcurrentMPMCCircularBufferWaitAddItem(&Buffer, &(int){ -1 });
+            
+            return (void*)Count;
+        }
+    }
+}
+
+-(void) testMultiThreading
+{
+    pthread_t Producers[PRODUCER_THREADS], Consumers[CONSUMER_THREADS];
+    int Args[PRODUCER_THREADS];
+    
+    for (int Loop = 0; Loop < CONSUMER_THREADS; Loop++) pthread_create(Consumers + Loop, NULL, Consumer, NULL);
+    
+    for (int Loop = 0; Loop < PRODUCER_THREADS; Loop++)
+    {
+        Args[Loop] = Loop;
+        pthread_create(Producers + Loop, NULL, Producer, Args + Loop);
+    }
+    
+    for (int Loop = 0; Loop < PRODUCER_THREADS; Loop++) pthread_join(Producers[Loop], NULL);
+    
+    for (int Loop = 0; Loop < CONSUMER_THREADS; Loop++) CCConcurrentMPMCCircularBufferWaitAddItem(&Buffer, &(int){ -1 });
+    
+    size_t Total = 0;
+    for (int Loop = 0; Loop < CONSUMER_THREADS; Loop++)
+    {
+        size_t Count;
+        pthread_join(Consumers[Loop], (void**)&Count);
+        
+        Total += Count;
+    }
+    
+    XCTAssertEqual(Total, ITEM_COUNT * PRODUCER_THREADS, @"Should receive every item");
+    
+    _Bool Once = TRUE;
+    for (size_t Loop = 0; Loop < ITEM_COUNT * PRODUCER_THREADS; Loop++) Once &= atomic_load(&Received[Loop]) == 1;
+    
+    XCTAssertTrue(Once, @"Should receive every item exactly once");
+}
+
+@end
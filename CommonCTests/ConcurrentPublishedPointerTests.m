@@ -0,0 +1,196 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import <stdatomic.h>
+#import <pthread.h>
+#import "EpochGarbageCollector.h"
+#import "Array.h"
+
+static _Atomic(int) ReclaimCount = ATOMIC_VAR_INIT(0);
+static void ArrayReclaimer(CCArray Array)
+{
+    atomic_fetch_add_explicit(&ReclaimCount, 1, memory_order_relaxed);
+    CCArrayDestroy(Array);
+}
+
+static CCArray ArrayCreate(int Version)
+{
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(int), 4);
+    
+    for (size_t Loop = 0; Loop < 4; Loop++) CCArrayAppendElement(Array, &Version);
+    
+    return Array;
+}
+
+#define Titem CCArray
+#define Treclaimer ArrayReclaimer
+#include "ConcurrentPublishedPointer.h"
+
+@interface ConcurrentPublishedPointerTests : XCTestCase
+@end
+
+@implementation ConcurrentPublishedPointerTests
+
+static void ForceFlush(CCConcurrentGarbageCollector GC)
+{
+    CCConcurrentGarbageCollectorBegin(GC);
+    CCConcurrentGarbageCollectorEnd(GC);
+    
+    CCConcurrentGarbageCollectorBegin(GC);
+    CCConcurrentGarbageCollectorEnd(GC);
+}
+
+-(void) testSettingItems
+{
+    CCConcurrentGarbageCollector GC = CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, CCEpochGarbageCollector);
+    CCConcurrentPublishedPointer(CCArray, ArrayReclaimer) Pointer = CC_CONCURRENT_PUBLISHED_POINTER_INIT;
+    
+    atomic_store(&ReclaimCount, 0);
+    
+    CCConcurrentGarbageCollectorBegin(GC);
+    XCTAssertEqual(CCConcurrentPublishedPointerGet(&Pointer), NULL, @"Should default to NULL");
+    
+    CCConcurrentPublishedPointerSet(&Pointer, GC, ArrayCreate(1));
+    
+    CCArray Current = CCConcurrentPublishedPointerGet(&Pointer);
+    XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Current, 0), 1, @"Should get the current pointer");
+    CCConcurrentGarbageCollectorEnd(GC);
+    
+    ForceFlush(GC);
+    XCTAssertEqual(atomic_load(&ReclaimCount), 0, @"Should not reclaim the current pointer");
+    
+    CCConcurrentGarbageCollectorBegin(GC);
+    Current = CCConcurrentPublishedPointerGet(&Pointer);
+    CCConcurrentPublishedPointerSet(&Pointer, GC, ArrayCreate(2));
+    
+    XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(Current, 0), 1, @"Should still be able to access the replaced pointer in the same section");
+    XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(CCConcurrentPublishedPointerGet(&Pointer), 0), 2, @"Should get the current pointer");
+    XCTAssertEqual(atomic_load(&ReclaimCount), 0, @"Should not reclaim the replaced pointer while in use");
+    
+    CCArray Data = ArrayCreate(3);
+    XCTAssertFalse(CCConcurrentPublishedPointerCompareAndSet(&Pointer, GC, Current, Data), @"Should not publish if the current pointer has changed");
+    XCTAssertTrue(CCConcurrentPublishedPointerCompareAndSet(&Pointer, GC, CCConcurrentPublishedPointerGet(&Pointer), Data), @"Should publish if the current pointer is unchanged");
+    XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(CCConcurrentPublishedPointerGet(&Pointer), 0), 3, @"Should get the current pointer");
+    CCConcurrentGarbageCollectorEnd(GC);
+    
+    ForceFlush(GC);
+    XCTAssertEqual(atomic_load(&ReclaimCount), 2, @"Should reclaim the replaced pointers");
+    
+    CCConcurrentGarbageCollectorBegin(GC);
+    CCConcurrentPublishedPointerSet(&Pointer, GC, NULL);
+    CCConcurrentGarbageCollectorEnd(GC);
+    
+    CCConcurrentGarbageCollectorDestroy(GC);
+    XCTAssertEqual(atomic_load(&ReclaimCount), 3, @"Should reclaim all pointers");
+}
+
+#define READER_THREADS 4
+#define WRITER_THREADS 2
+#define READ_COUNT 100000
+#define WRITE_COUNT 1000
+
+static CCConcurrentGarbageCollector GC;
+static CCConcurrentPublishedPointer(CCArray, ArrayReclaimer) Pointer = CC_CONCURRENT_PUBLISHED_POINTER_INIT;
+
+static void *Reader(void *Arg)
+{
+    _Bool Consistent = TRUE;
+    int Version = 0;
+    
+    for (int Loop = 0; Loop < READ_COUNT; Loop++)
+    {
+        CCConcurrentGarbageCollectorBegin(GC);
+        
+        CCArray Current = CCConcurrentPublishedPointerGet(&Pointer);
+        
+        Consistent &= *(int*)CCArrayGetElementAtIndex(Current, 0) >= Version;
+        Version = *(int*)CCArrayGetElementAtIndex(Current, 0);
+        
+        for (size_t Index = 0; Index < 4; Index++) Consistent &= *(int*)CCArrayGetElementAtIndex(Current, Index) == Version;
+        
+        CCConcurrentGarbageCollectorEnd(GC);
+    }
+    
+    return (void*)(uintptr_t)Consistent;
+}
+
+static void *Writer(void *Arg)
+{
+    for (int Loop = 0; Loop < WRITE_COUNT; Loop++)
+    {
+        CCConcurrentGarbageCollectorBegin(GC);
+        
+        for (;;)
+        {
+            CCArray Current = CCConcurrentPublishedPointerGet(&Pointer);
+            CCArray Data = ArrayCreate(*(int*)CCArrayGetElementAtIndex(Current, 0) + 1);
+            
+            if (CCConcurrentPublishedPointerCompareAndSet(&Pointer, GC, Current, Data)) break;
+            
+            CCArrayDestroy(Data);
+        }
+        
+        CCConcurrentGarbageCollectorEnd(GC);
+    }
+    
+    return NULL;
+}
+
+-(void) testMultiThreading
+{
+    GC = CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, CCEpochGarbageCollector);
+    
+    atomic_store(&ReclaimCount, 0);
+    
+    CCConcurrentGarbageCollectorBegin(GC);
+    CCConcurrentPublishedPointerSet(&Pointer, GC, ArrayCreate(0));
+    CCConcurrentGarbageCollectorEnd(GC);
+    
+    pthread_t Readers[READER_THREADS], Writers[WRITER_THREADS];
+    
+    for (int Loop = 0; Loop < READER_THREADS; Loop++) pthread_create(Readers + Loop, NULL, Reader, NULL);
+    for (int Loop = 0; Loop < WRITER_THREADS; Loop++) pthread_create(Writers + Loop, NULL, Writer, NULL);
+    
+    for (int Loop = 0; Loop < WRITER_THREADS; Loop++) pthread_join(Writers[Loop], NULL);
+    
+    for (int Loop = 0; Loop < READER_THREADS; Loop++)
+    {
+        uintptr_t Consistent;
+        pthread_join(Readers[Loop], (void**)&Consistent);
+        
+        XCTAssertTrue(Consistent, @"Should only read complete versions in order");
+    }
+    
+    CCConcurrentGarbageCollectorBegin(GC);
+    XCTAssertEqual(*(int*)CCArrayGetElementAtIndex(CCConcurrentPublishedPointerGet(&Pointer), 0), WRITER_THREADS * WRITE_COUNT, @"Should publish every update");
+    CCConcurrentPublishedPointerSet(&Pointer, GC, NULL);
+    CCConcurrentGarbageCollectorEnd(GC);
+    
+    CCConcurrentGarbageCollectorDestroy(GC);
+    XCTAssertEqual(atomic_load(&ReclaimCount), (WRITER_THREADS * WRITE_COUNT) + 1, @"Should reclaim every version");
+}
+
+@end
@@ -0,0 +1,119 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "ConcurrentSPSCQueue.h"
+#import <pthread.h>
+
+@interface ConcurrentSPSCQueueTests : XCTestCase
+
+@end
+
+@implementation ConcurrentSPSCQueueTests
+
+-(void) testPushAndPop
+{
+    CCConcurrentSPSCQueue Queue = CCConcurrentSPSCQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 4);
+    
+    XCTAssertTrue(CCConcurrentSPSCQueueIsEmpty(Queue), @"Should be empty");
+    XCTAssertEqual(CCConcurrentSPSCQueuePeek(Queue), NULL, @"Should not have an element");
+    XCTAssertFalse(CCConcurrentSPSCQueuePop(Queue, NULL), @"Should not pop an element");
+    
+    for (int Loop = 0; Loop < 10; Loop++) XCTAssertTrue(CCConcurrentSPSCQueuePush(Queue, &Loop), @"Should push the element");
+    
+    XCTAssertFalse(CCConcurrentSPSCQueueIsEmpty(Queue), @"Should not be empty");
+    
+    for (int Loop = 0; Loop < 10; Loop++)
+    {
+        XCTAssertEqual(*(int*)CCConcurrentSPSCQueuePeek(Queue), Loop, @"Should peek the front element");
+        
+        int Value;
+        XCTAssertTrue(CCConcurrentSPSCQueuePop(Queue, &Value), @"Should pop the element");
+        XCTAssertEqual(Value, Loop, @"Should pop the elements in order");
+    }
+    
+    XCTAssertTrue(CCConcurrentSPSCQueueIsEmpty(Queue), @"Should be empty");
+    XCTAssertFalse(CCConcurrentSPSCQueuePop(Queue, NULL), @"Should not pop an element");
+    
+    CCConcurrentSPSCQueueDestroy(Queue);
+}
+
+-(void) testSegmentReuse
+{
+    CCConcurrentSPSCQueue Queue = CCConcurrentSPSCQueueCreate(CC_STD_ALLOCATOR, sizeof(int), 3);
+    
+    int Next = 0, Expected = 0;
+    _Bool Ordered = TRUE;
+    for (int Round = 0; Round < 100; Round++)
+    {
+        //Vary the amount pushed and popped so the positions fall on every offset of a segment
+        for (int Loop = 0; Loop < (Round % 7) + 1; Loop++) CCConcurrentSPSCQueuePush(Queue, &(int){ Next++ });
+        
+        for (int Loop = 0, Value; (Loop < (Round % 5) + 1) && CCConcurrentSPSCQueuePop(Queue, &Value); Loop++) Ordered &= Value == Expected++;
+    }
+    
+    for (int Value; CCConcurrentSPSCQueuePop(Queue, &Value); ) Ordered &= Value == Expected++;
+    
+    XCTAssertTrue(Ordered, @"Should pop the elements in order");
+    XCTAssertEqual(Expected, Next, @"Should pop every element");
+    XCTAssertTrue(CCConcurrentSPSCQueueIsEmpty(Queue), @"Should be empty");
+    
+    CCConcurrentSPSCQueueDestroy(Queue);
+}
+
+#define ELEMENT_COUNT 1000000
+
+static CCConcurrentSPSCQueue Queue;
+
+static void *Producer(void *Arg)
+{
+    for (size_t Loop = 0; Loop < ELEMENT_COUNT; Loop++) CCConcurrentSPSCQueuePush(Queue, &Loop);
+    
+    return NULL;
+}
+
+-(void) testMultiThreading
+{
+    Queue = CCConcurrentSPSCQueueCreate(CC_STD_ALLOCATOR, sizeof(size_t), 64);
+    
+    pthread_t ProducerThread;
+    pthread_create(&ProducerThread, NULL, Producer, NULL);
+    
+    _Bool Ordered = TRUE;
+    for (size_t Expected = 0; Expected < ELEMENT_COUNT; )
+    {
+        size_t Value;
+        if (CCConcurrentSPSCQueuePop(Queue, &Value)) Ordered &= Value == Expected++;
+    }
+    
+    pthread_join(ProducerThread, NULL);
+    
+    XCTAssertTrue(Ordered, @"Should pop the elements in the order they were pushed");
+    XCTAssertTrue(CCConcurrentSPSCQueueIsEmpty(Queue), @"Should be empty");
+    
+    CCConcurrentSPSCQueueDestroy(Queue);
+}
+
+@end
@@ -0,0 +1,247 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "ConcurrentSkipList.h"
+#import "EpochGarbageCollector.h"
+#import "LazyGarbageCollector.h"
+#import <stdatomic.h>
+#import <pthread.h>
+
+@interface ConcurrentSkipListTests : XCTestCase
+
+@property (readonly) const CCConcurrentGarbageCollectorInterface *gc;
+
+@end
+
+@implementation ConcurrentSkipListTests
+
+-(const CCConcurrentGarbageCollectorInterface *) gc
+{
+    return CCEpochGarbageCollector;
+}
+
+static CCComparisonResult IntComparator(const int *Left, const int *Right)
+{
+    return *Left < *Right ? CCComparisonResultAscending : (*Left > *Right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+-(void) testInsertion
+{
+    CCConcurrentSkipList SkipList = CCConcurrentSkipListCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), (CCComparator)IntComparator, CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, self.gc));
+    
+    XCTAssertEqual(CCConcurrentSkipListGetCount(SkipList), 0, @"Should be empty");
+    XCTAssertFalse(CCConcurrentSkipListGetValue(SkipList, &(int){ 1 }, NULL), @"Should not contain the key");
+    
+    XCTAssertTrue(CCConcurrentSkipListInsert(SkipList, &(int){ 3 }, &(int){ 30 }), @"Should insert the entry");
+    XCTAssertTrue(CCConcurrentSkipListInsert(SkipList, &(int){ 1 }, &(int){ 10 }), @"Should insert the entry");
+    XCTAssertTrue(CCConcurrentSkipListInsert(SkipList, &(int){ 2 }, &(int){ 20 }), @"Should insert the entry");
+    XCTAssertFalse(CCConcurrentSkipListInsert(SkipList, &(int){ 2 }, &(int){ 21 }), @"Should not insert a duplicate key");
+    
+    XCTAssertEqual(CCConcurrentSkipListGetCount(SkipList), 3, @"Should contain 3 entries");
+    
+    int Value;
+    XCTAssertTrue(CCConcurrentSkipListGetValue(SkipList, &(int){ 1 }, &Value), @"Should contain the key");
+    XCTAssertEqual(Value, 10, @"Should be the inserted value");
+    XCTAssertTrue(CCConcurrentSkipListGetValue(SkipList, &(int){ 2 }, &Value), @"Should contain the key");
+    XCTAssertEqual(Value, 20, @"Should be the first inserted value");
+    XCTAssertTrue(CCConcurrentSkipListGetValue(SkipList, &(int){ 3 }, &Value), @"Should contain the key");
+    XCTAssertEqual(Value, 30, @"Should be the inserted value");
+    XCTAssertFalse(CCConcurrentSkipListGetValue(SkipList, &(int){ 4 }, &Value), @"Should not contain the key");
+    
+    CCConcurrentSkipListDestroy(SkipList);
+}
+
+-(void) testRemoval
+{
+    CCConcurrentSkipList SkipList = CCConcurrentSkipListCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), (CCComparator)IntComparator, CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, self.gc));
+    
+    for (int Loop = 0; Loop < 100; Loop++) CCConcurrentSkipListInsert(SkipList, &Loop, &(int){ Loop * 10 });
+    
+    int Value;
+    XCTAssertTrue(CCConcurrentSkipListRemove(SkipList, &(int){ 50 }, &Value), @"Should remove the entry");
+    XCTAssertEqual(Value, 500, @"Should be the removed value");
+    XCTAssertFalse(CCConcurrentSkipListRemove(SkipList, &(int){ 50 }, &Value), @"Should not remove a missing entry");
+    XCTAssertFalse(CCConcurrentSkipListGetValue(SkipList, &(int){ 50 }, &Value), @"Should not contain the key");
+    XCTAssertEqual(CCConcurrentSkipListGetCount(SkipList), 99, @"Should contain 99 entries");
+    
+    for (int Loop = 0; Loop < 100; Loop += 2) CCConcurrentSkipListRemove(SkipList, &Loop, NULL);
+    
+    XCTAssertEqual(CCConcurrentSkipListGetCount(SkipList), 50, @"Should contain 50 entries");
+    
+    _Bool Correct = TRUE;
+    for (int Loop = 0; Loop < 100; Loop++) Correct &= CCConcurrentSkipListGetValue(SkipList, &Loop, &Value) == ((Loop & 1) && (Loop != 50));
+    
+    XCTAssertTrue(Correct, @"Should only contain the remaining keys");
+    
+    XCTAssertTrue(CCConcurrentSkipListInsert(SkipList, &(int){ 50 }, &(int){ 5 }), @"Should insert the entry");
+    XCTAssertTrue(CCConcurrentSkipListGetValue(SkipList, &(int){ 50 }, &Value), @"Should contain the key");
+    XCTAssertEqual(Value, 5, @"Should be the reinserted value");
+    
+    CCConcurrentSkipListDestroy(SkipList);
+}
+
+-(void) testEnumeration
+{
+    CCConcurrentSkipList SkipList = CCConcurrentSkipListCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), (CCComparator)IntComparator, CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, self.gc));
+    
+    CCEnumerable Enumerable;
+    CCConcurrentSkipListGetKeyEnumerable(SkipList, NULL, NULL, &Enumerable);
+    
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"Enumerable should be empty");
+    
+    CCConcurrentSkipListReleaseEnumerable(SkipList, &Enumerable);
+    
+    for (int Loop = 9; Loop >= 0; Loop--) CCConcurrentSkipListInsert(SkipList, &(int){ Loop * 2 }, &(int){ Loop });
+    
+    CCConcurrentSkipListGetKeyEnumerable(SkipList, NULL, NULL, &Enumerable);
+    
+    int Expected = 0;
+    for (int *Key = CCEnumerableGetCurrent(&Enumerable); Key; Key = CCEnumerableNext(&Enumerable), Expected += 2)
+    {
+        XCTAssertEqual(*Key, Expected, @"Should enumerate the keys in order");
+    }
+    
+    XCTAssertEqual(Expected, 20, @"Should enumerate all of the keys");
+    XCTAssertEqual(*(int*)CCEnumerableGetTail(&Enumerable), 18, @"Should be the last key");
+    XCTAssertEqual(*(int*)CCEnumerablePrevious(&Enumerable), 16, @"Should be the previous key");
+    
+    CCConcurrentSkipListReleaseEnumerable(SkipList, &Enumerable);
+    
+    CCConcurrentSkipListGetValueEnumerable(SkipList, &(int){ 5 }, &(int){ 12 }, &Enumerable);
+    
+    XCTAssertEqual(*(int*)CCEnumerableGetCurrent(&Enumerable), 3, @"Should start at the first key in the range");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 4, @"Should be the next value");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 5, @"Should be the next value");
+    XCTAssertEqual(CCEnumerableNext(&Enumerable), NULL, @"Should exclude keys past the range");
+    XCTAssertEqual(*(int*)CCEnumerableGetTail(&Enumerable), 5, @"Should end at the last key in the range");
+    XCTAssertEqual(*(int*)CCEnumerablePrevious(&Enumerable), 4, @"Should be the previous value");
+    XCTAssertEqual(*(int*)CCEnumerablePrevious(&Enumerable), 3, @"Should be the previous value");
+    XCTAssertEqual(CCEnumerablePrevious(&Enumerable), NULL, @"Should exclude keys before the range");
+    
+    CCConcurrentSkipListReleaseEnumerable(SkipList, &Enumerable);
+    
+    CCConcurrentSkipListRemove(SkipList, &(int){ 8 }, NULL);
+    CCConcurrentSkipListGetValueEnumerable(SkipList, &(int){ 5 }, &(int){ 12 }, &Enumerable);
+    
+    XCTAssertEqual(*(int*)CCEnumerableGetCurrent(&Enumerable), 3, @"Should start at the first key in the range");
+    XCTAssertEqual(*(int*)CCEnumerableNext(&Enumerable), 5, @"Should skip removed entries");
+    
+    CCConcurrentSkipListReleaseEnumerable(SkipList, &Enumerable);
+    
+    CCConcurrentSkipListDestroy(SkipList);
+}
+
+#define THREAD_COUNT 4
+#define KEY_COUNT 20000
+
+static CCConcurrentSkipList SkipList;
+
+static void *Mutator(void *Arg)
+{
+    const int Offset = (int)(uintptr_t)Arg;
+    
+    for (int Loop = Offset; Loop < KEY_COUNT; Loop += THREAD_COUNT)
+    {
+        CCConcurrentSkipListInsert(SkipList, &Loop, &(int){ -Loop });
+        
+        //Remove every third key inserted by another thread
+        const int Key = Loop - 1;
+        if ((Key >= 0) && !(Key % 3)) while (!CCConcurrentSkipListRemove(SkipList, &Key, NULL));
+    }
+    
+    return NULL;
+}
+
+static void *Enumerator(void *Arg)
+{
+    _Bool Ordered = TRUE;
+    
+    while (!atomic_load_explicit((_Atomic(_Bool)*)Arg, memory_order_relaxed))
+    {
+        CCEnumerable Enumerable;
+        CCConcurrentSkipListGetKeyEnumerable(SkipList, NULL, NULL, &Enumerable);
+        
+        int Previous = -1;
+        for (int *Key = CCEnumerableGetCurrent(&Enumerable); Key; Key = CCEnumerableNext(&Enumerable))
+        {
+            Ordered &= *Key > Previous;
+            Previous = *Key;
+        }
+        
+        CCConcurrentSkipListReleaseEnumerable(SkipList, &Enumerable);
+    }
+    
+    return (void*)(uintptr_t)Ordered;
+}
+
+-(void) testMultiThreading
+{
+    SkipList = CCConcurrentSkipListCreate(CC_STD_ALLOCATOR, sizeof(int), sizeof(int), (CCComparator)IntComparator, CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, self.gc));
+    
+    pthread_t Mutators[THREAD_COUNT], EnumeratorThread;
+    _Atomic(_Bool) Done = ATOMIC_VAR_INIT(FALSE);
+    
+    pthread_create(&EnumeratorThread, NULL, Enumerator, (void*)&Done);
+    for (int Loop = 0; Loop < THREAD_COUNT; Loop++) pthread_create(Mutators + Loop, NULL, Mutator, (void*)(uintptr_t)Loop);
+    for (int Loop = 0; Loop < THREAD_COUNT; Loop++) pthread_join(Mutators[Loop], NULL);
+    
+    atomic_store(&Done, TRUE);
+    
+    uintptr_t Ordered;
+    pthread_join(EnumeratorThread, (void**)&Ordered);
+    
+    XCTAssertTrue(Ordered, @"Should always enumerate the keys in order");
+    
+    size_t Count = 0;
+    _Bool Correct = TRUE;
+    for (int Loop = 0; Loop < KEY_COUNT; Loop++)
+    {
+        int Value;
+        const _Bool Exists = CCConcurrentSkipListGetValue(SkipList, &Loop, &Value);
+        
+        Correct &= (Exists == ((Loop % 3) || (Loop == (KEY_COUNT - 1)))) && (!Exists || (Value == -Loop));
+        Count += Exists;
+    }
+    
+    XCTAssertTrue(Correct, @"Should only contain the keys that were not removed");
+    XCTAssertEqual(CCConcurrentSkipListGetCount(SkipList), Count, @"Should have the correct count");
+    
+    CCConcurrentSkipListDestroy(SkipList);
+}
+
+@end
+
+@interface ConcurrentSkipListTestsLazyGC : ConcurrentSkipListTests
+@end
+
+@implementation ConcurrentSkipListTestsLazyGC
+
+-(const CCConcurrentGarbageCollectorInterface *) gc
+{
+    return CCLazyGarbageCollector;
+}
+
+@end
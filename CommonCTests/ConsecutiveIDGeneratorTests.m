@@ -177,4 +177,38 @@ static void *Worker2(void *Arg)
     CCConcurrentIDGeneratorDestroy(P);
 }
 
+-(void) testLargePool
+{
+    const size_t Count = 100000;
+    CCConcurrentIDGenerator Pool = CCConcurrentIDGeneratorCreate(CC_STD_ALLOCATOR, Count, CCConsecutiveIDGenerator);
+    
+    uint8_t *Assigned = calloc(Count, sizeof(uint8_t));
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        uintptr_t ID;
+        XCTAssertTrue(CCConcurrentIDGeneratorTryAssign(Pool, &ID), @"Should assign ID");
+        XCTAssertLessThan(ID, Count, @"Should assign an ID within the pool");
+        XCTAssertFalse(Assigned[ID], @"Should not assign any ID more than once");
+        
+        Assigned[ID] = 1;
+    }
+    
+    uintptr_t ID;
+    XCTAssertFalse(CCConcurrentIDGeneratorTryAssign(Pool, &ID), @"Should not assign an ID");
+    
+    for (size_t Loop = 7; Loop < Count; Loop += 4099) CCConcurrentIDGeneratorRecycle(Pool, Loop);
+    
+    for (size_t Loop = 7; Loop < Count; Loop += 4099)
+    {
+        XCTAssertTrue(CCConcurrentIDGeneratorTryAssign(Pool, &ID), @"Should assign ID");
+        XCTAssertEqual(ID % 4099, 7, @"Should assign a recycled ID");
+    }
+    
+    XCTAssertFalse(CCConcurrentIDGeneratorTryAssign(Pool, &ID), @"Should not assign an ID");
+    
+    free(Assigned);
+    CCConcurrentIDGeneratorDestroy(Pool);
+}
+
 @end
@@ -1193,4 +1193,174 @@
     XCTAssertEqual(CCDecimalMultiplyU64(UINT64_MAX, ((CCDecimal32){ .coef = UINT32_MAX, .exp = -29 })), 0, @"should be the correct result");
 }
 
+-(void) testFixedDecimalArithmetic
+{
+    CCFixedDecimal Result;
+    
+    XCTAssertTrue(CCFixedDecimalAdd(CCFixedDecimalMake(125, 2), CCFixedDecimalMake(5, 1), &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 175, @"should be the correct result");
+    XCTAssertEqual(Result.scale, 2, @"should be the correct result");
+    
+    XCTAssertTrue(CCFixedDecimalSub(CCFixedDecimalMake(1, 0), CCFixedDecimalMake(1, 3), &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 999, @"should be the correct result");
+    XCTAssertEqual(Result.scale, 3, @"should be the correct result");
+    
+    XCTAssertFalse(CCFixedDecimalAdd(CCFixedDecimalMake(INT64_MAX, 2), CCFixedDecimalMake(1, 2), &Result), @"should catch overflow");
+    XCTAssertFalse(CCFixedDecimalAdd(CCFixedDecimalMake(INT64_MAX / 10 + 1, 0), CCFixedDecimalMake(0, 1), &Result), @"should catch overflow");
+    XCTAssertTrue(CCFixedDecimalSub(CCFixedDecimalMake(INT64_MIN + 1, 0), CCFixedDecimalMake(1, 0), &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, INT64_MIN, @"should be the correct result");
+    
+    XCTAssertTrue(CCFixedDecimalMul(CCFixedDecimalMake(150, 2), CCFixedDecimalMake(25, 1), 2, CCDecimalRoundingHalfEven, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 375, @"should be the correct result");
+    XCTAssertEqual(Result.scale, 2, @"should be the correct result");
+    
+    XCTAssertTrue(CCFixedDecimalMul(CCFixedDecimalMake(INT64_MAX, 9), CCFixedDecimalMake(INT64_MAX, 10), 0, CCDecimalRoundingDown, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, INT64_C(8507059173023461584), @"should be the correct result");
+    XCTAssertFalse(CCFixedDecimalMul(CCFixedDecimalMake(INT64_MAX, 0), CCFixedDecimalMake(2, 0), 0, CCDecimalRoundingDown, &Result), @"should catch overflow");
+    
+    XCTAssertTrue(CCFixedDecimalDiv(CCFixedDecimalMake(1, 0), CCFixedDecimalMake(3, 0), 4, CCDecimalRoundingHalfEven, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 3333, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalDiv(CCFixedDecimalMake(-2, 0), CCFixedDecimalMake(3, 0), 4, CCDecimalRoundingHalfEven, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, -6667, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalDiv(CCFixedDecimalMake(10, 1), CCFixedDecimalMake(4, 3), 2, CCDecimalRoundingDown, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 25000, @"should be the correct result");
+    XCTAssertFalse(CCFixedDecimalDiv(CCFixedDecimalMake(1, 0), CCFixedDecimalMake(0, 2), 2, CCDecimalRoundingDown, &Result), @"should fail on division by zero");
+    XCTAssertFalse(CCFixedDecimalDiv(CCFixedDecimalMake(INT64_MIN, 0), CCFixedDecimalMake(-1, 0), 0, CCDecimalRoundingDown, &Result), @"should catch overflow");
+    
+    XCTAssertEqual(CCFixedDecimalCompare(CCFixedDecimalMake(10, 1), CCFixedDecimalMake(1000, 3)), CCComparisonResultEqual, @"should be the correct result");
+    XCTAssertEqual(CCFixedDecimalCompare(CCFixedDecimalMake(-1, 0), CCFixedDecimalMake(-999, 3)), CCComparisonResultAscending, @"should be the correct result");
+    XCTAssertEqual(CCFixedDecimalCompare(CCFixedDecimalMake(INT64_MAX, 0), CCFixedDecimalMake(INT64_MAX, 18)), CCComparisonResultDescending, @"should be the correct result");
+}
+
+-(void) testFixedDecimalRounding
+{
+    const int64_t Values[] = { 25, 35, -25, -35, 24, 26, -26 };
+    const int64_t Expected[][7] = {
+        [CCDecimalRoundingDown] = { 2, 3, -2, -3, 2, 2, -2 },
+        [CCDecimalRoundingUp] = { 3, 4, -3, -4, 3, 3, -3 },
+        [CCDecimalRoundingFloor] = { 2, 3, -3, -4, 2, 2, -3 },
+        [CCDecimalRoundingCeiling] = { 3, 4, -2, -3, 3, 3, -2 },
+        [CCDecimalRoundingHalfUp] = { 3, 4, -3, -4, 2, 3, -3 },
+        [CCDecimalRoundingHalfDown] = { 2, 3, -2, -3, 2, 3, -3 },
+        [CCDecimalRoundingHalfEven] = { 2, 4, -2, -4, 2, 3, -3 }
+    };
+    
+    for (CCDecimalRounding Rounding = CCDecimalRoundingDown; Rounding <= CCDecimalRoundingHalfEven; Rounding++)
+    {
+        for (size_t Loop = 0; Loop < sizeof(Values) / sizeof(*Values); Loop++)
+        {
+            CCFixedDecimal Result;
+            XCTAssertTrue(CCFixedDecimalRescale(CCFixedDecimalMake(Values[Loop], 1), 0, Rounding, &Result), @"should not overflow");
+            XCTAssertEqual(Result.units, Expected[Rounding][Loop], @"should be the correct result");
+            
+            XCTAssertTrue(CCFixedDecimalDiv(CCFixedDecimalMake(Values[Loop], 0), CCFixedDecimalMake(10, 0), 0, Rounding, &Result), @"should not overflow");
+            XCTAssertEqual(Result.units, Expected[Rounding][Loop], @"should be the correct result");
+        }
+    }
+    
+    CCFixedDecimal Result;
+    XCTAssertTrue(CCFixedDecimalRescale(CCFixedDecimalMake(2500001, 6), 0, CCDecimalRoundingHalfEven, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 3, @"should be the correct result");
+    XCTAssertFalse(CCFixedDecimalRescale(CCFixedDecimalMake(INT64_MAX, 0), 1, CCDecimalRoundingDown, &Result), @"should catch overflow");
+    XCTAssertTrue(CCFixedDecimalRescale(CCFixedDecimalMake(INT64_MAX, 1), 0, CCDecimalRoundingUp, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, INT64_MAX / 10 + 1, @"should be the correct result");
+}
+
+-(void) testFixedDecimalStrings
+{
+    CCFixedDecimal Result;
+    char Buffer[CC_FIXED_DECIMAL_STRING_SIZE];
+    
+    XCTAssertTrue(CCFixedDecimalParse("12.5", 4, 2, CCDecimalRoundingDown, &Result), @"should parse");
+    XCTAssertEqual(Result.units, 1250, @"should be the correct result");
+    XCTAssertEqual(Result.scale, 2, @"should be the correct result");
+    XCTAssertEqual(CCFixedDecimalFormat(Result, Buffer, sizeof(Buffer)), 5, @"should be the correct length");
+    XCTAssertTrue(!strcmp(Buffer, "12.50"), @"should be the correct string");
+    
+    XCTAssertTrue(CCFixedDecimalParse("-0.05", 5, 2, CCDecimalRoundingDown, &Result), @"should parse");
+    XCTAssertEqual(Result.units, -5, @"should be the correct result");
+    CCFixedDecimalFormat(Result, Buffer, sizeof(Buffer));
+    XCTAssertTrue(!strcmp(Buffer, "-0.05"), @"should be the correct string");
+    
+    XCTAssertTrue(CCFixedDecimalParse("+1.2250000001", 13, 2, CCDecimalRoundingHalfEven, &Result), @"should parse");
+    XCTAssertEqual(Result.units, 123, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalParse("1.225", 5, 2, CCDecimalRoundingHalfEven, &Result), @"should parse");
+    XCTAssertEqual(Result.units, 122, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalParse("-1.225", 6, 2, CCDecimalRoundingFloor, &Result), @"should parse");
+    XCTAssertEqual(Result.units, -123, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalParse("7", 1, 0, CCDecimalRoundingDown, &Result), @"should parse");
+    XCTAssertEqual(Result.units, 7, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalParse("-9223372036854775808", 20, 0, CCDecimalRoundingDown, &Result), @"should parse");
+    XCTAssertEqual(Result.units, INT64_MIN, @"should be the correct result");
+    CCFixedDecimalFormat(Result, Buffer, sizeof(Buffer));
+    XCTAssertTrue(!strcmp(Buffer, "-9223372036854775808"), @"should be the correct string");
+    CCFixedDecimalFormat(CCFixedDecimalMake(INT64_MIN, 18), Buffer, sizeof(Buffer));
+    XCTAssertTrue(!strcmp(Buffer, "-9.223372036854775808"), @"should be the correct string");
+    
+    XCTAssertFalse(CCFixedDecimalParse("9223372036854775808", 19, 0, CCDecimalRoundingDown, &Result), @"should catch overflow");
+    XCTAssertFalse(CCFixedDecimalParse("10.5", 4, 18, CCDecimalRoundingDown, &Result), @"should catch overflow");
+    XCTAssertFalse(CCFixedDecimalParse("", 0, 2, CCDecimalRoundingDown, &Result), @"should fail on malformed strings");
+    XCTAssertFalse(CCFixedDecimalParse("-", 1, 2, CCDecimalRoundingDown, &Result), @"should fail on malformed strings");
+    XCTAssertFalse(CCFixedDecimalParse("1.2.3", 5, 2, CCDecimalRoundingDown, &Result), @"should fail on malformed strings");
+    XCTAssertFalse(CCFixedDecimalParse("1e5", 3, 2, CCDecimalRoundingDown, &Result), @"should fail on malformed strings");
+    
+    XCTAssertEqual(CCFixedDecimalFormat(CCFixedDecimalMake(1250, 2), Buffer, 5), 0, @"should fail when the buffer is too small");
+}
+
+-(void) testFixedDecimalConversion
+{
+    CCFixedDecimal Result;
+    
+    XCTAssertTrue(CCFixedDecimalFromDecimal(((CCDecimal32){ .coef = 125, .exp = -2 }), 1, CCDecimalRoundingHalfEven, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 12, @"should be the correct result");
+    XCTAssertEqual(Result.scale, 1, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalFromDecimal(((CCDecimal64){ .coef = 3, .exp = 4 }), 2, CCDecimalRoundingDown, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 3000000, @"should be the correct result");
+    XCTAssertTrue(CCFixedDecimalFromDecimal(((CCDecimal64){ .coef = 1, .exp = -100 }), 2, CCDecimalRoundingCeiling, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 1, @"should be the correct result");
+    XCTAssertFalse(CCFixedDecimalFromDecimal(((CCDecimal64){ .coef = UINT64_MAX, .exp = 0 }), 0, CCDecimalRoundingDown, &Result), @"should catch overflow");
+    
+    const CCDecimal64 Decimal = CCFixedDecimalToDecimal64(CCFixedDecimalMake(1250, 2));
+    XCTAssertEqual(Decimal.coef, 1250, @"should be the correct result");
+    XCTAssertEqual(Decimal.exp, -2, @"should be the correct result");
+}
+
+-(void) testFixedDecimalArrays
+{
+    const int64_t Values[] = { INT64_MAX, INT64_MAX, 5, INT64_MIN, INT64_MIN, 7, -3, 1, 2, 3 };
+    CCFixedDecimal Result;
+    
+    XCTAssertTrue(CCFixedDecimalSumArray(Values, sizeof(Values) / sizeof(*Values), 2, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 13, @"should be the correct result");
+    XCTAssertEqual(Result.scale, 2, @"should be the correct result");
+    XCTAssertFalse(CCFixedDecimalSumArray(Values, 2, 2, &Result), @"should catch overflow");
+    XCTAssertTrue(CCFixedDecimalSumArray(Values, 0, 2, &Result), @"should not overflow");
+    XCTAssertEqual(Result.units, 0, @"should be the correct result");
+    
+    int64_t A[37], B[37], Out[37];
+    for (size_t Loop = 0; Loop < 37; Loop++)
+    {
+        A[Loop] = (int64_t)Loop * 1000 - 18000;
+        B[Loop] = (int64_t)Loop;
+    }
+    
+    XCTAssertTrue(CCFixedDecimalAddArray(A, B, Out, 37), @"should not overflow");
+    for (size_t Loop = 0; Loop < 37; Loop++) XCTAssertEqual(Out[Loop], (int64_t)Loop * 1001 - 18000, @"should be the correct result");
+    
+    A[20] = INT64_MAX;
+    XCTAssertFalse(CCFixedDecimalAddArray(A, B, Out, 37), @"should catch overflow");
+    
+    XCTAssertTrue(CCFixedDecimalMulArray(B, 2, CCFixedDecimalMake(15, 1), Out, 2, 37, CCDecimalRoundingHalfEven), @"should not overflow");
+    for (size_t Loop = 0; Loop < 37; Loop++)
+    {
+        const int64_t Product = (int64_t)Loop * 15;
+        XCTAssertEqual(Out[Loop], (Product / 10) + ((Product % 10) > 5 || ((Product % 10) == 5 && ((Product / 10) & 1))), @"should be the correct result");
+    }
+    
+    XCTAssertTrue(CCFixedDecimalMulArray(B, 0, CCFixedDecimalMake(25, 1), Out, 3, 37, CCDecimalRoundingDown), @"should not overflow");
+    for (size_t Loop = 0; Loop < 37; Loop++) XCTAssertEqual(Out[Loop], (int64_t)Loop * 2500, @"should be the correct result");
+    
+    XCTAssertFalse(CCFixedDecimalMulArray(A, 0, CCFixedDecimalMake(2, 0), Out, 0, 37, CCDecimalRoundingDown), @"should catch overflow");
+}
+
 @end
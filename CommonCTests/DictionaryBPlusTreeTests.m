@@ -0,0 +1,265 @@
+/*
+ *  Copyright (c) 2024, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <Cocoa/Cocoa.h>
+#import <XCTest/XCTest.h>
+#import "DictionaryBPlusTree.h"
+#import "DictionaryHashMap.h"
+#import "DictionaryTests.h"
+#import "Dictionary.h"
+#import "DictionaryEnumerator.h"
+
+@interface DictionaryBPlusTreeTests : DictionaryTests
+
+@end
+
+static CCComparisonResult SignedComparator(const int *left, const int *right)
+{
+    return *left < *right ? CCComparisonResultAscending : (*left > *right ? CCComparisonResultDescending : CCComparisonResultEqual);
+}
+
+@implementation DictionaryBPlusTreeTests
+
+-(void) setUp
+{
+    [super setUp];
+    self.interface = CCDictionaryBPlusTree;
+}
+
+-(void) assertOrderOfDict: (CCDictionary)dict Count: (size_t)count
+{
+    XCTAssertEqual(CCDictionaryGetCount(dict), count, @"Should have the correct number of entries");
+    
+    size_t Count = 0;
+    uint64_t Prev = 0;
+    CC_DICTIONARY_FOREACH_KEY(uint64_t, Key, dict)
+    {
+        if (Count) XCTAssertLessThan(Prev, Key, @"Should enumerate the keys in ascending order");
+        XCTAssertEqual(*(uint64_t*)CCDictionaryGetEntry(dict, CCDictionaryEnumeratorGetEntry(&CC_DICTIONARY_CURRENT_KEY_ENUMERATOR)), Key * 10, @"Should have the value for the key");
+        Prev = Key;
+        Count++;
+    }
+    
+    XCTAssertEqual(Count, count, @"Should enumerate all the keys");
+    
+    CCEnumerator Enumerator;
+    CCDictionaryGetKeyEnumerator(dict, &Enumerator);
+    
+    Count = 0;
+    for (uint64_t *Key = CCDictionaryEnumeratorGetTail(&Enumerator); Key; Key = CCDictionaryEnumeratorPrevious(&Enumerator))
+    {
+        if (Count) XCTAssertGreaterThan(Prev, *Key, @"Should enumerate the keys in descending order");
+        Prev = *Key;
+        Count++;
+    }
+    
+    XCTAssertEqual(Count, count, @"Should enumerate all the keys");
+}
+
+-(void) testOrdering
+{
+    CCDictionary Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintOrdered, sizeof(uint64_t), sizeof(uint64_t), NULL, self.interface);
+    
+    for (uint64_t Loop = 0; Loop < 2003; Loop++)
+    {
+        const uint64_t Key = (Loop * 7919) % 2003;
+        CCDictionarySetValue(Dict, &Key, &(uint64_t){ Key * 10 });
+    }
+    
+    [self assertOrderOfDict: Dict Count: 2003];
+    
+    for (uint64_t Loop = 0; Loop < 2003; Loop++) XCTAssertEqual(*(uint64_t*)CCDictionaryGetValue(Dict, &Loop), Loop * 10, @"Should contain the correct value for the key");
+    
+    for (uint64_t Loop = 0; Loop < 2003; Loop++)
+    {
+        const uint64_t Key = (Loop * 7919) % 2003;
+        if (Key % 3) CCDictionaryRemoveValue(Dict, &Key);
+    }
+    
+    [self assertOrderOfDict: Dict Count: 668];
+    
+    for (uint64_t Loop = 0; Loop < 2003; Loop++)
+    {
+        if (Loop % 3) XCTAssertEqual(CCDictionaryGetValue(Dict, &Loop), NULL, @"Should have removed the value for the key");
+        else XCTAssertEqual(*(uint64_t*)CCDictionaryGetValue(Dict, &Loop), Loop * 10, @"Should contain the correct value for the key");
+    }
+    
+    for (uint64_t Loop = 0; Loop < 2003; Loop += 3) CCDictionaryRemoveValue(Dict, &Loop);
+    
+    [self assertOrderOfDict: Dict Count: 0];
+    
+    for (uint64_t Loop = 0; Loop < 100; Loop++) CCDictionarySetValue(Dict, &(uint64_t){ 99 - Loop }, &(uint64_t){ (99 - Loop) * 10 });
+    
+    [self assertOrderOfDict: Dict Count: 100];
+    
+    CCDictionaryDestroy(Dict);
+    
+    
+    
+    Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintOrdered, sizeof(int), sizeof(int), &(CCDictionaryCallbacks){
+        .compareKeys = (CCComparator)SignedComparator
+    }, self.interface);
+    
+    for (int Loop = 0; Loop < 200; Loop++) CCDictionarySetValue(Dict, &(int){ (Loop * 37) % 200 - 100 }, &(int){ Loop });
+    
+    int Prev = INT_MIN, Count = 0;
+    CC_DICTIONARY_FOREACH_KEY(int, Key, Dict)
+    {
+        XCTAssertLessThan(Prev, Key, @"Should enumerate the keys in ascending order");
+        Prev = Key;
+        Count++;
+    }
+    
+    XCTAssertEqual(Count, 200, @"Should enumerate all the keys");
+    
+    CCDictionaryDestroy(Dict);
+}
+
+-(void) testRanges
+{
+    CCDictionary Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintOrdered, sizeof(uint64_t), sizeof(uint64_t), NULL, self.interface);
+    
+    CCEnumerable Enumerable;
+    CCDictionaryGetKeyEnumerableInRange(Dict, NULL, NULL, &Enumerable);
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"Should be an empty range");
+    XCTAssertEqual(CCEnumerableGetTail(&Enumerable), NULL, @"Should be an empty range");
+    
+    for (uint64_t Loop = 0; Loop < 1000; Loop += 2) CCDictionarySetValue(Dict, &Loop, &(uint64_t){ Loop * 10 });
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, &(uint64_t){ 100 }, &(uint64_t){ 200 }, &Enumerable);
+    
+    size_t Count = 0;
+    uint64_t Expect = 100;
+    for (uint64_t *Key = CCEnumerableGetCurrent(&Enumerable); Key; Key = CCEnumerableNext(&Enumerable), Expect += 2, Count++) XCTAssertEqual(*Key, Expect, @"Should enumerate the keys in the range");
+    XCTAssertEqual(Count, 50, @"Should enumerate all the keys in the range");
+    
+    Count = 0;
+    Expect = 198;
+    for (uint64_t *Key = CCEnumerableGetTail(&Enumerable); Key; Key = CCEnumerablePrevious(&Enumerable), Expect -= 2, Count++) XCTAssertEqual(*Key, Expect, @"Should enumerate the keys in the range");
+    XCTAssertEqual(Count, 50, @"Should enumerate all the keys in the range");
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, &(uint64_t){ 101 }, &(uint64_t){ 201 }, &Enumerable);
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetCurrent(&Enumerable), 102, @"Should start at the first key in the range");
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetTail(&Enumerable), 200, @"Should end at the last key in the range");
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetHead(&Enumerable), 102, @"Should start at the first key in the range");
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, &(uint64_t){ 990 }, NULL, &Enumerable);
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetCurrent(&Enumerable), 990, @"Should start at the first key in the range");
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetTail(&Enumerable), 998, @"Should end at the last key");
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, NULL, &(uint64_t){ 5 }, &Enumerable);
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetCurrent(&Enumerable), 0, @"Should start at the first key");
+    XCTAssertEqual(*(uint64_t*)CCEnumerableGetTail(&Enumerable), 4, @"Should end at the last key in the range");
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, &(uint64_t){ 300 }, &(uint64_t){ 300 }, &Enumerable);
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"Should be an empty range");
+    XCTAssertEqual(CCEnumerableGetTail(&Enumerable), NULL, @"Should be an empty range");
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, &(uint64_t){ 301 }, &(uint64_t){ 302 }, &Enumerable);
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"Should be an empty range");
+    
+    CCDictionaryGetKeyEnumerableInRange(Dict, &(uint64_t){ 2000 }, NULL, &Enumerable);
+    XCTAssertEqual(CCEnumerableGetCurrent(&Enumerable), NULL, @"Should be an empty range");
+    XCTAssertEqual(CCEnumerableGetTail(&Enumerable), NULL, @"Should be an empty range");
+    
+    CCDictionaryGetValueEnumerableInRange(Dict, &(uint64_t){ 500 }, &(uint64_t){ 510 }, &Enumerable);
+    
+    uint64_t Sum = 0;
+    for (uint64_t *Value = CCEnumerableGetCurrent(&Enumerable); Value; Value = CCEnumerableNext(&Enumerable)) Sum += *Value;
+    XCTAssertEqual(Sum, 5000 + 5020 + 5040 + 5060 + 5080, @"Should enumerate the values in the range");
+    
+    CCDictionaryDestroy(Dict);
+}
+
+-(void) testBulkLoading
+{
+    uint64_t *Keys = malloc(sizeof(uint64_t) * 5000), *Values = malloc(sizeof(uint64_t) * 5000);
+    for (size_t Loop = 0; Loop < 5000; Loop++)
+    {
+        Keys[Loop] = Loop * 3;
+        Values[Loop] = Keys[Loop] * 10;
+    }
+    
+    CCDictionary Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintOrdered, sizeof(uint64_t), sizeof(uint64_t), NULL, self.interface);
+    
+    CCDictionarySetSortedValues(Dict, Keys, Values, 5000);
+    
+    [self assertOrderOfDict: Dict Count: 5000];
+    
+    for (size_t Loop = 0; Loop < 5000; Loop++)
+    {
+        XCTAssertEqual(*(uint64_t*)CCDictionaryGetValue(Dict, &Keys[Loop]), Values[Loop], @"Should contain the correct value for the key");
+        XCTAssertEqual(CCDictionaryGetValue(Dict, &(uint64_t){ Keys[Loop] + 1 }), NULL, @"Should not contain a value for the key");
+    }
+    
+    for (size_t Loop = 0; Loop < 5000; Loop++) CCDictionarySetValue(Dict, &(uint64_t){ Keys[Loop] + 1 }, &(uint64_t){ (Keys[Loop] + 1) * 10 });
+    
+    [self assertOrderOfDict: Dict Count: 10000];
+    
+    for (size_t Loop = 0; Loop < 5000; Loop += 2) CCDictionaryRemoveValue(Dict, &Keys[Loop]);
+    
+    [self assertOrderOfDict: Dict Count: 7500];
+    
+    for (size_t Loop = 0; Loop < 5000; Loop++) Keys[Loop] = (Loop * 3) + 2, Values[Loop] = Keys[Loop] * 10;
+    
+    CCDictionarySetSortedValues(Dict, Keys, Values, 5000);
+    
+    [self assertOrderOfDict: Dict Count: 12500];
+    
+    CCDictionaryDestroy(Dict);
+    
+    
+    
+    Dict = CCDictionaryCreateWithImplementation(CC_STD_ALLOCATOR, CCDictionaryHintOrdered, sizeof(uint64_t), sizeof(uint64_t), NULL, self.interface);
+    
+    for (size_t Count = 1; Count < 300; Count += 7)
+    {
+        CCDictionarySetSortedValues(Dict, Keys, Values, Count);
+        
+        [self assertOrderOfDict: Dict Count: Count];
+        
+        for (size_t Loop = 0; Loop < Count; Loop++) CCDictionaryRemoveValue(Dict, &Keys[Loop]);
+        
+        XCTAssertEqual(CCDictionaryGetCount(Dict), 0, @"Should remove all the entries");
+    }
+    
+    CCDictionaryDestroy(Dict);
+    
+    free(Keys);
+    free(Values);
+}
+
+-(void) testSelectingImplementation
+{
+    CCDictionary Dict = CCDictionaryCreate(CC_STD_ALLOCATOR, CCDictionaryHintOrdered | CCDictionaryHintHeavyFinding, sizeof(int), sizeof(int), NULL);
+    XCTAssertEqual(Dict->interface, CCDictionaryBPlusTree, @"Should use the ordered implementation");
+    CCDictionaryDestroy(Dict);
+    
+    Dict = CCDictionaryCreate(CC_STD_ALLOCATOR, CCDictionaryHintHeavyFinding | CCDictionaryHintHeavyEnumerating, sizeof(int), sizeof(int), NULL);
+    XCTAssertEqual(Dict->interface, CCDictionaryHashMap, @"Should not use the ordered implementation unless ordering is requested");
+    CCDictionaryDestroy(Dict);
+}
+
+@end
@@ -37,7 +37,17 @@ static uintmax_t StringHasher(CCString *Key)
 
 static CCComparisonResult StringComparator(CCString *left, CCString *right)
 {
-    return CCStringEqual(*left, *right) ? CCComparisonResultEqual : CCComparisonResultInvalid;
+    if (CCStringEqual(*left, *right)) return CCComparisonResultEqual;
+    
+    //Order the strings so implementations that maintain key order can use it too
+    const size_t LeftLength = CCStringGetLength(*left), RightLength = CCStringGetLength(*right);
+    for (size_t Loop = 0, Count = LeftLength < RightLength ? LeftLength : RightLength; Loop < Count; Loop++)
+    {
+        const CCChar LeftChar = CCStringGetCharacterAtIndex(*left, Loop), RightChar = CCStringGetCharacterAtIndex(*right, Loop);
+        if (LeftChar != RightChar) return LeftChar < RightChar ? CCComparisonResultAscending : CCComparisonResultDescending;
+    }
+    
+    return LeftLength < RightLength ? CCComparisonResultAscending : CCComparisonResultDescending;
 }
 
 @implementation DictionaryTests
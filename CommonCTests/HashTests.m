@@ -0,0 +1,69 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "Hash.h"
+#import "DataBuffer.h"
+
+@interface HashTests : XCTestCase
+
+@end
+
+@implementation HashTests
+
+static uint32_t CRC32CReference(const uint8_t *Bytes, size_t Size)
+{
+    uint32_t Hash = UINT32_MAX;
+    for (size_t Loop = 0; Loop < Size; Loop++)
+    {
+        Hash ^= Bytes[Loop];
+        for (int Bit = 0; Bit < 8; Bit++) Hash = (Hash >> 1) ^ (0x82f63b78 & -(Hash & 1));
+    }
+    
+    return ~Hash;
+}
+
+-(void) testCRC32C
+{
+    CCData Data = CCDataBufferCreate(CC_STD_ALLOCATOR, CCDataHintRead, 9, "123456789", NULL, NULL);
+    XCTAssertEqual(CCHashCRC32C(Data), 0xe3069283, @"should produce the check value");
+    CCDataDestroy(Data);
+    
+    Data = CCDataBufferCreate(CC_STD_ALLOCATOR, CCDataHintRead, 0, "", NULL, NULL);
+    XCTAssertEqual(CCHashCRC32C(Data), 0, @"should produce the check value");
+    CCDataDestroy(Data);
+    
+    uint8_t Bytes[1031];
+    for (size_t Loop = 0; Loop < sizeof(Bytes); Loop++) Bytes[Loop] = (uint8_t)((Loop * 131) ^ (Loop >> 3));
+    
+    for (size_t Size = 0; Size < sizeof(Bytes); Size += 17)
+    {
+        Data = CCDataBufferCreate(CC_STD_ALLOCATOR, CCDataHintRead, Size, Bytes + 3, NULL, NULL);
+        XCTAssertEqual(CCHashCRC32C(Data), CRC32CReference(Bytes + 3, Size), @"should match the bitwise implementation");
+        CCDataDestroy(Data);
+    }
+}
+
+@end
@@ -0,0 +1,242 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "MathArray.h"
+#import "TaskQueue.h"
+#import "EpochGarbageCollector.h"
+#import <math.h>
+#import <float.h>
+
+@interface MathArrayTests : XCTestCase
+
+@end
+
+#define TEST_COUNT 1031
+
+static float Input[TEST_COUNT + 8], Exponents[TEST_COUNT + 8], Results[TEST_COUNT + 8];
+
+static double Reference(CCMathArrayFunction Function, float a, float b)
+{
+    switch (Function)
+    {
+        case CCMathArrayFunctionSin: return sin(a);
+        case CCMathArrayFunctionCos: return cos(a);
+        case CCMathArrayFunctionExp: return exp(a);
+        case CCMathArrayFunctionLog: return log(a);
+        case CCMathArrayFunctionPow: return pow(a, b);
+    }
+    
+    return NAN;
+}
+
+static void Apply(CCMathArrayFunction Function, const float *a, const float *b, float *Out, size_t Count, CCMathAccuracy Accuracy)
+{
+    switch (Function)
+    {
+        case CCMathArrayFunctionSin: CCMathSinArray(a, Out, Count, Accuracy); break;
+        case CCMathArrayFunctionCos: CCMathCosArray(a, Out, Count, Accuracy); break;
+        case CCMathArrayFunctionExp: CCMathExpArray(a, Out, Count, Accuracy); break;
+        case CCMathArrayFunctionLog: CCMathLogArray(a, Out, Count, Accuracy); break;
+        case CCMathArrayFunctionPow: CCMathPowArray(a, b, Out, Count, Accuracy); break;
+    }
+}
+
+/// Error in ULP of the correctly rounded reference.
+static double ULPError(float Value, double Expect)
+{
+    const float Rounded = (float)Expect;
+    
+    if (isnan(Rounded)) return isnan(Value) ? 0.0 : INFINITY;
+    if (isinf(Rounded) || isinf(Value)) return Value == Rounded ? 0.0 : INFINITY;
+    
+    const float ULP = nextafterf(fabsf(Rounded), INFINITY) - fabsf(Rounded);
+    
+    return fabs((double)Value - Expect) / ULP;
+}
+
+static void FillInput(CCMathArrayFunction Function)
+{
+    for (size_t Loop = 0; Loop < TEST_COUNT + 8; Loop++)
+    {
+        const float t = (float)Loop / (TEST_COUNT + 8);
+        
+        switch (Function)
+        {
+            case CCMathArrayFunctionSin:
+            case CCMathArrayFunctionCos:
+                Input[Loop] = (Loop & 1) ? (t - 0.5f) * 20.0f : (t - 0.5f) * 16000.0f;
+                break;
+                
+            case CCMathArrayFunctionExp:
+                Input[Loop] = (t - 0.5f) * 170.0f;
+                break;
+                
+            case CCMathArrayFunctionLog:
+                Input[Loop] = (Loop & 1) ? t * 4.0f : ldexpf(t + 0.5f, (int)(Loop % 250) - 125);
+                break;
+                
+            case CCMathArrayFunctionPow:
+                Input[Loop] = t * 10.0f;
+                Exponents[Loop] = ((float)(Loop % 97) / 97.0f - 0.5f) * 20.0f;
+                break;
+        }
+    }
+    
+    // Values the vector kernels don't handle
+    switch (Function)
+    {
+        case CCMathArrayFunctionSin:
+        case CCMathArrayFunctionCos:
+            Input[3] = 1e6f;
+            Input[100] = -123456.7f;
+            Input[101] = INFINITY;
+            Input[102] = NAN;
+            Input[103] = -0.0f;
+            
+            // Close to multiples of pi/2, where the range reduction loses the most precision
+            Input[200] = 3.14159274f;
+            Input[201] = 252.898209f;
+            Input[202] = -505.796417f;
+            Input[203] = 4476.76953f;
+            Input[204] = 6371.15f;
+            Input[205] = -6715.1543f;
+            Input[206] = 2238.38477f;
+            break;
+            
+        case CCMathArrayFunctionExp:
+            Input[3] = 88.5f;
+            Input[100] = 100.0f;
+            Input[101] = -95.0f;
+            Input[102] = -INFINITY;
+            Input[103] = NAN;
+            break;
+            
+        case CCMathArrayFunctionLog:
+            Input[3] = 0.0f;
+            Input[100] = -1.0f;
+            Input[101] = 1e-40f;
+            Input[102] = INFINITY;
+            Input[103] = NAN;
+            break;
+            
+        case CCMathArrayFunctionPow:
+            Input[3] = 0.0f;
+            Exponents[100] = 0.0f;
+            break;
+    }
+}
+
+@implementation MathArrayTests
+
+-(void) testBoundedAccuracy
+{
+    for (CCMathArrayFunction Function = CCMathArrayFunctionSin; Function <= CCMathArrayFunctionPow; Function++)
+    {
+        FillInput(Function);
+        
+        for (size_t Offset = 0; Offset < 3; Offset++)
+        {
+            Apply(Function, Input + Offset, Exponents + Offset, Results + Offset, TEST_COUNT, CCMathAccuracyBounded);
+            
+            for (size_t Loop = Offset; Loop < TEST_COUNT + Offset; Loop++)
+            {
+                const double Expect = Reference(Function, Input[Loop], Exponents[Loop]);
+                
+                XCTAssertLessThanOrEqual(ULPError(Results[Loop], Expect), 2.0, @"Function (%d) of %g should be within 2 ULP of the reference", Function, Input[Loop]);
+            }
+        }
+    }
+}
+
+-(void) testPositionIndependence
+{
+    for (CCMathAccuracy Accuracy = CCMathAccuracyFast; Accuracy <= CCMathAccuracyBounded; Accuracy++)
+    {
+        for (CCMathArrayFunction Function = CCMathArrayFunctionSin; Function <= CCMathArrayFunctionPow; Function++)
+        {
+            FillInput(Function);
+            Apply(Function, Input + 1, Exponents + 1, Results + 1, TEST_COUNT, Accuracy);
+            
+            for (size_t Loop = 1; Loop <= TEST_COUNT; Loop += 7)
+            {
+                float Result;
+                Apply(Function, Input + Loop, Exponents + Loop, &Result, 1, Accuracy);
+                
+                XCTAssert(!memcmp(&Result, &Results[Loop], sizeof(float)), @"Function (%d) should produce the same result regardless of the element's position", Function);
+            }
+            
+            // In place
+            float Copy[TEST_COUNT];
+            memcpy(Copy, Results + 1, sizeof(Copy));
+            
+            Apply(Function, Input + 1, Exponents + 1, Input + 1, TEST_COUNT, Accuracy);
+            XCTAssert(!memcmp(Copy, Input + 1, sizeof(Copy)), @"Function (%d) should produce the same results in place", Function);
+        }
+    }
+}
+
+-(void) testFastAccuracy
+{
+    float Values[64], Small[64], Sin[64], Cos[64], Exp[64], Log[64];
+    for (size_t Loop = 0; Loop < 64; Loop++)
+    {
+        Values[Loop] = 0.05f + (float)Loop * 0.1f;
+        Small[Loop] = (float)Loop / 64.0f - 0.5f;
+    }
+    
+    CCMathSinArray(Values, Sin, 64, CCMathAccuracyFast);
+    CCMathCosArray(Values, Cos, 64, CCMathAccuracyFast);
+    CCMathExpArray(Small, Exp, 64, CCMathAccuracyFast);
+    CCMathLogArray(Values, Log, 64, CCMathAccuracyFast);
+    
+    for (size_t Loop = 0; Loop < 64; Loop++)
+    {
+        XCTAssertEqualWithAccuracy(Sin[Loop], sinf(Values[Loop]), 0.01f, @"Should approximate sine");
+        XCTAssertEqualWithAccuracy(Cos[Loop], cosf(Values[Loop]), 0.01f, @"Should approximate cosine");
+        XCTAssertEqualWithAccuracy(Exp[Loop], expf(Small[Loop]), expf(Small[Loop]) * 0.01f, @"Should approximate exp");
+        XCTAssertEqualWithAccuracy(Log[Loop], logf(Values[Loop]), 0.01f, @"Should approximate log");
+    }
+}
+
+-(void) testParallel
+{
+    CCTaskQueue Queue = CCTaskQueueCreate(CC_STD_ALLOCATOR, CCTaskQueueExecuteConcurrently, CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, CCEpochGarbageCollector));
+    
+    for (CCMathArrayFunction Function = CCMathArrayFunctionSin; Function <= CCMathArrayFunctionPow; Function++)
+    {
+        FillInput(Function);
+        Apply(Function, Input, Exponents, Results, TEST_COUNT, CCMathAccuracyBounded);
+        
+        float Parallel[TEST_COUNT];
+        CCMathArrayParallel(Function, Input, Function == CCMathArrayFunctionPow ? Exponents : NULL, Parallel, TEST_COUNT, CCMathAccuracyBounded, 100, Queue);
+        
+        XCTAssert(!memcmp(Parallel, Results, sizeof(Parallel)), @"Function (%d) should produce the same results when split into chunks", Function);
+    }
+    
+    CCTaskQueueDestroy(Queue);
+}
+
+@end
@@ -26,6 +26,7 @@
 #import <XCTest/XCTest.h>
 #define CC_RANDOM_XORSHIFT 1
 #import "Random.h"
+#import <pthread.h>
 
 @interface RandomTests : XCTestCase
 
@@ -95,4 +96,205 @@
     CCDataDestroy(Data);
 }
 
+-(void) testXoshiro256
+{
+    CCRandomState_xoshiro256 State;
+    CCRandomSeed_xoshiro256(&State, 1);
+    
+    CCRandomState_xoshiro256 Jumped = State;
+    
+    XCTAssertEqual(CCRandom_xoshiro256(&State), 0xb3f2af6d0fc710c5, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_xoshiro256(&State), 0x853b559647364cea, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_xoshiro256(&State), 0x92f89756082a4514, @"Should be reproducible");
+    
+    CCRandomJump_xoshiro256(&Jumped);
+    XCTAssertEqual(Jumped.s[0], 0x53d630076a137ded, @"Should jump ahead 2^128 values");
+    XCTAssertEqual(Jumped.s[1], 0xed07f666882edfc6, @"Should jump ahead 2^128 values");
+    XCTAssertEqual(Jumped.s[2], 0x963ec9617b0bdbd3, @"Should jump ahead 2^128 values");
+    XCTAssertEqual(Jumped.s[3], 0x84b96906e4b2569a, @"Should jump ahead 2^128 values");
+    
+    CCRandomState_xoshiro256 Copy = State;
+    uint32_t Values[7];
+    CCRandomFill_xoshiro256(&State, Values, 7);
+    
+    for (size_t Loop = 0; Loop < 7; Loop += 2)
+    {
+        const uint64_t Value = CCRandom_xoshiro256(&Copy);
+        XCTAssertEqual(Values[Loop], (uint32_t)Value, @"Should match the sequence");
+        if (Loop + 1 < 7) XCTAssertEqual(Values[Loop + 1], (uint32_t)(Value >> 32), @"Should match the sequence");
+    }
+    
+    XCTAssertEqual(CCRandom_xoshiro256(&State), CCRandom_xoshiro256(&Copy), @"Should leave the state after the filled values");
+    
+    float Floats[1000];
+    CCRandomFillf_xoshiro256(&State, Floats, 1000);
+    for (size_t Loop = 0; Loop < 1000; Loop++) XCTAssertTrue((Floats[Loop] >= 0.0f) && (Floats[Loop] < 1.0f), @"Should be in range");
+}
+
+-(void) testPCG64
+{
+    CCRandomState_pcg64 State;
+    CCRandomSeedStream_pcg64(&State, 42, 54);
+    
+    XCTAssertEqual(CCRandom_pcg64(&State), 0x86b1da1d72062b68, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_pcg64(&State), 0x1304aa46c9853d39, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_pcg64(&State), 0xa3670e9e0dd50358, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_pcg64(&State), 0xf9090e529a7dae00, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_pcg64(&State), 0xc85b9fd837996f2c, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_pcg64(&State), 0x606121f8e3919196, @"Should be reproducible");
+    
+    CCRandomState_pcg64 Advanced = State;
+    CCRandomAdvance_pcg64(&Advanced, 1000);
+    for (size_t Loop = 0; Loop < 1000; Loop++) CCRandom_pcg64(&State);
+    
+    XCTAssertEqual(CCRandom_pcg64(&Advanced), CCRandom_pcg64(&State), @"Should advance to the same position");
+    
+    CCRandomState_pcg64 Stream;
+    CCRandomSeedStream_pcg64(&Stream, 42, 55);
+    CCRandomSeedStream_pcg64(&State, 42, 54);
+    XCTAssertNotEqual(CCRandom_pcg64(&Stream), CCRandom_pcg64(&State), @"Should produce a different sequence");
+    
+    CCRandomState_pcg64 Copy = State;
+    uint32_t Values[5];
+    CCRandomFill_pcg64(&State, Values, 5);
+    
+    for (size_t Loop = 0; Loop < 5; Loop += 2)
+    {
+        const uint64_t Value = CCRandom_pcg64(&Copy);
+        XCTAssertEqual(Values[Loop], (uint32_t)Value, @"Should match the sequence");
+        if (Loop + 1 < 5) XCTAssertEqual(Values[Loop + 1], (uint32_t)(Value >> 32), @"Should match the sequence");
+    }
+    
+    float Floats[1000];
+    CCRandomFillf_pcg64(&State, Floats, 1000);
+    for (size_t Loop = 0; Loop < 1000; Loop++) XCTAssertTrue((Floats[Loop] >= 0.0f) && (Floats[Loop] < 1.0f), @"Should be in range");
+}
+
+-(void) testPhilox
+{
+    uint32_t Block[4];
+    
+    CCRandomBlock_philox((uint32_t[4]){ 0, 0, 0, 0 }, (uint32_t[2]){ 0, 0 }, Block);
+    XCTAssertEqual(Block[0], 0x6627e8d5, @"Should match the known answer");
+    XCTAssertEqual(Block[1], 0xe169c58d, @"Should match the known answer");
+    XCTAssertEqual(Block[2], 0xbc57ac4c, @"Should match the known answer");
+    XCTAssertEqual(Block[3], 0x9b00dbd8, @"Should match the known answer");
+    
+    CCRandomBlock_philox((uint32_t[4]){ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff }, (uint32_t[2]){ 0xffffffff, 0xffffffff }, Block);
+    XCTAssertEqual(Block[0], 0x408f276d, @"Should match the known answer");
+    XCTAssertEqual(Block[1], 0x41c83b0e, @"Should match the known answer");
+    XCTAssertEqual(Block[2], 0xa20bc7c6, @"Should match the known answer");
+    XCTAssertEqual(Block[3], 0x6d5451fd, @"Should match the known answer");
+    
+    CCRandomBlock_philox((uint32_t[4]){ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }, (uint32_t[2]){ 0xa4093822, 0x299f31d0 }, Block);
+    XCTAssertEqual(Block[0], 0xd16cfe09, @"Should match the known answer");
+    XCTAssertEqual(Block[1], 0x94fdcceb, @"Should match the known answer");
+    XCTAssertEqual(Block[2], 0x5001e420, @"Should match the known answer");
+    XCTAssertEqual(Block[3], 0x24126ea1, @"Should match the known answer");
+    
+    CCRandomState_philox State;
+    CCRandomSeed_philox(&State, 0);
+    
+    XCTAssertEqual(CCRandom_philox(&State), 0x6627e8d5, @"Should be reproducible");
+    XCTAssertEqual(CCRandom_philox(&State), 0xe169c58d, @"Should be reproducible");
+    
+    CCRandomState_philox Copy = State;
+    uint32_t Values[3 + 64 + 3];
+    CCRandomFill_philox(&State, Values, 3);
+    CCRandomFill_philox(&State, Values + 3, 64);
+    CCRandomFill_philox(&State, Values + 67, 3);
+    
+    for (size_t Loop = 0; Loop < sizeof(Values) / sizeof(*Values); Loop++) XCTAssertEqual(Values[Loop], CCRandom_philox(&Copy), @"Should match the sequence");
+    
+    XCTAssertEqual(CCRandom_philox(&State), CCRandom_philox(&Copy), @"Should leave the state after the filled values");
+    
+    CCRandomJump_philox(&State);
+    XCTAssertEqual(State.counter[2], 1, @"Should jump ahead 2^64 blocks");
+    CCRandomLongJump_philox(&State);
+    XCTAssertEqual(State.counter[3], 1, @"Should jump ahead 2^96 blocks");
+    
+    CCRandomSeed_philox(&State, 0);
+    State.counter[0] = State.counter[1] = State.counter[2] = State.counter[3] = 0xffffffff;
+    CCRandomFill_philox(&State, Values, 32);
+    XCTAssertEqual(State.counter[0], 7, @"Should wrap the counter");
+    CCRandomBlock_philox((uint32_t[4]){ 3, 0, 0, 0 }, State.key, Block);
+    XCTAssertEqual(Values[16], Block[0], @"Should wrap the counter");
+    
+    float Floats[1000];
+    CCRandomFillf_philox(&State, Floats, 1000);
+    for (size_t Loop = 0; Loop < 1000; Loop++) XCTAssertTrue((Floats[Loop] >= 0.0f) && (Floats[Loop] < 1.0f), @"Should be in range");
+}
+
+static void *RandomThread(void *Arg)
+{
+    uint32_t *Values = Arg;
+    for (size_t Loop = 0; Loop < 4; Loop++) Values[Loop] = CCRandom();
+    
+    return NULL;
+}
+
+-(void) testThreadState
+{
+    CCRandom();
+    typeof(CCRandomState) State = CCRandomState;
+    
+    pthread_t Threads[4];
+    uint32_t Values[4][4];
+    for (size_t Loop = 0; Loop < 4; Loop++) pthread_create(Threads + Loop, NULL, RandomThread, Values[Loop]);
+    for (size_t Loop = 0; Loop < 4; Loop++) pthread_join(Threads[Loop], NULL);
+    
+    XCTAssertEqual(memcmp(&State, &CCRandomState, sizeof(State)), 0, @"Should not modify the state of other threads");
+    
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        for (size_t Loop2 = Loop + 1; Loop2 < 4; Loop2++)
+        {
+            XCTAssertNotEqual(memcmp(Values[Loop], Values[Loop2], sizeof(*Values)), 0, @"Should use a unique seed for each thread");
+        }
+    }
+}
+
+-(void) testGenerator
+{
+    CCRandomGenerator Generator = CCRandomGeneratorCreate(CC_STD_ALLOCATOR, 1);
+    
+    XCTAssertEqual(CCRandomGeneratorNext(Generator), 0xb3f2af6d, @"Should be reproducible");
+    XCTAssertEqual(CCRandomGeneratorNext(Generator), 0x853b5596, @"Should be reproducible");
+    
+    CCRandomState_xoshiro256 State;
+    CCRandomSeed_xoshiro256(&State, 1);
+    CCRandom_xoshiro256(&State);
+    CCRandom_xoshiro256(&State);
+    
+    CCRandomState_xoshiro256 Copy = State;
+    CCRandomGenerator Stream = CCRandomGeneratorCreateStream(CC_STD_ALLOCATOR, Generator);
+    XCTAssertEqual(CCRandomGeneratorNext(Stream), (uint32_t)(CCRandom_xoshiro256(&Copy) >> 32), @"Should continue from the parent");
+    
+    CCRandomJump_xoshiro256(&State);
+    XCTAssertEqual(CCRandomGeneratorNext(Generator), (uint32_t)(CCRandom_xoshiro256(&State) >> 32), @"Should jump the parent");
+    
+    CCRandomGeneratorSeed(Stream, 1);
+    CCRandomGeneratorSeed(Generator, 1);
+    
+    uint32_t Values[5];
+    CCRandomGeneratorFill(Generator, Values, 5);
+    XCTAssertEqual(Values[0], 0x0fc710c5, @"Should be reproducible");
+    XCTAssertEqual(Values[1], 0xb3f2af6d, @"Should be reproducible");
+    
+    for (size_t Loop = 0; Loop < 1000; Loop++)
+    {
+        const int32_t Value = CCRandomGeneratorRangei(Stream, -5, 5);
+        XCTAssertTrue((Value >= -5) && (Value <= 5), @"Should be in range");
+        
+        const float Valuef = CCRandomGeneratorRangef(Stream, 2.0f, 3.0f);
+        XCTAssertTrue((Valuef >= 2.0f) && (Valuef <= 3.0f), @"Should be in range");
+        
+        const CCVector2D Point = CCRandomGeneratorPointInCircle(Stream, (CCVector2D){ 1.0f, 1.0f }, 2.0f);
+        XCTAssertTrue(CCVector2Distance(Point, (CCVector2D){ 1.0f, 1.0f }) <= 2.0001f, @"Should be in range");
+    }
+    
+    CCRandomGeneratorDestroy(Stream);
+    CCRandomGeneratorDestroy(Generator);
+}
+
 @end
@@ -39,6 +39,8 @@
 #import "Dictionary.h"
 #import "Swap.h"
 #import "ReflectStream.h"
+#import "ReflectChunked.h"
+#import "EpochGarbageCollector.h"
 
 @interface ReflectTests : XCTestCase
 
@@ -2710,6 +2712,30 @@ void MemoryDestructorCallbackUnmaps(CCReflectType Type, CCReflectType MappedType
     CCBigIntFastDestroy(BigIntFast);
     
     
+    BigIntFast = CCBigIntFastCreate(CC_STD_ALLOCATOR);
+    
+    CCBigIntFastSet(&BigIntFast, CC_STRING("0x10000000000000000000000000"));
+    
+    XCTAssertFalse(CCBigIntFastIsTaggedValue(BigIntFast), @"should not be a tagged value");
+    
+    CCMemoryZoneSave(Zone);
+    CCReflectSerializeBinary(&CC_REFLECT(CCBigIntFast), &BigIntFast, CCReflectEndianNative, SIZE_MAX, &(size_t){ 0 }, StreamWriter, Zone);
+    
+    CCBigIntFastDestroy(BigIntFast);
+    BigIntFast = NULL;
+    
+    CCReflectDeserializeBinary(&CC_REFLECT(CCBigIntFast), &BigIntFast, CCReflectEndianNative, SIZE_MAX, &(size_t){ 0 }, StreamReader, Zone, CC_STD_ALLOCATOR);
+    CCMemoryZoneRestore(Zone);
+    
+    Memory = CCMemoryZoneAllocate(Zone, 1024);
+    memset(Memory, 0, 1024);
+    CCMemoryZoneDeallocate(Zone, 1024);
+    
+    XCTAssertTrue(CCBigIntFastCompareEqual(BigIntFast, CC_STRING("0x10000000000000000000000000")), @"should deserialise the value correctly");
+    
+    CCBigIntFastDestroy(BigIntFast);
+    
+    
     BigIntFast = CCBigIntFastCreate(CC_STD_ALLOCATOR);
     
     CCBigIntFastSet(&BigIntFast, CC_STRING("0x80000000000000000000000000000000"));
@@ -3888,4 +3914,408 @@ static CCReflectType DeserializeBinaryTypeLookup(uint8_t Index, CCMemoryZone Zon
     FSPathDestroy(Path);
 }
 
+struct CompiledBar {
+    uint8_t a;
+    uint32_t b;
+    int16_t c;
+    float d;
+    uint16_t e[3];
+    struct Foo foo[6];
+};
+
+-(void) testCompiledSerializer
+{
+    CCMemoryZone Zone = CCMemoryZoneCreate(CC_STD_ALLOCATOR, 1024);
+    
+    const CCReflectStruct6 Type = CC_REFLECT_STRUCT(struct CompiledBar,
+        (a, &CC_REFLECT(uint8_t)),
+        (b, &TestNativeU32),
+        (c, &CC_REFLECT_SIGNED_FIXED_WIDTH_INTEGER(int16_t, CCReflectEndianBig)),
+        (d, &CC_REFLECT(float)),
+        (e, &CC_REFLECT_ARRAY(&CC_REFLECT_UNSIGNED_FIXED_WIDTH_INTEGER(uint16_t, CCReflectEndianLittle), 3)),
+        (foo, &CC_REFLECT_ARRAY(&TestFoo, 6))
+    );
+    
+    struct Foo Next = { .x = 100, .y = 200, .next = NULL };
+    struct CompiledBar Bar = { .a = 1, .b = 0x12345678, .c = -300, .d = 1.5f, .e = { 1, 0x100, 0xffff } };
+    
+    for (size_t Loop = 0; Loop < 6; Loop++)
+    {
+        Bar.foo[Loop] = (struct Foo){ .x = (uint32_t)Loop, .y = (uint32_t)Loop * 1000, .next = (Loop % 2) ? &Next : NULL };
+    }
+    
+    const CCReflectEndian Endianness[] = { CCReflectEndianNative, CCReflectEndianLittle, CCReflectEndianBig };
+    const size_t PreferVariableLength[] = { SIZE_MAX, 4, 2, 1 };
+    
+    for (size_t Loop = 0; Loop < sizeof(Endianness) / sizeof(*Endianness); Loop++)
+    {
+        for (size_t Loop2 = 0; Loop2 < sizeof(PreferVariableLength) / sizeof(*PreferVariableLength); Loop2++)
+        {
+            uint8_t Expected[sizeof(StreamData) / 2];
+            
+            size_t ExpectedSize = 0;
+            CCReflectSerializeBinary(&Type, &Bar, Endianness[Loop], PreferVariableLength[Loop2], &ExpectedSize, StreamWriter, Zone);
+            memcpy(Expected, StreamData, ExpectedSize);
+            
+            CCReflectSerializer Serializer = CCReflectCompileSerializer(CC_STD_ALLOCATOR, &Type, Endianness[Loop], PreferVariableLength[Loop2]);
+            
+            size_t Size = 0;
+            CCReflectSerializerSerialize(Serializer, &Bar, &Size, StreamWriter, Zone);
+            
+            XCTAssertEqual(Size, ExpectedSize, @"should serialize the same amount of data as the interpreted serializer");
+            XCTAssertTrue(!memcmp(StreamData, Expected, ExpectedSize), @"should serialize the same data as the interpreted serializer");
+            
+            struct CompiledBar Result;
+            memset(&Result, 0, sizeof(Result));
+            
+            CCMemoryZoneSave(Zone);
+            CCReflectSerializerDeserialize(Serializer, &Result, &(size_t){ 0 }, StreamReader, Zone, CC_STD_ALLOCATOR);
+            CCMemoryZoneRestore(Zone);
+            
+            XCTAssertEqual(Result.a, Bar.a, @"should deserialize the value correctly");
+            XCTAssertEqual(Result.b, Bar.b, @"should deserialize the value correctly");
+            XCTAssertEqual(Result.c, Bar.c, @"should deserialize the value correctly");
+            XCTAssertEqual(Result.d, Bar.d, @"should deserialize the value correctly");
+            XCTAssertEqual(Result.e[0], Bar.e[0], @"should deserialize the value correctly");
+            XCTAssertEqual(Result.e[1], Bar.e[1], @"should deserialize the value correctly");
+            XCTAssertEqual(Result.e[2], Bar.e[2], @"should deserialize the value correctly");
+            
+            for (size_t Loop3 = 0; Loop3 < 6; Loop3++)
+            {
+                XCTAssertEqual(Result.foo[Loop3].x, Bar.foo[Loop3].x, @"should deserialize the value correctly");
+                XCTAssertEqual(Result.foo[Loop3].y, Bar.foo[Loop3].y, @"should deserialize the value correctly");
+                
+                if (Bar.foo[Loop3].next)
+                {
+                    XCTAssertEqual(Result.foo[Loop3].next->x, Next.x, @"should deserialize the value correctly");
+                    XCTAssertEqual(Result.foo[Loop3].next->y, Next.y, @"should deserialize the value correctly");
+                    XCTAssertEqual(Result.foo[Loop3].next->next, NULL, @"should deserialize the value correctly");
+                    
+                    CCFree(Result.foo[Loop3].next);
+                }
+                
+                else XCTAssertEqual(Result.foo[Loop3].next, NULL, @"should deserialize the value correctly");
+            }
+            
+            CCReflectSerializerDestroy(Serializer);
+        }
+    }
+    
+    CCMemoryZoneDestroy(Zone);
+}
+
+static void TestVectorWriter(void *Stream, const CCReflectStreamVectorBuffer *Buffers, size_t Count)
+{
+    (*(size_t*)Stream)++;
+    
+    for (size_t Loop = 0; Loop < Count; Loop++)
+    {
+        StreamWriter(&((size_t*)Stream)[1], Buffers[Loop].data, Buffers[Loop].size);
+    }
+}
+
+-(void) testMemoryStreams
+{
+    CCMemoryZone Zone = CCMemoryZoneCreate(CC_STD_ALLOCATOR, 1024);
+    
+    uint32_t Values[64], Result[64];
+    for (size_t Loop = 0; Loop < 64; Loop++) Values[Loop] = (uint32_t)(Loop * 0x01010101);
+    
+    const CCReflectArray Type = CC_REFLECT_ARRAY(&TestNativeU32, 64);
+    
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, 1, 256);
+    CCReflectSerializeBinary(&Type, Values, CCReflectEndianBig, SIZE_MAX, Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Zone);
+    
+    XCTAssertEqual(CCArrayGetCount(Array), sizeof(Values), @"should write all of the data");
+    
+    CCReflectStreamMemory Memory = CC_REFLECT_STREAM_MEMORY(CCArrayGetData(Array), CCArrayGetCount(Array));
+    CCReflectDeserializeBinary(&Type, Result, CCReflectEndianBig, SIZE_MAX, &Memory, (CCReflectStreamReader)CCReflectStreamMemoryRead, Zone, CC_STD_ALLOCATOR);
+    
+    XCTAssertTrue(!memcmp(Values, Result, sizeof(Values)), @"should read the data correctly");
+    XCTAssertEqual(Memory.offset, sizeof(Values), @"should read all of the data");
+    XCTAssertEqual(Memory.failure.count, 0, @"should not fail");
+    
+    CCReflectStreamMemoryRead(&Memory, Result, 1);
+    XCTAssertEqual(Memory.failure.count, 1, @"should fail to read past the end");
+    
+    uint8_t Fixed[8];
+    Memory = CC_REFLECT_STREAM_MEMORY(Fixed, sizeof(Fixed));
+    CCReflectStreamMemoryWrite(&Memory, (uint8_t[]){ 1, 2, 3, 4, 5 }, 5);
+    CCReflectStreamMemoryWrite(&Memory, (uint8_t[]){ 6, 7, 8, 9 }, 4);
+    
+    XCTAssertEqual(Memory.offset, 5, @"should not write past the end");
+    XCTAssertEqual(Memory.failure.count, 1, @"should fail to write past the end");
+    XCTAssertTrue(!memcmp(Fixed, (uint8_t[]){ 1, 2, 3, 4, 5 }, 5), @"should write the data correctly");
+    
+    
+    size_t Size = 0;
+    uint8_t Buffer[100];
+    CCReflectStreamBuffered Buffered = CC_REFLECT_STREAM_WRITE_BUFFERED(&Size, StreamWriter, Buffer, sizeof(Buffer));
+    
+    CCReflectSerializeBinary(&Type, Values, CCReflectEndianBig, SIZE_MAX, &Buffered, (CCReflectStreamWriter)CCReflectStreamBufferedWrite, Zone);
+    
+    XCTAssertEqual(Size, 200, @"should only write full buffers");
+    
+    CCReflectStreamBufferedWriteFlush(&Buffered);
+    
+    XCTAssertEqual(Size, sizeof(Values), @"should write the remaining data");
+    XCTAssertTrue(!memcmp(StreamData, CCArrayGetData(Array), sizeof(Values)), @"should write the data correctly");
+    
+    CCReflectStreamBufferedWrite(&Buffered, Values, sizeof(Values));
+    
+    XCTAssertEqual(Size, sizeof(Values) * 2, @"should write data larger than the buffer directly");
+    
+    
+    size_t VectorStream[2] = { 0, 0 };
+    CCReflectStreamVectorBuffer Vectors[4];
+    CCReflectStreamVector Vector = CC_REFLECT_STREAM_WRITE_VECTOR(VectorStream, TestVectorWriter, Vectors, 4, Buffer, sizeof(Buffer), SIZE_MAX);
+    
+    CCReflectSerializeBinary(&Type, Values, CCReflectEndianBig, SIZE_MAX, &Vector, (CCReflectStreamWriter)CCReflectStreamVectorWrite, Zone);
+    CCReflectStreamVectorWriteFlush(&Vector);
+    
+    XCTAssertEqual(VectorStream[0], 3, @"should only write when the staging buffer is full");
+    XCTAssertEqual(VectorStream[1], sizeof(Values), @"should write all of the data");
+    XCTAssertTrue(!memcmp(StreamData, CCArrayGetData(Array), sizeof(Values)), @"should write the data correctly");
+    
+    VectorStream[0] = 0;
+    VectorStream[1] = 0;
+    Vector.reference = 16;
+    
+    CCReflectStreamVectorWrite(&Vector, (uint8_t[]){ 1, 2 }, 2);
+    CCReflectStreamVectorWrite(&Vector, Values, 16);
+    CCReflectStreamVectorWrite(&Vector, (uint8_t[]){ 3, 4 }, 2);
+    CCReflectStreamVectorWrite(&Vector, (uint8_t[]){ 5 }, 1);
+    
+    XCTAssertEqual(Vector.vectors.count, 3, @"should merge contiguous staged writes");
+    
+    CCReflectStreamVectorWrite(&Vector, Values + 4, 16);
+    CCReflectStreamVectorWrite(&Vector, (uint8_t[]){ 6 }, 1);
+    
+    XCTAssertEqual(VectorStream[0], 1, @"should write when the vectors are full");
+    
+    CCReflectStreamVectorWriteFlush(&Vector);
+    
+    XCTAssertEqual(VectorStream[0], 2, @"should write the remaining vectors");
+    XCTAssertEqual(VectorStream[1], 38, @"should write all of the data");
+    XCTAssertTrue(!memcmp(StreamData, (uint8_t[]){ 1, 2 }, 2), @"should write the data correctly");
+    XCTAssertTrue(!memcmp(StreamData + 2, Values, 16), @"should write the data correctly");
+    XCTAssertTrue(!memcmp(StreamData + 18, (uint8_t[]){ 3, 4, 5 }, 3), @"should write the data correctly");
+    XCTAssertTrue(!memcmp(StreamData + 21, Values + 4, 16), @"should write the data correctly");
+    XCTAssertTrue(!memcmp(StreamData + 37, (uint8_t[]){ 6 }, 1), @"should write the data correctly");
+    
+    CCArrayDestroy(Array);
+    CCMemoryZoneDestroy(Zone);
+}
+
+-(void) testView
+{
+    CCMemoryZone Zone = CCMemoryZoneCreate(CC_STD_ALLOCATOR, 1024);
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, 1, 64);
+    
+    struct Foo C = { .x = 5, .y = 6, .next = NULL }, B = { .x = 3, .y = 4, .next = &C }, A = { .x = 1, .y = 2, .next = &B };
+    CCReflectSerializeBinary(&TestFoo, &A, CCReflectEndianBig, SIZE_MAX, Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Zone);
+    
+    CCReflectView View = CCReflectViewCreate(CC_STD_ALLOCATOR, &TestFoo, CCReflectEndianBig, SIZE_MAX, CCArrayGetData(Array), CCArrayGetCount(Array));
+    
+    XCTAssertTrue(View, @"should create a view");
+    XCTAssertEqual(CCReflectViewGetSize(View), CCArrayGetCount(Array), @"should cover all of the data");
+    
+    CCReflectViewValue Node = CCReflectViewGetRoot(View);
+    for (uint32_t Loop = 0; Loop < 3; Loop++)
+    {
+        CCReflectViewValue Field;
+        XCTAssertTrue(CCReflectViewGetField(Node, CC_STRING("y"), &Field), @"should find the field");
+        XCTAssertFalse(CCReflectViewGetField(Node, CC_STRING("z"), &Field), @"should not find the field");
+        
+        uint32_t Value;
+        CCReflectViewRead(CCReflectViewGetChild(Node, 1), &Value, Zone, CC_STD_ALLOCATOR);
+        XCTAssertEqual(Value, (Loop * 2) + 2, @"should read the value in place");
+        XCTAssertTrue(!memcmp(CCReflectViewGetData(CCReflectViewGetChild(Node, 0)), (uint8_t[]){ 0, 0, 0, (Loop * 2) + 1 }, 4), @"should locate the value");
+        
+        CCReflectViewValue Next = CCReflectViewGetChild(Node, 2);
+        XCTAssertEqual(CCReflectViewGetCount(Next), Loop < 2, @"should have the correct number of pointees");
+        
+        if (Loop < 2) Node = CCReflectViewGetChild(Next, 0);
+    }
+    
+    struct Foo Copy;
+    CCReflectViewRead(CCReflectViewGetChild(CCReflectViewGetChild(CCReflectViewGetRoot(View), 2), 0), &Copy, Zone, CC_STD_ALLOCATOR);
+    XCTAssertEqual(Copy.x, 3, @"should read the value");
+    XCTAssertEqual(Copy.next->y, 6, @"should read the value");
+    XCTAssertEqual(Copy.next->next, NULL, @"should read the value");
+    CCFree(Copy.next);
+    
+    CCReflectViewDestroy(View);
+    
+    XCTAssertEqual(CCReflectViewCreate(CC_STD_ALLOCATOR, &TestFoo, CCReflectEndianBig, SIZE_MAX, CCArrayGetData(Array), CCArrayGetCount(Array) - 1), NULL, @"should fail to validate truncated data");
+    
+    
+    CCArray Values = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(uint32_t), 16);
+    for (uint32_t Loop = 0; Loop < 100; Loop++) CCArrayAppendElement(Values, &(uint32_t){ Loop * Loop * Loop });
+    
+    CCEnumerable Enumerable;
+    CCArrayGetEnumerable(Values, &Enumerable);
+    
+    const CCReflectEnumerable Types[2] = { CC_REFLECT_ENUMERABLE(&TestNativeU32), CC_REFLECT_ENUMERABLE(&TestNativeU32, .count = 100) };
+    const size_t Prefer[2] = { 0, SIZE_MAX };
+    
+    for (size_t Loop = 0; Loop < 4; Loop++)
+    {
+        CCArrayRemoveAllElements(Array);
+        CCReflectSerializeBinary(&Types[Loop % 2], &Enumerable, CCReflectEndianLittle, Prefer[Loop / 2], Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Zone);
+        
+        View = CCReflectViewCreate(CC_STD_ALLOCATOR, &Types[Loop % 2], CCReflectEndianLittle, Prefer[Loop / 2], CCArrayGetData(Array), CCArrayGetCount(Array));
+        
+        XCTAssertTrue(View, @"should create a view");
+        XCTAssertEqual(CCReflectViewGetCount(CCReflectViewGetRoot(View)), 100, @"should have the correct number of elements");
+        
+        for (size_t Index = 0; Index < 100; Index++)
+        {
+            uint32_t Value;
+            CCReflectViewRead(CCReflectViewGetChild(CCReflectViewGetRoot(View), Index), &Value, Zone, CC_STD_ALLOCATOR);
+            XCTAssertEqual(Value, *(uint32_t*)CCArrayGetElementAtIndex(Values, Index), @"should read the element in place");
+        }
+        
+        CCReflectViewDestroy(View);
+    }
+    
+    CCArrayDestroy(Values);
+    CCArrayDestroy(Array);
+    CCMemoryZoneDestroy(Zone);
+}
+
+-(void) testChunked
+{
+    CCMemoryZone Zone = CCMemoryZoneCreate(CC_STD_ALLOCATOR, 1024);
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, 1, 64);
+    CCTaskQueue Queue = CCTaskQueueCreate(CC_STD_ALLOCATOR, CCTaskQueueExecuteConcurrently, CCConcurrentGarbageCollectorCreate(CC_STD_ALLOCATOR, CCEpochGarbageCollector));
+    
+    struct Foo Tail = { .x = 7, .y = 8, .next = NULL }, Values[1000];
+    for (uint32_t Loop = 0; Loop < 1000; Loop++) Values[Loop] = (struct Foo){ .x = Loop, .y = Loop * 3, .next = (Loop % 7) ? NULL : &Tail };
+    
+    const CCReflectArray Type = CC_REFLECT_ARRAY(&TestFoo, 1000);
+    CCReflectSerializeBinaryChunked(&Type, Values, 64, CCReflectEndianBig, 0, Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Queue);
+    
+    struct Foo Result[1000];
+    CCReflectStreamMemory Memory = CC_REFLECT_STREAM_MEMORY(CCArrayGetData(Array), CCArrayGetCount(Array));
+    XCTAssertTrue(CCReflectDeserializeBinaryChunked(&Type, Result, CCReflectEndianBig, 0, &Memory, (CCReflectStreamReader)CCReflectStreamMemoryRead, Queue, Zone, CC_STD_ALLOCATOR), @"should deserialize the chunks");
+    XCTAssertEqual(Memory.offset, CCArrayGetCount(Array), @"should read all of the data");
+    
+    for (uint32_t Loop = 0; Loop < 1000; Loop++)
+    {
+        XCTAssertEqual(Result[Loop].x, Loop, @"should deserialize the element");
+        XCTAssertEqual(Result[Loop].y, Loop * 3, @"should deserialize the element");
+        
+        if (Loop % 7) XCTAssertEqual(Result[Loop].next, NULL, @"should deserialize the element");
+        else
+        {
+            XCTAssertEqual(Result[Loop].next->x, 7, @"should deserialize the element");
+            XCTAssertEqual(Result[Loop].next->y, 8, @"should deserialize the element");
+            XCTAssertEqual(Result[Loop].next->next, NULL, @"should deserialize the element");
+            
+            CCFree(Result[Loop].next);
+        }
+    }
+    
+    CCReflectChunkedIndex *Index = CCReflectChunkedIndexCreate(CC_STD_ALLOCATOR, CCArrayGetData(Array), CCArrayGetCount(Array));
+    
+    XCTAssertTrue(Index, @"should create the index");
+    XCTAssertEqual(Index->count, 1000, @"should have the correct number of elements");
+    XCTAssertEqual(Index->chunks, 16, @"should have the correct number of chunks");
+    XCTAssertEqual(Index->offsets[16], CCArrayGetCount(Array), @"should end at the end of the data");
+    
+    XCTAssertEqual(CCReflectDeserializeBinaryChunk(Index, 15, &TestFoo, Result, CCArrayGetData(Array), CCReflectEndianBig, 0, Zone, CC_STD_ALLOCATOR), 40, @"should deserialize the remaining elements");
+    XCTAssertEqual(Result[0].x, 960, @"should deserialize the element");
+    XCTAssertEqual(Result[39].y, 999 * 3, @"should deserialize the element");
+    
+    CCReflectChunkedIndexDestroy(Index);
+    
+    XCTAssertEqual(CCReflectChunkedIndexCreate(CC_STD_ALLOCATOR, CCArrayGetData(Array), CCArrayGetCount(Array) - 1), NULL, @"should fail to index truncated data");
+    
+    
+    CCArray Elements = CCArrayCreate(CC_STD_ALLOCATOR, sizeof(uint32_t), 16);
+    for (uint32_t Loop = 0; Loop < 100; Loop++) CCArrayAppendElement(Elements, &Loop);
+    
+    CCEnumerable Enumerable;
+    CCArrayGetEnumerable(Elements, &Enumerable);
+    
+    CCArrayRemoveAllElements(Array);
+    CCReflectSerializeBinaryChunked(&CC_REFLECT_ENUMERABLE(&TestNativeU32), &Enumerable, 30, CCReflectEndianLittle, SIZE_MAX, Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Queue);
+    
+    Memory = CC_REFLECT_STREAM_MEMORY(CCArrayGetData(Array), CCArrayGetCount(Array));
+    XCTAssertTrue(CCReflectDeserializeBinaryChunked(&CC_REFLECT_ENUMERABLE(&TestNativeU32), &Enumerable, CCReflectEndianLittle, SIZE_MAX, &Memory, (CCReflectStreamReader)CCReflectStreamMemoryRead, Queue, Zone, CC_STD_ALLOCATOR), @"should deserialize the chunks");
+    
+    uint32_t Count = 0;
+    for (const uint32_t *Element = CCEnumerableGetCurrent(&Enumerable); Element; Element = CCEnumerableNext(&Enumerable), Count++)
+    {
+        XCTAssertEqual(*Element, Count, @"should deserialize the element");
+    }
+    
+    XCTAssertEqual(Count, 100, @"should deserialize all of the elements");
+    
+    CCArrayDestroy(Elements);
+    CCTaskQueueDestroy(Queue);
+    CCArrayDestroy(Array);
+    CCMemoryZoneDestroy(Zone);
+}
+
+-(void) testLZStream
+{
+    CCMemoryZone Zone = CCMemoryZoneCreate(CC_STD_ALLOCATOR, 1024);
+    CCArray Array = CCArrayCreate(CC_STD_ALLOCATOR, 1, 1024);
+    
+    struct Foo Values[2000];
+    for (uint32_t Loop = 0; Loop < 2000; Loop++) Values[Loop] = (struct Foo){ .x = Loop % 10, .y = 1234, .next = NULL };
+    
+    const CCReflectArray Type = CC_REFLECT_ARRAY(&TestFoo, 2000);
+    
+    _Alignas(uint32_t) uint8_t Buffer[CC_REFLECT_STREAM_WRITE_LZ_BUFFER_SIZE(4096)];
+    CCReflectStreamLZ Stream = CC_REFLECT_STREAM_WRITE_LZ(Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Buffer, 4096);
+    
+    CCReflectSerializeBinary(&Type, Values, CCReflectEndianLittle, SIZE_MAX, &Stream, (CCReflectStreamWriter)CCReflectStreamLZWrite, Zone);
+    CCReflectStreamLZWriteFlush(&Stream);
+    
+    XCTAssertLessThan(CCArrayGetCount(Array), 2000 * 9 / 4, @"should compress the data");
+    
+    struct Foo Result[2000];
+    CCReflectStreamMemory Memory = CC_REFLECT_STREAM_MEMORY(CCArrayGetData(Array), CCArrayGetCount(Array));
+    Stream = CC_REFLECT_STREAM_READ_LZ(&Memory, (CCReflectStreamReader)CCReflectStreamMemoryRead, Buffer, 4096);
+    
+    CCReflectDeserializeBinary(&Type, Result, CCReflectEndianLittle, SIZE_MAX, &Stream, (CCReflectStreamReader)CCReflectStreamLZRead, Zone, CC_STD_ALLOCATOR);
+    
+    XCTAssertEqual(Stream.failure.count, 0, @"should not fail");
+    XCTAssertEqual(Memory.offset, CCArrayGetCount(Array), @"should read all of the blocks");
+    
+    for (uint32_t Loop = 0; Loop < 2000; Loop++)
+    {
+        XCTAssertEqual(Result[Loop].x, Loop % 10, @"should decompress the data");
+        XCTAssertEqual(Result[Loop].y, 1234, @"should decompress the data");
+    }
+    
+    uint8_t Data[5000];
+    uint32_t Seed = 1;
+    for (size_t Loop = 0; Loop < sizeof(Data); Loop++) Data[Loop] = (Seed = (Seed * 1103515245) + 12345) >> 16;
+    
+    CCArrayRemoveAllElements(Array);
+    Stream = CC_REFLECT_STREAM_WRITE_LZ(Array, (CCReflectStreamWriter)CCReflectStreamArrayWrite, Buffer, 4096);
+    CCReflectStreamLZWrite(&Stream, Data, sizeof(Data));
+    CCReflectStreamLZWriteFlush(&Stream);
+    
+    XCTAssertEqual(CCArrayGetCount(Array), sizeof(Data) + 16, @"should store incompressible blocks");
+    
+    uint8_t Decompressed[sizeof(Data)];
+    Memory = CC_REFLECT_STREAM_MEMORY(CCArrayGetData(Array), CCArrayGetCount(Array));
+    Stream = CC_REFLECT_STREAM_READ_LZ(&Memory, (CCReflectStreamReader)CCReflectStreamMemoryRead, Buffer, 4096);
+    CCReflectStreamLZRead(&Stream, Decompressed, sizeof(Decompressed));
+    
+    XCTAssertEqual(Stream.failure.count, 0, @"should not fail");
+    XCTAssertTrue(!memcmp(Data, Decompressed, sizeof(Data)), @"should read the stored blocks");
+    
+    CCReflectStreamLZRead(&Stream, Decompressed, 1);
+    XCTAssertEqual(Stream.failure.count, 1, @"should fail to read past the last block");
+    
+    CCArrayDestroy(Array);
+    CCMemoryZoneDestroy(Zone);
+}
+
 @end
@@ -0,0 +1,290 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+#define CC_SIMD_MATH_ACCURACY 100
+#define CC_SIMD_COMPATIBILITY 1
+#import "Simd.h"
+
+@interface Simd128Tests : XCTestCase
+@end
+
+@implementation Simd128Tests
+
+-(void) testLoadStore
+{
+    uint8_t Result_u8[16];
+    CCSimd_u8x16 Vec_u8x16 = CCSimdLoad_u8x16((uint8_t[16]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 });
+    
+    CCSimdStore_u8x16(Result_u8, Vec_u8x16);
+    for (size_t Loop = 0; Loop < 16; Loop++) XCTAssertEqual(Result_u8[Loop], Loop, @"should contain the correct value");
+    
+    Vec_u8x16 = CCSimdSet_u8x16(Vec_u8x16, 15, 200);
+    XCTAssertEqual(CCSimdGet_u8x16(Vec_u8x16, 14), 14, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_u8x16(Vec_u8x16, 15), 200, @"should contain the correct value");
+    
+    CCSimd_s64x2 Vec_s64x2 = CCSimdFill_s64x2(-5);
+    Vec_s64x2 = CCSimdSet_s64x2(Vec_s64x2, 1, INT64_MAX);
+    XCTAssertEqual(CCSimdGet_s64x2(Vec_s64x2, 0), -5, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s64x2(Vec_s64x2, 1), INT64_MAX, @"should contain the correct value");
+    
+    XCTAssertTrue(signbit(CCSimdGet_f64x2(CCSimdFill_f64x2(-0.0), 0)), @"should preserve negative zero");
+    
+    CCSimd_f32x4x3 Poly_f32x4x3 = CCSimdInterleaveLoad_f32x4x3((float[12]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 });
+    XCTAssertEqual(CCSimdGet_f32x4(Poly_f32x4x3.v[0], 1), 3, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x4(Poly_f32x4x3.v[1], 2), 7, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x4(Poly_f32x4x3.v[2], 3), 11, @"should contain the correct value");
+    
+    float Result_f32[12];
+    CCSimdInterleaveStore_f32x4x3(Result_f32, Poly_f32x4x3);
+    for (size_t Loop = 0; Loop < 12; Loop++) XCTAssertEqual(Result_f32[Loop], Loop, @"should contain the correct value");
+}
+
+-(void) testBitwiseOperations
+{
+    int32_t Result_s32[4];
+    const CCSimd_s32x4 VecA_s32x4 = CCSimdLoad_s32x4((int32_t[4]){ 1, -8, 16, -1 });
+    
+    CCSimdStore_s32x4(Result_s32, CCSimdShiftLeft_s32x4(VecA_s32x4, CCSimdLoad_s32x4((int32_t[4]){ 4, -2, 32, -40 })));
+    XCTAssertEqual(Result_s32[0], 16, @"should contain the correct value");
+    XCTAssertEqual(Result_s32[1], -2, @"should contain the correct value");
+    XCTAssertEqual(Result_s32[2], 0, @"should contain the correct value");
+    XCTAssertEqual(Result_s32[3], -1, @"should contain the correct value");
+    
+    uint32_t Result_u32[4];
+    const CCSimd_u32x4 VecA_u32x4 = CCSimdLoad_u32x4((uint32_t[4]){ 0x80000000, 0xf0, 1, 0 });
+    
+    CCSimdStore_u32x4(Result_u32, CCSimdShiftRight_u32x4(VecA_u32x4, CCSimdLoad_u32x4((uint32_t[4]){ 31, 4, 32, 1 })));
+    XCTAssertEqual(Result_u32[0], 1, @"should contain the correct value");
+    XCTAssertEqual(Result_u32[1], 0xf, @"should contain the correct value");
+    XCTAssertEqual(Result_u32[2], 0, @"should contain the correct value");
+    XCTAssertEqual(Result_u32[3], 0, @"should contain the correct value");
+    
+    CCSimdStore_u32x4(Result_u32, CCSimdOrNot_u32x4(VecA_u32x4, CCSimdFill_u32x4(1)));
+    XCTAssertEqual(Result_u32[0], 0x7fffffff, @"should contain the correct value");
+    XCTAssertEqual(Result_u32[1], 0xffffff0f, @"should contain the correct value");
+    XCTAssertEqual(Result_u32[2], 0xffffffff, @"should contain the correct value");
+    XCTAssertEqual(Result_u32[3], 0xffffffff, @"should contain the correct value");
+    
+    uint64_t Result_u64[2];
+    CCSimdStore_u64x2(Result_u64, CCSimdCountHighestUnset_u64x2(CCSimdLoad_u64x2((uint64_t[2]){ 1, 0 })));
+    XCTAssertEqual(Result_u64[0], 63, @"should contain the correct value");
+    XCTAssertEqual(Result_u64[1], 64, @"should contain the correct value");
+}
+
+-(void) testComparisons
+{
+    uint64_t Result_u64[2];
+    const CCSimd_f64x2 VecA_f64x2 = CCSimdLoad_f64x2((double[2]){ 1.5, -2.0 });
+    const CCSimd_f64x2 VecB_f64x2 = CCSimdLoad_f64x2((double[2]){ 1.5, 3.0 });
+    
+    CCSimdStore_u64x2(Result_u64, CCSimdMaskCompareEqual_f64x2(VecA_f64x2, VecB_f64x2));
+    XCTAssertEqual(Result_u64[0], UINT64_MAX, @"should contain the correct value");
+    XCTAssertEqual(Result_u64[1], 0, @"should contain the correct value");
+    
+    CCSimdStore_u64x2(Result_u64, CCSimdMaskCompareLessThan_f64x2(VecA_f64x2, VecB_f64x2));
+    XCTAssertEqual(Result_u64[0], 0, @"should contain the correct value");
+    XCTAssertEqual(Result_u64[1], UINT64_MAX, @"should contain the correct value");
+    
+    CCSimdStore_u64x2(Result_u64, CCSimdMaskCompareNotEqual_f64x2(VecA_f64x2, VecB_f64x2));
+    XCTAssertEqual(Result_u64[0], 0, @"should contain the correct value");
+    XCTAssertEqual(Result_u64[1], UINT64_MAX, @"should contain the correct value");
+    
+    int8_t Result_s8[16];
+    CCSimdStore_s8x16(Result_s8, CCSimdMaskCompareGreaterThan_s8x16(CCSimdLoad_s8x16((int8_t[16]){ -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 127 }), CCSimdFill_s8x16(5)));
+    for (size_t Loop = 0; Loop < 16; Loop++) XCTAssertEqual(Result_s8[Loop], Loop > 6 ? -1 : 0, @"should contain the correct value");
+}
+
+-(void) testArithmetic
+{
+    int8_t Result_s8[16];
+    CCSimdStore_s8x16(Result_s8, CCSimdMin_s8x16(CCSimdLoad_s8x16((int8_t[16]){ -128, 127, 0, 1, -1, 2, -2, 3, -3, 4, -4, 5, -5, 6, -6, 7 }), CCSimdFill_s8x16(0)));
+    XCTAssertEqual(Result_s8[0], -128, @"should contain the correct value");
+    XCTAssertEqual(Result_s8[1], 0, @"should contain the correct value");
+    XCTAssertEqual(Result_s8[14], -6, @"should contain the correct value");
+    XCTAssertEqual(Result_s8[15], 0, @"should contain the correct value");
+    
+    uint16_t Result_u16[8];
+    CCSimdStore_u16x8(Result_u16, CCSimdMax_u16x8(CCSimdLoad_u16x8((uint16_t[8]){ 0, 1, 0x8000, 0xffff, 5, 6, 7, 8 }), CCSimdFill_u16x8(6)));
+    XCTAssertEqual(Result_u16[0], 6, @"should contain the correct value");
+    XCTAssertEqual(Result_u16[2], 0x8000, @"should contain the correct value");
+    XCTAssertEqual(Result_u16[3], 0xffff, @"should contain the correct value");
+    XCTAssertEqual(Result_u16[7], 8, @"should contain the correct value");
+    
+    int64_t Result_s64[2];
+    CCSimdStore_s64x2(Result_s64, CCSimdMax_s64x2(CCSimdLoad_s64x2((int64_t[2]){ INT64_MIN, 10 }), CCSimdFill_s64x2(-1)));
+    XCTAssertEqual(Result_s64[0], -1, @"should contain the correct value");
+    XCTAssertEqual(Result_s64[1], 10, @"should contain the correct value");
+    
+    CCSimdStore_s64x2(Result_s64, CCSimdAbs_s64x2(CCSimdLoad_s64x2((int64_t[2]){ -7, 7 })));
+    XCTAssertEqual(Result_s64[0], 7, @"should contain the correct value");
+    XCTAssertEqual(Result_s64[1], 7, @"should contain the correct value");
+    
+    double Result_f64[2];
+    const CCSimd_f64x2 VecA_f64x2 = CCSimdLoad_f64x2((double[2]){ 2.0, -3.0 });
+    const CCSimd_f64x2 VecB_f64x2 = CCSimdLoad_f64x2((double[2]){ 4.0, 0.5 });
+    const CCSimd_f64x2 VecC_f64x2 = CCSimdFill_f64x2(1.0);
+    
+    CCSimdStore_f64x2(Result_f64, CCSimdMadd_f64x2(VecA_f64x2, VecB_f64x2, VecC_f64x2));
+    XCTAssertEqual(Result_f64[0], 9.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], -0.5, @"should contain the correct value");
+    
+    CCSimdStore_f64x2(Result_f64, CCSimdNegMadd_f64x2(VecA_f64x2, VecB_f64x2, VecC_f64x2));
+    XCTAssertEqual(Result_f64[0], -7.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], 2.5, @"should contain the correct value");
+    
+    CCSimdStore_f64x2(Result_f64, CCSimdMsub_f64x2(VecA_f64x2, VecB_f64x2, VecC_f64x2));
+    XCTAssertEqual(Result_f64[0], 7.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], -2.5, @"should contain the correct value");
+    
+    CCSimdStore_f64x2(Result_f64, CCSimdNegMsub_f64x2(VecA_f64x2, VecB_f64x2, VecC_f64x2));
+    XCTAssertEqual(Result_f64[0], -9.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], 0.5, @"should contain the correct value");
+    
+    CCSimdStore_f64x2(Result_f64, CCSimdSqrt_f64x2(CCSimdLoad_f64x2((double[2]){ 16.0, 2.25 })));
+    XCTAssertEqual(Result_f64[0], 4.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], 1.5, @"should contain the correct value");
+    
+    XCTAssertEqual(CCSimdSum_u8x16(CCSimdLoad_u8x16((uint8_t[16]){ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 })), 136, @"should contain the correct value");
+    XCTAssertEqual(CCSimdSum_s16x8(CCSimdLoad_s16x8((int16_t[8]){ 1, -2, 3, -4, 5, -6, 7, -8 })), -4, @"should contain the correct value");
+    XCTAssertEqual(CCSimdSum_f32x4(CCSimdLoad_f32x4((float[4]){ 0.5f, 1.5f, 2.0f, 4.0f })), 8.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdSum_f64x2(VecA_f64x2), -1.0, @"should contain the correct value");
+}
+
+-(void) testRounding
+{
+    float Result_f32[4];
+    const CCSimd_f32x4 Vec_f32x4 = CCSimdLoad_f32x4((float[4]){ 2.5f, -2.5f, 3.5f, -0.3f });
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdRoundNearestEven_f32x4(Vec_f32x4));
+    XCTAssertEqual(Result_f32[0], 2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], -2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 4.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 0.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdRoundNearestAway_f32x4(Vec_f32x4));
+    XCTAssertEqual(Result_f32[0], 3.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], -3.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 4.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 0.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdRoundZero_f32x4(Vec_f32x4));
+    XCTAssertEqual(Result_f32[0], 2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], -2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 3.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 0.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdFloor_f32x4(Vec_f32x4));
+    XCTAssertEqual(Result_f32[0], 2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], -3.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 3.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], -1.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdCeil_f32x4(Vec_f32x4));
+    XCTAssertEqual(Result_f32[0], 3.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], -2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 4.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 0.0f, @"should contain the correct value");
+    
+    double Result_f64[2];
+    CCSimdStore_f64x2(Result_f64, CCSimdRoundNearestAway_f64x2(CCSimdLoad_f64x2((double[2]){ 4503599627370497.0, -0.49999999999999994 })));
+    XCTAssertEqual(Result_f64[0], 4503599627370497.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], 0.0, @"should contain the correct value");
+    XCTAssertTrue(signbit(Result_f64[1]), @"should preserve the sign of zero");
+    
+    const CCSimd_f32x4 Zero_f32x4 = CCSimdLoad_f32x4((float[4]){ -0.0f, -0.5f, -0.7f, 0.7f });
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdCeil_f32x4(Zero_f32x4));
+    XCTAssertTrue(signbit(Result_f32[0]) && (Result_f32[0] == 0.0f), @"should preserve the sign of zero");
+    XCTAssertTrue(signbit(Result_f32[1]) && (Result_f32[1] == 0.0f), @"should preserve the sign of zero");
+    XCTAssertTrue(signbit(Result_f32[2]) && (Result_f32[2] == 0.0f), @"should preserve the sign of zero");
+    XCTAssertEqual(Result_f32[3], 1.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdRoundNearestAway_f32x4(Zero_f32x4));
+    XCTAssertTrue(signbit(Result_f32[0]) && (Result_f32[0] == 0.0f), @"should preserve the sign of zero");
+    XCTAssertEqual(Result_f32[1], -1.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], -1.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 1.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdRoundNearestAway_f32x4(Vec_f32x4));
+    XCTAssertTrue(signbit(Result_f32[3]), @"should preserve the sign of zero");
+}
+
+-(void) testSwizzle
+{
+    int32_t Result_s32[4];
+    const CCSimd_s32x4 Vec_s32x4 = CCSimdLoad_s32x4((int32_t[4]){ 10, 11, 12, 13 });
+    
+    CCSimdStore_s32x4(Result_s32, CCSimdSwizzle_s32x4(Vec_s32x4, 3, 1, 1, 0));
+    XCTAssertEqual(Result_s32[0], 13, @"should contain the correct value");
+    XCTAssertEqual(Result_s32[1], 11, @"should contain the correct value");
+    XCTAssertEqual(Result_s32[2], 11, @"should contain the correct value");
+    XCTAssertEqual(Result_s32[3], 10, @"should contain the correct value");
+    
+    double Result_f64[2];
+    CCSimdStore_f64x2(Result_f64, CCSimdSwizzle_f64x2(CCSimdLoad_f64x2((double[2]){ 1.0, 2.0 }), 1, 0));
+    XCTAssertEqual(Result_f64[0], 2.0, @"should contain the correct value");
+    XCTAssertEqual(Result_f64[1], 1.0, @"should contain the correct value");
+    
+    uint16_t Result_u16[8];
+    CCSimdStore_u16x8(Result_u16, CCSimdSwizzle_u16x8(CCSimdLoad_u16x8((uint16_t[8]){ 0, 100, 200, 300, 400, 500, 600, 700 }), 7, 6, 5, 4, 0, 0, 1, 1));
+    XCTAssertEqual(Result_u16[0], 700, @"should contain the correct value");
+    XCTAssertEqual(Result_u16[3], 400, @"should contain the correct value");
+    XCTAssertEqual(Result_u16[5], 0, @"should contain the correct value");
+    XCTAssertEqual(Result_u16[7], 100, @"should contain the correct value");
+    
+    uint8_t Result_u8[16];
+    CCSimdStore_u8x16(Result_u8, CCSimdSwizzle_u8x16(CCSimdLoad_u8x16((uint8_t[16]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }), 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+    for (size_t Loop = 0; Loop < 16; Loop++) XCTAssertEqual(Result_u8[Loop], 15 - Loop, @"should contain the correct value");
+}
+
+-(void) testInterleaveMerge
+{
+    float Result_f32[4];
+    const CCSimd_f32x4 VecA_f32x4 = CCSimdLoad_f32x4((float[4]){ 0.0f, 1.0f, 2.0f, 3.0f });
+    const CCSimd_f32x4 VecB_f32x4 = CCSimdLoad_f32x4((float[4]){ 4.0f, 5.0f, 6.0f, 7.0f });
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdInterleave_f32x4(VecA_f32x4, VecB_f32x4, 0, 1, 1, 0));
+    XCTAssertEqual(Result_f32[0], 0.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], 5.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 6.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 3.0f, @"should contain the correct value");
+    
+    CCSimdStore_f32x4(Result_f32, CCSimdMerge_f32x4(VecA_f32x4, VecB_f32x4, 0x13, 2, 0x10, 1));
+    XCTAssertEqual(Result_f32[0], 7.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[1], 2.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[2], 4.0f, @"should contain the correct value");
+    XCTAssertEqual(Result_f32[3], 1.0f, @"should contain the correct value");
+    
+    int8_t Result_s8[16];
+    const CCSimd_s8x16 VecA_s8x16 = CCSimdLoad_s8x16((int8_t[16]){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 });
+    const CCSimd_s8x16 VecB_s8x16 = CCSimdNeg_s8x16(VecA_s8x16);
+    
+    CCSimdStore_s8x16(Result_s8, CCSimdMerge_s8x16(VecA_s8x16, VecB_s8x16, 0x1f, 0, 0x1e, 1, 0x1d, 2, 0x1c, 3, 0x1b, 4, 0x1a, 5, 0x19, 6, 0x18, 7));
+    for (size_t Loop = 0; Loop < 16; Loop++) XCTAssertEqual(Result_s8[Loop], Loop & 1 ? (int8_t)(Loop / 2) : -(int8_t)(15 - (Loop / 2)), @"should contain the correct value");
+}
+
+@end
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+
+#define CC_SIMD_MATH_ACCURACY 100
+#define CC_SIMD_COMPATIBILITY 1
+#import "Simd.h"
+#import "Simd256.h"
+
+@interface Simd256Tests : XCTestCase
+@end
+
+@implementation Simd256Tests
+
+#if CC_HARDWARE_VECTOR_SUPPORT_SSE2
+-(void) testLoadStore
+{
+    uint8_t Result_u8[32], Values_u8[32];
+    for (size_t Loop = 0; Loop < 32; Loop++) Values_u8[Loop] = Loop * 3;
+    
+    CCSimd_u8x32 Vec_u8x32 = CCSimdLoad_u8x32(Values_u8);
+    CCSimdStore_u8x32(Result_u8, Vec_u8x32);
+    for (size_t Loop = 0; Loop < 32; Loop++) XCTAssertEqual(Result_u8[Loop], Loop * 3, @"should contain the correct value");
+    
+    Vec_u8x32 = CCSimdSet_u8x32(Vec_u8x32, 31, 200);
+    XCTAssertEqual(CCSimdGet_u8x32(Vec_u8x32, 30), 90, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_u8x32(Vec_u8x32, 31), 200, @"should contain the correct value");
+    
+    XCTAssertTrue(signbit(CCSimdGet_f64x4(CCSimdFill_f64x4(-0.0), 3)), @"should preserve negative zero");
+}
+
+-(void) testArithmetic
+{
+    const CCSimd_f32x8 Vec_f32x8 = CCSimdLoad_f32x8((float[8]){ 1.5f, -2.5f, 3.25f, 4.0f, -5.5f, 6.0f, 7.75f, 8.0f });
+    
+    XCTAssertEqual(CCSimdGet_f32x8(CCSimdMadd_f32x8(Vec_f32x8, CCSimdFill_f32x8(2.0f), CCSimdFill_f32x8(1.0f)), 7), 17.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdSum_f32x8(Vec_f32x8), 22.5f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdSum_u8x32(CCSimdFill_u8x32(3)), 96, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f64x4(CCSimdSqrt_f64x4(CCSimdLoad_f64x4((double[4]){ 4.0, 9.0, 16.0, 25.0 })), 3), 5.0, @"should contain the correct value");
+    XCTAssertEqualWithAccuracy(CCSimdGet_f32x8(CCSimdInvSqrt_f32x8(CCSimdFill_f32x8(4.0f)), 0), 0.5f, 0.001f, @"should contain the correct value");
+    
+    const CCSimd_f32x8 Min_f32x8 = CCSimdMin_f32x8(Vec_f32x8, CCSimdZero_f32x8());
+    XCTAssertEqual(CCSimdGet_f32x8(Min_f32x8, 0), 0.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(Min_f32x8, 1), -2.5f, @"should contain the correct value");
+    
+    const CCSimd_u8x32 Max_u8x32 = CCSimdMax_u8x32(CCSimdLoad_u8x32((uint8_t[32]){ 0, [31] = 93 }), CCSimdFill_u8x32(50));
+    XCTAssertEqual(CCSimdGet_u8x32(Max_u8x32, 0), 50, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_u8x32(Max_u8x32, 31), 93, @"should contain the correct value");
+    
+    const CCSimd_s64x4 Min_s64x4 = CCSimdMin_s64x4(CCSimdLoad_s64x4((int64_t[4]){ -5, 10, -20, 40 }), CCSimdZero_s64x4());
+    XCTAssertEqual(CCSimdGet_s64x4(Min_s64x4, 0), -5, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s64x4(Min_s64x4, 1), 0, @"should contain the correct value");
+    
+    XCTAssertEqual(CCSimdGet_s16x16(CCSimdAbs_s16x16(CCSimdFill_s16x16(-15)), 15), 15, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(CCSimd_f32x8_Cast_s32x8(CCSimdFill_s32x8(8)), 7), 8.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(CCSimdSin_f32x8(CCSimdFill_f32x8(0.5f)), 5), CCSimdGet_f32x4(CCSimdSin_f32x4(CCSimdFill_f32x4(0.5f)), 0), @"should match the 128-bit result");
+}
+
+-(void) testRounding
+{
+    const CCSimd_f32x8 Vec_f32x8 = CCSimdLoad_f32x8((float[8]){ 1.5f, -2.5f, 3.25f, 4.0f, -5.5f, 6.0f, 7.75f, 8.0f });
+    
+    const CCSimd_f32x8 Floor_f32x8 = CCSimdFloor_f32x8(Vec_f32x8);
+    XCTAssertEqual(CCSimdGet_f32x8(Floor_f32x8, 1), -3.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(Floor_f32x8, 2), 3.0f, @"should contain the correct value");
+    
+    const CCSimd_f32x8 Even_f32x8 = CCSimdRoundNearestEven_f32x8(Vec_f32x8);
+    XCTAssertEqual(CCSimdGet_f32x8(Even_f32x8, 0), 2.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(Even_f32x8, 1), -2.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(Even_f32x8, 4), -6.0f, @"should contain the correct value");
+    
+    const CCSimd_f32x8 Away_f32x8 = CCSimdRoundNearestAway_f32x8(Vec_f32x8);
+    XCTAssertEqual(CCSimdGet_f32x8(Away_f32x8, 1), -3.0f, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_f32x8(Away_f32x8, 6), 8.0f, @"should contain the correct value");
+    
+    const CCSimd_f32x8 Zero_f32x8 = CCSimdLoad_f32x8((float[8]){ -0.0f, -0.3f, -0.7f, 0.3f, -0.0f, -0.3f, -0.7f, 0.3f });
+    
+    const CCSimd_f32x8 ZeroAway_f32x8 = CCSimdRoundNearestAway_f32x8(Zero_f32x8);
+    XCTAssertTrue(signbit(CCSimdGet_f32x8(ZeroAway_f32x8, 0)), @"should preserve the sign of zero");
+    XCTAssertTrue(signbit(CCSimdGet_f32x8(ZeroAway_f32x8, 5)), @"should preserve the sign of zero");
+    XCTAssertEqual(CCSimdGet_f32x8(ZeroAway_f32x8, 6), -1.0f, @"should contain the correct value");
+    
+    const CCSimd_f32x8 ZeroCeil_f32x8 = CCSimdCeil_f32x8(Zero_f32x8);
+    XCTAssertTrue(signbit(CCSimdGet_f32x8(ZeroCeil_f32x8, 2)), @"should preserve the sign of zero");
+    XCTAssertTrue(signbit(CCSimdGet_f32x8(ZeroCeil_f32x8, 6)), @"should preserve the sign of zero");
+    XCTAssertEqual(CCSimdGet_f32x8(ZeroCeil_f32x8, 7), 1.0f, @"should contain the correct value");
+}
+
+-(void) testSwizzle
+{
+    uint8_t Values_u8[32];
+    for (size_t Loop = 0; Loop < 32; Loop++) Values_u8[Loop] = Loop * 3;
+    
+    const CCSimd_u8x32 Vec_u8x32 = CCSimdLoad_u8x32(Values_u8);
+    const CCSimd_u8x32 Reversed_u8x32 = CCSimdSwizzle_u8x32(Vec_u8x32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    for (size_t Loop = 0; Loop < 32; Loop++) XCTAssertEqual(CCSimdGet_u8x32(Reversed_u8x32, Loop), (31 - Loop) * 3, @"should contain the correct value");
+    
+    const CCSimd_u8x32 Mixed_u8x32 = CCSimdSwizzle_u8x32(Vec_u8x32, 0, 17, 2, 19, 4, 21, 6, 23, 8, 25, 10, 27, 12, 29, 14, 31, 16, 1, 18, 3, 20, 5, 22, 7, 24, 9, 26, 11, 28, 13, 30, 15);
+    XCTAssertEqual(CCSimdGet_u8x32(Mixed_u8x32, 1), 51, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_u8x32(Mixed_u8x32, 16), 48, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_u8x32(Mixed_u8x32, 17), 3, @"should contain the correct value");
+    
+    const CCSimd_s16x16 Reversed_s16x16 = CCSimdSwizzle_s16x16(CCSimdLoad_s16x16((int16_t[16]){ 0, -1, 2, -3, 4, -5, 6, -7, 8, -9, 10, -11, 12, -13, 14, -15 }), 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    XCTAssertEqual(CCSimdGet_s16x16(Reversed_s16x16, 0), -15, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s16x16(Reversed_s16x16, 8), -7, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s16x16(Reversed_s16x16, 15), 0, @"should contain the correct value");
+    
+    const CCSimd_s64x4 Reversed_s64x4 = CCSimdSwizzle_s64x4(CCSimdLoad_s64x4((int64_t[4]){ -5, 10, -20, 40 }), 3, 2, 1, 0);
+    XCTAssertEqual(CCSimdGet_s64x4(Reversed_s64x4, 0), 40, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s64x4(Reversed_s64x4, 3), -5, @"should contain the correct value");
+}
+
+-(void) testInterleaveMerge
+{
+    const CCSimd_u8x32 Interleaved_u8x32 = CCSimdInterleave_u8x32(CCSimdFill_u8x32(90), CCSimdZero_u8x32(), 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1);
+    XCTAssertEqual(CCSimdGet_u8x32(Interleaved_u8x32, 30), 90, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_u8x32(Interleaved_u8x32, 31), 0, @"should contain the correct value");
+    
+    const CCSimd_s16x16 VecA_s16x16 = CCSimdLoad_s16x16((int16_t[16]){ 0, -1, 2, -3, 4, -5, 6, -7, 8, -9, 10, -11, 12, -13, 14, -15 });
+    const CCSimd_s16x16 VecB_s16x16 = CCSimdNeg_s16x16(VecA_s16x16);
+    const CCSimd_s16x16 Merged_s16x16 = CCSimdMerge_s16x16(VecA_s16x16, VecB_s16x16, CC_SIMD_A1, CC_SIMD_B1, CC_SIMD_A15, CC_SIMD_B15, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A1, CC_SIMD_A8);
+    XCTAssertEqual(CCSimdGet_s16x16(Merged_s16x16, 0), -1, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s16x16(Merged_s16x16, 1), 1, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s16x16(Merged_s16x16, 2), -15, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s16x16(Merged_s16x16, 3), 15, @"should contain the correct value");
+    XCTAssertEqual(CCSimdGet_s16x16(Merged_s16x16, 15), 8, @"should contain the correct value");
+}
+#endif
+
+@end
@@ -921,6 +921,21 @@
     CCStringDestroy(Sub);
     
     
+    String = CCStringCreate(CC_STD_ALLOCATOR, CCStringEncodingUTF8 | CCStringHintCopy, "😀abcxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxaxxcxxxxxxxxxxxxxxxxxxxxxxxxxabcd😀abcdxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx");
+    Sub = CCStringCreate(CC_STD_ALLOCATOR, CCStringEncodingUTF8 | CCStringHintCopy, "abcd");
+    XCTAssertTrue(CCStringFindSubstring(String, 0, Sub) == 70, @"Should find substring");
+    XCTAssertTrue(CCStringFindSubstring(String, 70, Sub) == 70, @"Should find substring");
+    XCTAssertTrue(CCStringFindSubstring(String, 71, Sub) == 75, @"Should find substring");
+    XCTAssertTrue(CCStringFindSubstring(String, 76, Sub) == SIZE_MAX, @"Should not find substring");
+    CCStringDestroy(Sub);
+    
+    Sub = CCStringCreate(CC_STD_ALLOCATOR, CCStringEncodingUTF8 | CCStringHintCopy, "d😀a");
+    XCTAssertTrue(CCStringFindSubstring(String, 0, Sub) == 73, @"Should find substring");
+    XCTAssertTrue(CCStringFindSubstring(String, 74, Sub) == SIZE_MAX, @"Should not find substring");
+    CCStringDestroy(String);
+    CCStringDestroy(Sub);
+    
+    
     XCTAssertTrue(CCStringFindSubstring(CC_STRING("a"), 0, CC_STRING("")) == SIZE_MAX, @"Should not find substring");
     XCTAssertTrue(CCStringFindSubstring(CC_STRING(""), 0, CC_STRING("a")) == SIZE_MAX, @"Should not find substring");
     XCTAssertTrue(CCStringFindSubstring(CC_STRING(""), 0, CC_STRING("")) == SIZE_MAX, @"Should not find substring");
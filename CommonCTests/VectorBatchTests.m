@@ -0,0 +1,269 @@
+/*
+ *  Copyright (c) 2025, Stefan Johnson
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification,
+ *  are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice, this list
+ *     of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright notice, this
+ *     list of conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#import <XCTest/XCTest.h>
+#import "VectorBatch.h"
+#import "Vector.h"
+#import "Matrix4.h"
+
+@interface VectorBatchTests : XCTestCase
+
+@end
+
+#define TEST_COUNT 37
+
+#define TEST_ACCURACY(x) (fabsf(x) * 1e-5f + 1e-6f)
+
+static float ax[TEST_COUNT], ay[TEST_COUNT], az[TEST_COUNT], aw[TEST_COUNT];
+static float bx[TEST_COUNT], by[TEST_COUNT], bz[TEST_COUNT], bw[TEST_COUNT];
+static float rx[TEST_COUNT], ry[TEST_COUNT], rz[TEST_COUNT], rw[TEST_COUNT];
+static float r[TEST_COUNT];
+
+@implementation VectorBatchTests
+
++(void) setUp
+{
+    [super setUp];
+    
+    for (size_t Loop = 0; Loop < TEST_COUNT; Loop++)
+    {
+        ax[Loop] = (float)Loop * 0.5f - 7.0f;
+        ay[Loop] = (float)(Loop % 5) + 1.25f;
+        az[Loop] = 3.0f - (float)(Loop % 7);
+        aw[Loop] = (float)(Loop % 3) + 0.5f;
+        bx[Loop] = (float)(Loop % 4) - 1.5f;
+        by[Loop] = (float)Loop * -0.25f;
+        bz[Loop] = (float)(Loop % 9) * 0.75f;
+        bw[Loop] = 2.0f - (float)(Loop % 6);
+    }
+}
+
+-(void) testVector2
+{
+    const CCVector2DBatch a = CCVector2DBatchMake(ax, ay), b = CCVector2DBatchMake(bx, by), Result = CCVector2DBatchMake(rx, ry);
+    
+    for (size_t Count = 0; Count <= TEST_COUNT; Count += 6)
+    {
+        CCVector2BatchDot(a, b, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector2Dot(CCVector2DMake(ax[Loop], ay[Loop]), CCVector2DMake(bx[Loop], by[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Dot should match the single vector function");
+        }
+        
+        CCVector2BatchLength(a, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector2Length(CCVector2DMake(ax[Loop], ay[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Length should match the single vector function");
+        }
+        
+        CCVector2BatchDistance(a, b, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector2Distance(CCVector2DMake(ax[Loop], ay[Loop]), CCVector2DMake(bx[Loop], by[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Distance should match the single vector function");
+        }
+        
+        CCVector2BatchNormalize(a, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector2D Expect = CCVector2Normalize(CCVector2DMake(ax[Loop], ay[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Normalize should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Normalize should match the single vector function");
+        }
+        
+        CCVector2BatchMin(a, b, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector2D Expect = CCVector2Min(CCVector2DMake(ax[Loop], ay[Loop]), CCVector2DMake(bx[Loop], by[Loop]));
+            XCTAssert((rx[Loop] == Expect.x) && (ry[Loop] == Expect.y), @"Min should match the single vector function");
+        }
+        
+        CCVector2BatchMax(a, b, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector2D Expect = CCVector2Max(CCVector2DMake(ax[Loop], ay[Loop]), CCVector2DMake(bx[Loop], by[Loop]));
+            XCTAssert((rx[Loop] == Expect.x) && (ry[Loop] == Expect.y), @"Max should match the single vector function");
+        }
+    }
+}
+
+-(void) testVector3
+{
+    const CCVector3DBatch a = CCVector3DBatchMake(ax, ay, az), b = CCVector3DBatchMake(bx, by, bz), Result = CCVector3DBatchMake(rx, ry, rz);
+    
+    for (size_t Count = 0; Count <= TEST_COUNT; Count += 6)
+    {
+        CCVector3BatchDot(a, b, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector3Dot(CCVector3DMake(ax[Loop], ay[Loop], az[Loop]), CCVector3DMake(bx[Loop], by[Loop], bz[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Dot should match the single vector function");
+        }
+        
+        CCVector3BatchLength(a, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector3Length(CCVector3DMake(ax[Loop], ay[Loop], az[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Length should match the single vector function");
+        }
+        
+        CCVector3BatchDistance(a, b, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector3Distance(CCVector3DMake(ax[Loop], ay[Loop], az[Loop]), CCVector3DMake(bx[Loop], by[Loop], bz[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Distance should match the single vector function");
+        }
+        
+        CCVector3BatchNormalize(a, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector3D Expect = CCVector3Normalize(CCVector3DMake(ax[Loop], ay[Loop], az[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Normalize should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Normalize should match the single vector function");
+            XCTAssertEqualWithAccuracy(rz[Loop], Expect.z, TEST_ACCURACY(Expect.z), @"Normalize should match the single vector function");
+        }
+        
+        CCVector3BatchMin(a, b, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector3D Expect = CCVector3Min(CCVector3DMake(ax[Loop], ay[Loop], az[Loop]), CCVector3DMake(bx[Loop], by[Loop], bz[Loop]));
+            XCTAssert((rx[Loop] == Expect.x) && (ry[Loop] == Expect.y) && (rz[Loop] == Expect.z), @"Min should match the single vector function");
+        }
+        
+        CCVector3BatchMax(a, b, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector3D Expect = CCVector3Max(CCVector3DMake(ax[Loop], ay[Loop], az[Loop]), CCVector3DMake(bx[Loop], by[Loop], bz[Loop]));
+            XCTAssert((rx[Loop] == Expect.x) && (ry[Loop] == Expect.y) && (rz[Loop] == Expect.z), @"Max should match the single vector function");
+        }
+    }
+}
+
+-(void) testVector4
+{
+    const CCVector4DBatch a = CCVector4DBatchMake(ax, ay, az, aw), b = CCVector4DBatchMake(bx, by, bz, bw), Result = CCVector4DBatchMake(rx, ry, rz, rw);
+    
+    for (size_t Count = 0; Count <= TEST_COUNT; Count += 6)
+    {
+        CCVector4BatchDot(a, b, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector4Dot(CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]), CCVector4DMake(bx[Loop], by[Loop], bz[Loop], bw[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Dot should match the single vector function");
+        }
+        
+        CCVector4BatchLength(a, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector4Length(CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Length should match the single vector function");
+        }
+        
+        CCVector4BatchDistance(a, b, r, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const float Expect = CCVector4Distance(CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]), CCVector4DMake(bx[Loop], by[Loop], bz[Loop], bw[Loop]));
+            XCTAssertEqualWithAccuracy(r[Loop], Expect, TEST_ACCURACY(Expect), @"Distance should match the single vector function");
+        }
+        
+        CCVector4BatchNormalize(a, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector4D Expect = CCVector4Normalize(CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Normalize should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Normalize should match the single vector function");
+            XCTAssertEqualWithAccuracy(rz[Loop], Expect.z, TEST_ACCURACY(Expect.z), @"Normalize should match the single vector function");
+            XCTAssertEqualWithAccuracy(rw[Loop], Expect.w, TEST_ACCURACY(Expect.w), @"Normalize should match the single vector function");
+        }
+        
+        CCVector4BatchMin(a, b, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector4D Expect = CCVector4Min(CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]), CCVector4DMake(bx[Loop], by[Loop], bz[Loop], bw[Loop]));
+            XCTAssert((rx[Loop] == Expect.x) && (ry[Loop] == Expect.y) && (rz[Loop] == Expect.z) && (rw[Loop] == Expect.w), @"Min should match the single vector function");
+        }
+        
+        CCVector4BatchMax(a, b, Result, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector4D Expect = CCVector4Max(CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]), CCVector4DMake(bx[Loop], by[Loop], bz[Loop], bw[Loop]));
+            XCTAssert((rx[Loop] == Expect.x) && (ry[Loop] == Expect.y) && (rz[Loop] == Expect.z) && (rw[Loop] == Expect.w), @"Max should match the single vector function");
+        }
+    }
+}
+
+-(void) testMatrix4
+{
+    CCMatrix4 m = CCMatrix4Perspective(CCMatrix4Identity, 1.2f, 1.5f, 0.1f, 100.0f);
+    m = CCMatrix4Translate(m, CCVector3DMake(1.0f, -2.0f, -10.0f));
+    m = CCMatrix4RotateY(m, 0.7f);
+    
+    const CCVector3DBatch v3 = CCVector3DBatchMake(ax, ay, az), Result3 = CCVector3DBatchMake(rx, ry, rz);
+    const CCVector4DBatch v4 = CCVector4DBatchMake(ax, ay, az, aw), Result4 = CCVector4DBatchMake(rx, ry, rz, rw);
+    
+    for (size_t Count = 0; Count <= TEST_COUNT; Count += 6)
+    {
+        CCMatrix4BatchMulPositionVector3D(m, v3, Result3, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector3D Expect = CCMatrix4MulPositionVector3D(m, CCVector3DMake(ax[Loop], ay[Loop], az[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Position should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Position should match the single vector function");
+            XCTAssertEqualWithAccuracy(rz[Loop], Expect.z, TEST_ACCURACY(Expect.z), @"Position should match the single vector function");
+        }
+        
+        CCMatrix4BatchMulDirectionVector3D(m, v3, Result3, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector3D Expect = CCMatrix4MulDirectionVector3D(m, CCVector3DMake(ax[Loop], ay[Loop], az[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Direction should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Direction should match the single vector function");
+            XCTAssertEqualWithAccuracy(rz[Loop], Expect.z, TEST_ACCURACY(Expect.z), @"Direction should match the single vector function");
+        }
+        
+        CCMatrix4BatchMulProjectVector3D(m, v3, Result3, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector3D Expect = CCMatrix4MulProjectVector3D(m, CCVector3DMake(ax[Loop], ay[Loop], az[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Project should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Project should match the single vector function");
+            XCTAssertEqualWithAccuracy(rz[Loop], Expect.z, TEST_ACCURACY(Expect.z), @"Project should match the single vector function");
+        }
+        
+        CCMatrix4BatchMulVector4D(m, v4, Result4, Count);
+        for (size_t Loop = 0; Loop < Count; Loop++)
+        {
+            const CCVector4D Expect = CCMatrix4MulVector4D(m, CCVector4DMake(ax[Loop], ay[Loop], az[Loop], aw[Loop]));
+            XCTAssertEqualWithAccuracy(rx[Loop], Expect.x, TEST_ACCURACY(Expect.x), @"Transform should match the single vector function");
+            XCTAssertEqualWithAccuracy(ry[Loop], Expect.y, TEST_ACCURACY(Expect.y), @"Transform should match the single vector function");
+            XCTAssertEqualWithAccuracy(rz[Loop], Expect.z, TEST_ACCURACY(Expect.z), @"Transform should match the single vector function");
+            XCTAssertEqualWithAccuracy(rw[Loop], Expect.w, TEST_ACCURACY(Expect.w), @"Transform should match the single vector function");
+        }
+    }
+}
+
+@end
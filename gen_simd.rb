@@ -1484,6 +1484,17 @@ all_float_types = types(['f'], type_sizes, width).map { |type| "CC_SIMD_#{width}
 
 all_integer_bit_types = types(integer_type_units, type_sizes, width).map { |args| "#define CC_SIMD_#{width}_INTEGER_#{base_size(args)}_TYPES CC_SIMD_#{width}_#{count(args)}_ELEMENT_INTEGER_TYPES" }.uniq.reverse
 
+x86_types_include = (width == 128 ? "" : "#include <CommonC/Simd128.h>\n") + "#include <CommonC/Simd#{width}Types_x86.h>"
+
+# NEON backends only exist for the widths that map to native registers, wider types are only provided on x86
+if width <= 128
+    types_include = "#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON\n#include <CommonC/Simd#{width}Types_arm.h>\n#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2\n#{x86_types_include}\n#endif"
+    backend_include = "#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON\n#include <CommonC/Simd#{width}_arm.h>\n#elif CC_HARDWARE_VECTOR_SUPPORT_SSE2\n#include <CommonC/Simd#{width}_x86.h>\n#endif"
+else
+    types_include = "#if CC_HARDWARE_VECTOR_SUPPORT_SSE2\n#{x86_types_include}\n#endif"
+    backend_include = "#if CC_HARDWARE_VECTOR_SUPPORT_SSE2\n#include <CommonC/Simd#{width}_x86.h>\n#endif"
+end
+
 puts """
 #ifndef CommonC_Simd#{width}_h
 #define CommonC_Simd#{width}_h
@@ -1494,9 +1505,7 @@ puts """
 #include <CommonC/Maths.h>
 #include <CommonC/BitTricks.h>
 
-#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
-#include <CommonC/Simd#{width}Types_arm.h>
-#endif
+#{types_include}
 
 
 #{poly_type_defs}
@@ -1998,9 +2007,7 @@ puts """
 #define CC_SIMD_WIDTH #{width}
 #include <CommonC/SimdFallbackDefaults.h>
 
-#if CC_HARDWARE_VECTOR_SUPPORT_ARM_NEON
-#include <CommonC/Simd#{width}_arm.h>
-#endif
+#{backend_include}
 
 #pragma mark - Fallback Implementations
 